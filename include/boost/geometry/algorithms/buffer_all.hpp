@@ -0,0 +1,220 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_BUFFER_ALL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_BUFFER_ALL_HPP
+
+
+#include <cstddef>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/buffer.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
+#include <boost/geometry/strategies/intersection.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Buffers all geometries of a range, with the same strategies
+\ingroup buffer
+\details The buffer of the i-th input is assigned to the i-th output.
+    The outputs are resized to the size of the inputs.
+    The work is distributed over thread_count threads (0 means as many as
+    the hardware supports, 1 means sequentially). Every input is buffered
+    with its own piece collection, on the thread processing it, so the
+    threads do not share any state. If one of the buffers throws, the first
+    exception is rethrown, after all threads are finished.
+\tparam InputRange Range of geometries
+\tparam OutputRange Range (supporting resize) of multi polygons
+\param inputs The geometries to buffer
+\param outputs The buffered geometries
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param thread_count The number of threads to be used
+ */
+template
+<
+    typename InputRange,
+    typename OutputRange,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer_all(InputRange const& inputs,
+                OutputRange& outputs,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t thread_count = 1)
+{
+    std::size_t const count = boost::size(inputs);
+    outputs.resize(count);
+
+    detail::parallel::for_each_index(count, thread_count,
+        [&](std::size_t i)
+        {
+            geometry::buffer(range::at(inputs, i), range::at(outputs, i),
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy);
+        });
+}
+
+
+/*!
+\brief Buffers all geometries of a range and dissolves the buffers
+    into one multi polygon
+\ingroup buffer
+\details The pieces of the buffers of all inputs are added to one piece
+    collection, as the buffer of a multi geometry does, and dissolved in
+    its traversal. There is no union of the separate buffers. The turns
+    between the pieces are classified in parallel by thread_count threads
+    (0 means as many as the hardware supports, 1 means sequentially).
+\note Areal inputs should not overlap each other, as the polygons of
+    a valid multi polygon.
+\tparam InputRange Range of geometries
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\param inputs The geometries to buffer
+\param geometry_out The dissolved buffer of all inputs
+\param distance_strategy The distance strategy to be used
+\param side_strategy The side strategy to be used
+\param join_strategy The join strategy to be used
+\param end_strategy The end strategy to be used
+\param point_strategy The point strategy to be used
+\param thread_count The number of threads to be used
+ */
+template
+<
+    typename InputRange,
+    typename MultiPolygon,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy
+>
+inline void buffer_dissolved(InputRange const& inputs,
+                MultiPolygon& geometry_out,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                EndStrategy const& end_strategy,
+                PointStrategy const& point_strategy,
+                std::size_t thread_count = 1)
+{
+    typedef typename boost::range_value<InputRange>::type input_type;
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename point_type<input_type>::type point_type;
+    typedef typename cs_tag<point_type>::type cs_tag_type;
+    typedef typename rescale_policy_type
+        <
+            point_type,
+            cs_tag_type
+        >::type rescale_policy_type;
+    typedef typename strategy::intersection::services::default_strategy
+        <
+            cs_tag_type
+        >::type intersection_strategy_type;
+    typedef detail::buffer::buffered_piece_collection
+        <
+            typename geometry::ring_type<polygon_type>::type,
+            intersection_strategy_type,
+            DistanceStrategy,
+            rescale_policy_type
+        > collection_type;
+
+    range::clear(geometry_out);
+
+    // The envelope of all inputs, as in buffer
+    model::box<point_type> box;
+    bool empty = true;
+    for (input_type const& input : inputs)
+    {
+        if (! geometry::is_empty(input))
+        {
+            model::box<point_type> input_box;
+            geometry::envelope(input, input_box);
+            if (empty)
+            {
+                box = input_box;
+            }
+            else
+            {
+                geometry::expand(box, input_box);
+            }
+            empty = false;
+        }
+    }
+    if (empty)
+    {
+        return;
+    }
+    geometry::buffer(box, box, distance_strategy.max_distance(join_strategy, end_strategy));
+
+    intersection_strategy_type intersection_strategy;
+    rescale_policy_type rescale_policy
+            = boost::geometry::get_rescale_policy<rescale_policy_type>(
+                box, intersection_strategy);
+
+    collection_type collection(intersection_strategy, distance_strategy,
+                               rescale_policy, thread_count);
+    collection.set_buffer_side_strategy(side_strategy);
+
+    for (input_type const& input : inputs)
+    {
+        if (geometry::is_empty(input))
+        {
+            continue;
+        }
+        dispatch::buffer_inserter
+            <
+                typename tag_cast
+                    <
+                        typename tag<input_type>::type,
+                        multi_tag
+                    >::type,
+                input_type,
+                polygon_type
+            >::apply(input, collection,
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy,
+                rescale_policy, intersection_strategy.get_side_strategy());
+    }
+
+    detail::buffer::visit_pieces_default_policy visitor;
+    detail::buffer::traverse_collection<polygon_type>(collection,
+        range::back_inserter(geometry_out), distance_strategy,
+        util::is_areal<input_type>::value, visitor);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_BUFFER_ALL_HPP
@@ -161,7 +161,9 @@ struct buffer_range
                         std::vector<output_point_type> range_out;
                         if (join_strategy.apply(intersection_point,
                                     previous_input, prev_perp2, perp1,
-                                    distance.apply(previous_input, input, side),
+                                    geometry::detail::buffer::distance_at_vertex(
+                                        distance, previous_input, input,
+                                        previous_input, side),
                                     range_out))
                         {
                             collection.add_piece(geometry::strategy::buffer::buffered_join,
@@ -911,58 +913,24 @@ struct buffer_inserter<multi_tag, Multi, PolygonOutput>
 namespace detail { namespace buffer
 {
 
+// Calculates the turns of the pieces added to the collection, traverses
+// them, dissolving the pieces, and assigns the resulting rings to out
 template
 <
     typename GeometryOutput,
-    typename GeometryInput,
+    typename Collection,
     typename OutputIterator,
     typename DistanceStrategy,
-    typename SideStrategy,
-    typename JoinStrategy,
-    typename EndStrategy,
-    typename PointStrategy,
-    typename IntersectionStrategy,
-    typename RobustPolicy,
     typename VisitPiecesPolicy
 >
-inline void buffer_inserter(GeometryInput const& geometry_input, OutputIterator out,
+inline void traverse_collection(Collection& collection, OutputIterator out,
         DistanceStrategy const& distance_strategy,
-        SideStrategy const& side_strategy,
-        JoinStrategy const& join_strategy,
-        EndStrategy const& end_strategy,
-        PointStrategy const& point_strategy,
-        IntersectionStrategy const& intersection_strategy,
-        RobustPolicy const& robust_policy,
-        VisitPiecesPolicy& visit_pieces_policy
-    )
+        bool areal,
+        VisitPiecesPolicy& visit_pieces_policy)
 {
     boost::ignore_unused(visit_pieces_policy);
 
-    typedef detail::buffer::buffered_piece_collection
-    <
-        typename geometry::ring_type<GeometryOutput>::type,
-        IntersectionStrategy,
-        DistanceStrategy,
-        RobustPolicy
-    > collection_type;
-    collection_type collection(intersection_strategy, distance_strategy, robust_policy);
-    collection_type const& const_collection = collection;
-
-    bool const areal = util::is_areal<GeometryInput>::value;
-
-    dispatch::buffer_inserter
-        <
-            typename tag_cast
-                <
-                    typename tag<GeometryInput>::type,
-                    multi_tag
-                >::type,
-            GeometryInput,
-            GeometryOutput
-        >::apply(geometry_input, collection,
-            distance_strategy, side_strategy, join_strategy,
-            end_strategy, point_strategy,
-            robust_policy, intersection_strategy.get_side_strategy());
+    Collection const& const_collection = collection;
 
     collection.get_turns();
     if (BOOST_GEOMETRY_CONDITION(areal))
@@ -1019,6 +987,63 @@ inline void buffer_inserter(GeometryInput const& geometry_input, OutputIterator
     visit_pieces_policy.apply(const_collection, 2);
 }
 
+template
+<
+    typename GeometryOutput,
+    typename GeometryInput,
+    typename OutputIterator,
+    typename DistanceStrategy,
+    typename SideStrategy,
+    typename JoinStrategy,
+    typename EndStrategy,
+    typename PointStrategy,
+    typename IntersectionStrategy,
+    typename RobustPolicy,
+    typename VisitPiecesPolicy
+>
+inline void buffer_inserter(GeometryInput const& geometry_input, OutputIterator out,
+        DistanceStrategy const& distance_strategy,
+        SideStrategy const& side_strategy,
+        JoinStrategy const& join_strategy,
+        EndStrategy const& end_strategy,
+        PointStrategy const& point_strategy,
+        IntersectionStrategy const& intersection_strategy,
+        RobustPolicy const& robust_policy,
+        VisitPiecesPolicy& visit_pieces_policy,
+        std::size_t thread_count = BOOST_GEOMETRY_BUFFER_THREAD_COUNT
+    )
+{
+    typedef detail::buffer::buffered_piece_collection
+    <
+        typename geometry::ring_type<GeometryOutput>::type,
+        IntersectionStrategy,
+        DistanceStrategy,
+        RobustPolicy
+    > collection_type;
+    collection_type collection(intersection_strategy, distance_strategy,
+                               robust_policy, thread_count);
+    collection.set_buffer_side_strategy(side_strategy);
+
+    bool const areal = util::is_areal<GeometryInput>::value;
+
+    dispatch::buffer_inserter
+        <
+            typename tag_cast
+                <
+                    typename tag<GeometryInput>::type,
+                    multi_tag
+                >::type,
+            GeometryInput,
+            GeometryOutput
+        >::apply(geometry_input, collection,
+            distance_strategy, side_strategy, join_strategy,
+            end_strategy, point_strategy,
+            robust_policy, intersection_strategy.get_side_strategy());
+
+    traverse_collection<GeometryOutput>(collection, out, distance_strategy,
+                                        areal, visit_pieces_policy);
+}
+
 template
 <
     typename GeometryOutput,
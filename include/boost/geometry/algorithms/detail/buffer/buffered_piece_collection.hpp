@@ -22,6 +22,8 @@
 #include <boost/range/begin.hpp>
 #include <boost/range/empty.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/iterator_range.hpp>
 #include <boost/range/size.hpp>
 #include <boost/range/value_type.hpp>
 
@@ -54,6 +56,7 @@
 #include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
 #include <boost/geometry/algorithms/detail/partition.hpp>
 #include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
@@ -62,6 +65,13 @@
 #include <boost/geometry/util/range.hpp>
 
 
+// The number of threads classifying the turns of a buffer (turn in piece,
+// turn in original). 0 means as many as the hardware supports.
+#ifndef BOOST_GEOMETRY_BUFFER_THREAD_COUNT
+#define BOOST_GEOMETRY_BUFFER_THREAD_COUNT 1
+#endif
+
+
 namespace boost { namespace geometry
 {
 
@@ -303,11 +313,18 @@ struct buffered_piece_collection
     expand_strategy_type m_expand_strategy;
     point_in_geometry_strategy_type m_point_in_geometry_strategy;
 
+    // Measures the side of turns with respect to the piece borders, for
+    // geographic input with the spheroid of the buffer side strategy
+    typename piece_border_type::distance_measure_type m_distance_measure;
+
     RobustPolicy const& m_robust_policy;
 
+    std::size_t m_thread_count;
+
     buffered_piece_collection(IntersectionStrategy const& intersection_strategy,
                               DistanceStrategy const& distance_strategy,
-                              RobustPolicy const& robust_policy)
+                              RobustPolicy const& robust_policy,
+                              std::size_t thread_count = BOOST_GEOMETRY_BUFFER_THREAD_COUNT)
         : m_first_piece_index(-1)
         , m_deflate(false)
         , m_has_deflated(false)
@@ -321,8 +338,16 @@ struct buffered_piece_collection
         , m_point_in_geometry_strategy(intersection_strategy
             .template get_point_in_geometry_strategy<point_type, clockwise_ring_type>())
         , m_robust_policy(robust_policy)
+        , m_thread_count(thread_count)
     {}
 
+    template <typename BufferSideStrategy>
+    inline void set_buffer_side_strategy(BufferSideStrategy const& side_strategy)
+    {
+        m_distance_measure = typename piece_border_type::distance_measure_type
+            (side_strategy);
+    }
+
     inline bool is_following(buffer_turn_info_type const& turn,
                              buffer_turn_operation_type const& op)
     {
@@ -465,6 +490,65 @@ struct buffered_piece_collection
         }
     }
 
+    // Visits the turns and the items (pieces or original rings) having
+    // overlapping boxes, using partition. The classification of a turn does
+    // not depend on other turns, and visitors only change the turn they
+    // visit. So with more threads, the turns are divided into blocks which
+    // are partitioned against all items separately, in parallel.
+    template
+    <
+        typename IncludePolicy1,
+        typename IncludePolicy2,
+        typename Items,
+        typename Visitor,
+        typename ExpandPolicy1,
+        typename OverlapsPolicy1,
+        typename ExpandPolicy2,
+        typename OverlapsPolicy2
+    >
+    inline void visit_turns(Items const& items, Visitor const& visitor,
+                            ExpandPolicy1 const& expand_policy1,
+                            OverlapsPolicy1 const& overlaps_policy1,
+                            ExpandPolicy2 const& expand_policy2,
+                            OverlapsPolicy2 const& overlaps_policy2)
+    {
+        typedef geometry::partition
+            <
+                box_type, IncludePolicy1, IncludePolicy2
+            > partition_type;
+
+        // Blocks should be large enough to compensate for partitioning
+        // all items for each block
+        std::size_t const min_block_size = 256;
+        std::size_t const count = boost::size(m_turns);
+        std::size_t const threads = detail::parallel::thread_count(
+            m_thread_count, count / min_block_size);
+
+        if (threads <= 1)
+        {
+            Visitor mutable_visitor = visitor;
+            partition_type::apply(m_turns, items, mutable_visitor,
+                expand_policy1, overlaps_policy1,
+                expand_policy2, overlaps_policy2);
+            return;
+        }
+
+        typedef typename boost::range_iterator<turn_vector_type const>::type iterator_type;
+        std::size_t const block_size = (std::max)(min_block_size,
+            (count + threads * 4 - 1) / (threads * 4));
+        detail::parallel::for_each_block(count, threads, block_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                turn_vector_type const& turns = m_turns;
+                boost::iterator_range<iterator_type> const block(
+                    boost::begin(turns) + first, boost::begin(turns) + last);
+                Visitor mutable_visitor = visitor;
+                partition_type::apply(block, items, mutable_visitor,
+                    expand_policy1, overlaps_policy1,
+                    expand_policy2, overlaps_policy2);
+            });
+    }
+
     // Check if a turn is inside any of the originals
     inline void check_turn_in_original()
     {
@@ -483,14 +567,13 @@ struct buffered_piece_collection
                 point_in_geometry_strategy_type
             > visitor(m_turns, m_point_in_geometry_strategy);
 
-        geometry::partition
+        visit_turns
             <
-                box_type,
                 include_turn_policy,
                 detail::partition::include_all_policy
-            >::apply(m_turns, original_rings, visitor,
-                     turn_get_box(), turn_in_original_overlaps_box_type(),
-                     original_get_box(), original_overlaps_box_type());
+            >(original_rings, visitor,
+              turn_get_box(), turn_in_original_overlaps_box_type(),
+              original_get_box(), original_overlaps_box_type());
 
         bool const deflate = m_distance_strategy.negative();
 
@@ -551,6 +634,8 @@ struct buffered_piece_collection
             piece_border_type& border = pc.m_piece_border;
             buffered_ring<Ring> const& ring = offsetted_rings[pc.first_seg_id.multi_index];
 
+            border.set_distance_measure(m_distance_measure);
+
             if (pc.offsetted_count > 0)
             {
                 if (pc.type != strategy::buffer::buffered_concave)
@@ -623,12 +708,13 @@ struct buffered_piece_collection
                     typename IntersectionStrategy::disjoint_box_box_strategy_type
                 > piece_overlaps_box_type;
 
-            geometry::partition
+            visit_turns
                 <
-                    box_type
-                >::apply(m_turns, m_pieces, visitor,
-                         turn_get_box(), turn_overlaps_box_type(),
-                         piece_get_box(), piece_overlaps_box_type());
+                    detail::partition::include_all_policy,
+                    detail::partition::include_all_policy
+                >(m_pieces, visitor,
+                  turn_get_box(), turn_overlaps_box_type(),
+                  piece_get_box(), piece_overlaps_box_type());
         }
     }
 
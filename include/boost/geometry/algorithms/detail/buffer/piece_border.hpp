@@ -19,6 +19,7 @@
 
 #include <boost/geometry/core/assert.hpp>
 #include <boost/geometry/core/config.hpp>
+#include <boost/geometry/core/cs.hpp>
 
 #include <boost/geometry/algorithms/assign.hpp>
 #include <boost/geometry/algorithms/comparable_distance.hpp>
@@ -27,8 +28,16 @@
 #include <boost/geometry/algorithms/detail/buffer/buffer_box.hpp>
 #include <boost/geometry/algorithms/detail/buffer/buffer_policies.hpp>
 #include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_distance_measure.hpp>
+#include <boost/geometry/arithmetic/arithmetic.hpp>
+#include <boost/geometry/arithmetic/cross_product.hpp>
+#include <boost/geometry/arithmetic/dot_product.hpp>
+#include <boost/geometry/formulas/mean_radius.hpp>
+#include <boost/geometry/formulas/spherical.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
 #include <boost/geometry/strategies/cartesian/turn_in_ring_winding.hpp>
 #include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
 #include <boost/geometry/geometries/segment.hpp>
 
 
@@ -87,6 +96,87 @@ inline bool get_range_around(It begin, It end, T const& value, Compare const& co
 namespace detail { namespace buffer
 {
 
+// Measures the side (and an indication of the distance) of p2 with respect
+// to p0-p1, as get_distance_measure does for cartesian coordinates
+template <typename CalculationType, typename CsTag>
+struct piece_distance_measure
+{
+    piece_distance_measure()
+    {}
+
+    template <typename SideStrategy>
+    explicit piece_distance_measure(SideStrategy const& )
+    {}
+
+    template <typename Point>
+    inline distance_measure<CalculationType>
+        apply(Point const& p0, Point const& p1, Point const& p2) const
+    {
+        return detail_dispatch::get_distance_measure
+            <
+                CalculationType, CsTag
+            >::apply(p0, p1, p2);
+    }
+};
+
+// For geographic coordinates it is the determinant of the unit vectors,
+// which is twice the signed area of the (small) triangle on the unit sphere.
+// It is scaled to square meters with the mean radius of the spheroid of the
+// buffer side strategy, such that the thresholds used in turn_in_piece_visitor have
+// the same meaning as for projected input.
+template <typename CalculationType>
+struct piece_distance_measure<CalculationType, geographic_tag>
+{
+    piece_distance_measure()
+        : m_mean_radius(formula::mean_radius<CalculationType>(
+                            srs::spheroid<CalculationType>()))
+    {}
+
+    template <typename SideStrategy>
+    explicit piece_distance_measure(SideStrategy const& strategy)
+        : m_mean_radius(mean_radius(strategy, 0))
+    {}
+
+    template <typename Point>
+    inline distance_measure<CalculationType>
+        apply(Point const& p0, Point const& p1, Point const& p2) const
+    {
+        typedef model::point<CalculationType, 3, cs::cartesian> point3d_type;
+
+        point3d_type const v0 = formula::sph_to_cart3d<point3d_type>(p0);
+        point3d_type v1 = formula::sph_to_cart3d<point3d_type>(p1);
+        point3d_type v2 = formula::sph_to_cart3d<point3d_type>(p2);
+
+        // Subtract p0 to avoid cancellation for points close to each other
+        subtract_point(v1, v0);
+        subtract_point(v2, v0);
+
+        distance_measure<CalculationType> result;
+        result.measure = geometry::dot_product(geometry::cross_product(v1, v2), v0)
+                       * m_mean_radius * m_mean_radius;
+        return result;
+    }
+
+private :
+    // Buffer side strategies with a model (geographic_side_straight) provide
+    // the spheroid, others (used for points) use the default spheroid
+    template <typename SideStrategy>
+    static inline CalculationType mean_radius(SideStrategy const& strategy, int,
+            typename SideStrategy::model_type const* = NULL)
+    {
+        return formula::mean_radius<CalculationType>(strategy.model());
+    }
+
+    template <typename SideStrategy>
+    static inline CalculationType mean_radius(SideStrategy const& , long)
+    {
+        return formula::mean_radius<CalculationType>(
+                    srs::spheroid<CalculationType>());
+    }
+
+    CalculationType m_mean_radius;
+};
+
 //! Contains the border of the piece, consisting of 4 parts:
 //! 1: the part of the offsetted ring (referenced, not copied)
 //! 2: the part of the original (one or two points)
@@ -104,6 +194,11 @@ struct piece_border
     typedef typename geometry::coordinate_type<Point>::type coordinate_type;
     typedef typename default_comparable_distance_result<Point>::type radius_type;
     typedef typename geometry::strategy::buffer::turn_in_ring_winding<coordinate_type>::state_type state_type;
+    typedef piece_distance_measure
+        <
+            coordinate_type,
+            typename geometry::cs_tag<Point>::type
+        > distance_measure_type;
 
     bool m_reversed;
 
@@ -132,6 +227,8 @@ struct piece_border
     radius_type m_min_comparable_radius;
     radius_type m_max_comparable_radius;
 
+    distance_measure_type m_distance_measure;
+
     piece_border()
         : m_reversed(false)
         , m_ring(NULL)
@@ -182,6 +279,11 @@ struct piece_border
         }
     }
 
+    void set_distance_measure(distance_measure_type const& distance_measure)
+    {
+        m_distance_measure = distance_measure;
+    }
+
     template <typename SideStrategy>
     void get_properties_of_offsetted_ring_part(SideStrategy const& strategy)
     {
@@ -343,9 +445,8 @@ private :
         // Therefore, if the state count > 0, it means the point is left of it,
         // and because it is convex, we can stop
 
-        typedef typename geometry::coordinate_type<Point>::type coordinate_type;
         typedef geometry::detail::distance_measure<coordinate_type> dm_type;
-        dm_type const dm = geometry::detail::get_distance_measure(point, p1, p2);
+        dm_type const dm = m_distance_measure.apply(point, p1, p2);
         if (m_is_convex && dm.measure > 0)
         {
             // The point is left of this segment of a convex piece
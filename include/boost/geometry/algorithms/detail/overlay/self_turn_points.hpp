@@ -17,6 +17,7 @@
 
 
 #include <cstddef>
+#include <type_traits>
 
 
 #include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
@@ -24,6 +25,7 @@
 #include <boost/geometry/algorithms/detail/overlay/do_reverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
 #include <boost/geometry/algorithms/detail/sections/section_box_policies.hpp>
+#include <boost/geometry/algorithms/detail/sections/section_sweep.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/coordinate_dimension.hpp>
@@ -124,6 +126,23 @@ struct self_section_visitor
 
 
 
+// A strategy can select the sweep line instead of partition to find the
+// pairs of sections to intersect, by defining self_turns_by_sweep as true
+template <typename Strategy, typename Enable = void>
+struct use_sweep
+    : std::false_type
+{};
+
+template <typename Strategy>
+struct use_sweep
+    <
+        Strategy,
+        std::enable_if_t<Strategy::self_turns_by_sweep>
+    >
+    : std::true_type
+{};
+
+
 template <bool Reverse, typename TurnPolicy>
 struct get_turns
 {
@@ -151,10 +170,18 @@ struct get_turns
 
         typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
 
+        static bool const by_sweep = use_sweep<IntersectionStrategy>::value;
+
+        // The sweep line is output-sensitive on the level of the section
+        // boxes, so it uses sections of one segment each
+        std::size_t const max_count = by_sweep
+            ? 1 : BOOST_GEOMETRY_SECTIONALIZE_MAX_COUNT;
+
         sections_type sec;
         geometry::sectionalize<Reverse, dimensions>(geometry, robust_policy, sec,
                                                     intersection_strategy.get_envelope_strategy(),
-                                                    intersection_strategy.get_expand_strategy());
+                                                    intersection_strategy.get_expand_strategy(),
+                                                    0, max_count);
 
         self_section_visitor
             <
@@ -172,12 +199,19 @@ struct get_turns
             > overlaps_section_box_type;
 
         // false if interrupted
-        geometry::partition
-            <
-                box_type
-            >::apply(sec, visitor,
-                     get_section_box_type(),
-                     overlaps_section_box_type());
+        if (BOOST_GEOMETRY_CONDITION(by_sweep))
+        {
+            detail::section::sweep_sections(sec, visitor);
+        }
+        else
+        {
+            geometry::partition
+                <
+                    box_type
+                >::apply(sec, visitor,
+                         get_section_box_type(),
+                         overlaps_section_box_type());
+        }
 
         return ! interrupt_policy.has_intersections;
     }
@@ -0,0 +1,212 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_FOR_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_FOR_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+
+#include <boost/config.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#if ! defined(BOOST_NO_CXX11_HDR_THREAD) && ! defined(BOOST_NO_CXX11_HDR_ATOMIC) \
+ && ! defined(BOOST_GEOMETRY_NO_THREADS)
+#define BOOST_GEOMETRY_HAS_THREADS
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+#endif
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace parallel
+{
+
+/*!
+\brief Returns the number of threads to be used for a job of count items.
+\details A requested count of 0 means: as many as the hardware supports.
+    Without thread support (or with BOOST_GEOMETRY_NO_THREADS defined)
+    it always returns 1.
+*/
+inline std::size_t thread_count(std::size_t requested, std::size_t count)
+{
+#ifdef BOOST_GEOMETRY_HAS_THREADS
+    std::size_t result = requested;
+    if (result == 0)
+    {
+        result = std::thread::hardware_concurrency();
+    }
+    return (std::max)(std::size_t(1), (std::min)(result, count));
+#else
+    boost::ignore_unused(requested, count);
+    return 1;
+#endif
+}
+
+
+/*!
+\brief Calls f(first, last) for consecutive blocks of at most grain indices
+    in [0, count), distributing the blocks dynamically over threads.
+\details The calling thread takes part in the work. The first exception
+    thrown by f is rethrown in the calling thread, after all threads have
+    finished. Blocks are processed in unspecified order, so f should only
+    write to the output belonging to its own indices. The blocks are the
+    same without threads, they are then processed in increasing order.
+*/
+template <typename Function>
+inline void for_each_block(std::size_t count, std::size_t requested_threads,
+                           std::size_t grain, Function const& f)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    grain = (std::max)(std::size_t(1), grain);
+    std::size_t const block_count = (count + grain - 1) / grain;
+    std::size_t const threads = thread_count(requested_threads, block_count);
+
+    if (threads <= 1)
+    {
+        // The same blocks, callers can size buffers by grain
+        for (std::size_t first = 0; first < count; first += grain)
+        {
+            f(first, (std::min)(first + grain, count));
+        }
+        return;
+    }
+
+#ifdef BOOST_GEOMETRY_HAS_THREADS
+    std::atomic<std::size_t> next_block(0);
+    std::vector<std::exception_ptr> errors(threads);
+
+    auto worker = [&](std::size_t thread_index)
+    {
+        try
+        {
+            for (std::size_t block = next_block++; block < block_count;
+                 block = next_block++)
+            {
+                std::size_t const first = block * grain;
+                f(first, (std::min)(first + grain, count));
+            }
+        }
+        catch (...)
+        {
+            errors[thread_index] = std::current_exception();
+            // Let the other threads finish early
+            next_block = block_count;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; i++)
+    {
+        pool.emplace_back(worker, i);
+    }
+    worker(0);
+
+    for (std::thread& t : pool)
+    {
+        t.join();
+    }
+
+    for (std::exception_ptr const& e : errors)
+    {
+        if (e)
+        {
+            std::rethrow_exception(e);
+        }
+    }
+#endif
+}
+
+
+/*!
+\brief Calls f(index) for all indices in [0, count), in parallel if possible.
+*/
+template <typename Function>
+inline void for_each_index(std::size_t count, std::size_t requested_threads,
+                           Function const& f)
+{
+    std::size_t const threads = thread_count(requested_threads, count);
+    // Several blocks per thread to balance unequal work
+    std::size_t const grain = (std::max)(std::size_t(1), count / (threads * 8));
+    for_each_block(count, threads, grain,
+        [&f](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; i++)
+            {
+                f(i);
+            }
+        });
+}
+
+
+/*!
+\brief Sorts [first, last) with less, in parallel if possible.
+\details The range is divided into one part per thread, the parts are sorted
+    in parallel and then merged pairwise, also in parallel. The iterators
+    should be random access.
+*/
+template <typename Iterator, typename Less>
+inline void sort(Iterator first, Iterator last, Less const& less,
+                 std::size_t requested_threads)
+{
+    std::size_t const count = static_cast<std::size_t>(last - first);
+
+    // Small ranges are not worth the overhead
+    std::size_t const minimal_part_size = 1 << 14;
+    std::size_t const threads = thread_count(requested_threads,
+        count / minimal_part_size);
+
+    if (threads <= 1)
+    {
+        std::sort(first, last, less);
+        return;
+    }
+
+    // Sort each part
+    std::size_t part_size = (count + threads - 1) / threads;
+    for_each_index(threads, threads, [&](std::size_t i)
+    {
+        std::size_t const part_first = (std::min)(i * part_size, count);
+        std::size_t const part_last = (std::min)(part_first + part_size, count);
+        std::sort(first + part_first, first + part_last, less);
+    });
+
+    // Merge neighbouring parts, doubling the part size each round
+    for (; part_size < count; part_size *= 2)
+    {
+        std::size_t const merge_count
+            = (count + 2 * part_size - 1) / (2 * part_size);
+        for_each_index(merge_count, threads, [&](std::size_t i)
+        {
+            std::size_t const part_first = i * 2 * part_size;
+            std::size_t const middle = (std::min)(part_first + part_size, count);
+            std::size_t const part_last = (std::min)(middle + part_size, count);
+            std::inplace_merge(first + part_first, first + middle,
+                               first + part_last, less);
+        });
+    }
+}
+
+
+}} // namespace detail::parallel
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PARALLEL_FOR_HPP
@@ -0,0 +1,233 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_SEGMENT_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_SEGMENT_INDEX_HPP
+
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+/*!
+\brief Packed rtree over all segments of a linear or areal geometry
+\details It is built once and can afterwards be queried concurrently
+    from several threads. Point location is done by counting crossings
+    of a horizontal ray, visiting only the segments crossed by that ray,
+    instead of all segments of the geometry.
+\note Only cartesian coordinate systems are supported.
+*/
+template <typename Point>
+class segment_index
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (std::is_same
+            <
+                typename cs_tag<Point>::type,
+                cartesian_tag
+            >::value),
+        "Only cartesian coordinate systems are supported.",
+        Point);
+
+public :
+    typedef model::segment<Point> segment_type;
+    typedef model::box<Point> box_type;
+    typedef index::rtree<segment_type, index::rstar<16> > rtree_type;
+
+    segment_index()
+    {
+        geometry::assign_inverse(m_envelope);
+    }
+
+    template <typename Geometry>
+    explicit segment_index(Geometry const& geometry)
+    {
+        std::vector<segment_type> segments;
+        geometry::for_each_segment(geometry, [&](auto const& s)
+        {
+            segment_type segment;
+            detail::assign_point_from_index<0>(s, segment.first);
+            detail::assign_point_from_index<1>(s, segment.second);
+            segments.push_back(segment);
+        });
+
+        // Use the packing algorithm
+        rtree_type(segments.begin(), segments.end()).swap(m_rtree);
+
+        geometry::assign_inverse(m_envelope);
+        if (! m_rtree.empty())
+        {
+            geometry::convert(m_rtree.bounds(), m_envelope);
+        }
+    }
+
+    inline bool empty() const
+    {
+        return m_rtree.empty();
+    }
+
+    inline std::size_t size() const
+    {
+        return m_rtree.size();
+    }
+
+    inline box_type const& envelope() const
+    {
+        return m_envelope;
+    }
+
+    inline rtree_type const& rtree() const
+    {
+        return m_rtree;
+    }
+
+    //! Returns true if any segment intersects the (closed) box
+    template <typename Box>
+    inline bool intersects(Box const& box) const
+    {
+        return m_rtree.qbegin(index::intersects(box)) != m_rtree.qend();
+    }
+
+    //! Returns true if any segment intersects the specified segment
+    template <typename Segment>
+    inline bool intersects_segment(Segment const& segment) const
+    {
+        return m_rtree.qbegin(index::intersects(segment)) != m_rtree.qend();
+    }
+
+    //! Returns true if the point is located on one of the segments
+    template <typename OtherPoint>
+    inline bool on_segment(OtherPoint const& point) const
+    {
+        typedef typename coordinate_type<Point>::type coordinate_t;
+
+        box_type box;
+        set<min_corner, 0>(box, coordinate_t(get<0>(point)));
+        set<min_corner, 1>(box, coordinate_t(get<1>(point)));
+        set<max_corner, 0>(box, coordinate_t(get<0>(point)));
+        set<max_corner, 1>(box, coordinate_t(get<1>(point)));
+
+        for (typename rtree_type::const_query_iterator it
+                = m_rtree.qbegin(index::intersects(box));
+             it != m_rtree.qend(); ++it)
+        {
+            if (side_strategy::apply(it->first, it->second, point) == 0
+                && on_segment_range(it->first, it->second, point))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*!
+    \brief Locates a point with respect to the areal geometry
+        the segments were collected from
+    \return 1 if the point is inside, 0 if it is on the boundary,
+        -1 if it is outside (the convention of point_in_geometry)
+    */
+    template <typename OtherPoint>
+    inline int locate(OtherPoint const& point) const
+    {
+        typedef typename coordinate_type<Point>::type coordinate_t;
+
+        if (m_rtree.empty()
+            || get<0>(point) < get<min_corner, 0>(m_envelope)
+            || get<0>(point) > get<max_corner, 0>(m_envelope)
+            || get<1>(point) < get<min_corner, 1>(m_envelope)
+            || get<1>(point) > get<max_corner, 1>(m_envelope))
+        {
+            return -1;
+        }
+
+        // Degenerate box: the ray from the point to the right
+        box_type ray;
+        set<min_corner, 0>(ray, coordinate_t(get<0>(point)));
+        set<min_corner, 1>(ray, coordinate_t(get<1>(point)));
+        set<max_corner, 0>(ray, get<max_corner, 0>(m_envelope));
+        set<max_corner, 1>(ray, coordinate_t(get<1>(point)));
+
+        bool inside = false;
+        for (typename rtree_type::const_query_iterator it
+                = m_rtree.qbegin(index::intersects(ray));
+             it != m_rtree.qend(); ++it)
+        {
+            Point const& p1 = it->first;
+            Point const& p2 = it->second;
+            int const side = side_strategy::apply(p1, p2, point);
+
+            if (side == 0 && on_segment_range(p1, p2, point))
+            {
+                return 0;
+            }
+
+            // Half-open rule: a vertex on the ray counts for the segment
+            // running upwards from it only
+            bool const up1 = get<1>(p1) > get<1>(point);
+            bool const up2 = get<1>(p2) > get<1>(point);
+            if (up1 != up2)
+            {
+                // The ray crosses if the point is left of an upward segment
+                // or right of a downward segment
+                if ((up2 && side > 0) || (up1 && side < 0))
+                {
+                    inside = ! inside;
+                }
+            }
+        }
+        return inside ? 1 : -1;
+    }
+
+private :
+    typedef strategy::side::side_by_triangle<> side_strategy;
+
+    template <typename P1, typename P2, typename P>
+    static inline bool on_segment_range(P1 const& p1, P2 const& p2, P const& p)
+    {
+        return between(get<0>(p1), get<0>(p2), get<0>(p))
+            && between(get<1>(p1), get<1>(p2), get<1>(p));
+    }
+
+    template <typename T1, typename T2>
+    static inline bool between(T1 const& a, T1 const& b, T2 const& v)
+    {
+        return a <= b ? (a <= v && v <= b) : (b <= v && v <= a);
+    }
+
+    rtree_type m_rtree;
+    box_type m_envelope;
+};
+
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_PREPARED_SEGMENT_INDEX_HPP
@@ -0,0 +1,228 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
+
+
+#include <cstddef>
+#include <map>
+#include <queue>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/detail/sweep.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace section
+{
+
+template <typename Coordinate>
+struct sweep_event
+{
+    Coordinate x;
+    bool is_insert;
+    std::size_t index;
+};
+
+// Ordering of the (max-)priority queue: smallest x first and, for equal x,
+// insertions before removals such that touching boxes are reported
+template <typename Coordinate>
+struct sweep_event_later
+{
+    inline bool operator()(sweep_event<Coordinate> const& left,
+                           sweep_event<Coordinate> const& right) const
+    {
+        if (left.x != right.x)
+        {
+            return right.x < left.x;
+        }
+        if (left.is_insert != right.is_insert)
+        {
+            return right.is_insert;
+        }
+        return right.index < left.index;
+    }
+};
+
+template <typename Coordinate>
+struct sweep_initialization_visitor
+{
+    template <typename Sections, typename Queue, typename EventVisitor>
+    static inline void apply(Sections const& sections, Queue& queue,
+                             EventVisitor& )
+    {
+        std::size_t const count = boost::size(sections);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            auto const& section = range::at(sections, i);
+            if (section.duplicate)
+            {
+                continue;
+            }
+
+            auto const& box = section.bounding_box;
+            queue.push(sweep_event<Coordinate>{get<min_corner, 0>(box), true, i});
+            queue.push(sweep_event<Coordinate>{get<max_corner, 0>(box), false, i});
+        }
+    }
+};
+
+// Keeps the sections crossed by the sweep line ordered by their minimal y.
+// An inserted section is only compared with active sections having a
+// minimal y within the y-range of its box extended by the largest height
+// of the active sections. The heights of the active sections are kept too,
+// such that a tall section only widens that range while it is crossed by
+// the sweep line. While it is, all active sections within its height are
+// scanned, which is the worst case for sections of mixed heights.
+template <typename Sections, typename Coordinate, typename Visitor>
+struct sweep_event_visitor
+{
+    typedef std::multimap<Coordinate, std::size_t> active_type;
+    typedef std::multiset<Coordinate> heights_type;
+
+    inline sweep_event_visitor(Sections const& sections, Visitor& visitor)
+        : m_sections(sections)
+        , m_visitor(visitor)
+        , m_positions(boost::size(sections))
+        , m_height_positions(boost::size(sections))
+        , m_interrupted(false)
+    {}
+
+    template <typename Queue>
+    inline void apply(sweep_event<Coordinate> const& event, Queue& )
+    {
+        if (m_interrupted)
+        {
+            return;
+        }
+
+        if (! event.is_insert)
+        {
+            m_active.erase(m_positions[event.index]);
+            m_heights.erase(m_height_positions[event.index]);
+            return;
+        }
+
+        auto const& section = range::at(m_sections, event.index);
+        Coordinate const min_y = get<min_corner, 1>(section.bounding_box);
+        Coordinate const max_y = get<max_corner, 1>(section.bounding_box);
+        Coordinate const max_height = m_heights.empty()
+            ? Coordinate(0) : *m_heights.rbegin();
+
+        for (auto it = m_active.lower_bound(min_y - max_height);
+             it != m_active.end() && ! (max_y < it->first);
+             ++it)
+        {
+            auto const& other = range::at(m_sections, it->second);
+            if (get<max_corner, 1>(other.bounding_box) < min_y)
+            {
+                continue;
+            }
+
+            bool const proceed = it->second < event.index
+                ? m_visitor.apply(other, section)
+                : m_visitor.apply(section, other);
+            if (! proceed)
+            {
+                m_interrupted = true;
+                return;
+            }
+        }
+
+        m_positions[event.index] = m_active.insert(std::make_pair(min_y, event.index));
+        m_height_positions[event.index] = m_heights.insert(max_y - min_y);
+    }
+
+    Sections const& m_sections;
+    Visitor& m_visitor;
+    active_type m_active;
+    heights_type m_heights;
+    std::vector<typename active_type::iterator> m_positions;
+    std::vector<typename heights_type::iterator> m_height_positions;
+    bool m_interrupted;
+};
+
+template <typename EventVisitor>
+struct sweep_interrupt_policy
+{
+    static bool const enabled = true;
+
+    explicit sweep_interrupt_policy(EventVisitor const& event_visitor)
+        : m_event_visitor(event_visitor)
+    {}
+
+    template <typename Event>
+    inline bool apply(Event const& ) const
+    {
+        return m_event_visitor.m_interrupted;
+    }
+
+    EventVisitor const& m_event_visitor;
+};
+
+/*!
+\brief Visits all pairs of sections with overlapping boxes, as partition
+    does, but by sweeping a line over the sections in x-direction
+\details Boxes enter the active set at their minimal x and leave it at
+    their maximal x. Pairs are only formed with the boxes in the active set,
+    so the number of visited pairs is proportional to the number of really
+    overlapping boxes. This is beneficial for sections of long, nearly
+    horizontal lines (e.g. coastlines), for which partition has to compare
+    many sections sharing the same quadrants.
+    Sections marked as duplicate are skipped.
+    Only cartesian boxes are supported (boxes are not wrapped).
+\return false if the visitor interrupted the sweep
+*/
+template <typename Sections, typename Visitor>
+inline bool sweep_sections(Sections const& sections, Visitor& visitor)
+{
+    typedef typename boost::range_value<Sections>::type section_type;
+    typedef typename geometry::coordinate_type
+        <
+            typename section_type::box_type
+        >::type coordinate_type;
+    typedef sweep_event<coordinate_type> event_type;
+    typedef sweep_event_visitor
+        <
+            Sections, coordinate_type, Visitor
+        > event_visitor_type;
+
+    std::priority_queue
+        <
+            event_type,
+            std::vector<event_type>,
+            sweep_event_later<coordinate_type>
+        > queue;
+
+    sweep_initialization_visitor<coordinate_type> initialization_visitor;
+    event_visitor_type event_visitor(sections, visitor);
+
+    geometry::sweep(sections, queue, initialization_visitor, event_visitor,
+                    sweep_interrupt_policy<event_visitor_type>(event_visitor));
+
+    return ! event_visitor.m_interrupted;
+}
+
+
+}} // namespace detail::section
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTION_SWEEP_HPP
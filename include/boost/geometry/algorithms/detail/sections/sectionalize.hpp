@@ -21,6 +21,8 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONALIZE_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_SECTIONS_SECTIONALIZE_HPP
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <type_traits>
 #include <vector>
@@ -38,6 +40,7 @@
 #include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/expand.hpp>
 #include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
 #include <boost/geometry/algorithms/detail/interior_iterator.hpp>
 #include <boost/geometry/algorithms/detail/recalculate.hpp>
 #include <boost/geometry/algorithms/detail/ring_identifier.hpp>
@@ -65,6 +68,14 @@
 #include <boost/geometry/strategy/envelope.hpp>
 #include <boost/geometry/strategy/expand.hpp>
 
+
+// Maximal number of points per section used by default. Define it as 0
+// to let sectionalize select the section size per geometry (adaptive mode)
+#ifndef BOOST_GEOMETRY_SECTIONALIZE_MAX_COUNT
+#define BOOST_GEOMETRY_SECTIONALIZE_MAX_COUNT 10
+#endif
+
+
 namespace boost { namespace geometry
 {
 
@@ -852,6 +863,102 @@ inline void enlarge_sections(Sections& sections, Strategy const&)
 }
 
 
+// Passed as max_count, sectionalize selects the section size itself
+std::size_t const adaptive_max_count = 0;
+
+// The constants of select_max_count, derived from the results of
+// test/benchmark/sectionalize_max_count.cpp (turns of two polygons, the
+// overlay test cases densified, and synthetic coastlines):
+// - at 10000 vertices per polygon max_count 10 is within 20% of the
+//   fastest (5 or 10) for all cases, while 13 to 16, selected by a former
+//   threshold of 1000 segments, was up to 60% slower (geos_1)
+// - at 100000 vertices per polygon the fastest sizes range from 10
+//   (case_many_situations, geos_1) to 30 or 50 (dz_1, buffer_rt_a), the
+//   growth (with the reduction for their mean orientation) selects 13 to
+//   16 for these cases, the fastest or within about 20% of it, which is
+//   also the variation between runs, for all but isovist
+// - at 100 all cases are slower than at 50, except buffer_rt_a
+// - the coastlines do not depend on max_count, their sections end where
+//   the direction changes
+// The reduction for diagonal segments is not derived from these cases,
+// which have similar mean orientations, but from the box areas: the box
+// of n diagonal segments has an area proportional to n*n, of n segments
+// along an axis proportional to n.
+
+// Default number of points per section, used for small geometries
+std::size_t const default_max_count = 10;
+
+// Up to this number of segments the default is used
+std::size_t const adaptive_min_segment_count = 10000;
+
+// Relative growth of the section size, per doubling of the number of
+// segments, for segments along an axis (18 at 100000 segments)
+double const adaptive_growth_per_doubling = 0.25;
+
+// Relative reduction of the section size for diagonal segments
+// (9, so the default, at 100000 segments)
+double const adaptive_diagonal_reduction = 0.5;
+
+// Above this size the section boxes get too large
+std::size_t const adaptive_largest_max_count = 100;
+
+/*!
+\brief Selects the maximal number of points per section from the number of
+    segments and their orientation, gathered from the (exterior) rings
+\details Small geometries use the default of 10. For larger geometries the
+    number of sections to partition, and therefore the overhead per section,
+    gets dominant, so the sections are enlarged logarithmically. Boxes of
+    monotonic runs along a diagonal grow quadratically with their length,
+    boxes of runs along an axis linearly. Therefore diagonal input uses
+    smaller sections.
+*/
+template <typename Geometry>
+inline std::size_t select_max_count(Geometry const& geometry)
+{
+    std::size_t segment_count = 0;
+    double diagonality = 0.0;
+    detail::all_ranges_of(geometry, [&](auto const& range)
+    {
+        auto it = boost::begin(range);
+        if (it == boost::end(range))
+        {
+            return true;
+        }
+        for (auto prev = it++; it != boost::end(range); prev = it++)
+        {
+            double const dx = std::abs(double(geometry::get<0>(*it))
+                                       - double(geometry::get<0>(*prev)));
+            double const dy = std::abs(double(geometry::get<1>(*it))
+                                       - double(geometry::get<1>(*prev)));
+            double const larger = (std::max)(dx, dy);
+            if (larger > 0.0)
+            {
+                // 0 for a segment along an axis, 1 for a diagonal one
+                diagonality += (std::min)(dx, dy) / larger;
+            }
+            segment_count++;
+        }
+        return true;
+    });
+
+    if (segment_count < adaptive_min_segment_count)
+    {
+        return default_max_count;
+    }
+
+    double const mean_diagonality = diagonality / segment_count;
+    double const doublings = std::log2(double(segment_count)
+                                       / adaptive_min_segment_count);
+    double const count = default_max_count
+        * (1.0 + adaptive_growth_per_doubling * doublings)
+        * (1.0 - adaptive_diagonal_reduction * mean_diagonality);
+
+    return (std::min)(adaptive_largest_max_count,
+                      (std::max)(default_max_count,
+                                 static_cast<std::size_t>(count)));
+}
+
+
 }} // namespace detail::sectionalize
 #endif // DOXYGEN_NO_DETAIL
 
@@ -987,7 +1094,10 @@ struct sectionalize<multi_linestring_tag, MultiLinestring, Reverse, DimensionVec
     \param expand_strategy strategy for partitions
     \param source_index index to assign to the ring_identifiers
     \param max_count maximal number of points per section
-        (defaults to 10, this seems to give the fastest results)
+        (defaults to BOOST_GEOMETRY_SECTIONALIZE_MAX_COUNT, which is 10
+        unless defined otherwise, this seems to give the fastest results for
+        typical input). If it is 0 (adaptive_max_count) the section size is
+        selected from the number of segments and their orientation.
 
  */
 template
@@ -1006,7 +1116,7 @@ inline void sectionalize(Geometry const& geometry,
                 EnvelopeStrategy const& envelope_strategy,
                 ExpandStrategy const& expand_strategy,
                 int source_index = 0,
-                std::size_t max_count = 10)
+                std::size_t max_count = BOOST_GEOMETRY_SECTIONALIZE_MAX_COUNT)
 {
     BOOST_STATIC_ASSERT((! std::is_fundamental<EnvelopeStrategy>::value));
 
@@ -1034,6 +1144,11 @@ inline void sectionalize(Geometry const& geometry,
 
     sections.clear();
 
+    if (max_count == detail::sectionalize::adaptive_max_count)
+    {
+        max_count = detail::sectionalize::select_max_count(geometry);
+    }
+
     ring_identifier ring_id;
     ring_id.source_index = source_index;
 
@@ -1063,7 +1178,7 @@ inline void sectionalize(Geometry const& geometry,
                          RobustPolicy const& robust_policy,
                          Sections& sections,
                          int source_index = 0,
-                         std::size_t max_count = 10)
+                         std::size_t max_count = BOOST_GEOMETRY_SECTIONALIZE_MAX_COUNT)
 {
     typedef typename strategy::envelope::services::default_strategy
         <
@@ -0,0 +1,976 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_OFFSET_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_OFFSET_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/empty.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/rbegin.hpp>
+#include <boost/range/rend.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/detail/assign_values.hpp>
+#include <boost/geometry/algorithms/detail/buffer/line_line_intersection.hpp>
+#include <boost/geometry/algorithms/detail/direction_code.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/formulas/sjoberg_intersection.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/agnostic/buffer_distance_symmetric.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_join_round.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_side_straight.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+#include <boost/geometry/strategies/geographic/side.hpp>
+#include <boost/geometry/strategies/side.hpp>
+#include <boost/geometry/strategy/geographic/envelope_segment.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace offset
+{
+
+template <typename Point>
+struct offset_crossing
+{
+    std::size_t first;
+    std::size_t second;
+    Point point;
+
+    inline bool operator<(offset_crossing const& other) const
+    {
+        // Sort on first segment, and then on the largest loop first
+        return first != other.first
+            ? first < other.first
+            : second > other.second;
+    }
+};
+
+// Calculates the side of a point with respect to a segment of the raw curve
+// (1 if it is left, -1 if right and 0 if collinear), and the box of a
+// segment, to find the crossings of the curve. For cartesian curves they
+// are calculated in the coordinates of the curve.
+template
+<
+    typename SideStrategy,
+    typename CSTag
+>
+struct offset_segments
+{
+    explicit offset_segments(SideStrategy const& )
+    {}
+
+    template <typename Point>
+    inline int side(Point const& a, Point const& b, Point const& p) const
+    {
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                double
+            >::type ct;
+        ct const value
+            = (ct(get<0>(b)) - ct(get<0>(a))) * (ct(get<1>(p)) - ct(get<1>(a)))
+            - (ct(get<1>(b)) - ct(get<1>(a))) * (ct(get<0>(p)) - ct(get<0>(a)));
+        return math::equals(value, ct(0)) ? 0 : value > 0 ? 1 : -1;
+    }
+
+    template <typename Point, typename Box>
+    inline void envelope(Point const& p, Point const& q, Box& box) const
+    {
+        geometry::set<min_corner, 0>(box, (std::min)(get<0>(p), get<0>(q)));
+        geometry::set<min_corner, 1>(box, (std::min)(get<1>(p), get<1>(q)));
+        geometry::set<max_corner, 0>(box, (std::max)(get<0>(p), get<0>(q)));
+        geometry::set<max_corner, 1>(box, (std::max)(get<1>(p), get<1>(q)));
+    }
+};
+
+// For geographic curves the side is calculated with the azimuths of the
+// geodesics, and the box includes the latitude of the vertex of the
+// geodesic, with the spheroid of the side strategy and the formula used
+// for the intersections
+template <typename SideStrategy>
+struct offset_segments<SideStrategy, geographic_tag>
+{
+    typedef typename SideStrategy::model_type spheroid_type;
+
+    explicit offset_segments(SideStrategy const& side_strategy)
+        : m_side(side_strategy.model())
+        , m_envelope(side_strategy.model())
+    {}
+
+    template <typename Point>
+    inline int side(Point const& a, Point const& b, Point const& p) const
+    {
+        return m_side.apply(a, b, p);
+    }
+
+    template <typename Point, typename Box>
+    inline void envelope(Point const& p, Point const& q, Box& box) const
+    {
+        model::box<Point> geographic_box;
+        m_envelope.apply(p, q, geographic_box);
+        geometry::set<min_corner, 0>(box, get<min_corner, 0>(geographic_box));
+        geometry::set<min_corner, 1>(box, get<min_corner, 1>(geographic_box));
+        geometry::set<max_corner, 0>(box, get<max_corner, 0>(geographic_box));
+        geometry::set<max_corner, 1>(box, get<max_corner, 1>(geographic_box));
+    }
+
+private :
+    strategy::side::geographic<strategy::vincenty, spheroid_type> m_side;
+    strategy::envelope::geographic_segment<strategy::vincenty, spheroid_type> m_envelope;
+};
+
+// Shifts the longitude of a geographic point, in radians
+template <typename Point, typename T>
+inline void shift_longitude(Point& point, T const& shift)
+{
+    T longitude = get_as_radian<0>(point) + shift;
+    math::normalize_longitude<radian>(longitude);
+    set_from_radian<0>(point, longitude);
+}
+
+// Calculates the intersection point of the lines through p1-p2 and q1-q2.
+// These are infinite lines for cartesian curves, and geodesics for
+// geographic curves. The geodesics are intersected with the inverse formula
+// of vincenty: with the azimuths of andoyer, the intersection of segments
+// of a hundred kilometers can be a meter off.
+template
+<
+    typename SideStrategy,
+    typename CSTag
+>
+struct offset_intersection
+{
+    explicit offset_intersection(SideStrategy const& )
+    {}
+
+    template <typename Point>
+    inline bool apply(Point const& p1, Point const& p2,
+                      Point const& q1, Point const& q2, Point& ip) const
+    {
+        return detail::buffer::line_line_intersection::apply(p1, p2, q1, q2, ip);
+    }
+};
+
+template <typename SideStrategy>
+struct offset_intersection<SideStrategy, geographic_tag>
+{
+    typedef typename SideStrategy::model_type spheroid_type;
+
+    explicit offset_intersection(SideStrategy const& side_strategy)
+        : m_spheroid(side_strategy.model())
+    {}
+
+    template <typename Point>
+    inline bool apply(Point const& p1, Point const& p2,
+                      Point const& q1, Point const& q2, Point& ip) const
+    {
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                double
+            >::type ct;
+        typedef formula::sjoberg_intersection
+            <
+                ct, strategy::vincenty::template inverse
+            > intersection_t;
+
+        ct lon = 0;
+        ct lat = 0;
+        if (! intersection_t::apply(get_as_radian<0>(p1), get_as_radian<1>(p1),
+                                    get_as_radian<0>(p2), get_as_radian<1>(p2),
+                                    get_as_radian<0>(q1), get_as_radian<1>(q1),
+                                    get_as_radian<0>(q2), get_as_radian<1>(q2),
+                                    lon, lat, m_spheroid))
+        {
+            return false;
+        }
+
+        // Two geodesics intersect twice, take the intersection near the
+        // segments rather than its antipode
+        ct const lon_diff = math::longitude_distance_signed<radian>(
+                                ct(get_as_radian<0>(p2)), lon);
+        if (math::abs(lon_diff) > math::half_pi<ct>())
+        {
+            lon += math::pi<ct>();
+            math::normalize_longitude<radian>(lon);
+            lat = -lat;
+        }
+
+        set_from_radian<0>(ip, lon);
+        set_from_radian<1>(ip, lat);
+        return true;
+    }
+
+private :
+    spheroid_type m_spheroid;
+};
+
+// The relative tolerance for the distance of the vertices of the raw curve
+// to the input. Vertices of a valid curve are at the offset distance, up to
+// the errors of the side and join strategies and of the distance calculation.
+// For cartesian curves these are rounding errors. For geographic curves,
+// the cross track distance of the default strategy (andoyer) differs from
+// the distance of the side strategy by up to 2e-5 of the distance, for
+// segments of 150 km.
+template <typename CSTag>
+struct offset_distance_tolerance
+{
+    template <typename T>
+    static inline T apply()
+    {
+        return std::sqrt(std::numeric_limits<T>::epsilon());
+    }
+};
+
+template <>
+struct offset_distance_tolerance<geographic_tag>
+{
+    template <typename T>
+    static inline T apply()
+    {
+        return T(1.0e-4);
+    }
+};
+
+// Index over the segments of the input, to find out if a point of the raw
+// curve is closer to the input than the offset distance. It is built once
+// for each range, and queried for the nearest segment only.
+template <typename Range>
+class offset_input_index
+{
+    typedef typename geometry::point_type<Range>::type point_type;
+    typedef model::segment<point_type> segment_type;
+    typedef index::rtree<segment_type, index::rstar<16> > rtree_type;
+
+public :
+    explicit offset_input_index(Range const& range)
+        : m_rtree(segments(range))
+    {}
+
+    // Returns true if the point is closer to the input than the distance,
+    // by more than the tolerance. All vertices of a valid offset curve are
+    // at (at least) the distance.
+    template <typename Point, typename Distance>
+    inline bool is_inside(Point const& point, Distance const& distance) const
+    {
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<Point>::type,
+                Distance
+            >::type ct;
+
+        ct const limit = distance * (ct(1) - offset_distance_tolerance
+                <
+                    typename cs_tag<Point>::type
+                >::template apply<ct>());
+
+        typename rtree_type::const_query_iterator const it
+            = m_rtree.qbegin(index::nearest(point, 1));
+        return it != m_rtree.qend()
+            && geometry::distance(point, *it) < limit;
+    }
+
+private :
+    static inline std::vector<segment_type> segments(Range const& input)
+    {
+        std::vector<segment_type> result;
+        result.reserve(boost::size(input));
+        if (boost::size(input) == 1)
+        {
+            result.push_back(segment_type(range::front(input), range::front(input)));
+        }
+        for (typename boost::range_iterator<Range const>::type
+                prev = boost::begin(input), it = boost::begin(input);
+             it != boost::end(input); prev = it++)
+        {
+            if (it != prev)
+            {
+                result.push_back(segment_type(*prev, *it));
+            }
+        }
+        return result;
+    }
+
+    rtree_type m_rtree;
+};
+
+// Collects the crossings of non-adjacent segments of the raw curve
+template <typename Points, typename Intersection, typename Segments>
+struct offset_crossing_visitor
+{
+    typedef typename boost::range_value<Points>::type point_type;
+
+    Points const& m_points;
+    Intersection const& m_intersection;
+    Segments const& m_segments;
+    std::vector<offset_crossing<point_type> >& m_crossings;
+
+    offset_crossing_visitor(Points const& points,
+            Intersection const& intersection,
+            Segments const& segments,
+            std::vector<offset_crossing<point_type> >& crossings)
+        : m_points(points)
+        , m_intersection(intersection)
+        , m_segments(segments)
+        , m_crossings(crossings)
+    {}
+
+    // Visits segments i and j, with i < j
+    inline void apply(std::size_t i, std::size_t j)
+    {
+        if (j <= i + 1)
+        {
+            return;
+        }
+
+        point_type const& p1 = m_points[i];
+        point_type const& p2 = m_points[i + 1];
+        point_type const& q1 = m_points[j];
+        point_type const& q2 = m_points[j + 1];
+
+        int const sp1 = m_segments.side(q1, q2, p1);
+        int const sp2 = m_segments.side(q1, q2, p2);
+        int const sq1 = m_segments.side(p1, p2, q1);
+        int const sq2 = m_segments.side(p1, p2, q2);
+
+        // Only proper crossings, where both segments change side.
+        // Touching and collinear segments are kept as they are.
+        if (sp1 * sp2 < 0 && sq1 * sq2 < 0)
+        {
+            offset_crossing<point_type> crossing;
+            crossing.first = i;
+            crossing.second = j;
+            if (m_intersection.apply(p1, p2, q1, q2, crossing.point))
+            {
+                m_crossings.push_back(crossing);
+            }
+        }
+    }
+};
+
+// Generates the raw offset of a range, to the left, and removes its
+// invalid parts
+template <typename RangeOut>
+struct offset_range
+{
+    typedef typename point_type<RangeOut>::type output_point_type;
+    typedef std::vector<output_point_type> points_type;
+
+    template <typename Point, typename SideStrategy>
+    static inline strategy::buffer::join_selector get_join_type(
+            Point const& p0, Point const& p1, Point const& p2,
+            SideStrategy const& side_strategy)
+    {
+        int const side = side_strategy.apply(p0, p1, p2);
+        typedef typename cs_tag<Point>::type cs_tag;
+        return side == -1 ? strategy::buffer::join_convex
+            :  side == 1  ? strategy::buffer::join_concave
+            :  direction_code<cs_tag>(p0, p1, p2) == 1
+                ? strategy::buffer::join_continue
+            : strategy::buffer::join_spike;
+    }
+
+    // Returns true if p, on the infinite line a-b, is also on segment a-b
+    static inline bool on_segment(output_point_type const& a,
+            output_point_type const& b, output_point_type const& p)
+    {
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<output_point_type>::type,
+                double
+            >::type ct;
+        ct const dx = ct(get<0>(b)) - ct(get<0>(a));
+        ct const dy = ct(get<1>(b)) - ct(get<1>(a));
+        ct const pa = (ct(get<0>(p)) - ct(get<0>(a))) * dx
+                    + (ct(get<1>(p)) - ct(get<1>(a))) * dy;
+        ct const pb = (ct(get<0>(b)) - ct(get<0>(p))) * dx
+                    + (ct(get<1>(b)) - ct(get<1>(p))) * dy;
+        return pa >= 0 && pb >= 0;
+    }
+
+    template
+    <
+        typename Iterator,
+        typename DistanceStrategy,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename PointSideStrategy,
+        typename Intersection
+    >
+    static inline bool generate(Iterator begin, Iterator end,
+                DistanceStrategy const& distance_strategy,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                PointSideStrategy const& point_side_strategy,
+                Intersection const& intersection,
+                points_type& raw)
+    {
+        typedef typename std::iterator_traits<Iterator>::value_type point_type;
+
+        strategy::buffer::buffer_side_selector const side
+            = strategy::buffer::buffer_side_left;
+
+        std::vector<output_point_type> generated_side;
+        generated_side.reserve(2);
+        std::vector<output_point_type> range_out;
+
+        // The start (possibly trimmed) and end of the previous offset segment,
+        // and the point before the previous input point. They are assigned
+        // for the first segment, and used from the second segment on.
+        output_point_type last_p1, last_p2;
+        point_type penultimate;
+        geometry::assign_zero(last_p1);
+        geometry::assign_zero(last_p2);
+        geometry::assign_zero(penultimate);
+        bool first = true;
+
+        if (begin == end)
+        {
+            return true;
+        }
+
+        Iterator prev = begin;
+        Iterator it = begin;
+        for (++it; it != end; prev = it++)
+        {
+            generated_side.clear();
+            strategy::buffer::result_code const code
+                = side_strategy.apply(*prev, *it, side,
+                                      distance_strategy, generated_side);
+            if (code == strategy::buffer::result_no_output)
+            {
+                // Duplicate points, the segment is skipped
+                continue;
+            }
+            else if (code == strategy::buffer::result_error_numerical)
+            {
+                return false;
+            }
+
+            output_point_type p1 = generated_side.front();
+            output_point_type const& p2 = generated_side.back();
+
+            if (first)
+            {
+                raw.push_back(p1);
+                first = false;
+            }
+            else
+            {
+                switch (get_join_type(penultimate, *prev, *it,
+                                      point_side_strategy))
+                {
+                    case strategy::buffer::join_continue :
+                        // The offset continues along the same line
+                        break;
+                    case strategy::buffer::join_convex :
+                        {
+                            output_point_type ip;
+                            range_out.clear();
+                            if (intersection.apply(p1, p2, last_p1, last_p2, ip)
+                                && join_strategy.apply(ip, *prev, last_p2, p1,
+                                    geometry::detail::buffer::distance_at_vertex(
+                                        distance_strategy, *prev, *it,
+                                        *prev, side),
+                                    range_out))
+                            {
+                                // The join starts at last_p2, already added
+                                raw.insert(raw.end(),
+                                    range_out.begin() + 1, range_out.end());
+                            }
+                            else
+                            {
+                                raw.push_back(p1);
+                            }
+                        }
+                        break;
+                    case strategy::buffer::join_concave :
+                        {
+                            // If the two offset segments intersect, they
+                            // are trimmed there. Otherwise they are connected
+                            // and the loop is removed afterwards.
+                            output_point_type ip;
+                            if (intersection.apply(p1, p2, last_p1, last_p2, ip)
+                                && on_segment(last_p1, last_p2, ip)
+                                && on_segment(p1, p2, ip))
+                            {
+                                raw.back() = ip;
+                                p1 = ip;
+                            }
+                            else
+                            {
+                                raw.push_back(p1);
+                            }
+                        }
+                        break;
+                    case strategy::buffer::join_spike :
+                        // The input turns back, the offset is connected
+                        // straight to the other side
+                        raw.push_back(p1);
+                        break;
+                }
+            }
+
+            raw.push_back(p2);
+            last_p1 = p1;
+            last_p2 = p2;
+            penultimate = *prev;
+        }
+        return true;
+    }
+
+    // Removes the invalid parts of the raw offset curve. The curve crosses
+    // itself where the input has concave bends with segments shorter than
+    // the offset distance, or where parts of the input are closer to each
+    // other than twice the distance. At such a crossing, the loop, the head
+    // or the tail of the curve is inside the buffer, and it is cut off.
+    template
+    <
+        typename Range,
+        typename Distance,
+        typename Intersection,
+        typename Segments
+    >
+    static inline void remove_invalid_parts(points_type& raw,
+            Range const& range, Distance const& distance,
+            Intersection const& intersection,
+            Segments const& segments)
+    {
+        // Segments of the raw offset curve are indexed with their box in
+        // the coordinates of the curve
+        typedef typename coordinate_type<output_point_type>::type ct;
+        typedef model::box<model::point<ct, 2, cs::cartesian> > box_type;
+        typedef std::pair<box_type, std::size_t> value_type;
+        typedef index::rtree<value_type, index::rstar<16> > rtree_type;
+
+        if (raw.size() <= 3)
+        {
+            return;
+        }
+
+        std::vector<value_type> boxes(raw.size() - 1);
+        for (std::size_t i = 0; i + 1 < raw.size(); i++)
+        {
+            segments.envelope(raw[i], raw[i + 1], boxes[i].first);
+            boxes[i].second = i;
+        }
+
+        // Each segment is compared with the segments after it
+        // overlapping its box
+        rtree_type const rtree(boxes);
+        std::vector<offset_crossing<output_point_type> > crossings;
+        offset_crossing_visitor<points_type, Intersection, Segments> visitor(raw,
+            intersection, segments, crossings);
+        for (std::size_t i = 0; i < boxes.size(); i++)
+        {
+            for (typename rtree_type::const_query_iterator it
+                    = rtree.qbegin(index::intersects(boxes[i].first));
+                 it != rtree.qend(); ++it)
+            {
+                if (it->second > i)
+                {
+                    visitor.apply(i, it->second);
+                }
+            }
+        }
+
+        if (crossings.empty())
+        {
+            return;
+        }
+
+        std::sort(crossings.begin(), crossings.end());
+
+        offset_input_index<Range> const input(range);
+
+        // The invalid parts are cut in one pass along the curve. A cut only
+        // removes segments, or shortens the segments at the crossing, so the
+        // crossings of the segments which are kept are still valid, if they
+        // are on the part of a shortened segment which is kept. After a cut,
+        // the curve continues from the crossing point (start), on segment
+        // next - 1.
+        points_type result;
+        result.reserve(raw.size());
+        std::size_t next = 0;
+        output_point_type start;
+        geometry::assign_zero(start);
+        for (std::size_t c = 0; c < crossings.size(); c++)
+        {
+            offset_crossing<output_point_type> const& crossing = crossings[c];
+            std::size_t const i = crossing.first;
+            std::size_t const j = crossing.second;
+            if (i + 1 < next)
+            {
+                // The segment is removed
+                continue;
+            }
+
+            bool const from_start = i + 1 == next;
+            if (from_start && ! on_segment(start, raw[i + 1], crossing.point))
+            {
+                // The crossing is on the part of the segment which is removed
+                continue;
+            }
+            output_point_type const& head = from_start ? start : raw[i];
+
+            if (input.is_inside(raw[i + 1], distance)
+                || input.is_inside(raw[j], distance))
+            {
+                // The loop is inside, skip it
+                result.insert(result.end(), raw.begin() + next, raw.begin() + i + 1);
+                result.push_back(crossing.point);
+                next = j + 1;
+                start = crossing.point;
+            }
+            else if (input.is_inside(raw[j + 1], distance))
+            {
+                // The tail is inside, the curve ends at the crossing
+                result.insert(result.end(), raw.begin() + next, raw.begin() + j + 1);
+                result.push_back(crossing.point);
+                next = raw.size();
+                break;
+            }
+            else if (input.is_inside(head, distance))
+            {
+                // The head is inside, the curve starts at the crossing
+                result.clear();
+                result.push_back(crossing.point);
+                next = i + 1;
+                start = crossing.point;
+            }
+        }
+
+        result.insert(result.end(), raw.begin() + next, raw.end());
+        raw.swap(result);
+    }
+
+    // Calculates the offset curve of a range
+    template
+    <
+        typename Range,
+        typename Distance,
+        typename SideStrategy,
+        typename JoinStrategy
+    >
+    static inline void calculate(Range const& range, points_type& raw,
+                Distance const& distance,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy)
+    {
+        typedef typename strategy::side::services::default_strategy
+            <
+                typename cs_tag<Range>::type
+            >::type point_side_strategy_type;
+        typedef typename cs_tag<Range>::type cs_tag_type;
+
+        offset_intersection<SideStrategy, cs_tag_type> const intersection(side_strategy);
+        offset_segments<SideStrategy, cs_tag_type> const segments(side_strategy);
+
+        Distance const abs_distance = geometry::math::abs(distance);
+        strategy::buffer::distance_symmetric<Distance> const
+            distance_strategy(abs_distance);
+
+        // The offset is generated to the left. For a negative distance,
+        // it is generated to the left of the reversed input, and reversed
+        // afterwards
+        bool const reverse = distance < 0;
+
+        raw.reserve(boost::size(range) * 2);
+        bool const ok = reverse
+            ? generate(boost::rbegin(range), boost::rend(range),
+                       distance_strategy, side_strategy, join_strategy,
+                       point_side_strategy_type(), intersection, raw)
+            : generate(boost::begin(range), boost::end(range),
+                       distance_strategy, side_strategy, join_strategy,
+                       point_side_strategy_type(), intersection, raw);
+        if (! ok)
+        {
+            raw.clear();
+            return;
+        }
+
+        remove_invalid_parts(raw, range, abs_distance, intersection, segments);
+
+        if (reverse)
+        {
+            std::reverse(raw.begin(), raw.end());
+        }
+    }
+
+    template
+    <
+        typename Range,
+        typename Distance,
+        typename SideStrategy,
+        typename JoinStrategy,
+        typename CSTag
+    >
+    static inline void calculate(Range const& range, points_type& raw,
+                Distance const& distance,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                CSTag)
+    {
+        calculate(range, raw, distance, side_strategy, join_strategy);
+    }
+
+    // Geographic curves are calculated with longitudes relative to the
+    // first point of the input, and shifted back afterwards. A curve
+    // crossing the antimeridian is then continuous, such that its boxes
+    // and the positions along its segments are valid. Geodesics do not
+    // change if all longitudes are shifted.
+    template
+    <
+        typename Range,
+        typename Distance,
+        typename SideStrategy,
+        typename JoinStrategy
+    >
+    static inline void calculate(Range const& range, points_type& raw,
+                Distance const& distance,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy,
+                geographic_tag)
+    {
+        typedef typename geometry::point_type<Range>::type point_type;
+        typedef typename select_most_precise
+            <
+                typename coordinate_type<point_type>::type,
+                double
+            >::type ct;
+
+        if (boost::empty(range))
+        {
+            return;
+        }
+
+        ct const shift = get_as_radian<0>(range::front(range));
+
+        model::linestring<point_type> shifted(boost::begin(range), boost::end(range));
+        for (point_type& point : shifted)
+        {
+            shift_longitude(point, -shift);
+        }
+
+        calculate(shifted, raw, distance, side_strategy, join_strategy);
+
+        for (output_point_type& point : raw)
+        {
+            shift_longitude(point, shift);
+        }
+    }
+
+    template
+    <
+        typename Range,
+        typename Distance,
+        typename SideStrategy,
+        typename JoinStrategy
+    >
+    static inline void apply(Range const& range, RangeOut& out,
+                Distance const& distance,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy)
+    {
+        points_type raw;
+        calculate(range, raw, distance, side_strategy, join_strategy,
+                  typename cs_tag<Range>::type());
+
+        for (typename points_type::const_iterator it = raw.begin();
+             it != raw.end(); ++it)
+        {
+            range::push_back(out, *it);
+        }
+    }
+};
+
+template <typename MultiOut>
+struct offset_multi
+{
+    template
+    <
+        typename Multi,
+        typename Distance,
+        typename SideStrategy,
+        typename JoinStrategy
+    >
+    static inline void apply(Multi const& multi, MultiOut& out,
+                Distance const& distance,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy)
+    {
+        typedef typename boost::range_value<MultiOut>::type single_out;
+
+        for (typename boost::range_iterator<Multi const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            single_out single;
+            offset_range<single_out>::apply(*it, single, distance,
+                                            side_strategy, join_strategy);
+            if (boost::size(single) > 1)
+            {
+                range::push_back(out, single);
+            }
+        }
+    }
+};
+
+}} // namespace detail::offset
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template
+<
+    typename Geometry,
+    typename GeometryOut,
+    typename GeometryTag = typename tag<Geometry>::type,
+    typename GeometryOutTag = typename tag<GeometryOut>::type
+>
+struct offset
+    : not_implemented<GeometryTag, GeometryOutTag>
+{};
+
+
+template <typename Geometry, typename GeometryOut>
+struct offset<Geometry, GeometryOut, linestring_tag, linestring_tag>
+    : detail::offset::offset_range<GeometryOut>
+{};
+
+
+template <typename Geometry, typename GeometryOut>
+struct offset<Geometry, GeometryOut, multi_linestring_tag, multi_linestring_tag>
+    : detail::offset::offset_multi<GeometryOut>
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief \brief_calc{offset curve (a one-sided parallel line)} \brief_strategy
+\ingroup offset
+\details \details_calc{offset, offset curve}. The offset curve is the line
+    at the specified distance to the left (for a positive distance) or to
+    the right (for a negative distance) of a (multi)linestring. It is
+    generated by the side and join strategies of the buffer, but without
+    creating a polygon, and without the union of the buffer. Where the
+    curve crosses itself, at concave bends or where parts of the input are
+    closer to each other than twice the distance, the part which is too
+    close to the input is cut off. The input linestrings should not
+    intersect themselves. Linestrings of a multi-linestring
+    are offsetted independently.
+\note Geographic linestrings may cross the antimeridian, but each of them
+    should span less than 180 degrees of longitude.
+\tparam Geometry \tparam_geometry
+\tparam GeometryOut \tparam_geometry
+\tparam Distance \tparam_numeric
+\tparam SideStrategy A strategy defining creation along sides
+\tparam JoinStrategy A strategy defining creation around convex corners
+\param geometry \param_geometry
+\param geometry_out \param_geometry Output geometry, the offset curve
+\param distance The distance, positive for left and negative for right
+\param side_strategy \param_strategy{side}
+\param join_strategy \param_strategy{join}
+
+\qbk{distinguish,with strategies}
+
+\qbk{
+[heading Available Strategies]
+\* [link geometry.reference.strategies.strategy_buffer_side_straight side_straight]
+\* [link geometry.reference.strategies.strategy_buffer_join_round join_round]
+\* [link geometry.reference.strategies.strategy_buffer_join_miter join_miter]
+}
+ */
+template
+<
+    typename Geometry,
+    typename GeometryOut,
+    typename Distance,
+    typename SideStrategy,
+    typename JoinStrategy
+>
+inline void offset(Geometry const& geometry, GeometryOut& geometry_out,
+                Distance const& distance,
+                SideStrategy const& side_strategy,
+                JoinStrategy const& join_strategy)
+{
+    concepts::check<Geometry const>();
+    concepts::check<GeometryOut>();
+
+    geometry::clear(geometry_out);
+
+    dispatch::offset
+        <
+            Geometry,
+            GeometryOut
+        >::apply(geometry, geometry_out, distance, side_strategy, join_strategy);
+}
+
+
+/*!
+\brief \brief_calc{offset curve (a one-sided parallel line)}
+\ingroup offset
+\details \details_calc{offset, offset curve}, using straight sides and
+    round joins.
+\tparam Geometry \tparam_geometry
+\tparam GeometryOut \tparam_geometry
+\tparam Distance \tparam_numeric
+\param geometry \param_geometry
+\param geometry_out \param_geometry Output geometry, the offset curve
+\param distance The distance, positive for left and negative for right
+ */
+template <typename Geometry, typename GeometryOut, typename Distance>
+inline void offset(Geometry const& geometry, GeometryOut& geometry_out,
+                Distance const& distance)
+{
+    offset(geometry, geometry_out, distance,
+           strategy::buffer::side_straight(),
+           strategy::buffer::join_round());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_OFFSET_HPP
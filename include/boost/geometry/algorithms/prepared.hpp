@@ -0,0 +1,1434 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
+
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/crosses.hpp>
+#include <boost/geometry/algorithms/detail/assign_indexed_point.hpp>
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/prepared/segment_index.hpp>
+#include <boost/geometry/algorithms/detail/relate/de9im.hpp>
+#include <boost/geometry/algorithms/detail/relate/result.hpp>
+#include <boost/geometry/algorithms/detail/relate/topology_check.hpp>
+#include <boost/geometry/algorithms/disjoint.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/algorithms/overlaps.hpp>
+#include <boost/geometry/algorithms/point_on_surface.hpp>
+#include <boost/geometry/algorithms/relate.hpp>
+#include <boost/geometry/algorithms/relation.hpp>
+#include <boost/geometry/algorithms/touches.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/strategies/cartesian/disjoint_box_box.hpp>
+#include <boost/geometry/strategies/cartesian/point_in_point.hpp>
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Geometry with precomputed acceleration data for repeated predicates
+\ingroup geometries
+\details A prepared geometry keeps a copy of the geometry, its envelope and
+    a packed rtree over its segments. Predicates (intersects, disjoint,
+    within, covered_by) taking the prepared geometry as second argument use
+    this index: points
+    are located by counting the crossings of a ray, visiting only the
+    segments crossed by it (logarithmic plus output sensitive, instead of
+    linear in the number of vertices). Linear and polygonal geometries are
+    split where they meet the segments of the index and the parts are
+    located in the same way. For a polygonal geometry, the segments of
+    the index within its envelope are split by it as well, to find holes
+    and gaps of the prepared geometry inside it.
+    Relate and relation locate points in a polygonal prepared geometry with
+    the index. For other geometries they use the index to find out whether
+    the geometries are disjoint, and only then give the result without the
+    original geometry. Touches, crosses, overlaps and equals, and within
+    and covered_by taking the prepared geometry as first argument, check
+    their masks with relate in this way. Boxes in within and covered_by,
+    polygonal geometries within a linear prepared geometry and intersecting
+    geometries in relate and relation are passed on to the algorithms using
+    the original geometry.
+    A prepared geometry is immutable and can be used concurrently by
+    several threads.
+\tparam Geometry \tparam_geometry, linear or polygonal
+\note Only cartesian coordinate systems are supported.
+*/
+template <typename Geometry>
+class prepared
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (util::is_linear<Geometry>::value || util::is_polygonal<Geometry>::value),
+        "The prepared geometry should be linear or polygonal.",
+        Geometry);
+
+public :
+    typedef Geometry geometry_type;
+    typedef typename geometry::point_type<Geometry>::type point_type;
+    typedef detail::prepared::segment_index<point_type> index_type;
+    typedef model::box<point_type> box_type;
+
+    explicit prepared(Geometry const& original)
+        : m_geometry(original)
+        , m_index(original)
+    {}
+
+    inline Geometry const& geometry() const
+    {
+        return m_geometry;
+    }
+
+    inline index_type const& segment_index() const
+    {
+        return m_index;
+    }
+
+    inline box_type const& envelope() const
+    {
+        return m_index.envelope();
+    }
+
+    /*!
+    \brief Locates a point
+    \return 1 if the point is in the interior, 0 if it is on the boundary,
+        -1 if it is in the exterior (for linear geometries: 0 if the point
+        is on one of the segments, -1 otherwise)
+    */
+    template <typename Point>
+    inline int locate(Point const& point) const
+    {
+        return util::is_polygonal<Geometry>::value
+            ? m_index.locate(point)
+            : (m_index.on_segment(point) ? 0 : -1);
+    }
+
+private :
+    Geometry m_geometry;
+    index_type m_index;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+
+template <typename Geometry, typename Prepared>
+inline bool any_segment_intersects(Geometry const& geometry1,
+                                   Prepared const& geometry2)
+{
+    typedef typename Prepared::index_type::segment_type segment_type;
+
+    return geometry::any_segment_of(geometry1, [&](auto const& s)
+    {
+        segment_type segment;
+        detail::assign_point_from_index<0>(s, segment.first);
+        detail::assign_point_from_index<1>(s, segment.second);
+        return geometry2.segment_index().intersects_segment(segment);
+    });
+}
+
+// For any range (for polygons: the exterior ring) of geometry1,
+// a point on it is located in the prepared geometry
+template <typename Geometry, typename Prepared>
+inline bool any_range_located(Geometry const& geometry1,
+                              Prepared const& geometry2)
+{
+    return geometry::detail::any_range_of(geometry1, [&](auto const& range)
+    {
+        typename Prepared::point_type point;
+        return geometry::point_on_border(point, range)
+            && geometry2.locate(point) >= 0;
+    });
+}
+
+// For any range of the prepared geometry, a point on it is covered by geometry1
+template <typename Geometry, typename Prepared>
+inline bool any_range_covered_by(Geometry const& geometry1,
+                                 Prepared const& geometry2)
+{
+    return geometry::detail::any_range_of(geometry2.geometry(),
+        [&](auto const& range)
+        {
+            typename Prepared::point_type point;
+            return geometry::point_on_border(point, range)
+                && geometry::covered_by(point, geometry1);
+        });
+}
+
+template <typename Geometry, typename Prepared>
+inline bool envelopes_disjoint(Geometry const& geometry1,
+                               Prepared const& geometry2)
+{
+    typename Prepared::box_type box;
+    geometry::envelope(geometry1, box);
+    return strategy::disjoint::cartesian_box_box::apply(box,
+                geometry2.envelope());
+}
+
+template <typename Geometry, typename Prepared>
+inline bool envelope_covered_by(Geometry const& geometry1,
+                                Prepared const& geometry2)
+{
+    typename Prepared::box_type box;
+    geometry::envelope(geometry1, box);
+    return geometry::covered_by(box, geometry2.envelope());
+}
+
+
+template
+<
+    typename Geometry,
+    typename Tag = std::conditional_t
+        <
+            util::is_box<Geometry>::value,
+            box_tag,
+            typename tag_cast
+                <
+                    typename tag<Geometry>::type,
+                    pointlike_tag, linear_tag, areal_tag
+                >::type
+        >
+>
+struct intersects
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2)
+    {
+        return geometry::intersects(geometry1, geometry2.geometry());
+    }
+};
+
+template <typename Geometry>
+struct intersects<Geometry, pointlike_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2)
+    {
+        return geometry::any_point_of(geometry1, [&](auto const& point)
+        {
+            return geometry2.locate(point) >= 0;
+        });
+    }
+};
+
+template <typename Geometry>
+struct intersects<Geometry, linear_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2)
+    {
+        if (envelopes_disjoint(geometry1, geometry2))
+        {
+            return false;
+        }
+        if (any_segment_intersects(geometry1, geometry2))
+        {
+            return true;
+        }
+        // No segments are intersecting. Only for a polygonal prepared
+        // geometry, (a part of) geometry1 can be inside it.
+        return util::is_polygonal<typename Prepared::geometry_type>::value
+            && any_range_located(geometry1, geometry2);
+    }
+};
+
+template <typename Geometry>
+struct intersects<Geometry, areal_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2)
+    {
+        if (envelopes_disjoint(geometry1, geometry2))
+        {
+            return false;
+        }
+        if (any_segment_intersects(geometry1, geometry2))
+        {
+            return true;
+        }
+        // No segments are intersecting, one can be inside the other
+        return any_range_located(geometry1, geometry2)
+            || any_range_covered_by(geometry1, geometry2);
+    }
+};
+
+template <typename Box>
+struct intersects<Box, box_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Box const& box, Prepared const& geometry2)
+    {
+        if (strategy::disjoint::cartesian_box_box::apply(box, geometry2.envelope()))
+        {
+            return false;
+        }
+        if (geometry2.segment_index().intersects(box))
+        {
+            return true;
+        }
+        // No segments are intersecting, one can be inside the other
+        typename Prepared::point_type corner;
+        geometry::detail::assign_point_from_index<0>(box, corner);
+        return geometry2.locate(corner) >= 0
+            || any_range_covered_by(box, geometry2);
+    }
+};
+
+
+// Splits the segment p-q where other segments, added one by one, meet it.
+// Parts are visited by their middle, parts overlapping one of the added
+// segments are marked as such (their middle could be beside it because of
+// rounding).
+template <typename Point>
+class segment_splitter
+{
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calc_t;
+    typedef strategy::side::side_by_triangle<> side_strategy;
+
+public :
+    segment_splitter(Point const& p, Point const& q)
+        : m_p(p)
+        , m_q(q)
+        , m_px(get<0>(p))
+        , m_py(get<1>(p))
+        , m_dx(calc_t(get<0>(q)) - m_px)
+        , m_dy(calc_t(get<1>(q)) - m_py)
+        , m_length2(m_dx * m_dx + m_dy * m_dy)
+    {
+        m_fractions.push_back(0);
+        m_fractions.push_back(1);
+    }
+
+    inline bool degenerate() const
+    {
+        return m_length2 == 0;
+    }
+
+    template <typename OtherPoint>
+    inline void add(OtherPoint const& a, OtherPoint const& b)
+    {
+        int const side_a = side_strategy::apply(m_p, m_q, a);
+        int const side_b = side_strategy::apply(m_p, m_q, b);
+        if (side_a == 0 && side_b == 0)
+        {
+            calc_t const fa = fraction(a);
+            calc_t const fb = fraction(b);
+            m_fractions.push_back(fa);
+            m_fractions.push_back(fb);
+            m_overlaps.push_back(std::make_pair((std::min)(fa, fb),
+                                                (std::max)(fa, fb)));
+        }
+        else if (side_a == 0)
+        {
+            m_fractions.push_back(fraction(a));
+        }
+        else if (side_b == 0)
+        {
+            m_fractions.push_back(fraction(b));
+        }
+        else if (side_a != side_b)
+        {
+            // Crossing the line, the sides differ so the segments are not
+            // parallel. If a-b does not reach p-q, the fraction is clamped.
+            int const side_p = side_strategy::apply(a, b, m_p);
+            int const side_q = side_strategy::apply(a, b, m_q);
+            if (side_p != 0 && side_p == side_q)
+            {
+                return;
+            }
+            calc_t const ex = calc_t(get<0>(b)) - get<0>(a);
+            calc_t const ey = calc_t(get<1>(b)) - get<1>(a);
+            calc_t const f = ((get<0>(a) - m_px) * ey - (get<1>(a) - m_py) * ex)
+                           / (m_dx * ey - m_dy * ex);
+            m_fractions.push_back(clamp(f));
+        }
+    }
+
+    // Calls visit(middle, overlapping) for the parts, until it returns false
+    template <typename Visitor>
+    inline bool all_parts(Visitor const& visit)
+    {
+        std::sort(m_fractions.begin(), m_fractions.end());
+
+        // An intersection point calculated twice, once for each segment
+        // meeting there, can result in two fractions differing by some
+        // rounding errors. The part in between is not visited, its middle
+        // could be on either side.
+        calc_t const min_part = 16 * std::numeric_limits<calc_t>::epsilon();
+
+        for (std::size_t i = 1; i < m_fractions.size(); i++)
+        {
+            calc_t const f0 = m_fractions[i - 1];
+            calc_t const f1 = m_fractions[i];
+            if (f1 - f0 <= min_part)
+            {
+                continue;
+            }
+
+            calc_t const middle = (f0 + f1) / 2;
+            bool const overlapping = std::any_of(m_overlaps.begin(), m_overlaps.end(),
+                [&](std::pair<calc_t, calc_t> const& o)
+                {
+                    return o.first <= middle && middle <= o.second;
+                });
+
+            Point point;
+            set<0>(point, m_px + middle * m_dx);
+            set<1>(point, m_py + middle * m_dy);
+            if (! visit(point, overlapping))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private :
+    static inline calc_t clamp(calc_t f)
+    {
+        return (std::min)((std::max)(f, calc_t(0)), calc_t(1));
+    }
+
+    // The fraction of the projection of a point on the segment
+    template <typename OtherPoint>
+    inline calc_t fraction(OtherPoint const& point) const
+    {
+        return clamp(((get<0>(point) - m_px) * m_dx
+                    + (get<1>(point) - m_py) * m_dy) / m_length2);
+    }
+
+    Point m_p;
+    Point m_q;
+    calc_t m_px, m_py, m_dx, m_dy, m_length2;
+    std::vector<calc_t> m_fractions;
+    std::vector<std::pair<calc_t, calc_t> > m_overlaps;
+};
+
+// Calls visit(location) for the parts of the segment p-q between its
+// intersections with the segments of the prepared geometry, until it returns
+// false. A part is located by its middle, with the convention of locate().
+// Parts overlapping segments of the prepared geometry are on its boundary
+// (or on the linear geometry) without locating them. Other parts of a segment
+// can not be on a linear prepared geometry.
+template <typename Point, typename Prepared, typename Visitor>
+inline bool all_parts_of_segment(Point const& p, Point const& q,
+                                 Prepared const& geometry2,
+                                 Visitor const& visit)
+{
+    typedef typename Prepared::point_type point_type;
+    typedef typename Prepared::index_type::segment_type segment_type;
+    typedef typename Prepared::index_type::rtree_type rtree_type;
+
+    point_type p2, q2;
+    geometry::convert(p, p2);
+    geometry::convert(q, q2);
+
+    segment_splitter<point_type> splitter(p2, q2);
+    if (splitter.degenerate())
+    {
+        return visit(geometry2.locate(p2));
+    }
+
+    rtree_type const& rtree = geometry2.segment_index().rtree();
+    segment_type const segment(p2, q2);
+    for (typename rtree_type::const_query_iterator it
+            = rtree.qbegin(index::intersects(segment));
+         it != rtree.qend(); ++it)
+    {
+        splitter.add(it->first, it->second);
+    }
+
+    return splitter.all_parts([&](point_type const& middle, bool overlapping)
+    {
+        if (overlapping)
+        {
+            return visit(0);
+        }
+        return visit(util::is_polygonal<typename Prepared::geometry_type>::value
+                     ? geometry2.locate(middle)
+                     : -1);
+    });
+}
+
+// Returns true if a part of a segment of the prepared geometry is in the
+// interior of the polygonal geometry1. The segments of geometry1 are indexed
+// once. Only the segments of the prepared geometry in its envelope are
+// visited, each is split by the segments of geometry1 overlapping its box,
+// and the parts are located with that index.
+template <typename Geometry, typename Prepared>
+inline bool any_prepared_segment_inside(Geometry const& geometry1,
+                                        Prepared const& geometry2)
+{
+    typedef typename Prepared::point_type point_type;
+    typedef typename Prepared::box_type box_type;
+    typedef typename Prepared::index_type index_type;
+    typedef typename index_type::rtree_type rtree_type;
+
+    index_type const index1(geometry1);
+    rtree_type const& rtree1 = index1.rtree();
+    rtree_type const& rtree2 = geometry2.segment_index().rtree();
+    for (typename rtree_type::const_query_iterator it
+            = rtree2.qbegin(index::intersects(index1.envelope()));
+         it != rtree2.qend(); ++it)
+    {
+        segment_splitter<point_type> splitter(it->first, it->second);
+        box_type segment_box;
+        geometry::envelope(*it, segment_box);
+        for (typename rtree_type::const_query_iterator it1
+                = rtree1.qbegin(index::intersects(segment_box));
+             it1 != rtree1.qend(); ++it1)
+        {
+            splitter.add(it1->first, it1->second);
+        }
+
+        bool const outside = splitter.all_parts(
+            [&](point_type const& middle, bool overlapping)
+            {
+                return overlapping || index1.locate(middle) <= 0;
+            });
+        if (! outside)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Calls f(polygon) for the polygons of a polygonal geometry, until it
+// returns false
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct all_polygons_of
+{};
+
+template <typename Ring>
+struct all_polygons_of<Ring, ring_tag>
+{
+    template <typename Function>
+    static inline bool apply(Ring const& ring, Function const& f)
+    {
+        return f(ring);
+    }
+};
+
+template <typename Polygon>
+struct all_polygons_of<Polygon, polygon_tag>
+    : all_polygons_of<Polygon, ring_tag>
+{};
+
+template <typename MultiPolygon>
+struct all_polygons_of<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Function>
+    static inline bool apply(MultiPolygon const& multi_polygon, Function const& f)
+    {
+        return std::all_of(boost::begin(multi_polygon), boost::end(multi_polygon), f);
+    }
+};
+
+// Linear geometry1 with a covered boundary: it intersects the interior if
+// one of its parts did
+template <typename Geometry, typename Prepared>
+inline int locate_interior(Geometry const& , Prepared const& , bool interior,
+                           std::false_type)
+{
+    return interior ? 1 : 0;
+}
+
+// Polygonal geometry1 with a covered boundary
+template <typename Geometry, typename Prepared>
+inline int locate_interior(Geometry const& geometry1, Prepared const& geometry2,
+                           bool , std::true_type)
+{
+    typedef typename Prepared::point_type point_type;
+
+    // The exterior of the prepared geometry can still be inside geometry1:
+    // a hole, or a gap between its polygons. Then a part of its boundary is
+    // inside geometry1.
+    if (any_prepared_segment_inside(geometry1, geometry2))
+    {
+        return -1;
+    }
+
+    // Otherwise the interior of each polygon of geometry1 is either
+    // completely inside or completely outside the prepared geometry,
+    // even if its boundary is completely on the boundary of the prepared
+    // geometry.
+    bool const inside = all_polygons_of<Geometry>::apply(geometry1,
+        [&](auto const& polygon)
+        {
+            if (geometry::is_empty(polygon))
+            {
+                return true;
+            }
+            point_type point;
+            geometry::point_on_surface(polygon, point);
+            return geometry2.locate(point) > 0;
+        });
+
+    return inside ? 1 : -1;
+}
+
+// Returns 1 if geometry1 is covered by the prepared geometry and intersects
+// its interior, 0 if it is covered and only intersects its boundary (for a
+// linear prepared geometry: if it is covered), and -1 if it is not covered.
+template <typename Geometry, typename Prepared>
+inline int locate_parts(Geometry const& geometry1, Prepared const& geometry2)
+{
+    typedef typename Prepared::point_type point_type;
+
+    bool interior = false;
+    bool const covered = geometry::all_segments_of(geometry1,
+        [&](auto const& s)
+        {
+            point_type p, q;
+            detail::assign_point_from_index<0>(s, p);
+            detail::assign_point_from_index<1>(s, q);
+            return all_parts_of_segment(p, q, geometry2, [&](int location)
+            {
+                interior = interior || location > 0;
+                return location >= 0;
+            });
+        });
+
+    return covered
+        ? locate_interior(geometry1, geometry2, interior,
+                          util::is_polygonal<Geometry>())
+        : -1;
+}
+
+// Linear geometries and polygonal geometries in a polygonal prepared geometry
+template <typename Geometry, typename Prepared>
+struct is_located_by_parts
+    : std::integral_constant
+        <
+            bool,
+            util::is_linear<Geometry>::value
+            || (util::is_polygonal<Geometry>::value
+                && util::is_polygonal<typename Prepared::geometry_type>::value)
+        >
+{};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct covered_by
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2)
+    {
+        return apply(geometry1, geometry2,
+                     is_located_by_parts<Geometry, Prepared>());
+    }
+
+private :
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2,
+                             std::true_type)
+    {
+        if (geometry::is_empty(geometry1))
+        {
+            return geometry::covered_by(geometry1, geometry2.geometry());
+        }
+        return envelope_covered_by(geometry1, geometry2)
+            && locate_parts(geometry1, geometry2) >= 0;
+    }
+
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2,
+                             std::false_type)
+    {
+        return envelope_covered_by(geometry1, geometry2)
+            && geometry::covered_by(geometry1, geometry2.geometry());
+    }
+};
+
+template <typename Point>
+struct covered_by<Point, point_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Point const& point, Prepared const& geometry2)
+    {
+        return geometry2.locate(point) >= 0;
+    }
+};
+
+template <typename MultiPoint>
+struct covered_by<MultiPoint, multi_point_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(MultiPoint const& multi_point, Prepared const& geometry2)
+    {
+        return geometry::all_points_of(multi_point, [&](auto const& point)
+        {
+            return geometry2.locate(point) >= 0;
+        });
+    }
+};
+
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct within
+{
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2)
+    {
+        return apply(geometry1, geometry2,
+                     is_located_by_parts<Geometry, Prepared>());
+    }
+
+private :
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2,
+                             std::true_type)
+    {
+        if (geometry::is_empty(geometry1))
+        {
+            return geometry::within(geometry1, geometry2.geometry());
+        }
+        if (! envelope_covered_by(geometry1, geometry2))
+        {
+            return false;
+        }
+        // Within a polygonal geometry, the interiors should intersect. A
+        // covered linear geometry always intersects the interior of a linear
+        // prepared geometry, its boundary consists of points.
+        int const location = locate_parts(geometry1, geometry2);
+        return util::is_polygonal<typename Prepared::geometry_type>::value
+            ? location > 0
+            : location >= 0;
+    }
+
+    template <typename Prepared>
+    static inline bool apply(Geometry const& geometry1, Prepared const& geometry2,
+                             std::false_type)
+    {
+        return envelope_covered_by(geometry1, geometry2)
+            && geometry::within(geometry1, geometry2.geometry());
+    }
+};
+
+template <typename Point>
+struct within<Point, point_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(Point const& point, Prepared const& geometry2)
+    {
+        if (util::is_polygonal<typename Prepared::geometry_type>::value)
+        {
+            return geometry2.locate(point) > 0;
+        }
+        // A point on a linestring can still be on its boundary
+        return geometry2.locate(point) >= 0
+            && geometry::within(point, geometry2.geometry());
+    }
+};
+
+template <typename MultiPoint>
+struct within<MultiPoint, multi_point_tag>
+{
+    template <typename Prepared>
+    static inline bool apply(MultiPoint const& multi_point, Prepared const& geometry2)
+    {
+        if (! util::is_polygonal<typename Prepared::geometry_type>::value)
+        {
+            return geometry::within(multi_point, geometry2.geometry());
+        }
+
+        // All points should be covered, at least one in the interior
+        bool has_interior = false;
+        bool const all_covered = geometry::all_points_of(multi_point,
+            [&](auto const& point)
+            {
+                int const location = geometry2.locate(point);
+                has_interior = has_interior || location > 0;
+                return location >= 0;
+            });
+        return all_covered && has_interior;
+    }
+};
+
+
+// The dimensions of the interior and the boundary of a geometry,
+// see detail::relate::topology_check
+template
+<
+    typename Geometry,
+    typename Tag = typename tag_cast
+        <
+            typename tag<Geometry>::type,
+            pointlike_tag, linear_tag, areal_tag
+        >::type
+>
+struct topology
+{
+    static const char interior = '0';
+    static const char boundary = 'F';
+
+    explicit topology(Geometry const& geometry)
+        : m_empty(geometry::is_empty(geometry))
+    {}
+
+    bool has_interior() const { return ! m_empty; }
+    bool has_boundary() const { return false; }
+
+private :
+    bool m_empty;
+};
+
+template <typename Geometry>
+struct topology<Geometry, linear_tag>
+    : detail::relate::topology_check
+        <
+            Geometry, strategy::within::cartesian_point_point
+        >
+{
+    explicit topology(Geometry const& geometry)
+        : detail::relate::topology_check
+            <
+                Geometry, strategy::within::cartesian_point_point
+            >(geometry)
+    {}
+};
+
+template <typename Geometry>
+struct topology<Geometry, areal_tag>
+{
+    static const char interior = '2';
+    static const char boundary = '1';
+
+    explicit topology(Geometry const& geometry)
+        : m_empty(geometry::is_empty(geometry))
+    {}
+
+    bool has_interior() const { return ! m_empty; }
+    bool has_boundary() const { return ! m_empty; }
+
+private :
+    bool m_empty;
+};
+
+template <bool Transpose, typename Geometry, typename Handler>
+inline void set_exterior(Geometry const& geometry, Handler & handler)
+{
+    typedef topology<Geometry> topology_type;
+    topology_type const topo(geometry);
+    if (topo.has_interior())
+    {
+        detail::relate::set
+            <
+                detail::relate::interior, detail::relate::exterior,
+                topology_type::interior, Transpose
+            >(handler);
+    }
+    if (topo.has_boundary())
+    {
+        detail::relate::set
+            <
+                detail::relate::boundary, detail::relate::exterior,
+                topology_type::boundary, Transpose
+            >(handler);
+    }
+}
+
+// Sets the result of relate for disjoint geometries: only the exteriors
+// intersect the other geometry
+template <bool Transpose, typename Geometry, typename Original, typename Handler>
+inline void set_disjoint(Geometry const& geometry1, Original const& geometry2,
+                         Handler & handler)
+{
+    set_exterior<Transpose>(geometry1, handler);
+    set_exterior<! Transpose>(geometry2, handler);
+    detail::relate::set
+        <
+            detail::relate::exterior, detail::relate::exterior,
+            detail::relate::result_dimension<Geometry>::value
+        >(handler);
+}
+
+// Calculates the result of relate with the original geometry
+template <typename Geometry, typename Original, typename Handler>
+inline void relate_original(Geometry const& geometry1, Original const& geometry2,
+                            Handler & handler, std::false_type)
+{
+    geometry::resolve_strategy::relate::apply(geometry1, geometry2, handler,
+                                              default_strategy());
+}
+
+template <typename Geometry, typename Original, typename Handler>
+inline void relate_original(Geometry const& geometry1, Original const& geometry2,
+                            Handler & handler, std::true_type)
+{
+    geometry::resolve_strategy::relate::apply(geometry2, geometry1, handler,
+                                              default_strategy());
+}
+
+// Fills the handler of relate for geometry1 and the prepared geometry, or
+// (if Transpose is true) for the prepared geometry and geometry1. If the
+// index shows that the geometries are disjoint, the result is set without
+// the original geometry, otherwise it is calculated with it.
+template
+<
+    typename Geometry,
+    bool Transpose,
+    typename Tag = typename tag_cast
+        <
+            typename tag<Geometry>::type,
+            pointlike_tag
+        >::type
+>
+struct relate
+{
+    template <typename Prepared, typename Handler>
+    static inline void apply(Geometry const& geometry1, Prepared const& geometry2,
+                             Handler & handler)
+    {
+        if (! intersects<Geometry>::apply(geometry1, geometry2))
+        {
+            set_disjoint<Transpose>(geometry1, geometry2.geometry(), handler);
+            return;
+        }
+        relate_original(geometry1, geometry2.geometry(), handler,
+                        std::integral_constant<bool, Transpose>());
+    }
+};
+
+// Points in a polygonal prepared geometry are located with the index, as
+// point_geometry does. The interior and the boundary of the prepared
+// geometry always intersect the exterior of the points.
+template <typename Geometry, bool Transpose>
+struct relate<Geometry, Transpose, pointlike_tag>
+{
+    template <typename Prepared, typename Handler>
+    static inline void apply(Geometry const& geometry1, Prepared const& geometry2,
+                             Handler & handler)
+    {
+        apply(geometry1, geometry2, handler,
+              util::is_polygonal<typename Prepared::geometry_type>());
+    }
+
+private :
+    template <typename Prepared, typename Handler>
+    static inline void apply(Geometry const& geometry1, Prepared const& geometry2,
+                             Handler & handler, std::true_type)
+    {
+        using detail::relate::interior;
+        using detail::relate::boundary;
+        using detail::relate::exterior;
+
+        geometry::all_points_of(geometry1, [&](auto const& point)
+        {
+            int const location = geometry2.locate(point);
+            if (location > 0)
+            {
+                detail::relate::set<interior, interior, '0', Transpose>(handler);
+            }
+            else if (location == 0)
+            {
+                detail::relate::set<interior, boundary, '0', Transpose>(handler);
+            }
+            else
+            {
+                detail::relate::set<interior, exterior, '0', Transpose>(handler);
+            }
+            return ! handler.interrupt;
+        });
+
+        set_exterior<! Transpose>(geometry2.geometry(), handler);
+        detail::relate::set
+            <
+                exterior, exterior,
+                detail::relate::result_dimension<Geometry>::value
+            >(handler);
+    }
+
+    // For a linear prepared geometry, points can be on its boundary
+    template <typename Prepared, typename Handler>
+    static inline void apply(Geometry const& geometry1, Prepared const& geometry2,
+                             Handler & handler, std::false_type)
+    {
+        relate<Geometry, Transpose, void>::apply(geometry1, geometry2, handler);
+    }
+};
+
+// Checks the mask for geometry1 and the prepared geometry
+template <typename Geometry, typename Prepared, typename Mask>
+inline bool relate_mask(Geometry const& geometry1, Prepared const& geometry2,
+                        Mask const& mask)
+{
+    typename detail::relate::result_handler_type
+        <
+            Geometry, typename Prepared::geometry_type, Mask
+        >::type handler(mask);
+    relate<Geometry, false>::apply(geometry1, geometry2, handler);
+    return handler.result();
+}
+
+// Predicates defined by a static mask can be false for the dimensions of
+// the geometries, without calculating anything
+template <typename Geometry, typename Prepared>
+inline bool relate_mask(Geometry const& , Prepared const& ,
+                        detail::relate::false_mask)
+{
+    return false;
+}
+
+// Checks the mask for the prepared geometry and geometry2
+template <typename Prepared, typename Geometry, typename Mask>
+inline bool relate_mask_reversed(Prepared const& geometry1,
+                                 Geometry const& geometry2,
+                                 Mask const& mask)
+{
+    typename detail::relate::result_handler_type
+        <
+            typename Prepared::geometry_type, Geometry, Mask
+        >::type handler(mask);
+    relate<Geometry, true>::apply(geometry2, geometry1, handler);
+    return handler.result();
+}
+
+template <typename Prepared, typename Geometry>
+inline bool relate_mask_reversed(Prepared const& , Geometry const& ,
+                                 detail::relate::false_mask)
+{
+    return false;
+}
+
+template <typename Geometry, typename Prepared>
+inline geometry::de9im::matrix relation(Geometry const& geometry1,
+                                        Prepared const& geometry2)
+{
+    typename detail::relate::result_handler_type
+        <
+            Geometry, typename Prepared::geometry_type, geometry::de9im::matrix
+        >::type handler;
+    relate<Geometry, false>::apply(geometry1, geometry2, handler);
+    return handler.result();
+}
+
+template <typename Prepared, typename Geometry>
+inline geometry::de9im::matrix relation_reversed(Prepared const& geometry1,
+                                                 Geometry const& geometry2)
+{
+    typename detail::relate::result_handler_type
+        <
+            typename Prepared::geometry_type, Geometry, geometry::de9im::matrix
+        >::type handler;
+    relate<Geometry, true>::apply(geometry2, geometry1, handler);
+    return handler.result();
+}
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief \brief_check2{intersect}, the second being prepared
+\ingroup intersects
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 Prepared geometry
+\return \return_check2{intersect}
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool intersects(Geometry1 const& geometry1,
+                       prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::intersects<Geometry1>::apply(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool intersects(prepared<Geometry1> const& geometry1,
+                       Geometry2 const& geometry2)
+{
+    return detail::prepared::intersects<Geometry2>::apply(geometry2, geometry1);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool intersects(prepared<Geometry1> const& geometry1,
+                       prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::intersects<Geometry1>::apply(geometry1.geometry(),
+                                                          geometry2);
+}
+
+
+/*!
+\brief \brief_check2{are disjoint}, one or both being prepared
+\ingroup disjoint
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 Prepared geometry
+\return \return_check2{are disjoint}
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool disjoint(Geometry1 const& geometry1,
+                     prepared<Geometry2> const& geometry2)
+{
+    return ! geometry::intersects(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool disjoint(prepared<Geometry1> const& geometry1,
+                     Geometry2 const& geometry2)
+{
+    return ! geometry::intersects(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool disjoint(prepared<Geometry1> const& geometry1,
+                     prepared<Geometry2> const& geometry2)
+{
+    return ! geometry::intersects(geometry1, geometry2);
+}
+
+
+/*!
+\brief \brief_check12{is completely inside}, one or both being prepared
+\ingroup within
+\details If the first geometry is prepared, the index is only used to find
+    out whether the geometries are disjoint.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry which might be within the second geometry
+\param geometry2 Prepared geometry which might contain the first geometry
+\return true if geometry1 is completely contained within geometry2,
+    else false
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool within(Geometry1 const& geometry1,
+                   prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::within<Geometry1>::apply(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool within(prepared<Geometry1> const& geometry1,
+                   Geometry2 const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_within_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2,
+                                                  mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool within(prepared<Geometry1> const& geometry1,
+                   prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::within<Geometry1>::apply(geometry1.geometry(),
+                                                      geometry2);
+}
+
+
+/*!
+\brief \brief_check12{is inside or on border}, one or both being prepared
+\ingroup covered_by
+\details If the first geometry is prepared, the index is only used to find
+    out whether the geometries are disjoint.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry which might be covered by the second geometry
+\param geometry2 Prepared geometry which might cover the first geometry
+\return true if geometry1 is inside of or on the border of geometry2,
+    else false
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool covered_by(Geometry1 const& geometry1,
+                       prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::covered_by<Geometry1>::apply(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool covered_by(prepared<Geometry1> const& geometry1,
+                       Geometry2 const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_covered_by_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2,
+                                                  mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool covered_by(prepared<Geometry1> const& geometry1,
+                       prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::covered_by<Geometry1>::apply(geometry1.geometry(),
+                                                          geometry2);
+}
+
+
+/*!
+\brief \brief_check2{have at least one touching point (tangent - non overlapping)},
+    one or both being prepared
+\ingroup touches
+\details The mask of touches is checked with relate.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 Prepared geometry
+\return \return_check2{touch each other}
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool touches(Geometry1 const& geometry1,
+                    prepared<Geometry2> const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_touches_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask(geometry1, geometry2, mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool touches(prepared<Geometry1> const& geometry1,
+                    Geometry2 const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_touches_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2,
+                                                  mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool touches(prepared<Geometry1> const& geometry1,
+                    prepared<Geometry2> const& geometry2)
+{
+    return geometry::touches(geometry1.geometry(), geometry2);
+}
+
+
+/*!
+\brief \brief_check2{crosses}, one or both being prepared
+\ingroup crosses
+\details The mask of crosses is checked with relate.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 Prepared geometry
+\return \return_check2{crosses}
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool crosses(Geometry1 const& geometry1,
+                    prepared<Geometry2> const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_crosses_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask(geometry1, geometry2, mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool crosses(prepared<Geometry1> const& geometry1,
+                    Geometry2 const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_crosses_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2,
+                                                  mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool crosses(prepared<Geometry1> const& geometry1,
+                    prepared<Geometry2> const& geometry2)
+{
+    return geometry::crosses(geometry1.geometry(), geometry2);
+}
+
+
+/*!
+\brief \brief_check2{overlap}, one or both being prepared
+\ingroup overlaps
+\details The mask of overlaps is checked with relate.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 Prepared geometry
+\return \return_check2{overlap}
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool overlaps(Geometry1 const& geometry1,
+                     prepared<Geometry2> const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_overlaps_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask(geometry1, geometry2, mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool overlaps(prepared<Geometry1> const& geometry1,
+                     Geometry2 const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_overlaps_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2,
+                                                  mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool overlaps(prepared<Geometry1> const& geometry1,
+                     prepared<Geometry2> const& geometry2)
+{
+    return geometry::overlaps(geometry1.geometry(), geometry2);
+}
+
+
+/*!
+\brief \brief_check{are spatially equal}, one or both being prepared
+\ingroup equals
+\details The mask of equals is checked with relate.
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\param geometry1 \param_geometry
+\param geometry2 Prepared geometry
+\return \return_check2{are spatially equal}
+*/
+template <typename Geometry1, typename Geometry2>
+inline bool equals(Geometry1 const& geometry1,
+                   prepared<Geometry2> const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_equals_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask(geometry1, geometry2, mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool equals(prepared<Geometry1> const& geometry1,
+                   Geometry2 const& geometry2)
+{
+    typedef typename detail::de9im::static_mask_equals_type
+        <
+            Geometry1, Geometry2
+        >::type mask_type;
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2,
+                                                  mask_type());
+}
+
+template <typename Geometry1, typename Geometry2>
+inline bool equals(prepared<Geometry1> const& geometry1,
+                   prepared<Geometry2> const& geometry2)
+{
+    return geometry::equals(geometry1.geometry(), geometry2);
+}
+
+
+/*!
+\brief Checks relation between a geometry and a prepared geometry
+\ingroup relate
+\details Points and multi points are located in a polygonal prepared
+    geometry with its index. Otherwise, if the index shows that the
+    geometries are disjoint, the mask is checked without the original
+    geometry, else the original geometry is used.
+*/
+template <typename Geometry1, typename Geometry2, typename Mask>
+inline bool relate(Geometry1 const& geometry1,
+                   prepared<Geometry2> const& geometry2,
+                   Mask const& mask)
+{
+    return detail::prepared::relate_mask(geometry1, geometry2, mask);
+}
+
+template <typename Geometry1, typename Geometry2, typename Mask>
+inline bool relate(prepared<Geometry1> const& geometry1,
+                   Geometry2 const& geometry2,
+                   Mask const& mask)
+{
+    return detail::prepared::relate_mask_reversed(geometry1, geometry2, mask);
+}
+
+template <typename Geometry1, typename Geometry2, typename Mask>
+inline bool relate(prepared<Geometry1> const& geometry1,
+                   prepared<Geometry2> const& geometry2,
+                   Mask const& mask)
+{
+    return detail::prepared::relate_mask(geometry1.geometry(), geometry2, mask);
+}
+
+
+/*!
+\brief Calculates the relation between a geometry and a prepared geometry
+\ingroup relation
+\details Points and multi points are located in a polygonal prepared
+    geometry with its index. Otherwise, if the index shows that the
+    geometries are disjoint, the matrix is calculated without the original
+    geometry, else the original geometry is used.
+*/
+template <typename Geometry1, typename Geometry2>
+inline de9im::matrix relation(Geometry1 const& geometry1,
+                              prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::relation(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline de9im::matrix relation(prepared<Geometry1> const& geometry1,
+                              Geometry2 const& geometry2)
+{
+    return detail::prepared::relation_reversed(geometry1, geometry2);
+}
+
+template <typename Geometry1, typename Geometry2>
+inline de9im::matrix relation(prepared<Geometry1> const& geometry1,
+                              prepared<Geometry2> const& geometry2)
+{
+    return detail::prepared::relation(geometry1.geometry(), geometry2);
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_HPP
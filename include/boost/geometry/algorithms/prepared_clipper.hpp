@@ -0,0 +1,194 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_PREPARED_CLIPPER_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_PREPARED_CLIPPER_HPP
+
+
+#include <cstddef>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/detail/point_on_border.hpp>
+#include <boost/geometry/algorithms/detail/tupled_output.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/prepared.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/strategies/cartesian/disjoint_box_box.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/type_traits.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace prepared
+{
+
+template <typename Geometry, bool IsMulti = util::is_multi<Geometry>::value>
+struct append_as_is
+{
+    template <typename GeometryOut>
+    static inline void apply(Geometry const& geometry, GeometryOut& out)
+    {
+        typename output_geometry_value<GeometryOut>::type single;
+        geometry::convert(geometry, single);
+        range::push_back(out, single);
+    }
+};
+
+template <typename Geometry>
+struct append_as_is<Geometry, true>
+{
+    template <typename GeometryOut>
+    static inline void apply(Geometry const& geometry, GeometryOut& out)
+    {
+        for (auto it = boost::begin(geometry); it != boost::end(geometry); ++it)
+        {
+            append_as_is
+                <
+                    typename boost::range_value<Geometry>::type
+                >::apply(*it, out);
+        }
+    }
+};
+
+}} // namespace detail::prepared
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Clips many geometries against one and the same areal geometry
+\ingroup intersection
+\details The clip geometry is prepared once (see prepared): its envelope is
+    calculated and its segments are stored in a packed rtree. For every clipped geometry
+    this index is queried first. If no segment of the clip geometry comes
+    near the envelope of the input, the input is either completely inside
+    (and appended to the output as is) or completely outside (and skipped),
+    which is decided by a point location using the same index. Only inputs
+    really crossing the boundary are passed to geometry::intersection.
+    This is typically the case for a minority of features, for example
+    when generating vector tiles.
+    The clipper is immutable after construction and can be used by several
+    threads concurrently.
+\tparam ClipGeometry \tparam_geometry, polygonal
+\note Only cartesian coordinate systems are supported.
+*/
+template <typename ClipGeometry>
+class prepared_clipper
+{
+    BOOST_GEOMETRY_STATIC_ASSERT((util::is_polygonal<ClipGeometry>::value),
+        "The clip geometry should be a ring, polygon or multi_polygon.",
+        ClipGeometry);
+
+    typedef prepared<ClipGeometry> prepared_type;
+    typedef typename prepared_type::point_type point_type;
+
+public :
+    typedef typename prepared_type::box_type box_type;
+
+    explicit prepared_clipper(ClipGeometry const& clip)
+        : m_clip(clip)
+    {}
+
+    inline ClipGeometry const& clip_geometry() const
+    {
+        return m_clip.geometry();
+    }
+
+    inline prepared_type const& prepared_clip() const
+    {
+        return m_clip;
+    }
+
+    inline box_type const& envelope() const
+    {
+        return m_clip.envelope();
+    }
+
+    /*!
+    \brief Appends the intersection of geometry with the clip geometry
+        to geometry_out
+    \tparam Geometry \tparam_geometry, linear or areal
+    \tparam GeometryOut Collection of geometries (e.g. std::vector,
+        std::deque, boost::geometry::multi*)
+    */
+    template <typename Geometry, typename GeometryOut>
+    inline void clip(Geometry const& geometry, GeometryOut& geometry_out) const
+    {
+        if (m_clip.segment_index().empty())
+        {
+            return;
+        }
+
+        box_type box;
+        geometry::envelope(geometry, box);
+        if (strategy::disjoint::cartesian_box_box::apply(box, m_clip.envelope()))
+        {
+            return;
+        }
+
+        if (! m_clip.segment_index().intersects(box))
+        {
+            // The boundary of the clip geometry does not come near
+            // so the geometry is completely inside or completely outside
+            point_type point;
+            if (geometry::point_on_border(point, geometry)
+                && m_clip.locate(point) > 0)
+            {
+                detail::prepared::append_as_is<Geometry>::apply(geometry,
+                                                                geometry_out);
+            }
+            return;
+        }
+
+        geometry::intersection(geometry, m_clip.geometry(), geometry_out);
+    }
+
+    /*!
+    \brief Clips all geometries in inputs, the clipped result of
+        the i-th input is assigned to the i-th output
+    \details The outputs are resized to the size of the inputs.
+        The work is distributed over thread_count threads (0 means
+        as many as the hardware supports, 1 means sequentially).
+        If one of the clip operations throws, the first exception
+        is rethrown, after all threads are finished.
+    \tparam InputRange Range of linear or areal geometries
+    \tparam OutputRange Range (supporting resize) of collections of geometries
+    */
+    template <typename InputRange, typename OutputRange>
+    inline void clip_all(InputRange const& inputs, OutputRange& outputs,
+                         std::size_t thread_count = 1) const
+    {
+        std::size_t const count = boost::size(inputs);
+        outputs.resize(count);
+
+        detail::parallel::for_each_index(count, thread_count,
+            [&](std::size_t i)
+            {
+                auto& out = range::at(outputs, i);
+                range::clear(out);
+                clip(range::at(inputs, i), out);
+            });
+    }
+
+private :
+    prepared_type m_clip;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_PREPARED_CLIPPER_HPP
@@ -0,0 +1,889 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/not_implemented.hpp>
+#include <boost/geometry/algorithms/simplify.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/ring.hpp>
+#include <boost/geometry/geometries/segment.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategies/side.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace simplify_coverage
+{
+
+template <typename Point>
+inline bool equals_exactly(Point const& p1, Point const& p2)
+{
+    geometry::less<Point> const less;
+    return ! less(p1, p2) && ! less(p2, p1);
+}
+
+// Returns the points of a ring, without closing point
+// and without consecutive duplicates
+template <typename Ring, typename Points>
+inline void open_points(Ring const& ring, Points& points)
+{
+    for (typename boost::range_iterator<Ring const>::type
+            it = boost::begin(ring); it != boost::end(ring); ++it)
+    {
+        if (points.empty() || ! equals_exactly(points.back(), *it))
+        {
+            points.push_back(*it);
+        }
+    }
+    while (points.size() > 1 && equals_exactly(points.back(), points.front()))
+    {
+        points.pop_back();
+    }
+}
+
+// Assigns closed points (the first point is repeated at the end)
+template <typename Points, typename Ring>
+inline void assign_points(Points const& points, Ring& ring)
+{
+    range::clear(ring);
+    if (points.empty())
+    {
+        return;
+    }
+    std::size_t const count = geometry::closure<Ring>::value == open
+        ? points.size() - 1 : points.size();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        range::push_back(ring, points[i]);
+    }
+}
+
+// Lets closed points start at the specified point, if it is one of them
+template <typename Points, typename Point>
+inline void rotate_to(Points& points, Point const& first)
+{
+    if (points.size() < 2)
+    {
+        return;
+    }
+    for (std::size_t i = 1; i + 1 < points.size(); i++)
+    {
+        if (equals_exactly(points[i], first))
+        {
+            points.pop_back();
+            std::rotate(points.begin(), points.begin() + i, points.end());
+            points.push_back(points.front());
+            return;
+        }
+    }
+}
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type
+>
+struct coverage_rings
+    : not_implemented<Tag>
+{};
+
+template <typename Ring>
+struct coverage_rings<Ring, ring_tag>
+{
+    template <typename Rings>
+    static inline void get(Ring const& ring, Rings& rings)
+    {
+        rings.push_back(typename boost::range_value<Rings>::type());
+        open_points(ring, rings.back());
+    }
+
+    template <typename Iterator>
+    static inline void set(Ring& ring, Iterator& it)
+    {
+        assign_points(*it++, ring);
+    }
+};
+
+template <typename Polygon>
+struct coverage_rings<Polygon, polygon_tag>
+{
+    typedef typename ring_type<Polygon>::type ring_type;
+
+    template <typename Rings>
+    static inline void get(Polygon const& polygon, Rings& rings)
+    {
+        coverage_rings<ring_type>::get(exterior_ring(polygon), rings);
+        for (auto const& ring : interior_rings(polygon))
+        {
+            coverage_rings<ring_type>::get(ring, rings);
+        }
+    }
+
+    template <typename Iterator>
+    static inline void set(Polygon& polygon, Iterator& it)
+    {
+        coverage_rings<ring_type>::set(exterior_ring(polygon), it);
+        for (auto& ring : interior_rings(polygon))
+        {
+            coverage_rings<ring_type>::set(ring, it);
+        }
+    }
+};
+
+template <typename MultiPolygon>
+struct coverage_rings<MultiPolygon, multi_polygon_tag>
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    template <typename Rings>
+    static inline void get(MultiPolygon const& multi, Rings& rings)
+    {
+        for (auto const& polygon : multi)
+        {
+            coverage_rings<polygon_type>::get(polygon, rings);
+        }
+    }
+
+    template <typename Iterator>
+    static inline void set(MultiPolygon& multi, Iterator& it)
+    {
+        for (auto& polygon : multi)
+        {
+            coverage_rings<polygon_type>::set(polygon, it);
+        }
+    }
+};
+
+
+// Reference from a ring to one of its arcs
+struct ring_arc
+{
+    std::size_t arc_index;
+    bool reversed;
+};
+
+template <typename Point>
+struct lexicographic_less
+{
+    template <typename Points>
+    inline bool operator()(Points const& left, Points const& right) const
+    {
+        return std::lexicographical_compare(left.begin(), left.end(),
+            right.begin(), right.end(), geometry::less<Point>());
+    }
+};
+
+/*!
+\brief Decomposes rings into arcs, such that arcs shared by rings
+    are stored only once
+\details A vertex is a junction if it occurs in several rings with
+    different neighbours. The rings are split at their junctions. Rings
+    without junctions form one closed arc, starting at their smallest point.
+    Every arc is stored in the orientation which is lexicographically
+    the smallest, such that the shared arcs of two neighbouring rings,
+    which have opposite orientations, are found as the same arc.
+*/
+template <typename Point>
+class arc_collection
+{
+public :
+    typedef std::vector<Point> points_type;
+
+    template <typename Rings>
+    explicit arc_collection(Rings const& rings)
+    {
+        determine_junctions(rings);
+
+        typedef std::map
+            <
+                points_type, std::size_t, lexicographic_less<Point>
+            > map_type;
+        map_type arc_map;
+
+        ring_arcs.resize(rings.size());
+        for (std::size_t r = 0; r < rings.size(); r++)
+        {
+            std::vector<points_type> parts;
+            split(rings[r], parts);
+            for (points_type& part : parts)
+            {
+                points_type reversed_part(part.rbegin(), part.rend());
+                bool const reversed
+                    = lexicographic_less<Point>()(reversed_part, part);
+                if (reversed)
+                {
+                    part.swap(reversed_part);
+                }
+
+                std::pair<typename map_type::iterator, bool> const inserted
+                    = arc_map.insert(std::make_pair(part, arcs.size()));
+                if (inserted.second)
+                {
+                    arcs.push_back(part);
+                }
+                ring_arc const ra = { inserted.first->second, reversed };
+                ring_arcs[r].push_back(ra);
+            }
+        }
+    }
+
+    std::vector<points_type> arcs;
+    std::vector<std::vector<ring_arc> > ring_arcs;
+
+private :
+
+    struct occurrence
+    {
+        Point point;
+        Point neighbour1;
+        Point neighbour2;
+    };
+
+    struct less_by_point
+    {
+        inline bool operator()(occurrence const& left, occurrence const& right) const
+        {
+            return geometry::less<Point>()(left.point, right.point);
+        }
+    };
+
+    static inline bool same_neighbours(occurrence const& left,
+                                       occurrence const& right)
+    {
+        return equals_exactly(left.neighbour1, right.neighbour1)
+            && equals_exactly(left.neighbour2, right.neighbour2);
+    }
+
+    template <typename Rings>
+    inline void determine_junctions(Rings const& rings)
+    {
+        geometry::less<Point> const less;
+
+        std::vector<occurrence> occurrences;
+        for (points_type const& ring : rings)
+        {
+            std::size_t const n = ring.size();
+            for (std::size_t i = 0; i < n; i++)
+            {
+                Point const& previous = ring[(i + n - 1) % n];
+                Point const& next = ring[(i + 1) % n];
+                bool const ordered = less(previous, next);
+                occurrence const o = { ring[i],
+                    ordered ? previous : next, ordered ? next : previous };
+                occurrences.push_back(o);
+            }
+        }
+
+        std::sort(occurrences.begin(), occurrences.end(), less_by_point());
+
+        for (std::size_t i = 0; i < occurrences.size(); )
+        {
+            std::size_t j = i + 1;
+            bool junction = false;
+            while (j < occurrences.size()
+                   && equals_exactly(occurrences[j].point, occurrences[i].point))
+            {
+                if (! same_neighbours(occurrences[i], occurrences[j]))
+                {
+                    junction = true;
+                }
+                j++;
+            }
+            if (junction)
+            {
+                m_junctions.push_back(occurrences[i].point);
+            }
+            i = j;
+        }
+    }
+
+    inline bool is_junction(Point const& point) const
+    {
+        return std::binary_search(m_junctions.begin(), m_junctions.end(),
+                                  point, geometry::less<Point>());
+    }
+
+    inline void split(points_type const& ring,
+                      std::vector<points_type>& parts) const
+    {
+        std::size_t const n = ring.size();
+        if (n == 0)
+        {
+            return;
+        }
+
+        std::size_t start = n;
+        for (std::size_t i = 0; i < n && start == n; i++)
+        {
+            if (is_junction(ring[i]))
+            {
+                start = i;
+            }
+        }
+
+        if (start == n)
+        {
+            // No junctions: start at the smallest point, which is found
+            // for all rings having the same points
+            start = std::min_element(ring.begin(), ring.end(),
+                        geometry::less<Point>()) - ring.begin();
+        }
+
+        points_type part;
+        part.push_back(ring[start]);
+        for (std::size_t k = 1; k <= n; k++)
+        {
+            Point const& point = ring[(start + k) % n];
+            part.push_back(point);
+            if (k == n || is_junction(point))
+            {
+                parts.push_back(part);
+                part.clear();
+                part.push_back(point);
+            }
+        }
+    }
+
+    std::vector<Point> m_junctions;
+};
+
+
+template <typename Point, typename Strategy>
+class coverage_simplifier
+{
+public :
+    typedef std::vector<Point> points_type;
+    typedef model::segment<Point> segment_type;
+    typedef typename strategy::side::services::default_strategy
+        <
+            typename cs_tag<Point>::type
+        >::type side_strategy_type;
+
+    // Number of times the distance of an arc is halved when it
+    // conflicts with other arcs, after that the original arc is used
+    static std::size_t const max_level = 6;
+
+    coverage_simplifier(arc_collection<Point> const& collection,
+                        Strategy const& strategy)
+        : m_collection(collection)
+        , m_strategy(strategy)
+        , m_levels(collection.arcs.size(), 0)
+        , m_simplified(collection.arcs.size())
+    {
+        for (std::size_t r = 0; r < collection.ring_arcs.size(); r++)
+        {
+            points_type points;
+            assemble(r, collection.arcs, points);
+            m_input_signs.push_back(area_sign(points));
+        }
+        find_enclosures();
+    }
+
+    template <typename Distance>
+    inline void apply(Distance const& max_distance)
+    {
+        std::vector<bool> changed(m_levels.size(), true);
+        bool any_changed = true;
+        while (any_changed)
+        {
+            // Simplify the arcs which are not yet simplified,
+            // or conflicted with their current distance
+            for (std::size_t a = 0; a < m_levels.size(); a++)
+            {
+                if (changed[a])
+                {
+                    simplify_arc(a, max_distance);
+                }
+            }
+
+            std::vector<bool> conflicts(m_levels.size(), false);
+            find_intersections(conflicts);
+            find_collapsed_rings(conflicts);
+            find_escaped_rings(conflicts);
+
+            any_changed = false;
+            for (std::size_t a = 0; a < m_levels.size(); a++)
+            {
+                changed[a] = conflicts[a] && m_levels[a] <= max_level;
+                if (changed[a])
+                {
+                    m_levels[a]++;
+                    any_changed = true;
+                }
+            }
+        }
+    }
+
+    inline void get_ring(std::size_t ring_index, points_type& points) const
+    {
+        assemble(ring_index, m_simplified, points);
+    }
+
+private :
+
+    typedef model::ring<Point> ring_type;
+    typedef model::box<Point> box_type;
+
+    // A ring (a hole, or an island in a hole) and the smallest ring
+    // enclosing it. The first point of the ring is always kept, it should
+    // stay inside the enclosing ring.
+    struct enclosure
+    {
+        std::size_t container_index;
+        Point point;
+    };
+
+    struct less_by_container
+    {
+        inline bool operator()(enclosure const& left, enclosure const& right) const
+        {
+            return left.container_index < right.container_index;
+        }
+    };
+
+    // Finds the enclosing rings of the input, using an rtree of the
+    // envelopes of the rings
+    inline void find_enclosures()
+    {
+        typedef std::pair<box_type, std::size_t> value_type;
+        namespace bgi = geometry::index;
+
+        std::size_t const ring_count = m_collection.ring_arcs.size();
+        std::vector<ring_type> rings(ring_count);
+        std::vector<value_type> values;
+        for (std::size_t r = 0; r < ring_count; r++)
+        {
+            get_area_ring(r, m_collection.arcs, rings[r]);
+            if (boost::size(rings[r]) >= 4)
+            {
+                values.push_back(value_type(
+                    geometry::return_envelope<box_type>(rings[r]), r));
+            }
+        }
+
+        bgi::rtree<value_type, bgi::rstar<16> > const rtree(values.begin(),
+                                                           values.end());
+
+        std::vector<value_type> found;
+        for (value_type const& value : values)
+        {
+            Point const& point = range::front(rings[value.second]);
+
+            found.clear();
+            rtree.query(bgi::intersects(point), std::back_inserter(found));
+
+            std::size_t container = ring_count;
+            typename default_area_result<ring_type>::type min_area = 0;
+            for (value_type const& other : found)
+            {
+                if (other.second == value.second
+                    || ! geometry::within(point, rings[other.second]))
+                {
+                    continue;
+                }
+                typename default_area_result<ring_type>::type const area
+                    = geometry::area(rings[other.second]);
+                if (container == ring_count || area < min_area)
+                {
+                    container = other.second;
+                    min_area = area;
+                }
+            }
+
+            if (container < ring_count)
+            {
+                enclosure const e = { container, point };
+                m_enclosures.push_back(e);
+            }
+        }
+
+        std::sort(m_enclosures.begin(), m_enclosures.end(), less_by_container());
+    }
+
+    template <typename Distance>
+    inline void simplify_arc(std::size_t a, Distance const& max_distance)
+    {
+        points_type const& arc = m_collection.arcs[a];
+        points_type& result = m_simplified[a];
+        result.clear();
+
+        if (arc.size() <= 2 || m_levels[a] > max_level)
+        {
+            result = arc;
+            return;
+        }
+
+        Distance distance = max_distance;
+        for (std::size_t i = 0; i < m_levels[a]; i++)
+        {
+            distance /= 2;
+        }
+
+        if (equals_exactly(arc.front(), arc.back()))
+        {
+            // A closed arc is split at its point furthest from its first
+            // point, and both halves are simplified, keeping that point
+            typename Strategy::distance_strategy_type const distance_strategy;
+            std::size_t furthest = 0;
+            typename Strategy::distance_type max_dist(-1);
+            for (std::size_t i = 1; i + 1 < arc.size(); i++)
+            {
+                typename Strategy::distance_type const dist
+                    = distance_strategy.apply(arc[i], arc.front(), arc.front());
+                if (max_dist < dist)
+                {
+                    max_dist = dist;
+                    furthest = i;
+                }
+            }
+            points_type const first(arc.begin(), arc.begin() + furthest + 1);
+            points_type const second(arc.begin() + furthest, arc.end());
+            simplify_part(first, distance, result);
+            result.pop_back();
+            simplify_part(second, distance, result);
+        }
+        else
+        {
+            simplify_part(arc, distance, result);
+        }
+    }
+
+    template <typename Distance>
+    inline void simplify_part(points_type const& part,
+                              Distance const& distance,
+                              points_type& result) const
+    {
+        if (part.size() <= 2)
+        {
+            std::copy(part.begin(), part.end(), std::back_inserter(result));
+        }
+        else
+        {
+            m_strategy.apply(part, std::back_inserter(result), distance);
+        }
+    }
+
+    // Two segments conflict if they have more in common than one shared
+    // endpoint. A junction is the only location where arcs meet, and
+    // consecutive segments of an arc only share their common vertex.
+    inline bool conflicting(segment_type const& s1, segment_type const& s2) const
+    {
+        bool const shared1 = equals_exactly(s1.first, s2.first)
+                          || equals_exactly(s1.first, s2.second);
+        bool const shared2 = equals_exactly(s1.second, s2.first)
+                          || equals_exactly(s1.second, s2.second);
+
+        if (! shared1 && ! shared2)
+        {
+            return geometry::intersects(s1, s2);
+        }
+        if (shared1 && shared2)
+        {
+            return true;
+        }
+
+        // They share one endpoint. They only overlap if they are collinear
+        // and go in the same direction from that point.
+        Point const& other1 = shared1 ? s1.second : s1.first;
+        if (side_strategy_type::apply(s2.first, s2.second, other1) != 0)
+        {
+            return false;
+        }
+        Point const& shared = shared1 ? s1.first : s1.second;
+        Point const& other2 = equals_exactly(s2.first, shared)
+            ? s2.second : s2.first;
+        return geometry::intersects(other1, s2)
+            || geometry::intersects(other2, s1);
+    }
+
+    inline void find_intersections(std::vector<bool>& conflicts) const
+    {
+        typedef std::pair<segment_type, std::size_t> value_type;
+        namespace bgi = geometry::index;
+
+        std::vector<value_type> values;
+        std::vector<std::size_t> arc_of_value;
+        for (std::size_t a = 0; a < m_simplified.size(); a++)
+        {
+            points_type const& arc = m_simplified[a];
+            for (std::size_t i = 0; i + 1 < arc.size(); i++)
+            {
+                values.push_back(value_type(segment_type(arc[i], arc[i + 1]),
+                                            values.size()));
+                arc_of_value.push_back(a);
+            }
+        }
+
+        // Use the packing algorithm
+        bgi::rtree<value_type, bgi::rstar<16> > const rtree(values.begin(),
+                                                           values.end());
+
+        std::vector<value_type> found;
+        for (value_type const& value : values)
+        {
+            found.clear();
+            rtree.query(bgi::intersects(value.first),
+                        std::back_inserter(found));
+            for (value_type const& other : found)
+            {
+                if (other.second > value.second
+                    && conflicting(value.first, other.first))
+                {
+                    conflicts[arc_of_value[value.second]] = true;
+                    conflicts[arc_of_value[other.second]] = true;
+                }
+            }
+        }
+    }
+
+    // Rings should keep at least three different points,
+    // and their orientation
+    inline void find_collapsed_rings(std::vector<bool>& conflicts) const
+    {
+        points_type points;
+        for (std::size_t r = 0; r < m_collection.ring_arcs.size(); r++)
+        {
+            get_ring(r, points);
+            if (points.size() < 4 || area_sign(points) != m_input_signs[r])
+            {
+                for (ring_arc const& ra : m_collection.ring_arcs[r])
+                {
+                    conflicts[ra.arc_index] = true;
+                }
+            }
+        }
+    }
+
+    // Rings should stay inside their enclosing ring. Without intersections
+    // a ring is either completely inside or outside, which is verified with
+    // its first point. The enclosing ring is simplified less if it does not
+    // contain that point anymore (e.g. a hole in a removed bulge).
+    inline void find_escaped_rings(std::vector<bool>& conflicts) const
+    {
+        ring_type ring;
+        for (std::size_t i = 0; i < m_enclosures.size(); i++)
+        {
+            std::size_t const c = m_enclosures[i].container_index;
+            if (i == 0 || m_enclosures[i - 1].container_index != c)
+            {
+                get_area_ring(c, m_simplified, ring);
+            }
+            if (! geometry::within(m_enclosures[i].point, ring))
+            {
+                for (ring_arc const& ra : m_collection.ring_arcs[c])
+                {
+                    conflicts[ra.arc_index] = true;
+                }
+            }
+        }
+    }
+
+    // Assembles a ring in clockwise order, as the area it encloses,
+    // whatever its orientation in the input
+    inline void get_area_ring(std::size_t ring_index,
+                              std::vector<points_type> const& arcs,
+                              ring_type& ring) const
+    {
+        points_type points;
+        assemble(ring_index, arcs, points);
+        ring.assign(points.begin(), points.end());
+        if (area_sign(points) < 0)
+        {
+            std::reverse(ring.begin(), ring.end());
+        }
+    }
+
+    inline void assemble(std::size_t ring_index,
+                         std::vector<points_type> const& arcs,
+                         points_type& points) const
+    {
+        points.clear();
+        for (ring_arc const& ra : m_collection.ring_arcs[ring_index])
+        {
+            points_type const& arc = arcs[ra.arc_index];
+            std::size_t const start = points.empty() ? 0 : 1;
+            for (std::size_t i = start; i < arc.size(); i++)
+            {
+                points.push_back(ra.reversed ? arc[arc.size() - 1 - i] : arc[i]);
+            }
+        }
+    }
+
+    static inline int area_sign(points_type const& points)
+    {
+        model::ring<Point> ring(points.begin(), points.end());
+        typename default_area_result<model::ring<Point> >::type const area
+            = geometry::area(ring);
+        return area > 0 ? 1 : area < 0 ? -1 : 0;
+    }
+
+    arc_collection<Point> const& m_collection;
+    Strategy const& m_strategy;
+    std::vector<std::size_t> m_levels;
+    std::vector<points_type> m_simplified;
+    std::vector<int> m_input_signs;
+    std::vector<enclosure> m_enclosures;
+};
+
+
+}} // namespace detail::simplify_coverage
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Simplifies a collection of polygons, preserving their topology
+\ingroup simplify
+\details The polygons (or multi polygons, or rings) form a coverage:
+    neighbouring polygons share their borders, having the same vertices
+    along them. Each border is simplified only once, and used for all
+    polygons containing it, such that no gaps or overlaps are introduced.
+    The vertices where three or more polygons meet (or where the border
+    of one polygon starts to be shared with another polygon) are kept.
+    Simplified borders are checked for intersections with other borders,
+    using an rtree. Borders causing intersections, collapsing or
+    inverting rings, or leaving holes and islands outside the ring
+    enclosing them, are simplified again with a smaller distance, and if
+    that is not sufficient, they are kept as they are.
+    The simplified version of the i-th input is assigned to the i-th output.
+    A multi polygon can also be passed as input and output, the borders
+    shared by its polygons are then preserved.
+\tparam InputRange Range of polygons, multi polygons or rings
+\tparam OutputRange Range (supporting resize) of geometries of the same type
+\tparam Distance A numerical distance measure
+\tparam Strategy A type fulfilling a SimplifyStrategy concept
+\param inputs The geometries to simplify
+\param outputs The simplified geometries
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+\param strategy simplify strategy to be used for simplification of the
+    borders
+\note Rings are never removed, even if they are smaller than the distance,
+    because that would leave a gap in the coverage.
+\qbk{distinguish,with strategy}
+*/
+template
+<
+    typename InputRange,
+    typename OutputRange,
+    typename Distance,
+    typename Strategy
+>
+inline void simplify_coverage(InputRange const& inputs,
+                OutputRange& outputs,
+                Distance const& max_distance,
+                Strategy const& strategy)
+{
+    typedef typename boost::range_value<InputRange>::type geometry_type;
+    typedef typename point_type<geometry_type>::type point_type;
+    typedef detail::simplify_coverage::coverage_rings<geometry_type> rings_policy;
+    typedef std::vector<point_type> points_type;
+
+    BOOST_CONCEPT_ASSERT( (concepts::SimplifyStrategy<Strategy, point_type>) );
+
+    std::vector<points_type> rings;
+    for (auto const& geometry : inputs)
+    {
+        rings_policy::get(geometry, rings);
+    }
+
+    detail::simplify_coverage::arc_collection<point_type> const collection(rings);
+    detail::simplify_coverage::coverage_simplifier
+        <
+            point_type, Strategy
+        > simplifier(collection, strategy);
+    simplifier.apply(max_distance);
+
+    points_type simplified;
+    for (std::size_t r = 0; r < rings.size(); r++)
+    {
+        if (rings[r].empty())
+        {
+            // Empty rings stay empty
+            continue;
+        }
+        simplifier.get_ring(r, simplified);
+        detail::simplify_coverage::rotate_to(simplified, rings[r].front());
+        rings[r].swap(simplified);
+    }
+
+    std::size_t const count = boost::size(inputs);
+    outputs.resize(count);
+    typename std::vector<points_type>::const_iterator it = rings.begin();
+    for (std::size_t i = 0; i < count; i++)
+    {
+        range::at(outputs, i) = range::at(inputs, i);
+        rings_policy::set(range::at(outputs, i), it);
+    }
+}
+
+/*!
+\brief Simplifies a collection of polygons, preserving their topology
+\ingroup simplify
+\details This version uses the Douglas-Peucker strategy, see
+    simplify_coverage with strategy for the description.
+\tparam InputRange Range of polygons, multi polygons or rings
+\tparam OutputRange Range (supporting resize) of geometries of the same type
+\tparam Distance \tparam_numeric
+\param inputs The geometries to simplify
+\param outputs The simplified geometries
+\param max_distance distance (in units of input coordinates) of a vertex
+    to other segments to be removed
+*/
+template <typename InputRange, typename OutputRange, typename Distance>
+inline void simplify_coverage(InputRange const& inputs,
+                OutputRange& outputs,
+                Distance const& max_distance)
+{
+    typedef typename point_type
+        <
+            typename boost::range_value<InputRange>::type
+        >::type point_type;
+
+    typedef typename strategy::distance::services::default_strategy
+        <
+            point_tag, segment_tag, point_type
+        >::type ds_strategy_type;
+
+    geometry::simplify_coverage(inputs, outputs, max_distance,
+        strategy::simplify::douglas_peucker<point_type, ds_strategy_type>());
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_SIMPLIFY_COVERAGE_HPP
@@ -0,0 +1,78 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_TRANSFORM_ALL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_TRANSFORM_ALL_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/algorithms/transform.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Transforms all geometries of a range, with the same strategy
+\ingroup transform
+\details The i-th input is transformed into the i-th output.
+    The outputs are resized to the size of the inputs.
+    The work is distributed over thread_count threads (0 means as many as
+    the hardware supports, 1 means sequentially), so the strategy should
+    be usable by several threads at the same time, as the srs transformers
+    are. Each geometry is transformed by one thread. If one of the
+    transformations throws, the first exception is rethrown, after all
+    threads are finished.
+\tparam InputRange Range of geometries
+\tparam OutputRange Range (supporting resize) of geometries
+\tparam Strategy strategy
+\param inputs The geometries to transform
+\param outputs The transformed geometries
+\param strategy The strategy to be used for transformation
+\param thread_count The number of threads to be used
+\return True if all geometries could be transformed
+ */
+template <typename InputRange, typename OutputRange, typename Strategy>
+inline bool transform_all(InputRange const& inputs,
+                OutputRange& outputs,
+                Strategy const& strategy,
+                std::size_t thread_count = 1)
+{
+    std::size_t const count = boost::size(inputs);
+    outputs.resize(count);
+
+    std::vector<char> results(count, 1);
+
+    detail::parallel::for_each_index(count, thread_count,
+        [&](std::size_t i)
+        {
+            results[i] = geometry::transform(range::at(inputs, i),
+                                             range::at(outputs, i),
+                                             strategy);
+        });
+
+    for (char r : results)
+    {
+        if (! r)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_TRANSFORM_ALL_HPP
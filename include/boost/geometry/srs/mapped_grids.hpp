@@ -0,0 +1,210 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+#define BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
+
+
+#include <boost/geometry/srs/projections/grids.hpp>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/smart_ptr/make_shared.hpp>
+#include <boost/smart_ptr/shared_ptr.hpp>
+
+#include <algorithm>
+#include <ios>
+#include <string>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+namespace detail
+{
+
+// Read-only file mapped into memory, the pages are shared with other
+// processes mapping the same file
+class mapped_file
+{
+public:
+    explicit mapped_file(std::string const& filename)
+        : m_mapping(filename.c_str(), interprocess::read_only)
+        , m_region(m_mapping, interprocess::read_only)
+    {}
+
+    const char * data() const
+    {
+        return static_cast<const char *>(m_region.get_address());
+    }
+
+    std::size_t size() const
+    {
+        return m_region.get_size();
+    }
+
+private:
+    interprocess::file_mapping m_mapping;
+    interprocess::mapped_region m_region;
+};
+
+// Input stream interface used by pj_gridinfo_init() and pj_gridinfo_load()
+// reading from a mapped file
+class mapped_file_stream
+{
+public:
+    typedef boost::shared_ptr<mapped_file const> file_ptr;
+
+    mapped_file_stream()
+        : m_pos(0)
+        , m_gcount(0)
+        , m_fail(true)
+    {}
+
+    void open(std::string const& filename)
+    {
+        try
+        {
+            m_file = boost::make_shared<mapped_file const>(filename);
+        }
+        catch (interprocess::interprocess_exception const&)
+        {
+            m_file.reset();
+        }
+
+        m_pos = 0;
+        m_gcount = 0;
+        m_fail = ! is_open();
+    }
+
+    bool is_open() const
+    {
+        return m_file.get() != NULL;
+    }
+
+    void read(char * s, std::streamsize n)
+    {
+        std::size_t const available = m_pos < size() ? size() - m_pos : 0;
+        std::size_t const count = m_fail ? 0 : (std::min)(std::size_t(n), available);
+
+        if (count > 0)
+        {
+            std::copy(m_file->data() + m_pos, m_file->data() + m_pos + count, s);
+        }
+
+        m_pos += count;
+        m_gcount = std::streamsize(count);
+        if (count < std::size_t(n))
+        {
+            m_fail = true;
+        }
+    }
+
+    void seekg(std::streamoff off, std::ios::seekdir dir = std::ios::beg)
+    {
+        if (m_fail)
+        {
+            return;
+        }
+
+        std::streamoff const base = dir == std::ios::cur ? std::streamoff(m_pos)
+                                  : dir == std::ios::end ? std::streamoff(size())
+                                  : 0;
+        if (base + off < 0)
+        {
+            m_fail = true;
+            return;
+        }
+
+        m_pos = std::size_t(base + off);
+    }
+
+    std::streamoff tellg() const
+    {
+        return m_fail ? std::streamoff(-1) : std::streamoff(m_pos);
+    }
+
+    bool fail() const
+    {
+        return m_fail;
+    }
+
+    std::streamsize gcount() const
+    {
+        return m_gcount;
+    }
+
+    std::size_t size() const
+    {
+        return is_open() ? m_file->size() : 0;
+    }
+
+    file_ptr const& file() const
+    {
+        return m_file;
+    }
+
+private:
+    file_ptr m_file;
+    std::size_t m_pos;
+    std::streamsize m_gcount;
+    bool m_fail;
+};
+
+} // namespace detail
+
+// Stream policy mapping the grid files into memory instead of reading them.
+// With mapped_grids only the headers are read. It can also be used with grids
+// and shared grids, then the grids are loaded from the mapped files.
+struct mapped_file_policy
+{
+    typedef detail::mapped_file_stream stream_type;
+
+    static inline void open(stream_type & is, std::string const& gridname)
+    {
+        is.open(gridname);
+    }
+};
+
+// Grids accessed in place in the files mapped into memory by
+// mapped_file_policy, e.g. grids_storage<mapped_file_policy, mapped_grids>.
+// Nothing is loaded so the startup is fast, only the pages of the rows being
+// used are read and several processes share them. The grids are modified only
+// while they are initialized, applying them only reads the grids and files.
+class mapped_grids
+{
+public:
+    std::size_t size() const
+    {
+        return gridinfo.size();
+    }
+
+    bool empty() const
+    {
+        return gridinfo.empty();
+    }
+
+    typedef projections::detail::mapped_grids_tag tag;
+
+    projections::detail::pj_gridinfo gridinfo;
+
+    // The files containing the grids, for each grid in gridinfo
+    std::vector<detail::mapped_file_stream::file_ptr> files;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_MAPPED_GRIDS_HPP
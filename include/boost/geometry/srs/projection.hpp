@@ -14,6 +14,7 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
 
@@ -24,6 +25,7 @@
 #include <boost/geometry/algorithms/detail/convert_point_to_point.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/core/static_assert.hpp>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
@@ -35,6 +37,7 @@
 #include <boost/geometry/srs/projections/invalid_point.hpp>
 #include <boost/geometry/srs/projections/proj4.hpp>
 #include <boost/geometry/srs/projections/spar.hpp>
+#include <boost/geometry/util/math.hpp>
 
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
@@ -107,6 +110,21 @@ struct inverse_point_projection_policy
     }
 };
 
+// Factors converting coordinates in Units to radians and back
+template <typename Units, typename CT>
+struct radian_factors
+{
+    static inline CT to_radian() { return CT(1); }
+    static inline CT from_radian() { return CT(1); }
+};
+
+template <typename CT>
+struct radian_factors<geometry::degree, CT>
+{
+    static inline CT to_radian() { return math::d2r<CT>(); }
+    static inline CT from_radian() { return math::r2d<CT>(); }
+};
+
 template <typename PointPolicy>
 struct project_point
 {
@@ -490,6 +508,40 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /*!
+    \brief Forward projection of count coordinates, from arrays of
+        longitudes and latitudes to arrays of x and y coordinates
+    \details The coordinates are projected in blocks, and a dynamic
+        projection is called once for all of them, instead of once per
+        point. Values of the arrays are stride elements apart, so
+        interleaved coordinates can be passed with a stride of 2.
+        Coordinates which can not be projected are set to HUGE_VAL.
+    \tparam Units units of the longitudes and latitudes, degree or radian
+    \return false if any coordinate could not be projected
+    */
+    template <typename Units = geometry::degree>
+    inline bool forward(std::size_t count, CT const* lons, CT const* lats,
+                        CT* xs, CT* ys, std::size_t stride = 1) const
+    {
+        return base_t::proj().forward(count, lons, lats, xs, ys, stride,
+                projections::detail::radian_factors<Units, CT>::to_radian());
+    }
+
+    /*!
+    \brief Inverse projection of count coordinates, from arrays of x and y
+        coordinates to arrays of longitudes and latitudes
+    \details See the forward projection of arrays
+    \tparam Units units of the longitudes and latitudes, degree or radian
+    \return false if any coordinate could not be projected
+    */
+    template <typename Units = geometry::degree>
+    inline bool inverse(std::size_t count, CT const* xs, CT const* ys,
+                        CT* lons, CT* lats, std::size_t stride = 1) const
+    {
+        return base_t::proj().inverse(count, xs, ys, lons, lats, stride,
+                projections::detail::radian_factors<Units, CT>::from_radian());
+    }
 };
 
 } // namespace projections
@@ -0,0 +1,264 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
+#define BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
+
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_MUTEX) || defined(BOOST_NO_CXX11_HDR_UNORDERED_MAP)
+#error "C++11 <mutex> and <unordered_map> headers required."
+#endif
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <boost/geometry/core/static_assert.hpp>
+
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/projections/epsg_params.hpp>
+#include <boost/geometry/srs/projections/esri_params.hpp>
+#include <boost/geometry/srs/projections/iau2000_params.hpp>
+#include <boost/geometry/srs/projections/proj4.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+
+// projection_cache_key creates the key identifying a definition in
+// projection_cache, specialized for the definitions which can be cached
+template <typename Params>
+struct projection_cache_key
+{
+    BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+        "This definition can not be cached.",
+        Params);
+};
+
+template <>
+struct projection_cache_key<srs::proj4>
+{
+    static inline std::string apply(srs::proj4 const& params)
+    {
+        return "proj4:" + params.str();
+    }
+};
+
+template <>
+struct projection_cache_key<srs::epsg>
+{
+    static inline std::string apply(srs::epsg const& params)
+    {
+        return "epsg:" + std::to_string(params.code);
+    }
+};
+
+template <>
+struct projection_cache_key<srs::esri>
+{
+    static inline std::string apply(srs::esri const& params)
+    {
+        return "esri:" + std::to_string(params.code);
+    }
+};
+
+template <>
+struct projection_cache_key<srs::iau2000>
+{
+    static inline std::string apply(srs::iau2000 const& params)
+    {
+        return "iau2000:" + std::to_string(params.code);
+    }
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+// Shared values by key, the least recently used is removed when the
+// number of values exceeds the maximal size
+template <typename Value>
+class shared_lru_cache
+{
+public:
+    typedef std::shared_ptr<Value const> value_ptr;
+
+    explicit shared_lru_cache(std::size_t max_size)
+        : m_max_size(max_size)
+    {}
+
+    value_ptr find(std::string const& key)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        typename map_type::iterator it = m_map.find(key);
+        if (it == m_map.end())
+        {
+            return value_ptr();
+        }
+        m_list.splice(m_list.begin(), m_list, it->second);
+        return it->second->second;
+    }
+
+    // Returns the value already stored by another thread, if any
+    value_ptr insert(std::string const& key, value_ptr const& value)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        typename map_type::iterator it = m_map.find(key);
+        if (it != m_map.end())
+        {
+            m_list.splice(m_list.begin(), m_list, it->second);
+            return it->second->second;
+        }
+        if (m_max_size == 0)
+        {
+            return value;
+        }
+        if (m_list.size() >= m_max_size)
+        {
+            m_map.erase(m_list.back().first);
+            m_list.pop_back();
+        }
+        m_list.push_front(std::make_pair(key, value));
+        m_map.insert(std::make_pair(key, m_list.begin()));
+        return value;
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_list.size();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_map.clear();
+        m_list.clear();
+    }
+
+private:
+    typedef std::list<std::pair<std::string, value_ptr> > list_type;
+    typedef std::unordered_map<std::string, typename list_type::iterator> map_type;
+
+    std::size_t m_max_size;
+    list_type m_list;
+    map_type m_map;
+    mutable std::mutex m_mutex;
+};
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+    \brief Cache of projections and transformations by definition
+    \details Projections and transformations are created once for each
+        definition and shared. They are immutable, the same object can be
+        used by many threads at the same time. The cache is thread-safe.
+        At most max_size projections and max_size transformations are kept,
+        the least recently used are removed first. Objects removed from
+        the cache stay valid as long as they are used.
+        The cache is keyed by the text of proj4 definitions, so definitions
+        differing only in spaces or in the order of parameters are cached
+        separately. Definitions which can not be created throw and are not
+        cached.
+    \ingroup projection
+    \tparam CT calculation type used internally
+*/
+template <typename CT = double>
+class projection_cache
+{
+public:
+    typedef srs::projection<srs::dynamic, CT> projection_type;
+    typedef srs::transformation<srs::dynamic, srs::dynamic, CT> transformation_type;
+    typedef std::shared_ptr<projection_type const> projection_ptr;
+    typedef std::shared_ptr<transformation_type const> transformation_ptr;
+
+    explicit projection_cache(std::size_t max_size = 256)
+        : m_projections(max_size)
+        , m_transformations(max_size)
+    {}
+
+    projection_cache(projection_cache const&) = delete;
+    projection_cache& operator=(projection_cache const&) = delete;
+
+    template <typename Params>
+    projection_ptr get_projection(Params const& params)
+    {
+        std::string const key = projection_cache_key<Params>::apply(params);
+
+        projection_ptr result = m_projections.find(key);
+        if (! result)
+        {
+            // Created without the lock, the same definition can be created
+            // by several threads at the same time, only one is kept
+            result = m_projections.insert(key,
+                        std::make_shared<projection_type const>(params));
+        }
+        return result;
+    }
+
+    template <typename Params1, typename Params2>
+    transformation_ptr get_transformation(Params1 const& params1,
+                                          Params2 const& params2)
+    {
+        std::string const key1 = projection_cache_key<Params1>::apply(params1);
+        std::string const key2 = projection_cache_key<Params2>::apply(params2);
+        // The length makes the key unambiguous
+        std::string const key = std::to_string(key1.size()) + ":" + key1 + key2;
+
+        transformation_ptr result = m_transformations.find(key);
+        if (! result)
+        {
+            result = m_transformations.insert(key,
+                        std::make_shared<transformation_type const>(params1, params2));
+        }
+        return result;
+    }
+
+    //! Number of cached projections
+    std::size_t projections_size() const
+    {
+        return m_projections.size();
+    }
+
+    //! Number of cached transformations
+    std::size_t transformations_size() const
+    {
+        return m_transformations.size();
+    }
+
+    void clear()
+    {
+        m_projections.clear();
+        m_transformations.clear();
+    }
+
+private:
+    detail::shared_lru_cache<projection_type> m_projections;
+    detail::shared_lru_cache<transformation_type> m_transformations;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_PROJECTION_CACHE_HPP
@@ -12,6 +12,7 @@
 
 
 #include <algorithm>
+#include <cstddef>
 
 #include <boost/geometry/srs/projections/dpar.hpp>
 
@@ -24,10 +25,74 @@ namespace boost { namespace geometry { namespace projections
 namespace detail
 {
 
+    // Parameter of the EPSG, ESRI and IAU2000 tables. It is a literal
+    // type, so the tables are constant initialized, and the parameters of
+    // a code are only converted to dpar::parameters when it is looked up.
+    // A towgs84 list is stored as consecutive parameters, one per value.
+    struct code_parameter
+    {
+        enum kind_type
+        {
+            kind_f, kind_r, kind_i, kind_be, kind_datum, kind_ellps,
+            kind_pm, kind_pm_angle, kind_proj, kind_units, kind_towgs84
+        };
+
+        constexpr code_parameter(srs::dpar::name_f id, double v)
+            : kind(kind_f), id(id), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::name_r id, double v)
+            : kind(kind_r), id(id), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::name_i id, int v)
+            : kind(kind_i), id(id), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::name_be id)
+            : kind(kind_be), id(id), value(0)
+        {}
+
+        constexpr code_parameter(srs::dpar::value_datum v)
+            : kind(kind_datum), id(srs::dpar::datum), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::value_ellps v)
+            : kind(kind_ellps), id(srs::dpar::ellps), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::value_pm v)
+            : kind(kind_pm), id(srs::dpar::pm), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::name_pm id, double v)
+            : kind(kind_pm_angle), id(id), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::value_proj v)
+            : kind(kind_proj), id(srs::dpar::proj), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::value_units v)
+            : kind(kind_units), id(srs::dpar::units), value(v)
+        {}
+
+        constexpr code_parameter(srs::dpar::name_towgs84 id, double v)
+            : kind(kind_towgs84), id(id), value(v)
+        {}
+
+        short kind;
+        short id;
+        double value;
+    };
+
+    // Code of the EPSG, ESRI and IAU2000 tables, with its parameters
+    // in the range [first, first + count) of the parameters table
     struct code_element
     {
         int code;
-        srs::dpar::parameters<> parameters;
+        int first;
+        int count;
     };
 
     struct code_element_less
@@ -48,6 +113,77 @@ namespace detail
         return first != last && !comp(value, *first) ? first : last;
     }
 
+    inline srs::dpar::parameters<> code_to_parameters(code_parameter const* first,
+                                                      code_parameter const* last)
+    {
+        using namespace srs::dpar;
+
+        srs::dpar::parameters<> result;
+        for (code_parameter const* it = first; it != last; ++it)
+        {
+            switch (it->kind)
+            {
+            case code_parameter::kind_f :
+                result(name_f(it->id), it->value);
+                break;
+            case code_parameter::kind_r :
+                result(name_r(it->id), it->value);
+                break;
+            case code_parameter::kind_i :
+                result(name_i(it->id), int(it->value));
+                break;
+            case code_parameter::kind_be :
+                result(name_be(it->id));
+                break;
+            case code_parameter::kind_datum :
+                result(value_datum(int(it->value)));
+                break;
+            case code_parameter::kind_ellps :
+                result(value_ellps(int(it->value)));
+                break;
+            case code_parameter::kind_pm :
+                result(value_pm(int(it->value)));
+                break;
+            case code_parameter::kind_pm_angle :
+                result(pm, it->value);
+                break;
+            case code_parameter::kind_proj :
+                result(value_proj(int(it->value)));
+                break;
+            case code_parameter::kind_units :
+                result(value_units(int(it->value)));
+                break;
+            case code_parameter::kind_towgs84 :
+                {
+                    srs::detail::towgs84<> values;
+                    for (; it != last && it->kind == code_parameter::kind_towgs84; ++it)
+                    {
+                        values.push_back(it->value);
+                    }
+                    --it;
+                    result(towgs84, values);
+                }
+                break;
+            }
+        }
+        return result;
+    }
+
+    template <std::size_t ElementCount>
+    inline srs::dpar::parameters<> code_to_parameters(code_element const (&elements)[ElementCount],
+                                                      code_parameter const* parameters,
+                                                      int code)
+    {
+        code_element const* first = elements;
+        code_element const* last = elements + ElementCount;
+        code_element const* el = binary_find_code_element(first, last, code);
+
+        return el != last
+             ? code_to_parameters(parameters + el->first,
+                                  parameters + el->first + el->count)
+             : srs::dpar::parameters<>();
+    }
+
 }
 #endif // DOXYGEN_NO_DETAIL
 
@@ -27,461 +27,887 @@ namespace detail
     {
         using namespace srs::dpar;
 
-        static const code_element arr[] = {
-            {37001, srs::dpar::parameters<>(proj_longlat)(ellps_wgs66)(no_defs)},
-            {37002, srs::dpar::parameters<>(proj_longlat)(a,6378166)(b,6356784.283607107)(no_defs)},
-            {37003, srs::dpar::parameters<>(proj_longlat)(a,6378150)(b,6356768.337244385)(no_defs)},
-            {37004, srs::dpar::parameters<>(proj_longlat)(ellps_fschr60m)(no_defs)},
-            {37005, srs::dpar::parameters<>(proj_longlat)(a,6378270)(b,6356794.343434343)(no_defs)},
-            {37006, srs::dpar::parameters<>(proj_longlat)(a,6377295.664)(b,6356094.667915204)(no_defs)},
-            {37007, srs::dpar::parameters<>(proj_longlat)(a,6376896)(b,6355834.846687363)(no_defs)},
-            {37008, srs::dpar::parameters<>(proj_longlat)(r,6370997)(no_defs)},
-            {37201, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37202, srs::dpar::parameters<>(proj_longlat)(a,6377276.345)(b,6356075.41314024)(no_defs)},
-            {37203, srs::dpar::parameters<>(proj_longlat)(a,6377301.243)(b,6356100.230165384)(no_defs)},
-            {37204, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37205, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37206, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {37207, srs::dpar::parameters<>(proj_longlat)(ellps_fschr60m)(no_defs)},
-            {37208, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {37211, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {37212, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37213, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37214, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37215, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37216, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37217, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37218, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37219, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37220, srs::dpar::parameters<>(proj_longlat)(ellps_clrk66)(no_defs)},
-            {37221, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37222, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37223, srs::dpar::parameters<>(proj_longlat)(a,6378249.2)(b,6356514.999904194)(no_defs)},
-            {37224, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37226, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37227, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37228, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {37229, srs::dpar::parameters<>(proj_longlat)(a,6378270)(b,6356794.343434343)(no_defs)},
-            {37230, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37231, srs::dpar::parameters<>(proj_longlat)(ellps_aust_sa)(no_defs)},
-            {37232, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37233, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37234, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37235, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37237, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37238, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37239, srs::dpar::parameters<>(proj_longlat)(ellps_clrk66)(no_defs)},
-            {37240, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {37241, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37242, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37243, srs::dpar::parameters<>(proj_longlat)(ellps_clrk66)(no_defs)},
-            {37245, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37246, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37247, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37249, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37250, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37251, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37252, srs::dpar::parameters<>(proj_longlat)(ellps_clrk66)(no_defs)},
-            {37253, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37254, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {37255, srs::dpar::parameters<>(proj_longlat)(ellps_bessel)(no_defs)},
-            {37257, srs::dpar::parameters<>(proj_longlat)(ellps_krass)(no_defs)},
-            {37259, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {37260, srs::dpar::parameters<>(proj_longlat)(ellps_clrk66)(no_defs)},
+        static constexpr code_parameter parameters[] = {
+            /*37001*/ {proj_longlat}, {ellps_wgs66}, {no_defs},
+            /*37002*/ {proj_longlat}, {a,6378166}, {b,6356784.283607107}, {no_defs},
+            /*37003*/ {proj_longlat}, {a,6378150}, {b,6356768.337244385}, {no_defs},
+            /*37004*/ {proj_longlat}, {ellps_fschr60m}, {no_defs},
+            /*37005*/ {proj_longlat}, {a,6378270}, {b,6356794.343434343}, {no_defs},
+            /*37006*/ {proj_longlat}, {a,6377295.664}, {b,6356094.667915204}, {no_defs},
+            /*37007*/ {proj_longlat}, {a,6376896}, {b,6355834.846687363}, {no_defs},
+            /*37008*/ {proj_longlat}, {r,6370997}, {no_defs},
+            /*37201*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37202*/ {proj_longlat}, {a,6377276.345}, {b,6356075.41314024}, {no_defs},
+            /*37203*/ {proj_longlat}, {a,6377301.243}, {b,6356100.230165384}, {no_defs},
+            /*37204*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37205*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37206*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*37207*/ {proj_longlat}, {ellps_fschr60m}, {no_defs},
+            /*37208*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*37211*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*37212*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37213*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37214*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37215*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37216*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37217*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37218*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37219*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37220*/ {proj_longlat}, {ellps_clrk66}, {no_defs},
+            /*37221*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37222*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37223*/ {proj_longlat}, {a,6378249.2}, {b,6356514.999904194}, {no_defs},
+            /*37224*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37226*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37227*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37228*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*37229*/ {proj_longlat}, {a,6378270}, {b,6356794.343434343}, {no_defs},
+            /*37230*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37231*/ {proj_longlat}, {ellps_aust_sa}, {no_defs},
+            /*37232*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37233*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37234*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37235*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37237*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37238*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37239*/ {proj_longlat}, {ellps_clrk66}, {no_defs},
+            /*37240*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*37241*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37242*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37243*/ {proj_longlat}, {ellps_clrk66}, {no_defs},
+            /*37245*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37246*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37247*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37249*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37250*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37251*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37252*/ {proj_longlat}, {ellps_clrk66}, {no_defs},
+            /*37253*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37254*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*37255*/ {proj_longlat}, {ellps_bessel}, {no_defs},
+            /*37257*/ {proj_longlat}, {ellps_krass}, {no_defs},
+            /*37259*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*37260*/ {proj_longlat}, {ellps_clrk66}, {no_defs},
+            /*53002*/ {proj_eqc}, {lat_ts,60}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53003*/ {proj_mill}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {r_au}, {r,6371000}, {units_m}, {no_defs},
+            /*53004*/ {proj_merc}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53008*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53009*/ {proj_moll}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53010*/ {proj_eck6}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53012*/ {proj_eck4}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53016*/ {proj_gall}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53021*/ {proj_poly}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53024*/ {proj_bonne}, {lon_0,0}, {lat_1,60}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53025*/ {proj_omerc}, {lat_0,40}, {lon_1,0}, {lat_1,0}, {lon_2,0}, {lat_2,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53026*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53027*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,60}, {lat_2,60}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53028*/ {proj_cass}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53029*/ {proj_vandg}, {lon_0,0}, {x_0,0}, {y_0,0}, {r_au}, {r,6371000}, {units_m}, {no_defs},
+            /*53030*/ {proj_robin}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53031*/ {proj_tpeqd}, {lat_1,0}, {lon_1,0}, {lat_2,60}, {lon_2,60}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*53032*/ {proj_aeqd}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6371000}, {units_m}, {no_defs},
+            /*54002*/ {proj_eqc}, {lat_ts,60}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54003*/ {proj_mill}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {r_au}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54004*/ {proj_merc}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54008*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54009*/ {proj_moll}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54010*/ {proj_eck6}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54012*/ {proj_eck4}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54016*/ {proj_gall}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54021*/ {proj_poly}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54024*/ {proj_bonne}, {lon_0,0}, {lat_1,60}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54025*/ {proj_omerc}, {lat_0,40}, {lon_1,0}, {lat_1,0}, {lon_2,0}, {lat_2,0}, {k,1}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54026*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54027*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,60}, {lat_2,60}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54028*/ {proj_cass}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54029*/ {proj_vandg}, {lon_0,0}, {x_0,0}, {y_0,0}, {r_au}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54030*/ {proj_robin}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54031*/ {proj_tpeqd}, {lat_1,0}, {lon_1,0}, {lat_2,60}, {lon_2,60}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*54032*/ {proj_aeqd}, {lat_0,0}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*65061*/ {proj_poly}, {lat_0,13.47246635277778}, {lon_0,-144.7487507055556}, {x_0,50000.00000000001}, {y_0,50000.00000000001}, {ellps_clrk66}, {srs::dpar::datum_nad27}, {to_meter,0.3048006096012192}, {no_defs},
+            /*65161*/ {proj_poly}, {lat_0,13.47246635277778}, {lon_0,-144.7487507055556}, {x_0,50000}, {y_0,50000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102001*/ {proj_aea}, {lat_1,50}, {lat_2,70}, {lat_0,40}, {lon_0,-96}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102002*/ {proj_lcc}, {lat_1,50}, {lat_2,70}, {lat_0,40}, {lon_0,-96}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102003*/ {proj_aea}, {lat_1,29.5}, {lat_2,45.5}, {lat_0,37.5}, {lon_0,-96}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102004*/ {proj_lcc}, {lat_1,33}, {lat_2,45}, {lat_0,39}, {lon_0,-96}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102005*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,33}, {lat_2,45}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102006*/ {proj_aea}, {lat_1,55}, {lat_2,65}, {lat_0,50}, {lon_0,-154}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102007*/ {proj_aea}, {lat_1,8}, {lat_2,18}, {lat_0,13}, {lon_0,-157}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102008*/ {proj_aea}, {lat_1,20}, {lat_2,60}, {lat_0,40}, {lon_0,-96}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102009*/ {proj_lcc}, {lat_1,20}, {lat_2,60}, {lat_0,40}, {lon_0,-96}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102010*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,20}, {lat_2,60}, {x_0,0}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102011*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102012*/ {proj_lcc}, {lat_1,30}, {lat_2,62}, {lat_0,0}, {lon_0,105}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102013*/ {proj_aea}, {lat_1,43}, {lat_2,62}, {lat_0,30}, {lon_0,10}, {x_0,0}, {y_0,0}, {ellps_intl}, {units_m}, {no_defs},
+            /*102014*/ {proj_lcc}, {lat_1,43}, {lat_2,62}, {lat_0,30}, {lon_0,10}, {x_0,0}, {y_0,0}, {ellps_intl}, {units_m}, {no_defs},
+            /*102015*/ {proj_lcc}, {lat_1,-5}, {lat_2,-42}, {lat_0,-32}, {lon_0,-60}, {x_0,0}, {y_0,0}, {ellps_aust_sa}, {units_m}, {no_defs},
+            /*102016*/ {proj_aeqd}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102017*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102018*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102019*/ {proj_aeqd}, {lat_0,-90}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102020*/ {proj_laea}, {lat_0,-90}, {lon_0,0}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102021*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102022*/ {proj_aea}, {lat_1,20}, {lat_2,-23}, {lat_0,0}, {lon_0,25}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102023*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,20}, {lat_2,-23}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102024*/ {proj_lcc}, {lat_1,20}, {lat_2,-23}, {lat_0,0}, {lon_0,25}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102025*/ {proj_aea}, {lat_1,15}, {lat_2,65}, {lat_0,30}, {lon_0,95}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102026*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,15}, {lat_2,65}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102027*/ {proj_lcc}, {lat_1,15}, {lat_2,65}, {lat_0,30}, {lon_0,95}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102028*/ {proj_aea}, {lat_1,7}, {lat_2,-32}, {lat_0,-15}, {lon_0,125}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102029*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,7}, {lat_2,-32}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102030*/ {proj_lcc}, {lat_1,7}, {lat_2,-32}, {lat_0,-15}, {lon_0,125}, {x_0,0}, {y_0,0}, {ellps_wgs84}, {srs::dpar::datum_wgs84}, {units_m}, {no_defs},
+            /*102031*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,43}, {lat_2,62}, {x_0,0}, {y_0,0}, {ellps_intl}, {units_m}, {no_defs},
+            /*102032*/ {proj_eqdc}, {lat_0,0}, {lon_0,0}, {lat_1,-5}, {lat_2,-42}, {x_0,0}, {y_0,0}, {ellps_aust_sa}, {units_m}, {no_defs},
+            /*102033*/ {proj_aea}, {lat_1,-5}, {lat_2,-42}, {lat_0,-32}, {lon_0,-60}, {x_0,0}, {y_0,0}, {ellps_aust_sa}, {units_m}, {no_defs},
+            /*102065*/ {proj_krovak}, {lat_0,49.5}, {lon_0,24.83333333333333}, {alpha,30.28813975277778}, {k,0.9999}, {x_0,0}, {y_0,0}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102066*/ {proj_krovak}, {lat_0,49.5}, {lon_0,42.5}, {alpha,30.28813975277778}, {k,0.9999}, {x_0,0}, {y_0,0}, {ellps_bessel}, {pm,-17.66666666666667}, {units_m}, {no_defs},
+            /*102067*/ {proj_krovak}, {lat_0,49.5}, {lon_0,24.83333333333333}, {alpha,30.28813975277778}, {k,0.9999}, {x_0,0}, {y_0,0}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102091*/ {proj_tmerc}, {lat_0,0}, {lon_0,9}, {k,0.9996}, {x_0,1500000}, {y_0,0}, {ellps_intl}, {units_m}, {no_defs},
+            /*102092*/ {proj_tmerc}, {lat_0,0}, {lon_0,15}, {k,0.9996}, {x_0,2520000}, {y_0,0}, {ellps_intl}, {units_m}, {no_defs},
+            /*102101*/ {proj_tmerc}, {lat_0,58}, {lon_0,6.05625}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102102*/ {proj_tmerc}, {lat_0,58}, {lon_0,8.389583333333333}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102103*/ {proj_tmerc}, {lat_0,58}, {lon_0,10.72291666666667}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102104*/ {proj_tmerc}, {lat_0,58}, {lon_0,13.22291666666667}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102105*/ {proj_tmerc}, {lat_0,58}, {lon_0,16.88958333333333}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102106*/ {proj_tmerc}, {lat_0,58}, {lon_0,20.88958333333333}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102107*/ {proj_tmerc}, {lat_0,58}, {lon_0,24.88958333333333}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102108*/ {proj_tmerc}, {lat_0,58}, {lon_0,29.05625}, {k,1}, {x_0,0}, {y_0,0}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102110*/ {proj_lcc}, {lat_1,44}, {lat_2,49}, {lat_0,46.5}, {lon_0,3}, {x_0,700000}, {y_0,6600000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102114*/ {proj_utm}, {zone,4}, {ellps_clrk66}, {units_m}, {no_defs},
+            /*102115*/ {proj_utm}, {zone,5}, {ellps_clrk66}, {units_m}, {no_defs},
+            /*102120*/ {proj_omerc}, {lat_0,45.30916666666666}, {lonc,-86}, {alpha,337.255555555556}, {k,0.9996}, {x_0,2546731.495961392}, {y_0,-4354009.816002033}, {ellps_clrk66}, {srs::dpar::datum_nad27}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102121*/ {proj_omerc}, {lat_0,45.30916666666666}, {lonc,-86}, {alpha,337.255555555556}, {k,0.9996}, {x_0,2546731.495961392}, {y_0,-4354009.816002033}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102122*/ {proj_omerc}, {lat_0,45.30916666666666}, {lonc,-86}, {alpha,337.255555555556}, {k,0.9996}, {x_0,2546731.496}, {y_0,-4354009.816}, {ellps_clrk66}, {srs::dpar::datum_nad27}, {units_m}, {no_defs},
+            /*102123*/ {proj_omerc}, {lat_0,45.30916666666666}, {lonc,-86}, {alpha,337.255555555556}, {k,0.9996}, {x_0,2546731.496}, {y_0,-4354009.816}, {ellps_grs80}, {srs::dpar::datum_nad83}, {units_m}, {no_defs},
+            /*102132*/ {proj_utm}, {zone,32}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102133*/ {proj_utm}, {zone,33}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102134*/ {proj_utm}, {zone,34}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102135*/ {proj_utm}, {zone,35}, {a,6377492.018}, {b,6356173.508712696}, {units_m}, {no_defs},
+            /*102140*/ {proj_tmerc}, {lat_0,22.31213333333334}, {lon_0,114.1785555555556}, {k,1}, {x_0,836694.05}, {y_0,819069.8}, {ellps_intl}, {units_m}, {no_defs},
+            /*102141*/ {proj_utm}, {zone,49}, {ellps_intl}, {units_m}, {no_defs},
+            /*102142*/ {proj_utm}, {zone,50}, {ellps_intl}, {units_m}, {no_defs},
+            /*102151*/ {proj_utm}, {zone,51}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102152*/ {proj_utm}, {zone,52}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102153*/ {proj_utm}, {zone,53}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102154*/ {proj_utm}, {zone,54}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102155*/ {proj_utm}, {zone,55}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102156*/ {proj_utm}, {zone,56}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102160*/ {proj_tmerc}, {lat_0,39.66666666666666}, {lon_0,-8.131906111111112}, {k,1}, {x_0,200180.598}, {y_0,299913.01}, {ellps_intl}, {units_m}, {no_defs},
+            /*102161*/ {proj_tmerc}, {lat_0,39.66666666666666}, {lon_0,-8.131906111111112}, {k,1}, {x_0,180.598}, {y_0,-86.98999999999999}, {ellps_intl}, {units_m}, {no_defs},
+            /*102162*/ {proj_utm}, {zone,26}, {ellps_intl}, {units_m}, {no_defs},
+            /*102163*/ {proj_bonne}, {lon_0,-8.131906111111112}, {lat_1,39.66666666666666}, {x_0,0}, {y_0,0}, {ellps_bessel}, {units_m}, {no_defs},
+            /*102164*/ {proj_tmerc}, {lat_0,39.66666666666666}, {lon_0,-8.131906111111112}, {k,1}, {x_0,200000}, {y_0,300000}, {ellps_intl}, {units_m}, {no_defs},
+            /*102165*/ {proj_tmerc}, {lat_0,39.66666666666666}, {lon_0,-8.131906111111112}, {k,1}, {x_0,0}, {y_0,0}, {ellps_intl}, {units_m}, {no_defs},
+            /*102166*/ {proj_utm}, {zone,25}, {ellps_intl}, {units_m}, {no_defs},
+            /*102167*/ {proj_utm}, {zone,28}, {ellps_intl}, {units_m}, {no_defs},
+            /*102168*/ {proj_utm}, {zone,26}, {ellps_intl}, {units_m}, {no_defs},
+            /*102169*/ {proj_utm}, {zone,28}, {ellps_intl}, {units_m}, {no_defs},
+            /*102191*/ {proj_lcc}, {lat_1,33.3}, {lat_0,33.3}, {lon_0,-5.4}, {k_0,0.999625769}, {x_0,500000}, {y_0,300000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102192*/ {proj_lcc}, {lat_1,29.7}, {lat_0,29.7}, {lon_0,-5.4}, {k_0,0.9996155960000001}, {x_0,500000}, {y_0,300000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102193*/ {proj_lcc}, {lat_1,26.1}, {lat_0,26.1}, {lon_0,-5.4}, {k_0,0.9996}, {x_0,1200000}, {y_0,400000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102229*/ {proj_tmerc}, {lat_0,30.5}, {lon_0,-85.83333333333333}, {k,0.99996}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102230*/ {proj_tmerc}, {lat_0,30}, {lon_0,-87.5}, {k,0.9999333333333333}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102241*/ {proj_lcc}, {lat_1,40}, {lat_2,41.66666666666666}, {lat_0,39.33333333333334}, {lon_0,-122}, {x_0,2000000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102242*/ {proj_lcc}, {lat_1,38.33333333333334}, {lat_2,39.83333333333334}, {lat_0,37.66666666666666}, {lon_0,-122}, {x_0,2000000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102243*/ {proj_lcc}, {lat_1,37.06666666666667}, {lat_2,38.43333333333333}, {lat_0,36.5}, {lon_0,-120.5}, {x_0,2000000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102244*/ {proj_lcc}, {lat_1,36}, {lat_2,37.25}, {lat_0,35.33333333333334}, {lon_0,-119}, {x_0,2000000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102245*/ {proj_lcc}, {lat_1,34.03333333333333}, {lat_2,35.46666666666667}, {lat_0,33.5}, {lon_0,-118}, {x_0,2000000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102246*/ {proj_lcc}, {lat_1,32.78333333333333}, {lat_2,33.88333333333333}, {lat_0,32.16666666666666}, {lon_0,-116.25}, {x_0,2000000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102248*/ {proj_tmerc}, {lat_0,31}, {lon_0,-110.1666666666667}, {k,0.9999}, {x_0,213360}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102249*/ {proj_tmerc}, {lat_0,31}, {lon_0,-111.9166666666667}, {k,0.9999}, {x_0,213360}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102250*/ {proj_tmerc}, {lat_0,31}, {lon_0,-113.75}, {k,0.9999333333333333}, {x_0,213360}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102251*/ {proj_lcc}, {lat_1,34.93333333333333}, {lat_2,36.23333333333333}, {lat_0,34.33333333333334}, {lon_0,-92}, {x_0,400000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102252*/ {proj_lcc}, {lat_1,33.3}, {lat_2,34.76666666666667}, {lat_0,32.66666666666666}, {lon_0,-92}, {x_0,400000}, {y_0,400000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102253*/ {proj_lcc}, {lat_1,39.71666666666667}, {lat_2,40.78333333333333}, {lat_0,39.33333333333334}, {lon_0,-105.5}, {x_0,914401.8289}, {y_0,304800.6096}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102254*/ {proj_lcc}, {lat_1,38.45}, {lat_2,39.75}, {lat_0,37.83333333333334}, {lon_0,-105.5}, {x_0,914401.8289}, {y_0,304800.6096}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102255*/ {proj_lcc}, {lat_1,37.23333333333333}, {lat_2,38.43333333333333}, {lat_0,36.66666666666666}, {lon_0,-105.5}, {x_0,914401.8289}, {y_0,304800.6096}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102256*/ {proj_lcc}, {lat_1,41.2}, {lat_2,41.86666666666667}, {lat_0,40.83333333333334}, {lon_0,-72.75}, {x_0,304800.6096}, {y_0,152400.3048}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102257*/ {proj_tmerc}, {lat_0,38}, {lon_0,-75.41666666666667}, {k,0.999995}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102258*/ {proj_tmerc}, {lat_0,24.33333333333333}, {lon_0,-81}, {k,0.9999411764705882}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102259*/ {proj_tmerc}, {lat_0,24.33333333333333}, {lon_0,-82}, {k,0.9999411764705882}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102260*/ {proj_lcc}, {lat_1,29.58333333333333}, {lat_2,30.75}, {lat_0,29}, {lon_0,-84.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102261*/ {proj_tmerc}, {lat_0,18.83333333333333}, {lon_0,-155.5}, {k,0.9999666666666667}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102262*/ {proj_tmerc}, {lat_0,20.33333333333333}, {lon_0,-156.6666666666667}, {k,0.9999666666666667}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102263*/ {proj_tmerc}, {lat_0,21.16666666666667}, {lon_0,-158}, {k,0.99999}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102264*/ {proj_tmerc}, {lat_0,21.83333333333333}, {lon_0,-159.5}, {k,0.99999}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102265*/ {proj_tmerc}, {lat_0,21.66666666666667}, {lon_0,-160.1666666666667}, {k,1}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102266*/ {proj_tmerc}, {lat_0,30}, {lon_0,-82.16666666666667}, {k,0.9999}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102267*/ {proj_tmerc}, {lat_0,30}, {lon_0,-84.16666666666667}, {k,0.9999}, {x_0,700000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102268*/ {proj_tmerc}, {lat_0,41.66666666666666}, {lon_0,-112.1666666666667}, {k,0.9999473684210526}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102269*/ {proj_tmerc}, {lat_0,41.66666666666666}, {lon_0,-114}, {k,0.9999473684210526}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102270*/ {proj_tmerc}, {lat_0,41.66666666666666}, {lon_0,-115.75}, {k,0.9999333333333333}, {x_0,800000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102271*/ {proj_tmerc}, {lat_0,36.66666666666666}, {lon_0,-88.33333333333333}, {k,0.9999749999999999}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102272*/ {proj_tmerc}, {lat_0,36.66666666666666}, {lon_0,-90.16666666666667}, {k,0.9999411764705882}, {x_0,700000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102273*/ {proj_tmerc}, {lat_0,37.5}, {lon_0,-85.66666666666667}, {k,0.9999666666666667}, {x_0,100000}, {y_0,250000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102274*/ {proj_tmerc}, {lat_0,37.5}, {lon_0,-87.08333333333333}, {k,0.9999666666666667}, {x_0,900000}, {y_0,250000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102277*/ {proj_lcc}, {lat_1,38.71666666666667}, {lat_2,39.78333333333333}, {lat_0,38.33333333333334}, {lon_0,-98}, {x_0,400000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102278*/ {proj_lcc}, {lat_1,37.26666666666667}, {lat_2,38.56666666666667}, {lat_0,36.66666666666666}, {lon_0,-98.5}, {x_0,400000}, {y_0,400000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102279*/ {proj_lcc}, {lat_1,37.96666666666667}, {lat_2,38.96666666666667}, {lat_0,37.5}, {lon_0,-84.25}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102280*/ {proj_lcc}, {lat_1,36.73333333333333}, {lat_2,37.93333333333333}, {lat_0,36.33333333333334}, {lon_0,-85.75}, {x_0,500000}, {y_0,500000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102281*/ {proj_lcc}, {lat_1,31.16666666666667}, {lat_2,32.66666666666666}, {lat_0,30.5}, {lon_0,-92.5}, {x_0,1000000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102282*/ {proj_lcc}, {lat_1,29.3}, {lat_2,30.7}, {lat_0,28.5}, {lon_0,-91.33333333333333}, {x_0,1000000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102283*/ {proj_tmerc}, {lat_0,43.66666666666666}, {lon_0,-68.5}, {k,0.9999}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102284*/ {proj_tmerc}, {lat_0,42.83333333333334}, {lon_0,-70.16666666666667}, {k,0.9999666666666667}, {x_0,900000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102285*/ {proj_lcc}, {lat_1,38.3}, {lat_2,39.45}, {lat_0,37.66666666666666}, {lon_0,-77}, {x_0,400000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102286*/ {proj_lcc}, {lat_1,41.71666666666667}, {lat_2,42.68333333333333}, {lat_0,41}, {lon_0,-71.5}, {x_0,200000}, {y_0,750000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102287*/ {proj_lcc}, {lat_1,41.28333333333333}, {lat_2,41.48333333333333}, {lat_0,41}, {lon_0,-70.5}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102288*/ {proj_lcc}, {lat_1,45.48333333333333}, {lat_2,47.08333333333334}, {lat_0,44.78333333333333}, {lon_0,-87}, {x_0,8000000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102289*/ {proj_lcc}, {lat_1,44.18333333333333}, {lat_2,45.7}, {lat_0,43.31666666666667}, {lon_0,-84.36666666666666}, {x_0,6000000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102290*/ {proj_lcc}, {lat_1,42.1}, {lat_2,43.66666666666666}, {lat_0,41.5}, {lon_0,-84.36666666666666}, {x_0,4000000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102291*/ {proj_lcc}, {lat_1,47.03333333333333}, {lat_2,48.63333333333333}, {lat_0,46.5}, {lon_0,-93.09999999999999}, {x_0,800000}, {y_0,100000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102292*/ {proj_lcc}, {lat_1,45.61666666666667}, {lat_2,47.05}, {lat_0,45}, {lon_0,-94.25}, {x_0,800000}, {y_0,100000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102293*/ {proj_lcc}, {lat_1,43.78333333333333}, {lat_2,45.21666666666667}, {lat_0,43}, {lon_0,-94}, {x_0,800000}, {y_0,100000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102294*/ {proj_tmerc}, {lat_0,29.5}, {lon_0,-88.83333333333333}, {k,0.99995}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102295*/ {proj_tmerc}, {lat_0,29.5}, {lon_0,-90.33333333333333}, {k,0.99995}, {x_0,700000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102296*/ {proj_tmerc}, {lat_0,35.83333333333334}, {lon_0,-90.5}, {k,0.9999333333333333}, {x_0,250000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102297*/ {proj_tmerc}, {lat_0,35.83333333333334}, {lon_0,-92.5}, {k,0.9999333333333333}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102298*/ {proj_tmerc}, {lat_0,36.16666666666666}, {lon_0,-94.5}, {k,0.9999411764705882}, {x_0,850000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102300*/ {proj_lcc}, {lat_1,45}, {lat_2,49}, {lat_0,44.25}, {lon_0,-109.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102304*/ {proj_lcc}, {lat_1,40}, {lat_2,43}, {lat_0,39.83333333333334}, {lon_0,-100}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102307*/ {proj_tmerc}, {lat_0,34.75}, {lon_0,-115.5833333333333}, {k,0.9999}, {x_0,200000}, {y_0,8000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102308*/ {proj_tmerc}, {lat_0,34.75}, {lon_0,-116.6666666666667}, {k,0.9999}, {x_0,500000}, {y_0,6000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102309*/ {proj_tmerc}, {lat_0,34.75}, {lon_0,-118.5833333333333}, {k,0.9999}, {x_0,800000}, {y_0,4000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102310*/ {proj_tmerc}, {lat_0,42.5}, {lon_0,-71.66666666666667}, {k,0.9999666666666667}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102311*/ {proj_tmerc}, {lat_0,38.83333333333334}, {lon_0,-74.5}, {k,0.9999}, {x_0,150000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102312*/ {proj_tmerc}, {lat_0,31}, {lon_0,-104.3333333333333}, {k,0.9999090909090909}, {x_0,165000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102313*/ {proj_tmerc}, {lat_0,31}, {lon_0,-106.25}, {k,0.9999}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102314*/ {proj_tmerc}, {lat_0,31}, {lon_0,-107.8333333333333}, {k,0.9999166666666667}, {x_0,830000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102315*/ {proj_tmerc}, {lat_0,38.83333333333334}, {lon_0,-74.5}, {k,0.9999}, {x_0,150000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102316*/ {proj_tmerc}, {lat_0,40}, {lon_0,-76.58333333333333}, {k,0.9999375}, {x_0,250000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102317*/ {proj_tmerc}, {lat_0,40}, {lon_0,-78.58333333333333}, {k,0.9999375}, {x_0,350000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102318*/ {proj_lcc}, {lat_1,40.66666666666666}, {lat_2,41.03333333333333}, {lat_0,40.16666666666666}, {lon_0,-74}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102320*/ {proj_lcc}, {lat_1,47.43333333333333}, {lat_2,48.73333333333333}, {lat_0,47}, {lon_0,-100.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102321*/ {proj_lcc}, {lat_1,46.18333333333333}, {lat_2,47.48333333333333}, {lat_0,45.66666666666666}, {lon_0,-100.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102322*/ {proj_lcc}, {lat_1,40.43333333333333}, {lat_2,41.7}, {lat_0,39.66666666666666}, {lon_0,-82.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102323*/ {proj_lcc}, {lat_1,38.73333333333333}, {lat_2,40.03333333333333}, {lat_0,38}, {lon_0,-82.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102324*/ {proj_lcc}, {lat_1,35.56666666666667}, {lat_2,36.76666666666667}, {lat_0,35}, {lon_0,-98}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102325*/ {proj_lcc}, {lat_1,33.93333333333333}, {lat_2,35.23333333333333}, {lat_0,33.33333333333334}, {lon_0,-98}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102326*/ {proj_lcc}, {lat_1,44.33333333333334}, {lat_2,46}, {lat_0,43.66666666666666}, {lon_0,-120.5}, {x_0,2500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102327*/ {proj_lcc}, {lat_1,42.33333333333334}, {lat_2,44}, {lat_0,41.66666666666666}, {lon_0,-120.5}, {x_0,1500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102330*/ {proj_tmerc}, {lat_0,41.08333333333334}, {lon_0,-71.5}, {k,0.99999375}, {x_0,100000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102334*/ {proj_lcc}, {lat_1,44.41666666666666}, {lat_2,45.68333333333333}, {lat_0,43.83333333333334}, {lon_0,-100}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102335*/ {proj_lcc}, {lat_1,42.83333333333334}, {lat_2,44.4}, {lat_0,42.33333333333334}, {lon_0,-100.3333333333333}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102336*/ {proj_lcc}, {lat_1,35.25}, {lat_2,36.41666666666666}, {lat_0,34.33333333333334}, {lon_0,-86}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102337*/ {proj_lcc}, {lat_1,34.65}, {lat_2,36.18333333333333}, {lat_0,34}, {lon_0,-101.5}, {x_0,200000}, {y_0,1000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102338*/ {proj_lcc}, {lat_1,32.13333333333333}, {lat_2,33.96666666666667}, {lat_0,31.66666666666667}, {lon_0,-98.5}, {x_0,600000}, {y_0,2000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102339*/ {proj_lcc}, {lat_1,30.11666666666667}, {lat_2,31.88333333333333}, {lat_0,29.66666666666667}, {lon_0,-100.3333333333333}, {x_0,700000}, {y_0,3000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102340*/ {proj_lcc}, {lat_1,28.38333333333333}, {lat_2,30.28333333333334}, {lat_0,27.83333333333333}, {lon_0,-99}, {x_0,600000}, {y_0,4000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102341*/ {proj_lcc}, {lat_1,26.16666666666667}, {lat_2,27.83333333333333}, {lat_0,25.66666666666667}, {lon_0,-98.5}, {x_0,300000}, {y_0,5000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102342*/ {proj_lcc}, {lat_1,40.71666666666667}, {lat_2,41.78333333333333}, {lat_0,40.33333333333334}, {lon_0,-111.5}, {x_0,500000}, {y_0,1000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102343*/ {proj_lcc}, {lat_1,39.01666666666667}, {lat_2,40.65}, {lat_0,38.33333333333334}, {lon_0,-111.5}, {x_0,500000}, {y_0,2000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102344*/ {proj_lcc}, {lat_1,37.21666666666667}, {lat_2,38.35}, {lat_0,36.66666666666666}, {lon_0,-111.5}, {x_0,500000}, {y_0,3000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102345*/ {proj_tmerc}, {lat_0,42.5}, {lon_0,-72.5}, {k,0.9999642857142857}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102346*/ {proj_lcc}, {lat_1,38.03333333333333}, {lat_2,39.2}, {lat_0,37.66666666666666}, {lon_0,-78.5}, {x_0,3500000}, {y_0,2000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102347*/ {proj_lcc}, {lat_1,36.76666666666667}, {lat_2,37.96666666666667}, {lat_0,36.33333333333334}, {lon_0,-78.5}, {x_0,3500000}, {y_0,1000000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102348*/ {proj_lcc}, {lat_1,47.5}, {lat_2,48.73333333333333}, {lat_0,47}, {lon_0,-120.8333333333333}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102349*/ {proj_lcc}, {lat_1,45.83333333333334}, {lat_2,47.33333333333334}, {lat_0,45.33333333333334}, {lon_0,-120.5}, {x_0,500000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102350*/ {proj_lcc}, {lat_1,39}, {lat_2,40.25}, {lat_0,38.5}, {lon_0,-79.5}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102351*/ {proj_lcc}, {lat_1,37.48333333333333}, {lat_2,38.88333333333333}, {lat_0,37}, {lon_0,-81}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102352*/ {proj_lcc}, {lat_1,45.56666666666667}, {lat_2,46.76666666666667}, {lat_0,45.16666666666666}, {lon_0,-90}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102353*/ {proj_lcc}, {lat_1,44.25}, {lat_2,45.5}, {lat_0,43.83333333333334}, {lon_0,-90}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102354*/ {proj_lcc}, {lat_1,42.73333333333333}, {lat_2,44.06666666666667}, {lat_0,42}, {lon_0,-90}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102355*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-105.1666666666667}, {k,0.9999375}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102356*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-107.3333333333333}, {k,0.9999375}, {x_0,400000}, {y_0,100000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102357*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-108.75}, {k,0.9999375}, {x_0,600000}, {y_0,0}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102358*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-110.0833333333333}, {k,0.9999375}, {x_0,800000}, {y_0,100000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102361*/ {proj_lcc}, {lat_1,18.03333333333334}, {lat_2,18.43333333333333}, {lat_0,17.83333333333333}, {lon_0,-66.43333333333334}, {x_0,200000}, {y_0,200000}, {ellps_grs80}, {units_m}, {no_defs},
+            /*102491*/ {proj_lcc}, {lat_1,36}, {lat_0,36}, {lon_0,2.7}, {k_0,0.999625544}, {x_0,500000}, {y_0,300000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102492*/ {proj_lcc}, {lat_1,33.3}, {lat_0,33.3}, {lon_0,2.7}, {k_0,0.999625769}, {x_0,500000}, {y_0,300000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102581*/ {proj_lcc}, {lat_1,49.5}, {lat_0,49.5}, {lon_0,2.337229166666667}, {k_0,0.999877341}, {x_0,600000}, {y_0,1200000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102582*/ {proj_lcc}, {lat_1,46.8}, {lat_0,46.8}, {lon_0,2.337229166666667}, {k_0,0.99987742}, {x_0,600000}, {y_0,2200000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102583*/ {proj_lcc}, {lat_1,44.1}, {lat_0,44.1}, {lon_0,2.337229166666667}, {k_0,0.999877499}, {x_0,600000}, {y_0,3200000}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102584*/ {proj_lcc}, {lat_1,42.165}, {lat_0,42.165}, {lon_0,2.337229166666667}, {k_0,0.99994471}, {x_0,234.358}, {y_0,4185861.369}, {a,6378249.2}, {b,6356514.999904194}, {units_m}, {no_defs},
+            /*102591*/ {proj_lcc}, {lat_1,36}, {lat_0,36}, {lon_0,2.7}, {k_0,0.999625544}, {x_0,500135}, {y_0,300090}, {ellps_clrk80}, {units_m}, {no_defs},
+            /*102592*/ {proj_lcc}, {lat_1,33.3}, {lat_0,33.3}, {lon_0,2.7}, {k_0,0.999625769}, {x_0,500135}, {y_0,300090}, {ellps_clrk80}, {units_m}, {no_defs},
+            /*102629*/ {proj_tmerc}, {lat_0,30.5}, {lon_0,-85.83333333333333}, {k,0.99996}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102630*/ {proj_tmerc}, {lat_0,30}, {lon_0,-87.5}, {k,0.9999333333333333}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102631*/ {proj_omerc}, {lat_0,57}, {lonc,-133.6666666666667}, {alpha,-36.86989764583333}, {k,0.9999}, {x_0,4999999.999999999}, {y_0,-4999999.999999999}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102632*/ {proj_tmerc}, {lat_0,54}, {lon_0,-142}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102633*/ {proj_tmerc}, {lat_0,54}, {lon_0,-146}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102634*/ {proj_tmerc}, {lat_0,54}, {lon_0,-150}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102635*/ {proj_tmerc}, {lat_0,54}, {lon_0,-154}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102636*/ {proj_tmerc}, {lat_0,54}, {lon_0,-158}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102637*/ {proj_tmerc}, {lat_0,54}, {lon_0,-162}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102638*/ {proj_tmerc}, {lat_0,54}, {lon_0,-166}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102639*/ {proj_tmerc}, {lat_0,54}, {lon_0,-170}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102640*/ {proj_lcc}, {lat_1,51.83333333333334}, {lat_2,53.83333333333334}, {lat_0,51}, {lon_0,-176}, {x_0,1000000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102641*/ {proj_lcc}, {lat_1,40}, {lat_2,41.66666666666666}, {lat_0,39.33333333333334}, {lon_0,-122}, {x_0,2000000}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102642*/ {proj_lcc}, {lat_1,38.33333333333334}, {lat_2,39.83333333333334}, {lat_0,37.66666666666666}, {lon_0,-122}, {x_0,2000000}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102643*/ {proj_lcc}, {lat_1,37.06666666666667}, {lat_2,38.43333333333333}, {lat_0,36.5}, {lon_0,-120.5}, {x_0,2000000}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102644*/ {proj_lcc}, {lat_1,36}, {lat_2,37.25}, {lat_0,35.33333333333334}, {lon_0,-119}, {x_0,2000000}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102645*/ {proj_lcc}, {lat_1,34.03333333333333}, {lat_2,35.46666666666667}, {lat_0,33.5}, {lon_0,-118}, {x_0,2000000}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102646*/ {proj_lcc}, {lat_1,32.78333333333333}, {lat_2,33.88333333333333}, {lat_0,32.16666666666666}, {lon_0,-116.25}, {x_0,2000000}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102648*/ {proj_tmerc}, {lat_0,31}, {lon_0,-110.1666666666667}, {k,0.9999}, {x_0,213360}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102649*/ {proj_tmerc}, {lat_0,31}, {lon_0,-111.9166666666667}, {k,0.9999}, {x_0,213360}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102650*/ {proj_tmerc}, {lat_0,31}, {lon_0,-113.75}, {k,0.9999333333333333}, {x_0,213360}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102651*/ {proj_lcc}, {lat_1,34.93333333333333}, {lat_2,36.23333333333333}, {lat_0,34.33333333333334}, {lon_0,-92}, {x_0,399999.9999999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102652*/ {proj_lcc}, {lat_1,33.3}, {lat_2,34.76666666666667}, {lat_0,32.66666666666666}, {lon_0,-92}, {x_0,399999.9999999999}, {y_0,399999.9999999999}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102653*/ {proj_lcc}, {lat_1,39.71666666666667}, {lat_2,40.78333333333333}, {lat_0,39.33333333333334}, {lon_0,-105.5}, {x_0,914401.8289}, {y_0,304800.6096}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102654*/ {proj_lcc}, {lat_1,38.45}, {lat_2,39.75}, {lat_0,37.83333333333334}, {lon_0,-105.5}, {x_0,914401.8289}, {y_0,304800.6096}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102655*/ {proj_lcc}, {lat_1,37.23333333333333}, {lat_2,38.43333333333333}, {lat_0,36.66666666666666}, {lon_0,-105.5}, {x_0,914401.8289}, {y_0,304800.6096}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102656*/ {proj_lcc}, {lat_1,41.2}, {lat_2,41.86666666666667}, {lat_0,40.83333333333334}, {lon_0,-72.75}, {x_0,304800.6096}, {y_0,152400.3048}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102657*/ {proj_tmerc}, {lat_0,38}, {lon_0,-75.41666666666667}, {k,0.999995}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102658*/ {proj_tmerc}, {lat_0,24.33333333333333}, {lon_0,-81}, {k,0.9999411764705882}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102659*/ {proj_tmerc}, {lat_0,24.33333333333333}, {lon_0,-82}, {k,0.9999411764705882}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102660*/ {proj_lcc}, {lat_1,29.58333333333333}, {lat_2,30.75}, {lat_0,29}, {lon_0,-84.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102661*/ {proj_tmerc}, {lat_0,18.83333333333333}, {lon_0,-155.5}, {k,0.9999666666666667}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102662*/ {proj_tmerc}, {lat_0,20.33333333333333}, {lon_0,-156.6666666666667}, {k,0.9999666666666667}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102663*/ {proj_tmerc}, {lat_0,21.16666666666667}, {lon_0,-158}, {k,0.99999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102664*/ {proj_tmerc}, {lat_0,21.83333333333333}, {lon_0,-159.5}, {k,0.99999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102665*/ {proj_tmerc}, {lat_0,21.66666666666667}, {lon_0,-160.1666666666667}, {k,1}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102666*/ {proj_tmerc}, {lat_0,30}, {lon_0,-82.16666666666667}, {k,0.9999}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102667*/ {proj_tmerc}, {lat_0,30}, {lon_0,-84.16666666666667}, {k,0.9999}, {x_0,700000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102668*/ {proj_tmerc}, {lat_0,41.66666666666666}, {lon_0,-112.1666666666667}, {k,0.9999473684210526}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102669*/ {proj_tmerc}, {lat_0,41.66666666666666}, {lon_0,-114}, {k,0.9999473684210526}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102670*/ {proj_tmerc}, {lat_0,41.66666666666666}, {lon_0,-115.75}, {k,0.9999333333333333}, {x_0,799999.9999999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102671*/ {proj_tmerc}, {lat_0,36.66666666666666}, {lon_0,-88.33333333333333}, {k,0.9999749999999999}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102672*/ {proj_tmerc}, {lat_0,36.66666666666666}, {lon_0,-90.16666666666667}, {k,0.9999411764705882}, {x_0,700000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102673*/ {proj_tmerc}, {lat_0,37.5}, {lon_0,-85.66666666666667}, {k,0.9999666666666667}, {x_0,100000}, {y_0,250000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102674*/ {proj_tmerc}, {lat_0,37.5}, {lon_0,-87.08333333333333}, {k,0.9999666666666667}, {x_0,900000.0000000001}, {y_0,250000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102675*/ {proj_lcc}, {lat_1,42.06666666666667}, {lat_2,43.26666666666667}, {lat_0,41.5}, {lon_0,-93.5}, {x_0,1500000}, {y_0,1000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102676*/ {proj_lcc}, {lat_1,40.61666666666667}, {lat_2,41.78333333333333}, {lat_0,40}, {lon_0,-93.5}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102677*/ {proj_lcc}, {lat_1,38.71666666666667}, {lat_2,39.78333333333333}, {lat_0,38.33333333333334}, {lon_0,-98}, {x_0,399999.9999999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102678*/ {proj_lcc}, {lat_1,37.26666666666667}, {lat_2,38.56666666666667}, {lat_0,36.66666666666666}, {lon_0,-98.5}, {x_0,399999.9999999999}, {y_0,399999.9999999999}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102679*/ {proj_lcc}, {lat_1,37.96666666666667}, {lat_2,38.96666666666667}, {lat_0,37.5}, {lon_0,-84.25}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102680*/ {proj_lcc}, {lat_1,36.73333333333333}, {lat_2,37.93333333333333}, {lat_0,36.33333333333334}, {lon_0,-85.75}, {x_0,500000.0000000002}, {y_0,500000.0000000002}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102681*/ {proj_lcc}, {lat_1,31.16666666666667}, {lat_2,32.66666666666666}, {lat_0,30.5}, {lon_0,-92.5}, {x_0,1000000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102682*/ {proj_lcc}, {lat_1,29.3}, {lat_2,30.7}, {lat_0,28.5}, {lon_0,-91.33333333333333}, {x_0,1000000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102683*/ {proj_tmerc}, {lat_0,43.66666666666666}, {lon_0,-68.5}, {k,0.9999}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102684*/ {proj_tmerc}, {lat_0,42.83333333333334}, {lon_0,-70.16666666666667}, {k,0.9999666666666667}, {x_0,900000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102685*/ {proj_lcc}, {lat_1,38.3}, {lat_2,39.45}, {lat_0,37.66666666666666}, {lon_0,-77}, {x_0,399999.9999999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102686*/ {proj_lcc}, {lat_1,41.71666666666667}, {lat_2,42.68333333333333}, {lat_0,41}, {lon_0,-71.5}, {x_0,200000}, {y_0,750000.0000000001}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102687*/ {proj_lcc}, {lat_1,41.28333333333333}, {lat_2,41.48333333333333}, {lat_0,41}, {lon_0,-70.5}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102688*/ {proj_lcc}, {lat_1,45.48333333333333}, {lat_2,47.08333333333334}, {lat_0,44.78333333333333}, {lon_0,-87}, {x_0,7999999.999999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102689*/ {proj_lcc}, {lat_1,44.18333333333333}, {lat_2,45.7}, {lat_0,43.31666666666667}, {lon_0,-84.36666666666666}, {x_0,6000000.000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102690*/ {proj_lcc}, {lat_1,42.1}, {lat_2,43.66666666666666}, {lat_0,41.5}, {lon_0,-84.36666666666666}, {x_0,4000000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102691*/ {proj_lcc}, {lat_1,47.03333333333333}, {lat_2,48.63333333333333}, {lat_0,46.5}, {lon_0,-93.09999999999999}, {x_0,799999.9999999999}, {y_0,100000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102692*/ {proj_lcc}, {lat_1,45.61666666666667}, {lat_2,47.05}, {lat_0,45}, {lon_0,-94.25}, {x_0,799999.9999999999}, {y_0,100000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102693*/ {proj_lcc}, {lat_1,43.78333333333333}, {lat_2,45.21666666666667}, {lat_0,43}, {lon_0,-94}, {x_0,799999.9999999999}, {y_0,100000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102694*/ {proj_tmerc}, {lat_0,29.5}, {lon_0,-88.83333333333333}, {k,0.99995}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102695*/ {proj_tmerc}, {lat_0,29.5}, {lon_0,-90.33333333333333}, {k,0.99995}, {x_0,700000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102696*/ {proj_tmerc}, {lat_0,35.83333333333334}, {lon_0,-90.5}, {k,0.9999333333333333}, {x_0,250000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102697*/ {proj_tmerc}, {lat_0,35.83333333333334}, {lon_0,-92.5}, {k,0.9999333333333333}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102698*/ {proj_tmerc}, {lat_0,36.16666666666666}, {lon_0,-94.5}, {k,0.9999411764705882}, {x_0,850000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102700*/ {proj_lcc}, {lat_1,45}, {lat_2,49}, {lat_0,44.25}, {lon_0,-109.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102704*/ {proj_lcc}, {lat_1,40}, {lat_2,43}, {lat_0,39.83333333333334}, {lon_0,-100}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102707*/ {proj_tmerc}, {lat_0,34.75}, {lon_0,-115.5833333333333}, {k,0.9999}, {x_0,200000}, {y_0,7999999.999999999}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102708*/ {proj_tmerc}, {lat_0,34.75}, {lon_0,-116.6666666666667}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,6000000.000000001}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102709*/ {proj_tmerc}, {lat_0,34.75}, {lon_0,-118.5833333333333}, {k,0.9999}, {x_0,799999.9999999999}, {y_0,4000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102710*/ {proj_tmerc}, {lat_0,42.5}, {lon_0,-71.66666666666667}, {k,0.9999666666666667}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102711*/ {proj_tmerc}, {lat_0,38.83333333333334}, {lon_0,-74.5}, {k,0.9999}, {x_0,150000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102712*/ {proj_tmerc}, {lat_0,31}, {lon_0,-104.3333333333333}, {k,0.9999090909090909}, {x_0,165000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102713*/ {proj_tmerc}, {lat_0,31}, {lon_0,-106.25}, {k,0.9999}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102714*/ {proj_tmerc}, {lat_0,31}, {lon_0,-107.8333333333333}, {k,0.9999166666666667}, {x_0,829999.9999999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102715*/ {proj_tmerc}, {lat_0,38.83333333333334}, {lon_0,-74.5}, {k,0.9999}, {x_0,150000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102716*/ {proj_tmerc}, {lat_0,40}, {lon_0,-76.58333333333333}, {k,0.9999375}, {x_0,250000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102717*/ {proj_tmerc}, {lat_0,40}, {lon_0,-78.58333333333333}, {k,0.9999375}, {x_0,350000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102718*/ {proj_lcc}, {lat_1,40.66666666666666}, {lat_2,41.03333333333333}, {lat_0,40.16666666666666}, {lon_0,-74}, {x_0,300000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102719*/ {proj_lcc}, {lat_1,34.33333333333334}, {lat_2,36.16666666666666}, {lat_0,33.75}, {lon_0,-79}, {x_0,609601.2199999999}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102720*/ {proj_lcc}, {lat_1,47.43333333333333}, {lat_2,48.73333333333333}, {lat_0,47}, {lon_0,-100.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102721*/ {proj_lcc}, {lat_1,46.18333333333333}, {lat_2,47.48333333333333}, {lat_0,45.66666666666666}, {lon_0,-100.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102722*/ {proj_lcc}, {lat_1,40.43333333333333}, {lat_2,41.7}, {lat_0,39.66666666666666}, {lon_0,-82.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102723*/ {proj_lcc}, {lat_1,38.73333333333333}, {lat_2,40.03333333333333}, {lat_0,38}, {lon_0,-82.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102724*/ {proj_lcc}, {lat_1,35.56666666666667}, {lat_2,36.76666666666667}, {lat_0,35}, {lon_0,-98}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102725*/ {proj_lcc}, {lat_1,33.93333333333333}, {lat_2,35.23333333333333}, {lat_0,33.33333333333334}, {lon_0,-98}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102726*/ {proj_lcc}, {lat_1,44.33333333333334}, {lat_2,46}, {lat_0,43.66666666666666}, {lon_0,-120.5}, {x_0,2500000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102727*/ {proj_lcc}, {lat_1,42.33333333333334}, {lat_2,44}, {lat_0,41.66666666666666}, {lon_0,-120.5}, {x_0,1500000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102728*/ {proj_lcc}, {lat_1,40.88333333333333}, {lat_2,41.95}, {lat_0,40.16666666666666}, {lon_0,-77.75}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102729*/ {proj_lcc}, {lat_1,39.93333333333333}, {lat_2,40.96666666666667}, {lat_0,39.33333333333334}, {lon_0,-77.75}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102730*/ {proj_tmerc}, {lat_0,41.08333333333334}, {lon_0,-71.5}, {k,0.99999375}, {x_0,100000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102733*/ {proj_lcc}, {lat_1,32.5}, {lat_2,34.83333333333334}, {lat_0,31.83333333333333}, {lon_0,-81}, {x_0,609600.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102734*/ {proj_lcc}, {lat_1,44.41666666666666}, {lat_2,45.68333333333333}, {lat_0,43.83333333333334}, {lon_0,-100}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102735*/ {proj_lcc}, {lat_1,42.83333333333334}, {lat_2,44.4}, {lat_0,42.33333333333334}, {lon_0,-100.3333333333333}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102736*/ {proj_lcc}, {lat_1,35.25}, {lat_2,36.41666666666666}, {lat_0,34.33333333333334}, {lon_0,-86}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102737*/ {proj_lcc}, {lat_1,34.65}, {lat_2,36.18333333333333}, {lat_0,34}, {lon_0,-101.5}, {x_0,200000}, {y_0,1000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102738*/ {proj_lcc}, {lat_1,32.13333333333333}, {lat_2,33.96666666666667}, {lat_0,31.66666666666667}, {lon_0,-98.5}, {x_0,600000.0000000001}, {y_0,2000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102739*/ {proj_lcc}, {lat_1,30.11666666666667}, {lat_2,31.88333333333333}, {lat_0,29.66666666666667}, {lon_0,-100.3333333333333}, {x_0,700000}, {y_0,3000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102740*/ {proj_lcc}, {lat_1,28.38333333333333}, {lat_2,30.28333333333334}, {lat_0,27.83333333333333}, {lon_0,-99}, {x_0,600000.0000000001}, {y_0,4000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102741*/ {proj_lcc}, {lat_1,26.16666666666667}, {lat_2,27.83333333333333}, {lat_0,25.66666666666667}, {lon_0,-98.5}, {x_0,300000}, {y_0,4999999.999999999}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102742*/ {proj_lcc}, {lat_1,40.71666666666667}, {lat_2,41.78333333333333}, {lat_0,40.33333333333334}, {lon_0,-111.5}, {x_0,500000.0000000002}, {y_0,1000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102743*/ {proj_lcc}, {lat_1,39.01666666666667}, {lat_2,40.65}, {lat_0,38.33333333333334}, {lon_0,-111.5}, {x_0,500000.0000000002}, {y_0,2000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102744*/ {proj_lcc}, {lat_1,37.21666666666667}, {lat_2,38.35}, {lat_0,36.66666666666666}, {lon_0,-111.5}, {x_0,500000.0000000002}, {y_0,3000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102745*/ {proj_tmerc}, {lat_0,42.5}, {lon_0,-72.5}, {k,0.9999642857142857}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102746*/ {proj_lcc}, {lat_1,38.03333333333333}, {lat_2,39.2}, {lat_0,37.66666666666666}, {lon_0,-78.5}, {x_0,3499999.999999999}, {y_0,2000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102747*/ {proj_lcc}, {lat_1,36.76666666666667}, {lat_2,37.96666666666667}, {lat_0,36.33333333333334}, {lon_0,-78.5}, {x_0,3499999.999999999}, {y_0,1000000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102748*/ {proj_lcc}, {lat_1,47.5}, {lat_2,48.73333333333333}, {lat_0,47}, {lon_0,-120.8333333333333}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102749*/ {proj_lcc}, {lat_1,45.83333333333334}, {lat_2,47.33333333333334}, {lat_0,45.33333333333334}, {lon_0,-120.5}, {x_0,500000.0000000002}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102750*/ {proj_lcc}, {lat_1,39}, {lat_2,40.25}, {lat_0,38.5}, {lon_0,-79.5}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102751*/ {proj_lcc}, {lat_1,37.48333333333333}, {lat_2,38.88333333333333}, {lat_0,37}, {lon_0,-81}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102752*/ {proj_lcc}, {lat_1,45.56666666666667}, {lat_2,46.76666666666667}, {lat_0,45.16666666666666}, {lon_0,-90}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102753*/ {proj_lcc}, {lat_1,44.25}, {lat_2,45.5}, {lat_0,43.83333333333334}, {lon_0,-90}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102754*/ {proj_lcc}, {lat_1,42.73333333333333}, {lat_2,44.06666666666667}, {lat_0,42}, {lon_0,-90}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102755*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-105.1666666666667}, {k,0.9999375}, {x_0,200000}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102756*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-107.3333333333333}, {k,0.9999375}, {x_0,399999.9999999999}, {y_0,100000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102757*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-108.75}, {k,0.9999375}, {x_0,600000.0000000001}, {y_0,0}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102758*/ {proj_tmerc}, {lat_0,40.5}, {lon_0,-110.0833333333333}, {k,0.9999375}, {x_0,799999.9999999999}, {y_0,100000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102761*/ {proj_lcc}, {lat_1,18.03333333333334}, {lat_2,18.43333333333333}, {lat_0,17.83333333333333}, {lon_0,-66.43333333333334}, {x_0,200000}, {y_0,200000}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*102766*/ {proj_poly}, {lat_0,13.47246635277778}, {lon_0,-144.7487507055556}, {x_0,49999.99999999999}, {y_0,49999.99999999999}, {ellps_grs80}, {srs::dpar::datum_nad83}, {to_meter,0.3048006096012192}, {no_defs},
+            /*103300*/ {proj_lcc}, {lat_1,49.8333339}, {lat_2,51.16666733333333}, {lat_0,90}, {lon_0,4.367486666666666}, {x_0,150000.01256}, {y_0,5400088.4378}, {ellps_intl}, {units_m}, {no_defs},
+            /*104000*/ {proj_longlat}, {ellps_clrk66}, {srs::dpar::datum_nad27}, {no_defs},
+            /*104101*/ {proj_longlat}, {ellps_bessel}, {no_defs},
+            /*104102*/ {proj_longlat}, {ellps_bessel}, {no_defs},
+            /*104103*/ {proj_longlat}, {ellps_clrk80}, {no_defs},
+            /*104104*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*104105*/ {proj_longlat}, {ellps_bessel}, {no_defs},
+            /*104106*/ {proj_longlat}, {ellps_intl}, {no_defs},
+            /*104107*/ {proj_longlat}, {ellps_grs80}, {no_defs},
+            /*104108*/ {proj_longlat}, {ellps_grs80}, {no_defs},
+            /*104261*/ {proj_longlat}, {a,6378249.2}, {b,6356514.999904194}, {no_defs},
+            /*104304*/ {proj_longlat}, {a,6378249.2}, {b,6356514.999904194}, {no_defs},
+            /*104305*/ {proj_longlat}, {ellps_clrk80}, {no_defs}
+        };
+
+        static constexpr code_element elements[] = {
+            {37001, 0, 3},
+            {37002, 3, 4},
+            {37003, 7, 4},
+            {37004, 11, 3},
+            {37005, 14, 4},
+            {37006, 18, 4},
+            {37007, 22, 4},
+            {37008, 26, 3},
+            {37201, 29, 3},
+            {37202, 32, 4},
+            {37203, 36, 4},
+            {37204, 40, 3},
+            {37205, 43, 3},
+            {37206, 46, 3},
+            {37207, 49, 3},
+            {37208, 52, 3},
+            {37211, 55, 3},
+            {37212, 58, 3},
+            {37213, 61, 3},
+            {37214, 64, 3},
+            {37215, 67, 3},
+            {37216, 70, 3},
+            {37217, 73, 3},
+            {37218, 76, 3},
+            {37219, 79, 3},
+            {37220, 82, 3},
+            {37221, 85, 3},
+            {37222, 88, 3},
+            {37223, 91, 4},
+            {37224, 95, 3},
+            {37226, 98, 3},
+            {37227, 101, 3},
+            {37228, 104, 3},
+            {37229, 107, 4},
+            {37230, 111, 3},
+            {37231, 114, 3},
+            {37232, 117, 3},
+            {37233, 120, 3},
+            {37234, 123, 3},
+            {37235, 126, 3},
+            {37237, 129, 3},
+            {37238, 132, 3},
+            {37239, 135, 3},
+            {37240, 138, 3},
+            {37241, 141, 3},
+            {37242, 144, 3},
+            {37243, 147, 3},
+            {37245, 150, 3},
+            {37246, 153, 3},
+            {37247, 156, 3},
+            {37249, 159, 3},
+            {37250, 162, 3},
+            {37251, 165, 3},
+            {37252, 168, 3},
+            {37253, 171, 3},
+            {37254, 174, 3},
+            {37255, 177, 3},
+            {37257, 180, 3},
+            {37259, 183, 3},
+            {37260, 186, 3},
             //{53001},
-            {53002, srs::dpar::parameters<>(proj_eqc)(lat_ts,60)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53003, srs::dpar::parameters<>(proj_mill)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(r_au)(r,6371000)(units_m)(no_defs)},
-            {53004, srs::dpar::parameters<>(proj_merc)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53008, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53009, srs::dpar::parameters<>(proj_moll)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53010, srs::dpar::parameters<>(proj_eck6)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
+            {53002, 189, 9},
+            {53003, 198, 9},
+            {53004, 207, 8},
+            {53008, 215, 7},
+            {53009, 222, 7},
+            {53010, 229, 7},
             //{53011},
-            {53012, srs::dpar::parameters<>(proj_eck4)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
+            {53012, 236, 7},
             //{53013},
             //{53014},
             //{53015},
-            {53016, srs::dpar::parameters<>(proj_gall)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
+            {53016, 243, 7},
             //{53017},
             //{53018},
             //{53019},
-            {53021, srs::dpar::parameters<>(proj_poly)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
+            {53021, 250, 8},
             //{53022},
             //{53023},
-            {53024, srs::dpar::parameters<>(proj_bonne)(lon_0,0)(lat_1,60)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53025, srs::dpar::parameters<>(proj_omerc)(lat_0,40)(lon_1,0)(lat_1,0)(lon_2,0)(lat_2,0)(k,1)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53026, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53027, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,60)(lat_2,60)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53028, srs::dpar::parameters<>(proj_cass)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53029, srs::dpar::parameters<>(proj_vandg)(lon_0,0)(x_0,0)(y_0,0)(r_au)(r,6371000)(units_m)(no_defs)},
-            {53030, srs::dpar::parameters<>(proj_robin)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53031, srs::dpar::parameters<>(proj_tpeqd)(lat_1,0)(lon_1,0)(lat_2,60)(lon_2,60)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
-            {53032, srs::dpar::parameters<>(proj_aeqd)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(r,6371000)(units_m)(no_defs)},
+            {53024, 258, 8},
+            {53025, 266, 12},
+            {53026, 278, 9},
+            {53027, 287, 10},
+            {53028, 297, 8},
+            {53029, 305, 8},
+            {53030, 313, 7},
+            {53031, 320, 10},
+            {53032, 330, 8},
             //{54001},
-            {54002, srs::dpar::parameters<>(proj_eqc)(lat_ts,60)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54003, srs::dpar::parameters<>(proj_mill)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(r_au)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54004, srs::dpar::parameters<>(proj_merc)(lon_0,0)(k,1)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54008, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54009, srs::dpar::parameters<>(proj_moll)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54010, srs::dpar::parameters<>(proj_eck6)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
+            {54002, 338, 10},
+            {54003, 348, 10},
+            {54004, 358, 9},
+            {54008, 367, 8},
+            {54009, 375, 8},
+            {54010, 383, 8},
             //{54011},
-            {54012, srs::dpar::parameters<>(proj_eck4)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
+            {54012, 391, 8},
             //{54013},
             //{54014},
             //{54015},
-            {54016, srs::dpar::parameters<>(proj_gall)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
+            {54016, 399, 8},
             //{54017},
             //{54018},
             //{54019},
-            {54021, srs::dpar::parameters<>(proj_poly)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
+            {54021, 407, 9},
             //{54022},
             //{54023},
-            {54024, srs::dpar::parameters<>(proj_bonne)(lon_0,0)(lat_1,60)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54025, srs::dpar::parameters<>(proj_omerc)(lat_0,40)(lon_1,0)(lat_1,0)(lon_2,0)(lat_2,0)(k,1)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54026, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54027, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,60)(lat_2,60)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54028, srs::dpar::parameters<>(proj_cass)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54029, srs::dpar::parameters<>(proj_vandg)(lon_0,0)(x_0,0)(y_0,0)(r_au)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54030, srs::dpar::parameters<>(proj_robin)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54031, srs::dpar::parameters<>(proj_tpeqd)(lat_1,0)(lon_1,0)(lat_2,60)(lon_2,60)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {54032, srs::dpar::parameters<>(proj_aeqd)(lat_0,0)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {65061, srs::dpar::parameters<>(proj_poly)(lat_0,13.47246635277778)(lon_0,-144.7487507055556)(x_0,50000.00000000001)(y_0,50000.00000000001)(ellps_clrk66)(srs::dpar::datum_nad27)(to_meter,0.3048006096012192)(no_defs)},
-            {65161, srs::dpar::parameters<>(proj_poly)(lat_0,13.47246635277778)(lon_0,-144.7487507055556)(x_0,50000)(y_0,50000)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102001, srs::dpar::parameters<>(proj_aea)(lat_1,50)(lat_2,70)(lat_0,40)(lon_0,-96)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102002, srs::dpar::parameters<>(proj_lcc)(lat_1,50)(lat_2,70)(lat_0,40)(lon_0,-96)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102003, srs::dpar::parameters<>(proj_aea)(lat_1,29.5)(lat_2,45.5)(lat_0,37.5)(lon_0,-96)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102004, srs::dpar::parameters<>(proj_lcc)(lat_1,33)(lat_2,45)(lat_0,39)(lon_0,-96)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102005, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,33)(lat_2,45)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102006, srs::dpar::parameters<>(proj_aea)(lat_1,55)(lat_2,65)(lat_0,50)(lon_0,-154)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102007, srs::dpar::parameters<>(proj_aea)(lat_1,8)(lat_2,18)(lat_0,13)(lon_0,-157)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102008, srs::dpar::parameters<>(proj_aea)(lat_1,20)(lat_2,60)(lat_0,40)(lon_0,-96)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102009, srs::dpar::parameters<>(proj_lcc)(lat_1,20)(lat_2,60)(lat_0,40)(lon_0,-96)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102010, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,20)(lat_2,60)(x_0,0)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102011, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102012, srs::dpar::parameters<>(proj_lcc)(lat_1,30)(lat_2,62)(lat_0,0)(lon_0,105)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102013, srs::dpar::parameters<>(proj_aea)(lat_1,43)(lat_2,62)(lat_0,30)(lon_0,10)(x_0,0)(y_0,0)(ellps_intl)(units_m)(no_defs)},
-            {102014, srs::dpar::parameters<>(proj_lcc)(lat_1,43)(lat_2,62)(lat_0,30)(lon_0,10)(x_0,0)(y_0,0)(ellps_intl)(units_m)(no_defs)},
-            {102015, srs::dpar::parameters<>(proj_lcc)(lat_1,-5)(lat_2,-42)(lat_0,-32)(lon_0,-60)(x_0,0)(y_0,0)(ellps_aust_sa)(units_m)(no_defs)},
-            {102016, srs::dpar::parameters<>(proj_aeqd)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102017, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102018, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102019, srs::dpar::parameters<>(proj_aeqd)(lat_0,-90)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102020, srs::dpar::parameters<>(proj_laea)(lat_0,-90)(lon_0,0)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102021, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102022, srs::dpar::parameters<>(proj_aea)(lat_1,20)(lat_2,-23)(lat_0,0)(lon_0,25)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102023, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,20)(lat_2,-23)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102024, srs::dpar::parameters<>(proj_lcc)(lat_1,20)(lat_2,-23)(lat_0,0)(lon_0,25)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102025, srs::dpar::parameters<>(proj_aea)(lat_1,15)(lat_2,65)(lat_0,30)(lon_0,95)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102026, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,15)(lat_2,65)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102027, srs::dpar::parameters<>(proj_lcc)(lat_1,15)(lat_2,65)(lat_0,30)(lon_0,95)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102028, srs::dpar::parameters<>(proj_aea)(lat_1,7)(lat_2,-32)(lat_0,-15)(lon_0,125)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102029, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,7)(lat_2,-32)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102030, srs::dpar::parameters<>(proj_lcc)(lat_1,7)(lat_2,-32)(lat_0,-15)(lon_0,125)(x_0,0)(y_0,0)(ellps_wgs84)(srs::dpar::datum_wgs84)(units_m)(no_defs)},
-            {102031, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,43)(lat_2,62)(x_0,0)(y_0,0)(ellps_intl)(units_m)(no_defs)},
-            {102032, srs::dpar::parameters<>(proj_eqdc)(lat_0,0)(lon_0,0)(lat_1,-5)(lat_2,-42)(x_0,0)(y_0,0)(ellps_aust_sa)(units_m)(no_defs)},
-            {102033, srs::dpar::parameters<>(proj_aea)(lat_1,-5)(lat_2,-42)(lat_0,-32)(lon_0,-60)(x_0,0)(y_0,0)(ellps_aust_sa)(units_m)(no_defs)},
-            {102065, srs::dpar::parameters<>(proj_krovak)(lat_0,49.5)(lon_0,24.83333333333333)(alpha,30.28813975277778)(k,0.9999)(x_0,0)(y_0,0)(ellps_bessel)(units_m)(no_defs)},
-            {102066, srs::dpar::parameters<>(proj_krovak)(lat_0,49.5)(lon_0,42.5)(alpha,30.28813975277778)(k,0.9999)(x_0,0)(y_0,0)(ellps_bessel)(pm,-17.66666666666667)(units_m)(no_defs)},
-            {102067, srs::dpar::parameters<>(proj_krovak)(lat_0,49.5)(lon_0,24.83333333333333)(alpha,30.28813975277778)(k,0.9999)(x_0,0)(y_0,0)(ellps_bessel)(units_m)(no_defs)},
-            {102091, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,9)(k,0.9996)(x_0,1500000)(y_0,0)(ellps_intl)(units_m)(no_defs)},
-            {102092, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,15)(k,0.9996)(x_0,2520000)(y_0,0)(ellps_intl)(units_m)(no_defs)},
-            {102101, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,6.05625)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102102, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,8.389583333333333)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102103, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,10.72291666666667)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102104, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,13.22291666666667)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102105, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,16.88958333333333)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102106, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,20.88958333333333)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102107, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,24.88958333333333)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102108, srs::dpar::parameters<>(proj_tmerc)(lat_0,58)(lon_0,29.05625)(k,1)(x_0,0)(y_0,0)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102110, srs::dpar::parameters<>(proj_lcc)(lat_1,44)(lat_2,49)(lat_0,46.5)(lon_0,3)(x_0,700000)(y_0,6600000)(ellps_grs80)(units_m)(no_defs)},
-            {102114, srs::dpar::parameters<>(proj_utm)(zone,4)(ellps_clrk66)(units_m)(no_defs)},
-            {102115, srs::dpar::parameters<>(proj_utm)(zone,5)(ellps_clrk66)(units_m)(no_defs)},
-            {102120, srs::dpar::parameters<>(proj_omerc)(lat_0,45.30916666666666)(lonc,-86)(alpha,337.255555555556)(k,0.9996)(x_0,2546731.495961392)(y_0,-4354009.816002033)(ellps_clrk66)(srs::dpar::datum_nad27)(to_meter,0.3048006096012192)(no_defs)},
-            {102121, srs::dpar::parameters<>(proj_omerc)(lat_0,45.30916666666666)(lonc,-86)(alpha,337.255555555556)(k,0.9996)(x_0,2546731.495961392)(y_0,-4354009.816002033)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102122, srs::dpar::parameters<>(proj_omerc)(lat_0,45.30916666666666)(lonc,-86)(alpha,337.255555555556)(k,0.9996)(x_0,2546731.496)(y_0,-4354009.816)(ellps_clrk66)(srs::dpar::datum_nad27)(units_m)(no_defs)},
-            {102123, srs::dpar::parameters<>(proj_omerc)(lat_0,45.30916666666666)(lonc,-86)(alpha,337.255555555556)(k,0.9996)(x_0,2546731.496)(y_0,-4354009.816)(ellps_grs80)(srs::dpar::datum_nad83)(units_m)(no_defs)},
-            {102132, srs::dpar::parameters<>(proj_utm)(zone,32)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102133, srs::dpar::parameters<>(proj_utm)(zone,33)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102134, srs::dpar::parameters<>(proj_utm)(zone,34)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102135, srs::dpar::parameters<>(proj_utm)(zone,35)(a,6377492.018)(b,6356173.508712696)(units_m)(no_defs)},
-            {102140, srs::dpar::parameters<>(proj_tmerc)(lat_0,22.31213333333334)(lon_0,114.1785555555556)(k,1)(x_0,836694.05)(y_0,819069.8)(ellps_intl)(units_m)(no_defs)},
-            {102141, srs::dpar::parameters<>(proj_utm)(zone,49)(ellps_intl)(units_m)(no_defs)},
-            {102142, srs::dpar::parameters<>(proj_utm)(zone,50)(ellps_intl)(units_m)(no_defs)},
-            {102151, srs::dpar::parameters<>(proj_utm)(zone,51)(ellps_bessel)(units_m)(no_defs)},
-            {102152, srs::dpar::parameters<>(proj_utm)(zone,52)(ellps_bessel)(units_m)(no_defs)},
-            {102153, srs::dpar::parameters<>(proj_utm)(zone,53)(ellps_bessel)(units_m)(no_defs)},
-            {102154, srs::dpar::parameters<>(proj_utm)(zone,54)(ellps_bessel)(units_m)(no_defs)},
-            {102155, srs::dpar::parameters<>(proj_utm)(zone,55)(ellps_bessel)(units_m)(no_defs)},
-            {102156, srs::dpar::parameters<>(proj_utm)(zone,56)(ellps_bessel)(units_m)(no_defs)},
-            {102160, srs::dpar::parameters<>(proj_tmerc)(lat_0,39.66666666666666)(lon_0,-8.131906111111112)(k,1)(x_0,200180.598)(y_0,299913.01)(ellps_intl)(units_m)(no_defs)},
-            {102161, srs::dpar::parameters<>(proj_tmerc)(lat_0,39.66666666666666)(lon_0,-8.131906111111112)(k,1)(x_0,180.598)(y_0,-86.98999999999999)(ellps_intl)(units_m)(no_defs)},
-            {102162, srs::dpar::parameters<>(proj_utm)(zone,26)(ellps_intl)(units_m)(no_defs)},
-            {102163, srs::dpar::parameters<>(proj_bonne)(lon_0,-8.131906111111112)(lat_1,39.66666666666666)(x_0,0)(y_0,0)(ellps_bessel)(units_m)(no_defs)},
-            {102164, srs::dpar::parameters<>(proj_tmerc)(lat_0,39.66666666666666)(lon_0,-8.131906111111112)(k,1)(x_0,200000)(y_0,300000)(ellps_intl)(units_m)(no_defs)},
-            {102165, srs::dpar::parameters<>(proj_tmerc)(lat_0,39.66666666666666)(lon_0,-8.131906111111112)(k,1)(x_0,0)(y_0,0)(ellps_intl)(units_m)(no_defs)},
-            {102166, srs::dpar::parameters<>(proj_utm)(zone,25)(ellps_intl)(units_m)(no_defs)},
-            {102167, srs::dpar::parameters<>(proj_utm)(zone,28)(ellps_intl)(units_m)(no_defs)},
-            {102168, srs::dpar::parameters<>(proj_utm)(zone,26)(ellps_intl)(units_m)(no_defs)},
-            {102169, srs::dpar::parameters<>(proj_utm)(zone,28)(ellps_intl)(units_m)(no_defs)},
-            {102191, srs::dpar::parameters<>(proj_lcc)(lat_1,33.3)(lat_0,33.3)(lon_0,-5.4)(k_0,0.999625769)(x_0,500000)(y_0,300000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102192, srs::dpar::parameters<>(proj_lcc)(lat_1,29.7)(lat_0,29.7)(lon_0,-5.4)(k_0,0.9996155960000001)(x_0,500000)(y_0,300000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102193, srs::dpar::parameters<>(proj_lcc)(lat_1,26.1)(lat_0,26.1)(lon_0,-5.4)(k_0,0.9996)(x_0,1200000)(y_0,400000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102229, srs::dpar::parameters<>(proj_tmerc)(lat_0,30.5)(lon_0,-85.83333333333333)(k,0.99996)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102230, srs::dpar::parameters<>(proj_tmerc)(lat_0,30)(lon_0,-87.5)(k,0.9999333333333333)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102241, srs::dpar::parameters<>(proj_lcc)(lat_1,40)(lat_2,41.66666666666666)(lat_0,39.33333333333334)(lon_0,-122)(x_0,2000000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102242, srs::dpar::parameters<>(proj_lcc)(lat_1,38.33333333333334)(lat_2,39.83333333333334)(lat_0,37.66666666666666)(lon_0,-122)(x_0,2000000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102243, srs::dpar::parameters<>(proj_lcc)(lat_1,37.06666666666667)(lat_2,38.43333333333333)(lat_0,36.5)(lon_0,-120.5)(x_0,2000000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102244, srs::dpar::parameters<>(proj_lcc)(lat_1,36)(lat_2,37.25)(lat_0,35.33333333333334)(lon_0,-119)(x_0,2000000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102245, srs::dpar::parameters<>(proj_lcc)(lat_1,34.03333333333333)(lat_2,35.46666666666667)(lat_0,33.5)(lon_0,-118)(x_0,2000000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102246, srs::dpar::parameters<>(proj_lcc)(lat_1,32.78333333333333)(lat_2,33.88333333333333)(lat_0,32.16666666666666)(lon_0,-116.25)(x_0,2000000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102248, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-110.1666666666667)(k,0.9999)(x_0,213360)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102249, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-111.9166666666667)(k,0.9999)(x_0,213360)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102250, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-113.75)(k,0.9999333333333333)(x_0,213360)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102251, srs::dpar::parameters<>(proj_lcc)(lat_1,34.93333333333333)(lat_2,36.23333333333333)(lat_0,34.33333333333334)(lon_0,-92)(x_0,400000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102252, srs::dpar::parameters<>(proj_lcc)(lat_1,33.3)(lat_2,34.76666666666667)(lat_0,32.66666666666666)(lon_0,-92)(x_0,400000)(y_0,400000)(ellps_grs80)(units_m)(no_defs)},
-            {102253, srs::dpar::parameters<>(proj_lcc)(lat_1,39.71666666666667)(lat_2,40.78333333333333)(lat_0,39.33333333333334)(lon_0,-105.5)(x_0,914401.8289)(y_0,304800.6096)(ellps_grs80)(units_m)(no_defs)},
-            {102254, srs::dpar::parameters<>(proj_lcc)(lat_1,38.45)(lat_2,39.75)(lat_0,37.83333333333334)(lon_0,-105.5)(x_0,914401.8289)(y_0,304800.6096)(ellps_grs80)(units_m)(no_defs)},
-            {102255, srs::dpar::parameters<>(proj_lcc)(lat_1,37.23333333333333)(lat_2,38.43333333333333)(lat_0,36.66666666666666)(lon_0,-105.5)(x_0,914401.8289)(y_0,304800.6096)(ellps_grs80)(units_m)(no_defs)},
-            {102256, srs::dpar::parameters<>(proj_lcc)(lat_1,41.2)(lat_2,41.86666666666667)(lat_0,40.83333333333334)(lon_0,-72.75)(x_0,304800.6096)(y_0,152400.3048)(ellps_grs80)(units_m)(no_defs)},
-            {102257, srs::dpar::parameters<>(proj_tmerc)(lat_0,38)(lon_0,-75.41666666666667)(k,0.999995)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102258, srs::dpar::parameters<>(proj_tmerc)(lat_0,24.33333333333333)(lon_0,-81)(k,0.9999411764705882)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102259, srs::dpar::parameters<>(proj_tmerc)(lat_0,24.33333333333333)(lon_0,-82)(k,0.9999411764705882)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102260, srs::dpar::parameters<>(proj_lcc)(lat_1,29.58333333333333)(lat_2,30.75)(lat_0,29)(lon_0,-84.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102261, srs::dpar::parameters<>(proj_tmerc)(lat_0,18.83333333333333)(lon_0,-155.5)(k,0.9999666666666667)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102262, srs::dpar::parameters<>(proj_tmerc)(lat_0,20.33333333333333)(lon_0,-156.6666666666667)(k,0.9999666666666667)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102263, srs::dpar::parameters<>(proj_tmerc)(lat_0,21.16666666666667)(lon_0,-158)(k,0.99999)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102264, srs::dpar::parameters<>(proj_tmerc)(lat_0,21.83333333333333)(lon_0,-159.5)(k,0.99999)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102265, srs::dpar::parameters<>(proj_tmerc)(lat_0,21.66666666666667)(lon_0,-160.1666666666667)(k,1)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102266, srs::dpar::parameters<>(proj_tmerc)(lat_0,30)(lon_0,-82.16666666666667)(k,0.9999)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102267, srs::dpar::parameters<>(proj_tmerc)(lat_0,30)(lon_0,-84.16666666666667)(k,0.9999)(x_0,700000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102268, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.66666666666666)(lon_0,-112.1666666666667)(k,0.9999473684210526)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102269, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.66666666666666)(lon_0,-114)(k,0.9999473684210526)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102270, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.66666666666666)(lon_0,-115.75)(k,0.9999333333333333)(x_0,800000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102271, srs::dpar::parameters<>(proj_tmerc)(lat_0,36.66666666666666)(lon_0,-88.33333333333333)(k,0.9999749999999999)(x_0,300000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102272, srs::dpar::parameters<>(proj_tmerc)(lat_0,36.66666666666666)(lon_0,-90.16666666666667)(k,0.9999411764705882)(x_0,700000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102273, srs::dpar::parameters<>(proj_tmerc)(lat_0,37.5)(lon_0,-85.66666666666667)(k,0.9999666666666667)(x_0,100000)(y_0,250000)(ellps_grs80)(units_m)(no_defs)},
-            {102274, srs::dpar::parameters<>(proj_tmerc)(lat_0,37.5)(lon_0,-87.08333333333333)(k,0.9999666666666667)(x_0,900000)(y_0,250000)(ellps_grs80)(units_m)(no_defs)},
-            {102277, srs::dpar::parameters<>(proj_lcc)(lat_1,38.71666666666667)(lat_2,39.78333333333333)(lat_0,38.33333333333334)(lon_0,-98)(x_0,400000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102278, srs::dpar::parameters<>(proj_lcc)(lat_1,37.26666666666667)(lat_2,38.56666666666667)(lat_0,36.66666666666666)(lon_0,-98.5)(x_0,400000)(y_0,400000)(ellps_grs80)(units_m)(no_defs)},
-            {102279, srs::dpar::parameters<>(proj_lcc)(lat_1,37.96666666666667)(lat_2,38.96666666666667)(lat_0,37.5)(lon_0,-84.25)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102280, srs::dpar::parameters<>(proj_lcc)(lat_1,36.73333333333333)(lat_2,37.93333333333333)(lat_0,36.33333333333334)(lon_0,-85.75)(x_0,500000)(y_0,500000)(ellps_grs80)(units_m)(no_defs)},
-            {102281, srs::dpar::parameters<>(proj_lcc)(lat_1,31.16666666666667)(lat_2,32.66666666666666)(lat_0,30.5)(lon_0,-92.5)(x_0,1000000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102282, srs::dpar::parameters<>(proj_lcc)(lat_1,29.3)(lat_2,30.7)(lat_0,28.5)(lon_0,-91.33333333333333)(x_0,1000000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102283, srs::dpar::parameters<>(proj_tmerc)(lat_0,43.66666666666666)(lon_0,-68.5)(k,0.9999)(x_0,300000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102284, srs::dpar::parameters<>(proj_tmerc)(lat_0,42.83333333333334)(lon_0,-70.16666666666667)(k,0.9999666666666667)(x_0,900000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102285, srs::dpar::parameters<>(proj_lcc)(lat_1,38.3)(lat_2,39.45)(lat_0,37.66666666666666)(lon_0,-77)(x_0,400000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102286, srs::dpar::parameters<>(proj_lcc)(lat_1,41.71666666666667)(lat_2,42.68333333333333)(lat_0,41)(lon_0,-71.5)(x_0,200000)(y_0,750000)(ellps_grs80)(units_m)(no_defs)},
-            {102287, srs::dpar::parameters<>(proj_lcc)(lat_1,41.28333333333333)(lat_2,41.48333333333333)(lat_0,41)(lon_0,-70.5)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102288, srs::dpar::parameters<>(proj_lcc)(lat_1,45.48333333333333)(lat_2,47.08333333333334)(lat_0,44.78333333333333)(lon_0,-87)(x_0,8000000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102289, srs::dpar::parameters<>(proj_lcc)(lat_1,44.18333333333333)(lat_2,45.7)(lat_0,43.31666666666667)(lon_0,-84.36666666666666)(x_0,6000000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102290, srs::dpar::parameters<>(proj_lcc)(lat_1,42.1)(lat_2,43.66666666666666)(lat_0,41.5)(lon_0,-84.36666666666666)(x_0,4000000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102291, srs::dpar::parameters<>(proj_lcc)(lat_1,47.03333333333333)(lat_2,48.63333333333333)(lat_0,46.5)(lon_0,-93.09999999999999)(x_0,800000)(y_0,100000)(ellps_grs80)(units_m)(no_defs)},
-            {102292, srs::dpar::parameters<>(proj_lcc)(lat_1,45.61666666666667)(lat_2,47.05)(lat_0,45)(lon_0,-94.25)(x_0,800000)(y_0,100000)(ellps_grs80)(units_m)(no_defs)},
-            {102293, srs::dpar::parameters<>(proj_lcc)(lat_1,43.78333333333333)(lat_2,45.21666666666667)(lat_0,43)(lon_0,-94)(x_0,800000)(y_0,100000)(ellps_grs80)(units_m)(no_defs)},
-            {102294, srs::dpar::parameters<>(proj_tmerc)(lat_0,29.5)(lon_0,-88.83333333333333)(k,0.99995)(x_0,300000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102295, srs::dpar::parameters<>(proj_tmerc)(lat_0,29.5)(lon_0,-90.33333333333333)(k,0.99995)(x_0,700000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102296, srs::dpar::parameters<>(proj_tmerc)(lat_0,35.83333333333334)(lon_0,-90.5)(k,0.9999333333333333)(x_0,250000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102297, srs::dpar::parameters<>(proj_tmerc)(lat_0,35.83333333333334)(lon_0,-92.5)(k,0.9999333333333333)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102298, srs::dpar::parameters<>(proj_tmerc)(lat_0,36.16666666666666)(lon_0,-94.5)(k,0.9999411764705882)(x_0,850000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102300, srs::dpar::parameters<>(proj_lcc)(lat_1,45)(lat_2,49)(lat_0,44.25)(lon_0,-109.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102304, srs::dpar::parameters<>(proj_lcc)(lat_1,40)(lat_2,43)(lat_0,39.83333333333334)(lon_0,-100)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102307, srs::dpar::parameters<>(proj_tmerc)(lat_0,34.75)(lon_0,-115.5833333333333)(k,0.9999)(x_0,200000)(y_0,8000000)(ellps_grs80)(units_m)(no_defs)},
-            {102308, srs::dpar::parameters<>(proj_tmerc)(lat_0,34.75)(lon_0,-116.6666666666667)(k,0.9999)(x_0,500000)(y_0,6000000)(ellps_grs80)(units_m)(no_defs)},
-            {102309, srs::dpar::parameters<>(proj_tmerc)(lat_0,34.75)(lon_0,-118.5833333333333)(k,0.9999)(x_0,800000)(y_0,4000000)(ellps_grs80)(units_m)(no_defs)},
-            {102310, srs::dpar::parameters<>(proj_tmerc)(lat_0,42.5)(lon_0,-71.66666666666667)(k,0.9999666666666667)(x_0,300000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102311, srs::dpar::parameters<>(proj_tmerc)(lat_0,38.83333333333334)(lon_0,-74.5)(k,0.9999)(x_0,150000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102312, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-104.3333333333333)(k,0.9999090909090909)(x_0,165000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102313, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-106.25)(k,0.9999)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102314, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-107.8333333333333)(k,0.9999166666666667)(x_0,830000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102315, srs::dpar::parameters<>(proj_tmerc)(lat_0,38.83333333333334)(lon_0,-74.5)(k,0.9999)(x_0,150000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102316, srs::dpar::parameters<>(proj_tmerc)(lat_0,40)(lon_0,-76.58333333333333)(k,0.9999375)(x_0,250000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102317, srs::dpar::parameters<>(proj_tmerc)(lat_0,40)(lon_0,-78.58333333333333)(k,0.9999375)(x_0,350000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102318, srs::dpar::parameters<>(proj_lcc)(lat_1,40.66666666666666)(lat_2,41.03333333333333)(lat_0,40.16666666666666)(lon_0,-74)(x_0,300000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102320, srs::dpar::parameters<>(proj_lcc)(lat_1,47.43333333333333)(lat_2,48.73333333333333)(lat_0,47)(lon_0,-100.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102321, srs::dpar::parameters<>(proj_lcc)(lat_1,46.18333333333333)(lat_2,47.48333333333333)(lat_0,45.66666666666666)(lon_0,-100.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102322, srs::dpar::parameters<>(proj_lcc)(lat_1,40.43333333333333)(lat_2,41.7)(lat_0,39.66666666666666)(lon_0,-82.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102323, srs::dpar::parameters<>(proj_lcc)(lat_1,38.73333333333333)(lat_2,40.03333333333333)(lat_0,38)(lon_0,-82.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102324, srs::dpar::parameters<>(proj_lcc)(lat_1,35.56666666666667)(lat_2,36.76666666666667)(lat_0,35)(lon_0,-98)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102325, srs::dpar::parameters<>(proj_lcc)(lat_1,33.93333333333333)(lat_2,35.23333333333333)(lat_0,33.33333333333334)(lon_0,-98)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102326, srs::dpar::parameters<>(proj_lcc)(lat_1,44.33333333333334)(lat_2,46)(lat_0,43.66666666666666)(lon_0,-120.5)(x_0,2500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102327, srs::dpar::parameters<>(proj_lcc)(lat_1,42.33333333333334)(lat_2,44)(lat_0,41.66666666666666)(lon_0,-120.5)(x_0,1500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102330, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.08333333333334)(lon_0,-71.5)(k,0.99999375)(x_0,100000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102334, srs::dpar::parameters<>(proj_lcc)(lat_1,44.41666666666666)(lat_2,45.68333333333333)(lat_0,43.83333333333334)(lon_0,-100)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102335, srs::dpar::parameters<>(proj_lcc)(lat_1,42.83333333333334)(lat_2,44.4)(lat_0,42.33333333333334)(lon_0,-100.3333333333333)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102336, srs::dpar::parameters<>(proj_lcc)(lat_1,35.25)(lat_2,36.41666666666666)(lat_0,34.33333333333334)(lon_0,-86)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102337, srs::dpar::parameters<>(proj_lcc)(lat_1,34.65)(lat_2,36.18333333333333)(lat_0,34)(lon_0,-101.5)(x_0,200000)(y_0,1000000)(ellps_grs80)(units_m)(no_defs)},
-            {102338, srs::dpar::parameters<>(proj_lcc)(lat_1,32.13333333333333)(lat_2,33.96666666666667)(lat_0,31.66666666666667)(lon_0,-98.5)(x_0,600000)(y_0,2000000)(ellps_grs80)(units_m)(no_defs)},
-            {102339, srs::dpar::parameters<>(proj_lcc)(lat_1,30.11666666666667)(lat_2,31.88333333333333)(lat_0,29.66666666666667)(lon_0,-100.3333333333333)(x_0,700000)(y_0,3000000)(ellps_grs80)(units_m)(no_defs)},
-            {102340, srs::dpar::parameters<>(proj_lcc)(lat_1,28.38333333333333)(lat_2,30.28333333333334)(lat_0,27.83333333333333)(lon_0,-99)(x_0,600000)(y_0,4000000)(ellps_grs80)(units_m)(no_defs)},
-            {102341, srs::dpar::parameters<>(proj_lcc)(lat_1,26.16666666666667)(lat_2,27.83333333333333)(lat_0,25.66666666666667)(lon_0,-98.5)(x_0,300000)(y_0,5000000)(ellps_grs80)(units_m)(no_defs)},
-            {102342, srs::dpar::parameters<>(proj_lcc)(lat_1,40.71666666666667)(lat_2,41.78333333333333)(lat_0,40.33333333333334)(lon_0,-111.5)(x_0,500000)(y_0,1000000)(ellps_grs80)(units_m)(no_defs)},
-            {102343, srs::dpar::parameters<>(proj_lcc)(lat_1,39.01666666666667)(lat_2,40.65)(lat_0,38.33333333333334)(lon_0,-111.5)(x_0,500000)(y_0,2000000)(ellps_grs80)(units_m)(no_defs)},
-            {102344, srs::dpar::parameters<>(proj_lcc)(lat_1,37.21666666666667)(lat_2,38.35)(lat_0,36.66666666666666)(lon_0,-111.5)(x_0,500000)(y_0,3000000)(ellps_grs80)(units_m)(no_defs)},
-            {102345, srs::dpar::parameters<>(proj_tmerc)(lat_0,42.5)(lon_0,-72.5)(k,0.9999642857142857)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102346, srs::dpar::parameters<>(proj_lcc)(lat_1,38.03333333333333)(lat_2,39.2)(lat_0,37.66666666666666)(lon_0,-78.5)(x_0,3500000)(y_0,2000000)(ellps_grs80)(units_m)(no_defs)},
-            {102347, srs::dpar::parameters<>(proj_lcc)(lat_1,36.76666666666667)(lat_2,37.96666666666667)(lat_0,36.33333333333334)(lon_0,-78.5)(x_0,3500000)(y_0,1000000)(ellps_grs80)(units_m)(no_defs)},
-            {102348, srs::dpar::parameters<>(proj_lcc)(lat_1,47.5)(lat_2,48.73333333333333)(lat_0,47)(lon_0,-120.8333333333333)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102349, srs::dpar::parameters<>(proj_lcc)(lat_1,45.83333333333334)(lat_2,47.33333333333334)(lat_0,45.33333333333334)(lon_0,-120.5)(x_0,500000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102350, srs::dpar::parameters<>(proj_lcc)(lat_1,39)(lat_2,40.25)(lat_0,38.5)(lon_0,-79.5)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102351, srs::dpar::parameters<>(proj_lcc)(lat_1,37.48333333333333)(lat_2,38.88333333333333)(lat_0,37)(lon_0,-81)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102352, srs::dpar::parameters<>(proj_lcc)(lat_1,45.56666666666667)(lat_2,46.76666666666667)(lat_0,45.16666666666666)(lon_0,-90)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102353, srs::dpar::parameters<>(proj_lcc)(lat_1,44.25)(lat_2,45.5)(lat_0,43.83333333333334)(lon_0,-90)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102354, srs::dpar::parameters<>(proj_lcc)(lat_1,42.73333333333333)(lat_2,44.06666666666667)(lat_0,42)(lon_0,-90)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102355, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-105.1666666666667)(k,0.9999375)(x_0,200000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102356, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-107.3333333333333)(k,0.9999375)(x_0,400000)(y_0,100000)(ellps_grs80)(units_m)(no_defs)},
-            {102357, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-108.75)(k,0.9999375)(x_0,600000)(y_0,0)(ellps_grs80)(units_m)(no_defs)},
-            {102358, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-110.0833333333333)(k,0.9999375)(x_0,800000)(y_0,100000)(ellps_grs80)(units_m)(no_defs)},
-            {102361, srs::dpar::parameters<>(proj_lcc)(lat_1,18.03333333333334)(lat_2,18.43333333333333)(lat_0,17.83333333333333)(lon_0,-66.43333333333334)(x_0,200000)(y_0,200000)(ellps_grs80)(units_m)(no_defs)},
-            {102491, srs::dpar::parameters<>(proj_lcc)(lat_1,36)(lat_0,36)(lon_0,2.7)(k_0,0.999625544)(x_0,500000)(y_0,300000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102492, srs::dpar::parameters<>(proj_lcc)(lat_1,33.3)(lat_0,33.3)(lon_0,2.7)(k_0,0.999625769)(x_0,500000)(y_0,300000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102581, srs::dpar::parameters<>(proj_lcc)(lat_1,49.5)(lat_0,49.5)(lon_0,2.337229166666667)(k_0,0.999877341)(x_0,600000)(y_0,1200000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102582, srs::dpar::parameters<>(proj_lcc)(lat_1,46.8)(lat_0,46.8)(lon_0,2.337229166666667)(k_0,0.99987742)(x_0,600000)(y_0,2200000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102583, srs::dpar::parameters<>(proj_lcc)(lat_1,44.1)(lat_0,44.1)(lon_0,2.337229166666667)(k_0,0.999877499)(x_0,600000)(y_0,3200000)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102584, srs::dpar::parameters<>(proj_lcc)(lat_1,42.165)(lat_0,42.165)(lon_0,2.337229166666667)(k_0,0.99994471)(x_0,234.358)(y_0,4185861.369)(a,6378249.2)(b,6356514.999904194)(units_m)(no_defs)},
-            {102591, srs::dpar::parameters<>(proj_lcc)(lat_1,36)(lat_0,36)(lon_0,2.7)(k_0,0.999625544)(x_0,500135)(y_0,300090)(ellps_clrk80)(units_m)(no_defs)},
-            {102592, srs::dpar::parameters<>(proj_lcc)(lat_1,33.3)(lat_0,33.3)(lon_0,2.7)(k_0,0.999625769)(x_0,500135)(y_0,300090)(ellps_clrk80)(units_m)(no_defs)},
-            {102629, srs::dpar::parameters<>(proj_tmerc)(lat_0,30.5)(lon_0,-85.83333333333333)(k,0.99996)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102630, srs::dpar::parameters<>(proj_tmerc)(lat_0,30)(lon_0,-87.5)(k,0.9999333333333333)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102631, srs::dpar::parameters<>(proj_omerc)(lat_0,57)(lonc,-133.6666666666667)(alpha,-36.86989764583333)(k,0.9999)(x_0,4999999.999999999)(y_0,-4999999.999999999)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102632, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-142)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102633, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-146)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102634, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-150)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102635, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-154)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102636, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-158)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102637, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-162)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102638, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-166)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102639, srs::dpar::parameters<>(proj_tmerc)(lat_0,54)(lon_0,-170)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102640, srs::dpar::parameters<>(proj_lcc)(lat_1,51.83333333333334)(lat_2,53.83333333333334)(lat_0,51)(lon_0,-176)(x_0,1000000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102641, srs::dpar::parameters<>(proj_lcc)(lat_1,40)(lat_2,41.66666666666666)(lat_0,39.33333333333334)(lon_0,-122)(x_0,2000000)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102642, srs::dpar::parameters<>(proj_lcc)(lat_1,38.33333333333334)(lat_2,39.83333333333334)(lat_0,37.66666666666666)(lon_0,-122)(x_0,2000000)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102643, srs::dpar::parameters<>(proj_lcc)(lat_1,37.06666666666667)(lat_2,38.43333333333333)(lat_0,36.5)(lon_0,-120.5)(x_0,2000000)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102644, srs::dpar::parameters<>(proj_lcc)(lat_1,36)(lat_2,37.25)(lat_0,35.33333333333334)(lon_0,-119)(x_0,2000000)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102645, srs::dpar::parameters<>(proj_lcc)(lat_1,34.03333333333333)(lat_2,35.46666666666667)(lat_0,33.5)(lon_0,-118)(x_0,2000000)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102646, srs::dpar::parameters<>(proj_lcc)(lat_1,32.78333333333333)(lat_2,33.88333333333333)(lat_0,32.16666666666666)(lon_0,-116.25)(x_0,2000000)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102648, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-110.1666666666667)(k,0.9999)(x_0,213360)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102649, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-111.9166666666667)(k,0.9999)(x_0,213360)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102650, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-113.75)(k,0.9999333333333333)(x_0,213360)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102651, srs::dpar::parameters<>(proj_lcc)(lat_1,34.93333333333333)(lat_2,36.23333333333333)(lat_0,34.33333333333334)(lon_0,-92)(x_0,399999.9999999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102652, srs::dpar::parameters<>(proj_lcc)(lat_1,33.3)(lat_2,34.76666666666667)(lat_0,32.66666666666666)(lon_0,-92)(x_0,399999.9999999999)(y_0,399999.9999999999)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102653, srs::dpar::parameters<>(proj_lcc)(lat_1,39.71666666666667)(lat_2,40.78333333333333)(lat_0,39.33333333333334)(lon_0,-105.5)(x_0,914401.8289)(y_0,304800.6096)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102654, srs::dpar::parameters<>(proj_lcc)(lat_1,38.45)(lat_2,39.75)(lat_0,37.83333333333334)(lon_0,-105.5)(x_0,914401.8289)(y_0,304800.6096)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102655, srs::dpar::parameters<>(proj_lcc)(lat_1,37.23333333333333)(lat_2,38.43333333333333)(lat_0,36.66666666666666)(lon_0,-105.5)(x_0,914401.8289)(y_0,304800.6096)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102656, srs::dpar::parameters<>(proj_lcc)(lat_1,41.2)(lat_2,41.86666666666667)(lat_0,40.83333333333334)(lon_0,-72.75)(x_0,304800.6096)(y_0,152400.3048)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102657, srs::dpar::parameters<>(proj_tmerc)(lat_0,38)(lon_0,-75.41666666666667)(k,0.999995)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102658, srs::dpar::parameters<>(proj_tmerc)(lat_0,24.33333333333333)(lon_0,-81)(k,0.9999411764705882)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102659, srs::dpar::parameters<>(proj_tmerc)(lat_0,24.33333333333333)(lon_0,-82)(k,0.9999411764705882)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102660, srs::dpar::parameters<>(proj_lcc)(lat_1,29.58333333333333)(lat_2,30.75)(lat_0,29)(lon_0,-84.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102661, srs::dpar::parameters<>(proj_tmerc)(lat_0,18.83333333333333)(lon_0,-155.5)(k,0.9999666666666667)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102662, srs::dpar::parameters<>(proj_tmerc)(lat_0,20.33333333333333)(lon_0,-156.6666666666667)(k,0.9999666666666667)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102663, srs::dpar::parameters<>(proj_tmerc)(lat_0,21.16666666666667)(lon_0,-158)(k,0.99999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102664, srs::dpar::parameters<>(proj_tmerc)(lat_0,21.83333333333333)(lon_0,-159.5)(k,0.99999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102665, srs::dpar::parameters<>(proj_tmerc)(lat_0,21.66666666666667)(lon_0,-160.1666666666667)(k,1)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102666, srs::dpar::parameters<>(proj_tmerc)(lat_0,30)(lon_0,-82.16666666666667)(k,0.9999)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102667, srs::dpar::parameters<>(proj_tmerc)(lat_0,30)(lon_0,-84.16666666666667)(k,0.9999)(x_0,700000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102668, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.66666666666666)(lon_0,-112.1666666666667)(k,0.9999473684210526)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102669, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.66666666666666)(lon_0,-114)(k,0.9999473684210526)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102670, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.66666666666666)(lon_0,-115.75)(k,0.9999333333333333)(x_0,799999.9999999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102671, srs::dpar::parameters<>(proj_tmerc)(lat_0,36.66666666666666)(lon_0,-88.33333333333333)(k,0.9999749999999999)(x_0,300000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102672, srs::dpar::parameters<>(proj_tmerc)(lat_0,36.66666666666666)(lon_0,-90.16666666666667)(k,0.9999411764705882)(x_0,700000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102673, srs::dpar::parameters<>(proj_tmerc)(lat_0,37.5)(lon_0,-85.66666666666667)(k,0.9999666666666667)(x_0,100000)(y_0,250000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102674, srs::dpar::parameters<>(proj_tmerc)(lat_0,37.5)(lon_0,-87.08333333333333)(k,0.9999666666666667)(x_0,900000.0000000001)(y_0,250000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102675, srs::dpar::parameters<>(proj_lcc)(lat_1,42.06666666666667)(lat_2,43.26666666666667)(lat_0,41.5)(lon_0,-93.5)(x_0,1500000)(y_0,1000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102676, srs::dpar::parameters<>(proj_lcc)(lat_1,40.61666666666667)(lat_2,41.78333333333333)(lat_0,40)(lon_0,-93.5)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102677, srs::dpar::parameters<>(proj_lcc)(lat_1,38.71666666666667)(lat_2,39.78333333333333)(lat_0,38.33333333333334)(lon_0,-98)(x_0,399999.9999999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102678, srs::dpar::parameters<>(proj_lcc)(lat_1,37.26666666666667)(lat_2,38.56666666666667)(lat_0,36.66666666666666)(lon_0,-98.5)(x_0,399999.9999999999)(y_0,399999.9999999999)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102679, srs::dpar::parameters<>(proj_lcc)(lat_1,37.96666666666667)(lat_2,38.96666666666667)(lat_0,37.5)(lon_0,-84.25)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102680, srs::dpar::parameters<>(proj_lcc)(lat_1,36.73333333333333)(lat_2,37.93333333333333)(lat_0,36.33333333333334)(lon_0,-85.75)(x_0,500000.0000000002)(y_0,500000.0000000002)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102681, srs::dpar::parameters<>(proj_lcc)(lat_1,31.16666666666667)(lat_2,32.66666666666666)(lat_0,30.5)(lon_0,-92.5)(x_0,1000000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102682, srs::dpar::parameters<>(proj_lcc)(lat_1,29.3)(lat_2,30.7)(lat_0,28.5)(lon_0,-91.33333333333333)(x_0,1000000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102683, srs::dpar::parameters<>(proj_tmerc)(lat_0,43.66666666666666)(lon_0,-68.5)(k,0.9999)(x_0,300000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102684, srs::dpar::parameters<>(proj_tmerc)(lat_0,42.83333333333334)(lon_0,-70.16666666666667)(k,0.9999666666666667)(x_0,900000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102685, srs::dpar::parameters<>(proj_lcc)(lat_1,38.3)(lat_2,39.45)(lat_0,37.66666666666666)(lon_0,-77)(x_0,399999.9999999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102686, srs::dpar::parameters<>(proj_lcc)(lat_1,41.71666666666667)(lat_2,42.68333333333333)(lat_0,41)(lon_0,-71.5)(x_0,200000)(y_0,750000.0000000001)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102687, srs::dpar::parameters<>(proj_lcc)(lat_1,41.28333333333333)(lat_2,41.48333333333333)(lat_0,41)(lon_0,-70.5)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102688, srs::dpar::parameters<>(proj_lcc)(lat_1,45.48333333333333)(lat_2,47.08333333333334)(lat_0,44.78333333333333)(lon_0,-87)(x_0,7999999.999999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102689, srs::dpar::parameters<>(proj_lcc)(lat_1,44.18333333333333)(lat_2,45.7)(lat_0,43.31666666666667)(lon_0,-84.36666666666666)(x_0,6000000.000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102690, srs::dpar::parameters<>(proj_lcc)(lat_1,42.1)(lat_2,43.66666666666666)(lat_0,41.5)(lon_0,-84.36666666666666)(x_0,4000000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102691, srs::dpar::parameters<>(proj_lcc)(lat_1,47.03333333333333)(lat_2,48.63333333333333)(lat_0,46.5)(lon_0,-93.09999999999999)(x_0,799999.9999999999)(y_0,100000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102692, srs::dpar::parameters<>(proj_lcc)(lat_1,45.61666666666667)(lat_2,47.05)(lat_0,45)(lon_0,-94.25)(x_0,799999.9999999999)(y_0,100000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102693, srs::dpar::parameters<>(proj_lcc)(lat_1,43.78333333333333)(lat_2,45.21666666666667)(lat_0,43)(lon_0,-94)(x_0,799999.9999999999)(y_0,100000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102694, srs::dpar::parameters<>(proj_tmerc)(lat_0,29.5)(lon_0,-88.83333333333333)(k,0.99995)(x_0,300000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102695, srs::dpar::parameters<>(proj_tmerc)(lat_0,29.5)(lon_0,-90.33333333333333)(k,0.99995)(x_0,700000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102696, srs::dpar::parameters<>(proj_tmerc)(lat_0,35.83333333333334)(lon_0,-90.5)(k,0.9999333333333333)(x_0,250000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102697, srs::dpar::parameters<>(proj_tmerc)(lat_0,35.83333333333334)(lon_0,-92.5)(k,0.9999333333333333)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102698, srs::dpar::parameters<>(proj_tmerc)(lat_0,36.16666666666666)(lon_0,-94.5)(k,0.9999411764705882)(x_0,850000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102700, srs::dpar::parameters<>(proj_lcc)(lat_1,45)(lat_2,49)(lat_0,44.25)(lon_0,-109.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102704, srs::dpar::parameters<>(proj_lcc)(lat_1,40)(lat_2,43)(lat_0,39.83333333333334)(lon_0,-100)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102707, srs::dpar::parameters<>(proj_tmerc)(lat_0,34.75)(lon_0,-115.5833333333333)(k,0.9999)(x_0,200000)(y_0,7999999.999999999)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102708, srs::dpar::parameters<>(proj_tmerc)(lat_0,34.75)(lon_0,-116.6666666666667)(k,0.9999)(x_0,500000.0000000002)(y_0,6000000.000000001)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102709, srs::dpar::parameters<>(proj_tmerc)(lat_0,34.75)(lon_0,-118.5833333333333)(k,0.9999)(x_0,799999.9999999999)(y_0,4000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102710, srs::dpar::parameters<>(proj_tmerc)(lat_0,42.5)(lon_0,-71.66666666666667)(k,0.9999666666666667)(x_0,300000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102711, srs::dpar::parameters<>(proj_tmerc)(lat_0,38.83333333333334)(lon_0,-74.5)(k,0.9999)(x_0,150000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102712, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-104.3333333333333)(k,0.9999090909090909)(x_0,165000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102713, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-106.25)(k,0.9999)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102714, srs::dpar::parameters<>(proj_tmerc)(lat_0,31)(lon_0,-107.8333333333333)(k,0.9999166666666667)(x_0,829999.9999999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102715, srs::dpar::parameters<>(proj_tmerc)(lat_0,38.83333333333334)(lon_0,-74.5)(k,0.9999)(x_0,150000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102716, srs::dpar::parameters<>(proj_tmerc)(lat_0,40)(lon_0,-76.58333333333333)(k,0.9999375)(x_0,250000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102717, srs::dpar::parameters<>(proj_tmerc)(lat_0,40)(lon_0,-78.58333333333333)(k,0.9999375)(x_0,350000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102718, srs::dpar::parameters<>(proj_lcc)(lat_1,40.66666666666666)(lat_2,41.03333333333333)(lat_0,40.16666666666666)(lon_0,-74)(x_0,300000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102719, srs::dpar::parameters<>(proj_lcc)(lat_1,34.33333333333334)(lat_2,36.16666666666666)(lat_0,33.75)(lon_0,-79)(x_0,609601.2199999999)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102720, srs::dpar::parameters<>(proj_lcc)(lat_1,47.43333333333333)(lat_2,48.73333333333333)(lat_0,47)(lon_0,-100.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102721, srs::dpar::parameters<>(proj_lcc)(lat_1,46.18333333333333)(lat_2,47.48333333333333)(lat_0,45.66666666666666)(lon_0,-100.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102722, srs::dpar::parameters<>(proj_lcc)(lat_1,40.43333333333333)(lat_2,41.7)(lat_0,39.66666666666666)(lon_0,-82.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102723, srs::dpar::parameters<>(proj_lcc)(lat_1,38.73333333333333)(lat_2,40.03333333333333)(lat_0,38)(lon_0,-82.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102724, srs::dpar::parameters<>(proj_lcc)(lat_1,35.56666666666667)(lat_2,36.76666666666667)(lat_0,35)(lon_0,-98)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102725, srs::dpar::parameters<>(proj_lcc)(lat_1,33.93333333333333)(lat_2,35.23333333333333)(lat_0,33.33333333333334)(lon_0,-98)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102726, srs::dpar::parameters<>(proj_lcc)(lat_1,44.33333333333334)(lat_2,46)(lat_0,43.66666666666666)(lon_0,-120.5)(x_0,2500000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102727, srs::dpar::parameters<>(proj_lcc)(lat_1,42.33333333333334)(lat_2,44)(lat_0,41.66666666666666)(lon_0,-120.5)(x_0,1500000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102728, srs::dpar::parameters<>(proj_lcc)(lat_1,40.88333333333333)(lat_2,41.95)(lat_0,40.16666666666666)(lon_0,-77.75)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102729, srs::dpar::parameters<>(proj_lcc)(lat_1,39.93333333333333)(lat_2,40.96666666666667)(lat_0,39.33333333333334)(lon_0,-77.75)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102730, srs::dpar::parameters<>(proj_tmerc)(lat_0,41.08333333333334)(lon_0,-71.5)(k,0.99999375)(x_0,100000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102733, srs::dpar::parameters<>(proj_lcc)(lat_1,32.5)(lat_2,34.83333333333334)(lat_0,31.83333333333333)(lon_0,-81)(x_0,609600.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102734, srs::dpar::parameters<>(proj_lcc)(lat_1,44.41666666666666)(lat_2,45.68333333333333)(lat_0,43.83333333333334)(lon_0,-100)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102735, srs::dpar::parameters<>(proj_lcc)(lat_1,42.83333333333334)(lat_2,44.4)(lat_0,42.33333333333334)(lon_0,-100.3333333333333)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102736, srs::dpar::parameters<>(proj_lcc)(lat_1,35.25)(lat_2,36.41666666666666)(lat_0,34.33333333333334)(lon_0,-86)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102737, srs::dpar::parameters<>(proj_lcc)(lat_1,34.65)(lat_2,36.18333333333333)(lat_0,34)(lon_0,-101.5)(x_0,200000)(y_0,1000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102738, srs::dpar::parameters<>(proj_lcc)(lat_1,32.13333333333333)(lat_2,33.96666666666667)(lat_0,31.66666666666667)(lon_0,-98.5)(x_0,600000.0000000001)(y_0,2000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102739, srs::dpar::parameters<>(proj_lcc)(lat_1,30.11666666666667)(lat_2,31.88333333333333)(lat_0,29.66666666666667)(lon_0,-100.3333333333333)(x_0,700000)(y_0,3000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102740, srs::dpar::parameters<>(proj_lcc)(lat_1,28.38333333333333)(lat_2,30.28333333333334)(lat_0,27.83333333333333)(lon_0,-99)(x_0,600000.0000000001)(y_0,4000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102741, srs::dpar::parameters<>(proj_lcc)(lat_1,26.16666666666667)(lat_2,27.83333333333333)(lat_0,25.66666666666667)(lon_0,-98.5)(x_0,300000)(y_0,4999999.999999999)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102742, srs::dpar::parameters<>(proj_lcc)(lat_1,40.71666666666667)(lat_2,41.78333333333333)(lat_0,40.33333333333334)(lon_0,-111.5)(x_0,500000.0000000002)(y_0,1000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102743, srs::dpar::parameters<>(proj_lcc)(lat_1,39.01666666666667)(lat_2,40.65)(lat_0,38.33333333333334)(lon_0,-111.5)(x_0,500000.0000000002)(y_0,2000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102744, srs::dpar::parameters<>(proj_lcc)(lat_1,37.21666666666667)(lat_2,38.35)(lat_0,36.66666666666666)(lon_0,-111.5)(x_0,500000.0000000002)(y_0,3000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102745, srs::dpar::parameters<>(proj_tmerc)(lat_0,42.5)(lon_0,-72.5)(k,0.9999642857142857)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102746, srs::dpar::parameters<>(proj_lcc)(lat_1,38.03333333333333)(lat_2,39.2)(lat_0,37.66666666666666)(lon_0,-78.5)(x_0,3499999.999999999)(y_0,2000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102747, srs::dpar::parameters<>(proj_lcc)(lat_1,36.76666666666667)(lat_2,37.96666666666667)(lat_0,36.33333333333334)(lon_0,-78.5)(x_0,3499999.999999999)(y_0,1000000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102748, srs::dpar::parameters<>(proj_lcc)(lat_1,47.5)(lat_2,48.73333333333333)(lat_0,47)(lon_0,-120.8333333333333)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102749, srs::dpar::parameters<>(proj_lcc)(lat_1,45.83333333333334)(lat_2,47.33333333333334)(lat_0,45.33333333333334)(lon_0,-120.5)(x_0,500000.0000000002)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102750, srs::dpar::parameters<>(proj_lcc)(lat_1,39)(lat_2,40.25)(lat_0,38.5)(lon_0,-79.5)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102751, srs::dpar::parameters<>(proj_lcc)(lat_1,37.48333333333333)(lat_2,38.88333333333333)(lat_0,37)(lon_0,-81)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102752, srs::dpar::parameters<>(proj_lcc)(lat_1,45.56666666666667)(lat_2,46.76666666666667)(lat_0,45.16666666666666)(lon_0,-90)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102753, srs::dpar::parameters<>(proj_lcc)(lat_1,44.25)(lat_2,45.5)(lat_0,43.83333333333334)(lon_0,-90)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102754, srs::dpar::parameters<>(proj_lcc)(lat_1,42.73333333333333)(lat_2,44.06666666666667)(lat_0,42)(lon_0,-90)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102755, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-105.1666666666667)(k,0.9999375)(x_0,200000)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102756, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-107.3333333333333)(k,0.9999375)(x_0,399999.9999999999)(y_0,100000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102757, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-108.75)(k,0.9999375)(x_0,600000.0000000001)(y_0,0)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102758, srs::dpar::parameters<>(proj_tmerc)(lat_0,40.5)(lon_0,-110.0833333333333)(k,0.9999375)(x_0,799999.9999999999)(y_0,100000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102761, srs::dpar::parameters<>(proj_lcc)(lat_1,18.03333333333334)(lat_2,18.43333333333333)(lat_0,17.83333333333333)(lon_0,-66.43333333333334)(x_0,200000)(y_0,200000)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {102766, srs::dpar::parameters<>(proj_poly)(lat_0,13.47246635277778)(lon_0,-144.7487507055556)(x_0,49999.99999999999)(y_0,49999.99999999999)(ellps_grs80)(srs::dpar::datum_nad83)(to_meter,0.3048006096012192)(no_defs)},
-            {103300, srs::dpar::parameters<>(proj_lcc)(lat_1,49.8333339)(lat_2,51.16666733333333)(lat_0,90)(lon_0,4.367486666666666)(x_0,150000.01256)(y_0,5400088.4378)(ellps_intl)(units_m)(no_defs)},
-            {104000, srs::dpar::parameters<>(proj_longlat)(ellps_clrk66)(srs::dpar::datum_nad27)(no_defs)},
-            {104101, srs::dpar::parameters<>(proj_longlat)(ellps_bessel)(no_defs)},
-            {104102, srs::dpar::parameters<>(proj_longlat)(ellps_bessel)(no_defs)},
-            {104103, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)},
-            {104104, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {104105, srs::dpar::parameters<>(proj_longlat)(ellps_bessel)(no_defs)},
-            {104106, srs::dpar::parameters<>(proj_longlat)(ellps_intl)(no_defs)},
-            {104107, srs::dpar::parameters<>(proj_longlat)(ellps_grs80)(no_defs)},
-            {104108, srs::dpar::parameters<>(proj_longlat)(ellps_grs80)(no_defs)},
-            {104261, srs::dpar::parameters<>(proj_longlat)(a,6378249.2)(b,6356514.999904194)(no_defs)},
-            {104304, srs::dpar::parameters<>(proj_longlat)(a,6378249.2)(b,6356514.999904194)(no_defs)},
-            {104305, srs::dpar::parameters<>(proj_longlat)(ellps_clrk80)(no_defs)}
+            {54024, 416, 9},
+            {54025, 425, 13},
+            {54026, 438, 10},
+            {54027, 448, 11},
+            {54028, 459, 9},
+            {54029, 468, 9},
+            {54030, 477, 8},
+            {54031, 485, 11},
+            {54032, 496, 9},
+            {65061, 505, 9},
+            {65161, 514, 9},
+            {102001, 523, 11},
+            {102002, 534, 11},
+            {102003, 545, 11},
+            {102004, 556, 11},
+            {102005, 567, 11},
+            {102006, 578, 11},
+            {102007, 589, 11},
+            {102008, 600, 11},
+            {102009, 611, 11},
+            {102010, 622, 11},
+            {102011, 633, 8},
+            {102012, 641, 11},
+            {102013, 652, 10},
+            {102014, 662, 10},
+            {102015, 672, 10},
+            {102016, 682, 9},
+            {102017, 691, 9},
+            {102018, 700, 10},
+            {102019, 710, 9},
+            {102020, 719, 9},
+            {102021, 728, 10},
+            {102022, 738, 11},
+            {102023, 749, 11},
+            {102024, 760, 11},
+            {102025, 771, 11},
+            {102026, 782, 11},
+            {102027, 793, 11},
+            {102028, 804, 11},
+            {102029, 815, 11},
+            {102030, 826, 11},
+            {102031, 837, 10},
+            {102032, 847, 10},
+            {102033, 857, 10},
+            {102065, 867, 10},
+            {102066, 877, 11},
+            {102067, 888, 10},
+            {102091, 898, 9},
+            {102092, 907, 9},
+            {102101, 916, 10},
+            {102102, 926, 10},
+            {102103, 936, 10},
+            {102104, 946, 10},
+            {102105, 956, 10},
+            {102106, 966, 10},
+            {102107, 976, 10},
+            {102108, 986, 10},
+            {102110, 996, 10},
+            {102114, 1006, 5},
+            {102115, 1011, 5},
+            {102120, 1016, 11},
+            {102121, 1027, 11},
+            {102122, 1038, 11},
+            {102123, 1049, 11},
+            {102132, 1060, 6},
+            {102133, 1066, 6},
+            {102134, 1072, 6},
+            {102135, 1078, 6},
+            {102140, 1084, 9},
+            {102141, 1093, 5},
+            {102142, 1098, 5},
+            {102151, 1103, 5},
+            {102152, 1108, 5},
+            {102153, 1113, 5},
+            {102154, 1118, 5},
+            {102155, 1123, 5},
+            {102156, 1128, 5},
+            {102160, 1133, 9},
+            {102161, 1142, 9},
+            {102162, 1151, 5},
+            {102163, 1156, 8},
+            {102164, 1164, 9},
+            {102165, 1173, 9},
+            {102166, 1182, 5},
+            {102167, 1187, 5},
+            {102168, 1192, 5},
+            {102169, 1197, 5},
+            {102191, 1202, 11},
+            {102192, 1213, 11},
+            {102193, 1224, 11},
+            {102229, 1235, 9},
+            {102230, 1244, 9},
+            {102241, 1253, 10},
+            {102242, 1263, 10},
+            {102243, 1273, 10},
+            {102244, 1283, 10},
+            {102245, 1293, 10},
+            {102246, 1303, 10},
+            {102248, 1313, 9},
+            {102249, 1322, 9},
+            {102250, 1331, 9},
+            {102251, 1340, 10},
+            {102252, 1350, 10},
+            {102253, 1360, 10},
+            {102254, 1370, 10},
+            {102255, 1380, 10},
+            {102256, 1390, 10},
+            {102257, 1400, 9},
+            {102258, 1409, 9},
+            {102259, 1418, 9},
+            {102260, 1427, 10},
+            {102261, 1437, 9},
+            {102262, 1446, 9},
+            {102263, 1455, 9},
+            {102264, 1464, 9},
+            {102265, 1473, 9},
+            {102266, 1482, 9},
+            {102267, 1491, 9},
+            {102268, 1500, 9},
+            {102269, 1509, 9},
+            {102270, 1518, 9},
+            {102271, 1527, 9},
+            {102272, 1536, 9},
+            {102273, 1545, 9},
+            {102274, 1554, 9},
+            {102277, 1563, 10},
+            {102278, 1573, 10},
+            {102279, 1583, 10},
+            {102280, 1593, 10},
+            {102281, 1603, 10},
+            {102282, 1613, 10},
+            {102283, 1623, 9},
+            {102284, 1632, 9},
+            {102285, 1641, 10},
+            {102286, 1651, 10},
+            {102287, 1661, 10},
+            {102288, 1671, 10},
+            {102289, 1681, 10},
+            {102290, 1691, 10},
+            {102291, 1701, 10},
+            {102292, 1711, 10},
+            {102293, 1721, 10},
+            {102294, 1731, 9},
+            {102295, 1740, 9},
+            {102296, 1749, 9},
+            {102297, 1758, 9},
+            {102298, 1767, 9},
+            {102300, 1776, 10},
+            {102304, 1786, 10},
+            {102307, 1796, 9},
+            {102308, 1805, 9},
+            {102309, 1814, 9},
+            {102310, 1823, 9},
+            {102311, 1832, 9},
+            {102312, 1841, 9},
+            {102313, 1850, 9},
+            {102314, 1859, 9},
+            {102315, 1868, 9},
+            {102316, 1877, 9},
+            {102317, 1886, 9},
+            {102318, 1895, 10},
+            {102320, 1905, 10},
+            {102321, 1915, 10},
+            {102322, 1925, 10},
+            {102323, 1935, 10},
+            {102324, 1945, 10},
+            {102325, 1955, 10},
+            {102326, 1965, 10},
+            {102327, 1975, 10},
+            {102330, 1985, 9},
+            {102334, 1994, 10},
+            {102335, 2004, 10},
+            {102336, 2014, 10},
+            {102337, 2024, 10},
+            {102338, 2034, 10},
+            {102339, 2044, 10},
+            {102340, 2054, 10},
+            {102341, 2064, 10},
+            {102342, 2074, 10},
+            {102343, 2084, 10},
+            {102344, 2094, 10},
+            {102345, 2104, 9},
+            {102346, 2113, 10},
+            {102347, 2123, 10},
+            {102348, 2133, 10},
+            {102349, 2143, 10},
+            {102350, 2153, 10},
+            {102351, 2163, 10},
+            {102352, 2173, 10},
+            {102353, 2183, 10},
+            {102354, 2193, 10},
+            {102355, 2203, 9},
+            {102356, 2212, 9},
+            {102357, 2221, 9},
+            {102358, 2230, 9},
+            {102361, 2239, 10},
+            {102491, 2249, 11},
+            {102492, 2260, 11},
+            {102581, 2271, 11},
+            {102582, 2282, 11},
+            {102583, 2293, 11},
+            {102584, 2304, 11},
+            {102591, 2315, 10},
+            {102592, 2325, 10},
+            {102629, 2335, 10},
+            {102630, 2345, 10},
+            {102631, 2355, 11},
+            {102632, 2366, 10},
+            {102633, 2376, 10},
+            {102634, 2386, 10},
+            {102635, 2396, 10},
+            {102636, 2406, 10},
+            {102637, 2416, 10},
+            {102638, 2426, 10},
+            {102639, 2436, 10},
+            {102640, 2446, 11},
+            {102641, 2457, 11},
+            {102642, 2468, 11},
+            {102643, 2479, 11},
+            {102644, 2490, 11},
+            {102645, 2501, 11},
+            {102646, 2512, 11},
+            {102648, 2523, 10},
+            {102649, 2533, 10},
+            {102650, 2543, 10},
+            {102651, 2553, 11},
+            {102652, 2564, 11},
+            {102653, 2575, 11},
+            {102654, 2586, 11},
+            {102655, 2597, 11},
+            {102656, 2608, 11},
+            {102657, 2619, 10},
+            {102658, 2629, 10},
+            {102659, 2639, 10},
+            {102660, 2649, 11},
+            {102661, 2660, 10},
+            {102662, 2670, 10},
+            {102663, 2680, 10},
+            {102664, 2690, 10},
+            {102665, 2700, 10},
+            {102666, 2710, 10},
+            {102667, 2720, 10},
+            {102668, 2730, 10},
+            {102669, 2740, 10},
+            {102670, 2750, 10},
+            {102671, 2760, 10},
+            {102672, 2770, 10},
+            {102673, 2780, 10},
+            {102674, 2790, 10},
+            {102675, 2800, 11},
+            {102676, 2811, 11},
+            {102677, 2822, 11},
+            {102678, 2833, 11},
+            {102679, 2844, 11},
+            {102680, 2855, 11},
+            {102681, 2866, 11},
+            {102682, 2877, 11},
+            {102683, 2888, 10},
+            {102684, 2898, 10},
+            {102685, 2908, 11},
+            {102686, 2919, 11},
+            {102687, 2930, 11},
+            {102688, 2941, 11},
+            {102689, 2952, 11},
+            {102690, 2963, 11},
+            {102691, 2974, 11},
+            {102692, 2985, 11},
+            {102693, 2996, 11},
+            {102694, 3007, 10},
+            {102695, 3017, 10},
+            {102696, 3027, 10},
+            {102697, 3037, 10},
+            {102698, 3047, 10},
+            {102700, 3057, 11},
+            {102704, 3068, 11},
+            {102707, 3079, 10},
+            {102708, 3089, 10},
+            {102709, 3099, 10},
+            {102710, 3109, 10},
+            {102711, 3119, 10},
+            {102712, 3129, 10},
+            {102713, 3139, 10},
+            {102714, 3149, 10},
+            {102715, 3159, 10},
+            {102716, 3169, 10},
+            {102717, 3179, 10},
+            {102718, 3189, 11},
+            {102719, 3200, 11},
+            {102720, 3211, 11},
+            {102721, 3222, 11},
+            {102722, 3233, 11},
+            {102723, 3244, 11},
+            {102724, 3255, 11},
+            {102725, 3266, 11},
+            {102726, 3277, 11},
+            {102727, 3288, 11},
+            {102728, 3299, 11},
+            {102729, 3310, 11},
+            {102730, 3321, 10},
+            {102733, 3331, 11},
+            {102734, 3342, 11},
+            {102735, 3353, 11},
+            {102736, 3364, 11},
+            {102737, 3375, 11},
+            {102738, 3386, 11},
+            {102739, 3397, 11},
+            {102740, 3408, 11},
+            {102741, 3419, 11},
+            {102742, 3430, 11},
+            {102743, 3441, 11},
+            {102744, 3452, 11},
+            {102745, 3463, 10},
+            {102746, 3473, 11},
+            {102747, 3484, 11},
+            {102748, 3495, 11},
+            {102749, 3506, 11},
+            {102750, 3517, 11},
+            {102751, 3528, 11},
+            {102752, 3539, 11},
+            {102753, 3550, 11},
+            {102754, 3561, 11},
+            {102755, 3572, 10},
+            {102756, 3582, 10},
+            {102757, 3592, 10},
+            {102758, 3602, 10},
+            {102761, 3612, 11},
+            {102766, 3623, 9},
+            {103300, 3632, 10},
+            {104000, 3642, 4},
+            {104101, 3646, 3},
+            {104102, 3649, 3},
+            {104103, 3652, 3},
+            {104104, 3655, 3},
+            {104105, 3658, 3},
+            {104106, 3661, 3},
+            {104107, 3664, 3},
+            {104108, 3667, 3},
+            {104261, 3670, 4},
+            {104304, 3674, 4},
+            {104305, 3678, 3}
         };
 
-        const code_element * first = arr;
-        const code_element * last = arr + sizeof(arr) / sizeof(code_element);
-        const code_element * el = binary_find_code_element(first, last, code);
-
-        return el != last ? el->parameters : srs::dpar::parameters<>();
+        return code_to_parameters(elements, parameters, code);
     }
 
 }
@@ -27,2381 +27,3784 @@ namespace detail
     {
         using namespace srs::dpar;
 
-        static const code_element arr[] = {
-            {19900, srs::dpar::parameters<>(proj_longlat)(r,2439700)(no_defs)},
-            {19901, srs::dpar::parameters<>(proj_longlat)(r,2439700)(no_defs)},
+        static constexpr code_parameter parameters[] = {
+            /*19900*/ {proj_longlat}, {r,2439700}, {no_defs},
+            /*19901*/ {proj_longlat}, {r,2439700}, {no_defs},
+            /*19914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*19973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2439700}, {units_m}, {no_defs},
+            /*29900*/ {proj_longlat}, {r,6051800}, {no_defs},
+            /*29901*/ {proj_longlat}, {r,6051800}, {no_defs},
+            /*29914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*29973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,6051800}, {units_m}, {no_defs},
+            /*30100*/ {proj_longlat}, {r,1737400}, {no_defs},
+            /*30101*/ {proj_longlat}, {r,1737400}, {no_defs},
+            /*30114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*30173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1737400}, {units_m}, {no_defs},
+            /*39900*/ {proj_longlat}, {a,6378140}, {b,6356750}, {no_defs},
+            /*39901*/ {proj_longlat}, {a,6378140}, {b,6356750}, {no_defs},
+            /*39914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*39973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,6378140}, {b,6356750}, {units_m}, {no_defs},
+            /*40100*/ {proj_longlat}, {a,13400}, {b,9200}, {no_defs},
+            /*40101*/ {proj_longlat}, {a,13400}, {b,9200}, {no_defs},
+            /*40114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,13400}, {b,9200}, {units_m}, {no_defs},
+            /*40200*/ {proj_longlat}, {a,7500}, {b,5200}, {no_defs},
+            /*40201*/ {proj_longlat}, {a,7500}, {b,5200}, {no_defs},
+            /*40214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*40273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,7500}, {b,5200}, {units_m}, {no_defs},
+            /*49900*/ {proj_longlat}, {a,3396190}, {b,3376200}, {no_defs},
+            /*49901*/ {proj_longlat}, {a,3396190}, {b,3376200}, {no_defs},
+            /*49914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*49973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,3396190}, {b,3376200}, {units_m}, {no_defs},
+            /*50100*/ {proj_longlat}, {a,1829400}, {b,1815700}, {no_defs},
+            /*50101*/ {proj_longlat}, {a,1829400}, {b,1815700}, {no_defs},
+            /*50114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1829400}, {b,1815700}, {units_m}, {no_defs},
+            /*50200*/ {proj_longlat}, {a,1564130}, {b,1560930}, {no_defs},
+            /*50201*/ {proj_longlat}, {a,1564130}, {b,1560930}, {no_defs},
+            /*50214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,1564130}, {b,1560930}, {units_m}, {no_defs},
+            /*50300*/ {proj_longlat}, {a,2632400}, {b,2632350}, {no_defs},
+            /*50301*/ {proj_longlat}, {a,2632400}, {b,2632350}, {no_defs},
+            /*50314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2632400}, {b,2632350}, {units_m}, {no_defs},
+            /*50400*/ {proj_longlat}, {a,2409400}, {b,2409300}, {no_defs},
+            /*50401*/ {proj_longlat}, {a,2409400}, {b,2409300}, {no_defs},
+            /*50414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,2409400}, {b,2409300}, {units_m}, {no_defs},
+            /*50500*/ {proj_longlat}, {a,125000}, {b,64000}, {no_defs},
+            /*50501*/ {proj_longlat}, {a,125000}, {b,64000}, {no_defs},
+            /*50514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,125000}, {b,64000}, {units_m}, {no_defs},
+            /*50600*/ {proj_longlat}, {r,85000}, {no_defs},
+            /*50601*/ {proj_longlat}, {r,85000}, {no_defs},
+            /*50614*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50615*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50616*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50617*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50618*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50619*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50620*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50621*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50660*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50661*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50662*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50663*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50664*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50665*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50666*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50667*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50672*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50673*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,85000}, {units_m}, {no_defs},
+            /*50700*/ {proj_longlat}, {r,40000}, {no_defs},
+            /*50701*/ {proj_longlat}, {r,40000}, {no_defs},
+            /*50714*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50715*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50716*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50717*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50718*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50719*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50720*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50721*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50760*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50761*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50762*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50763*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50764*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50765*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50766*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50767*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50772*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50773*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*50800*/ {proj_longlat}, {r,18000}, {no_defs},
+            /*50801*/ {proj_longlat}, {r,18000}, {no_defs},
+            /*50814*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50815*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50816*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50817*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50818*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50819*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50820*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50821*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50860*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50861*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50862*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50863*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50864*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50865*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50866*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50867*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50872*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50873*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,18000}, {units_m}, {no_defs},
+            /*50900*/ {proj_longlat}, {r,14000}, {no_defs},
+            /*50901*/ {proj_longlat}, {r,14000}, {no_defs},
+            /*50914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*50973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,14000}, {units_m}, {no_defs},
+            /*51000*/ {proj_longlat}, {r,12000}, {no_defs},
+            /*51001*/ {proj_longlat}, {r,12000}, {no_defs},
+            /*51014*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51015*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51016*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51017*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51018*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51019*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51020*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51021*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51060*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51061*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51062*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51063*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51064*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51065*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51066*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51067*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51072*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51073*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,12000}, {units_m}, {no_defs},
+            /*51100*/ {proj_longlat}, {r,15000}, {no_defs},
+            /*51101*/ {proj_longlat}, {r,15000}, {no_defs},
+            /*51114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*51200*/ {proj_longlat}, {r,10000}, {no_defs},
+            /*51201*/ {proj_longlat}, {r,10000}, {no_defs},
+            /*51214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*51300*/ {proj_longlat}, {r,5000}, {no_defs},
+            /*51301*/ {proj_longlat}, {r,5000}, {no_defs},
+            /*51314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,5000}, {units_m}, {no_defs},
+            /*51400*/ {proj_longlat}, {a,58000}, {b,42000}, {no_defs},
+            /*51401*/ {proj_longlat}, {a,58000}, {b,42000}, {no_defs},
+            /*51414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,58000}, {b,42000}, {units_m}, {no_defs},
+            /*51500*/ {proj_longlat}, {a,10000}, {b,7000}, {no_defs},
+            /*51501*/ {proj_longlat}, {a,10000}, {b,7000}, {no_defs},
+            /*51514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,10000}, {b,7000}, {units_m}, {no_defs},
+            /*51600*/ {proj_longlat}, {r,21500}, {no_defs},
+            /*51601*/ {proj_longlat}, {r,21500}, {no_defs},
+            /*51614*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51615*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51616*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51617*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51618*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51619*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51620*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51621*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51660*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51661*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51662*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51663*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51664*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51665*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51666*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51667*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51672*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*51673*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21500}, {units_m}, {no_defs},
+            /*59900*/ {proj_longlat}, {a,71492000}, {b,66854000}, {no_defs},
+            /*59901*/ {proj_longlat}, {a,71492000}, {b,66854000}, {no_defs},
+            /*59914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*59973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,71492000}, {b,66854000}, {units_m}, {no_defs},
+            /*60100*/ {proj_longlat}, {a,209100}, {b,191400}, {no_defs},
+            /*60101*/ {proj_longlat}, {a,209100}, {b,191400}, {no_defs},
+            /*60114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,209100}, {b,191400}, {units_m}, {no_defs},
+            /*60200*/ {proj_longlat}, {a,256300}, {b,244600}, {no_defs},
+            /*60201*/ {proj_longlat}, {a,256300}, {b,244600}, {no_defs},
+            /*60214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,256300}, {b,244600}, {units_m}, {no_defs},
+            /*60300*/ {proj_longlat}, {a,535600}, {b,525800}, {no_defs},
+            /*60301*/ {proj_longlat}, {a,535600}, {b,525800}, {no_defs},
+            /*60314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,535600}, {b,525800}, {units_m}, {no_defs},
+            /*60400*/ {proj_longlat}, {r,560000}, {no_defs},
+            /*60401*/ {proj_longlat}, {r,560000}, {no_defs},
+            /*60414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,560000}, {units_m}, {no_defs},
+            /*60500*/ {proj_longlat}, {r,764000}, {no_defs},
+            /*60501*/ {proj_longlat}, {r,764000}, {no_defs},
+            /*60514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,764000}, {units_m}, {no_defs},
+            /*60600*/ {proj_longlat}, {r,2575000}, {no_defs},
+            /*60601*/ {proj_longlat}, {r,2575000}, {no_defs},
+            /*60614*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60615*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60616*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60617*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60618*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60619*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60620*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60621*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60660*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60661*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60662*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60663*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60664*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60665*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60666*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60667*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60672*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60673*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,2575000}, {units_m}, {no_defs},
+            /*60700*/ {proj_longlat}, {a,164000}, {b,107000}, {no_defs},
+            /*60701*/ {proj_longlat}, {a,164000}, {b,107000}, {no_defs},
+            /*60714*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60715*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60716*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60717*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60718*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60719*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60720*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60721*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60760*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60761*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60762*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60763*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60764*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60765*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60766*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60767*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60772*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60773*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,164000}, {b,107000}, {units_m}, {no_defs},
+            /*60800*/ {proj_longlat}, {r,718000}, {no_defs},
+            /*60801*/ {proj_longlat}, {r,718000}, {no_defs},
+            /*60814*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60815*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60816*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60817*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60818*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60819*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60820*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60821*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60860*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60861*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60862*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60863*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60864*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60865*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60866*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60867*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60872*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60873*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,718000}, {units_m}, {no_defs},
+            /*60900*/ {proj_longlat}, {a,115000}, {b,105000}, {no_defs},
+            /*60901*/ {proj_longlat}, {a,115000}, {b,105000}, {no_defs},
+            /*60914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*60973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,115000}, {b,105000}, {units_m}, {no_defs},
+            /*61000*/ {proj_longlat}, {a,97000}, {b,77000}, {no_defs},
+            /*61001*/ {proj_longlat}, {a,97000}, {b,77000}, {no_defs},
+            /*61014*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61015*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61016*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61017*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61018*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61019*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61020*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61021*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61060*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61061*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61062*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61063*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61064*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61065*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61066*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61067*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61072*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61073*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,97000}, {b,77000}, {units_m}, {no_defs},
+            /*61100*/ {proj_longlat}, {a,69000}, {b,55000}, {no_defs},
+            /*61101*/ {proj_longlat}, {a,69000}, {b,55000}, {no_defs},
+            /*61114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,69000}, {b,55000}, {units_m}, {no_defs},
+            /*61200*/ {proj_longlat}, {r,16000}, {no_defs},
+            /*61201*/ {proj_longlat}, {r,16000}, {no_defs},
+            /*61214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,16000}, {units_m}, {no_defs},
+            /*61300*/ {proj_longlat}, {a,15000}, {b,7500}, {no_defs},
+            /*61301*/ {proj_longlat}, {a,15000}, {b,7500}, {no_defs},
+            /*61314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,7500}, {units_m}, {no_defs},
+            /*61400*/ {proj_longlat}, {a,15000}, {b,8000}, {no_defs},
+            /*61401*/ {proj_longlat}, {a,15000}, {b,8000}, {no_defs},
+            /*61414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,15000}, {b,8000}, {units_m}, {no_defs},
+            /*61500*/ {proj_longlat}, {a,18500}, {b,13500}, {no_defs},
+            /*61501*/ {proj_longlat}, {a,18500}, {b,13500}, {no_defs},
+            /*61514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,18500}, {b,13500}, {units_m}, {no_defs},
+            /*61600*/ {proj_longlat}, {a,74000}, {b,34000}, {no_defs},
+            /*61601*/ {proj_longlat}, {a,74000}, {b,34000}, {no_defs},
+            /*61614*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61615*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61616*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61617*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61618*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61619*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61620*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61621*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61660*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61661*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61662*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61663*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61664*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61665*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61666*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61667*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61672*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61673*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,74000}, {b,34000}, {units_m}, {no_defs},
+            /*61700*/ {proj_longlat}, {a,55000}, {b,31000}, {no_defs},
+            /*61701*/ {proj_longlat}, {a,55000}, {b,31000}, {no_defs},
+            /*61714*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61715*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61716*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61717*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61718*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61719*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61720*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61721*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61760*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61761*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61762*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61763*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61764*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61765*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61766*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61767*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61772*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61773*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,55000}, {b,31000}, {units_m}, {no_defs},
+            /*61800*/ {proj_longlat}, {r,10000}, {no_defs},
+            /*61801*/ {proj_longlat}, {r,10000}, {no_defs},
+            /*61814*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61815*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61816*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61817*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61818*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61819*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61820*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61821*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61860*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61861*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61862*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61863*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61864*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61865*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61866*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61867*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61872*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*61873*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,10000}, {units_m}, {no_defs},
+            /*69900*/ {proj_longlat}, {a,60268000}, {b,54364000}, {no_defs},
+            /*69901*/ {proj_longlat}, {a,60268000}, {b,54364000}, {no_defs},
+            /*69914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*69973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,60268000}, {b,54364000}, {units_m}, {no_defs},
+            /*70100*/ {proj_longlat}, {a,581100}, {b,577700}, {no_defs},
+            /*70101*/ {proj_longlat}, {a,581100}, {b,577700}, {no_defs},
+            /*70114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,581100}, {b,577700}, {units_m}, {no_defs},
+            /*70200*/ {proj_longlat}, {r,584700}, {no_defs},
+            /*70201*/ {proj_longlat}, {r,584700}, {no_defs},
+            /*70214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,584700}, {units_m}, {no_defs},
+            /*70300*/ {proj_longlat}, {r,788900}, {no_defs},
+            /*70301*/ {proj_longlat}, {r,788900}, {no_defs},
+            /*70314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,788900}, {units_m}, {no_defs},
+            /*70400*/ {proj_longlat}, {r,761400}, {no_defs},
+            /*70401*/ {proj_longlat}, {r,761400}, {no_defs},
+            /*70414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,761400}, {units_m}, {no_defs},
+            /*70500*/ {proj_longlat}, {a,240400}, {b,232900}, {no_defs},
+            /*70501*/ {proj_longlat}, {a,240400}, {b,232900}, {no_defs},
+            /*70514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,240400}, {b,232900}, {units_m}, {no_defs},
+            /*70600*/ {proj_longlat}, {r,13000}, {no_defs},
+            /*70601*/ {proj_longlat}, {r,13000}, {no_defs},
+            /*70614*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70615*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70616*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70617*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70618*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70619*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70620*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70621*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70660*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70661*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70662*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70663*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70664*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70665*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70666*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70667*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70672*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70673*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,13000}, {units_m}, {no_defs},
+            /*70700*/ {proj_longlat}, {r,15000}, {no_defs},
+            /*70701*/ {proj_longlat}, {r,15000}, {no_defs},
+            /*70714*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70715*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70716*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70717*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70718*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70719*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70720*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70721*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70760*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70761*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70762*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70763*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70764*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70765*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70766*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70767*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70772*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70773*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,15000}, {units_m}, {no_defs},
+            /*70800*/ {proj_longlat}, {r,21000}, {no_defs},
+            /*70801*/ {proj_longlat}, {r,21000}, {no_defs},
+            /*70814*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70815*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70816*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70817*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70818*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70819*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70820*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70821*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70860*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70861*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70862*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70863*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70864*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70865*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70866*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70867*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70872*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70873*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,21000}, {units_m}, {no_defs},
+            /*70900*/ {proj_longlat}, {r,31000}, {no_defs},
+            /*70901*/ {proj_longlat}, {r,31000}, {no_defs},
+            /*70914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*70973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,31000}, {units_m}, {no_defs},
+            /*71000*/ {proj_longlat}, {r,27000}, {no_defs},
+            /*71001*/ {proj_longlat}, {r,27000}, {no_defs},
+            /*71014*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71015*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71016*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71017*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71018*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71019*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71020*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71021*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71060*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71061*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71062*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71063*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71064*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71065*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71066*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71067*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71072*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71073*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71100*/ {proj_longlat}, {r,42000}, {no_defs},
+            /*71101*/ {proj_longlat}, {r,42000}, {no_defs},
+            /*71114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,42000}, {units_m}, {no_defs},
+            /*71200*/ {proj_longlat}, {r,54000}, {no_defs},
+            /*71201*/ {proj_longlat}, {r,54000}, {no_defs},
+            /*71214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,54000}, {units_m}, {no_defs},
+            /*71300*/ {proj_longlat}, {r,27000}, {no_defs},
+            /*71301*/ {proj_longlat}, {r,27000}, {no_defs},
+            /*71314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,27000}, {units_m}, {no_defs},
+            /*71400*/ {proj_longlat}, {r,33000}, {no_defs},
+            /*71401*/ {proj_longlat}, {r,33000}, {no_defs},
+            /*71414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,33000}, {units_m}, {no_defs},
+            /*71500*/ {proj_longlat}, {r,77000}, {no_defs},
+            /*71501*/ {proj_longlat}, {r,77000}, {no_defs},
+            /*71514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*71573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,77000}, {units_m}, {no_defs},
+            /*79900*/ {proj_longlat}, {a,25559000}, {b,24973000}, {no_defs},
+            /*79901*/ {proj_longlat}, {a,25559000}, {b,24973000}, {no_defs},
+            /*79914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*79973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,25559000}, {b,24973000}, {units_m}, {no_defs},
+            /*80100*/ {proj_longlat}, {r,1352600}, {no_defs},
+            /*80101*/ {proj_longlat}, {r,1352600}, {no_defs},
+            /*80114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1352600}, {units_m}, {no_defs},
+            /*80200*/ {proj_longlat}, {r,170000}, {no_defs},
+            /*80201*/ {proj_longlat}, {r,170000}, {no_defs},
+            /*80214*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80215*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80216*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80217*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80218*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80219*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80220*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80221*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80260*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80261*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80262*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80263*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80264*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80265*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80266*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80267*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80272*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80273*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,170000}, {units_m}, {no_defs},
+            /*80300*/ {proj_longlat}, {r,29000}, {no_defs},
+            /*80301*/ {proj_longlat}, {r,29000}, {no_defs},
+            /*80314*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80315*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80316*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80317*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80318*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80319*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80320*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80321*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80360*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80361*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80362*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80363*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80364*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80365*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80366*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80367*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80372*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80373*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,29000}, {units_m}, {no_defs},
+            /*80400*/ {proj_longlat}, {r,40000}, {no_defs},
+            /*80401*/ {proj_longlat}, {r,40000}, {no_defs},
+            /*80414*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80415*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80416*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80417*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80418*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80419*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80420*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80421*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80460*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80461*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80462*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80463*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80464*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80465*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80466*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80467*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80472*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80473*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,40000}, {units_m}, {no_defs},
+            /*80500*/ {proj_longlat}, {r,74000}, {no_defs},
+            /*80501*/ {proj_longlat}, {r,74000}, {no_defs},
+            /*80514*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80515*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80516*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80517*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80518*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80519*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80520*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80521*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80560*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80561*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80562*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80563*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80564*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80565*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80566*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80567*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80572*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80573*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,74000}, {units_m}, {no_defs},
+            /*80600*/ {proj_longlat}, {r,79000}, {no_defs},
+            /*80601*/ {proj_longlat}, {r,79000}, {no_defs},
+            /*80614*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80615*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80616*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80617*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80618*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80619*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80620*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80621*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80660*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80661*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80662*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80663*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80664*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80665*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80666*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80667*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80672*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80673*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,79000}, {units_m}, {no_defs},
+            /*80700*/ {proj_longlat}, {r,96000}, {no_defs},
+            /*80701*/ {proj_longlat}, {r,96000}, {no_defs},
+            /*80714*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80715*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80716*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80717*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80718*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80719*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80720*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80721*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80760*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80761*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80762*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80763*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80764*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80765*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80766*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80767*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80772*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80773*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,96000}, {units_m}, {no_defs},
+            /*80800*/ {proj_longlat}, {a,218000}, {b,201000}, {no_defs},
+            /*80801*/ {proj_longlat}, {a,218000}, {b,201000}, {no_defs},
+            /*80814*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80815*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80816*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80817*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80818*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80819*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80820*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80821*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80860*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80861*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80862*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80863*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80864*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80865*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80866*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80867*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80872*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*80873*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,218000}, {b,201000}, {units_m}, {no_defs},
+            /*89900*/ {proj_longlat}, {a,24764000}, {b,24341000}, {no_defs},
+            /*89901*/ {proj_longlat}, {a,24764000}, {b,24341000}, {no_defs},
+            /*89914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*89973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {a,24764000}, {b,24341000}, {units_m}, {no_defs},
+            /*90100*/ {proj_longlat}, {r,593000}, {no_defs},
+            /*90101*/ {proj_longlat}, {r,593000}, {no_defs},
+            /*90114*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90115*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90116*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90117*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90118*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90119*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90120*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90121*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90160*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90161*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90162*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90163*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90164*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90165*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90166*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90167*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90172*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*90173*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,593000}, {units_m}, {no_defs},
+            /*99900*/ {proj_longlat}, {r,1195000}, {no_defs},
+            /*99901*/ {proj_longlat}, {r,1195000}, {no_defs},
+            /*99914*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99915*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99916*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99917*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99918*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99919*/ {proj_stere}, {lat_0,90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99920*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99921*/ {proj_stere}, {lat_0,-90}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99960*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99961*/ {proj_sinu}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99962*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99963*/ {proj_stere}, {lat_0,0}, {lon_0,0}, {k,1}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99964*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99965*/ {proj_tmerc}, {lat_0,0}, {lon_0,0}, {k,0.9996}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99966*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99967*/ {proj_ortho}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99972*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs},
+            /*99973*/ {proj_laea}, {lat_0,90}, {lon_0,0}, {x_0,0}, {y_0,0}, {r,1195000}, {units_m}, {no_defs}
+        };
+
+        static constexpr code_element elements[] = {
+            {19900, 0, 3},
+            {19901, 3, 3},
             //{19910},
             //{19911},
             //{19912},
             //{19913},
-            {19914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
+            {19914, 6, 7},
+            {19915, 13, 7},
+            {19916, 20, 7},
+            {19917, 27, 7},
+            {19918, 34, 9},
+            {19919, 43, 9},
+            {19920, 52, 9},
+            {19921, 61, 9},
+            {19960, 70, 7},
+            {19961, 77, 7},
+            {19962, 84, 9},
+            {19963, 93, 9},
+            {19964, 102, 9},
+            {19965, 111, 9},
+            {19966, 120, 8},
+            {19967, 128, 8},
             //{19968},
             //{19969},
             //{19970},
             //{19971},
-            {19972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
-            {19973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2439700)(units_m)(no_defs)},
+            {19972, 136, 8},
+            {19973, 144, 8},
             //{19974},
             //{19975},
             //{19976},
             //{19977},
             //{19978},
             //{19979},
-            {29900, srs::dpar::parameters<>(proj_longlat)(r,6051800)(no_defs)},
-            {29901, srs::dpar::parameters<>(proj_longlat)(r,6051800)(no_defs)},
+            {29900, 152, 3},
+            {29901, 155, 3},
             //{29910},
             //{29911},
             //{29912},
             //{29913},
-            {29914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
+            {29914, 158, 7},
+            {29915, 165, 7},
+            {29916, 172, 7},
+            {29917, 179, 7},
+            {29918, 186, 9},
+            {29919, 195, 9},
+            {29920, 204, 9},
+            {29921, 213, 9},
+            {29960, 222, 7},
+            {29961, 229, 7},
+            {29962, 236, 9},
+            {29963, 245, 9},
+            {29964, 254, 9},
+            {29965, 263, 9},
+            {29966, 272, 8},
+            {29967, 280, 8},
             //{29968},
             //{29969},
             //{29970},
             //{29971},
-            {29972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
-            {29973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,6051800)(units_m)(no_defs)},
+            {29972, 288, 8},
+            {29973, 296, 8},
             //{29974},
             //{29975},
             //{29976},
             //{29977},
             //{29978},
             //{29979},
-            {30100, srs::dpar::parameters<>(proj_longlat)(r,1737400)(no_defs)},
-            {30101, srs::dpar::parameters<>(proj_longlat)(r,1737400)(no_defs)},
+            {30100, 304, 3},
+            {30101, 307, 3},
             //{30110},
             //{30111},
             //{30112},
             //{30113},
-            {30114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
+            {30114, 310, 7},
+            {30115, 317, 7},
+            {30116, 324, 7},
+            {30117, 331, 7},
+            {30118, 338, 9},
+            {30119, 347, 9},
+            {30120, 356, 9},
+            {30121, 365, 9},
+            {30160, 374, 7},
+            {30161, 381, 7},
+            {30162, 388, 9},
+            {30163, 397, 9},
+            {30164, 406, 9},
+            {30165, 415, 9},
+            {30166, 424, 8},
+            {30167, 432, 8},
             //{30168},
             //{30169},
             //{30170},
             //{30171},
-            {30172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
-            {30173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1737400)(units_m)(no_defs)},
+            {30172, 440, 8},
+            {30173, 448, 8},
             //{30174},
             //{30175},
             //{30176},
             //{30177},
             //{30178},
             //{30179},
-            {39900, srs::dpar::parameters<>(proj_longlat)(a,6378140)(b,6356750)(no_defs)},
-            {39901, srs::dpar::parameters<>(proj_longlat)(a,6378140)(b,6356750)(no_defs)},
+            {39900, 456, 4},
+            {39901, 460, 4},
             //{39910},
             //{39911},
             //{39912},
             //{39913},
-            {39914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
+            {39914, 464, 8},
+            {39915, 472, 8},
+            {39916, 480, 8},
+            {39917, 488, 8},
+            {39918, 496, 10},
+            {39919, 506, 10},
+            {39920, 516, 10},
+            {39921, 526, 10},
+            {39960, 536, 8},
+            {39961, 544, 8},
+            {39962, 552, 10},
+            {39963, 562, 10},
+            {39964, 572, 10},
+            {39965, 582, 10},
+            {39966, 592, 9},
+            {39967, 601, 9},
             //{39968},
             //{39969},
             //{39970},
             //{39971},
-            {39972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
-            {39973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,6378140)(b,6356750)(units_m)(no_defs)},
+            {39972, 610, 9},
+            {39973, 619, 9},
             //{39974},
             //{39975},
             //{39976},
             //{39977},
             //{39978},
             //{39979},
-            {40100, srs::dpar::parameters<>(proj_longlat)(a,13400)(b,9200)(no_defs)},
-            {40101, srs::dpar::parameters<>(proj_longlat)(a,13400)(b,9200)(no_defs)},
+            {40100, 628, 4},
+            {40101, 632, 4},
             //{40110},
             //{40111},
             //{40112},
             //{40113},
-            {40114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
+            {40114, 636, 8},
+            {40115, 644, 8},
+            {40116, 652, 8},
+            {40117, 660, 8},
+            {40118, 668, 10},
+            {40119, 678, 10},
+            {40120, 688, 10},
+            {40121, 698, 10},
+            {40160, 708, 8},
+            {40161, 716, 8},
+            {40162, 724, 10},
+            {40163, 734, 10},
+            {40164, 744, 10},
+            {40165, 754, 10},
+            {40166, 764, 9},
+            {40167, 773, 9},
             //{40168},
             //{40169},
             //{40170},
             //{40171},
-            {40172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
-            {40173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,13400)(b,9200)(units_m)(no_defs)},
+            {40172, 782, 9},
+            {40173, 791, 9},
             //{40174},
             //{40175},
             //{40176},
             //{40177},
             //{40178},
             //{40179},
-            {40200, srs::dpar::parameters<>(proj_longlat)(a,7500)(b,5200)(no_defs)},
-            {40201, srs::dpar::parameters<>(proj_longlat)(a,7500)(b,5200)(no_defs)},
+            {40200, 800, 4},
+            {40201, 804, 4},
             //{40210},
             //{40211},
             //{40212},
             //{40213},
-            {40214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
+            {40214, 808, 8},
+            {40215, 816, 8},
+            {40216, 824, 8},
+            {40217, 832, 8},
+            {40218, 840, 10},
+            {40219, 850, 10},
+            {40220, 860, 10},
+            {40221, 870, 10},
+            {40260, 880, 8},
+            {40261, 888, 8},
+            {40262, 896, 10},
+            {40263, 906, 10},
+            {40264, 916, 10},
+            {40265, 926, 10},
+            {40266, 936, 9},
+            {40267, 945, 9},
             //{40268},
             //{40269},
             //{40270},
             //{40271},
-            {40272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
-            {40273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,7500)(b,5200)(units_m)(no_defs)},
+            {40272, 954, 9},
+            {40273, 963, 9},
             //{40274},
             //{40275},
             //{40276},
             //{40277},
             //{40278},
             //{40279},
-            {49900, srs::dpar::parameters<>(proj_longlat)(a,3396190)(b,3376200)(no_defs)},
-            {49901, srs::dpar::parameters<>(proj_longlat)(a,3396190)(b,3376200)(no_defs)},
+            {49900, 972, 4},
+            {49901, 976, 4},
             //{49910},
             //{49911},
             //{49912},
             //{49913},
-            {49914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
+            {49914, 980, 8},
+            {49915, 988, 8},
+            {49916, 996, 8},
+            {49917, 1004, 8},
+            {49918, 1012, 10},
+            {49919, 1022, 10},
+            {49920, 1032, 10},
+            {49921, 1042, 10},
+            {49960, 1052, 8},
+            {49961, 1060, 8},
+            {49962, 1068, 10},
+            {49963, 1078, 10},
+            {49964, 1088, 10},
+            {49965, 1098, 10},
+            {49966, 1108, 9},
+            {49967, 1117, 9},
             //{49968},
             //{49969},
             //{49970},
             //{49971},
-            {49972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
-            {49973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,3396190)(b,3376200)(units_m)(no_defs)},
+            {49972, 1126, 9},
+            {49973, 1135, 9},
             //{49974},
             //{49975},
             //{49976},
             //{49977},
             //{49978},
             //{49979},
-            {50100, srs::dpar::parameters<>(proj_longlat)(a,1829400)(b,1815700)(no_defs)},
-            {50101, srs::dpar::parameters<>(proj_longlat)(a,1829400)(b,1815700)(no_defs)},
+            {50100, 1144, 4},
+            {50101, 1148, 4},
             //{50110},
             //{50111},
             //{50112},
             //{50113},
-            {50114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
+            {50114, 1152, 8},
+            {50115, 1160, 8},
+            {50116, 1168, 8},
+            {50117, 1176, 8},
+            {50118, 1184, 10},
+            {50119, 1194, 10},
+            {50120, 1204, 10},
+            {50121, 1214, 10},
+            {50160, 1224, 8},
+            {50161, 1232, 8},
+            {50162, 1240, 10},
+            {50163, 1250, 10},
+            {50164, 1260, 10},
+            {50165, 1270, 10},
+            {50166, 1280, 9},
+            {50167, 1289, 9},
             //{50168},
             //{50169},
             //{50170},
             //{50171},
-            {50172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
-            {50173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1829400)(b,1815700)(units_m)(no_defs)},
+            {50172, 1298, 9},
+            {50173, 1307, 9},
             //{50174},
             //{50175},
             //{50176},
             //{50177},
             //{50178},
             //{50179},
-            {50200, srs::dpar::parameters<>(proj_longlat)(a,1564130)(b,1560930)(no_defs)},
-            {50201, srs::dpar::parameters<>(proj_longlat)(a,1564130)(b,1560930)(no_defs)},
+            {50200, 1316, 4},
+            {50201, 1320, 4},
             //{50210},
             //{50211},
             //{50212},
             //{50213},
-            {50214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
+            {50214, 1324, 8},
+            {50215, 1332, 8},
+            {50216, 1340, 8},
+            {50217, 1348, 8},
+            {50218, 1356, 10},
+            {50219, 1366, 10},
+            {50220, 1376, 10},
+            {50221, 1386, 10},
+            {50260, 1396, 8},
+            {50261, 1404, 8},
+            {50262, 1412, 10},
+            {50263, 1422, 10},
+            {50264, 1432, 10},
+            {50265, 1442, 10},
+            {50266, 1452, 9},
+            {50267, 1461, 9},
             //{50268},
             //{50269},
             //{50270},
             //{50271},
-            {50272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
-            {50273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,1564130)(b,1560930)(units_m)(no_defs)},
+            {50272, 1470, 9},
+            {50273, 1479, 9},
             //{50274},
             //{50275},
             //{50276},
             //{50277},
             //{50278},
             //{50279},
-            {50300, srs::dpar::parameters<>(proj_longlat)(a,2632400)(b,2632350)(no_defs)},
-            {50301, srs::dpar::parameters<>(proj_longlat)(a,2632400)(b,2632350)(no_defs)},
+            {50300, 1488, 4},
+            {50301, 1492, 4},
             //{50310},
             //{50311},
             //{50312},
             //{50313},
-            {50314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
+            {50314, 1496, 8},
+            {50315, 1504, 8},
+            {50316, 1512, 8},
+            {50317, 1520, 8},
+            {50318, 1528, 10},
+            {50319, 1538, 10},
+            {50320, 1548, 10},
+            {50321, 1558, 10},
+            {50360, 1568, 8},
+            {50361, 1576, 8},
+            {50362, 1584, 10},
+            {50363, 1594, 10},
+            {50364, 1604, 10},
+            {50365, 1614, 10},
+            {50366, 1624, 9},
+            {50367, 1633, 9},
             //{50368},
             //{50369},
             //{50370},
             //{50371},
-            {50372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
-            {50373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2632400)(b,2632350)(units_m)(no_defs)},
+            {50372, 1642, 9},
+            {50373, 1651, 9},
             //{50374},
             //{50375},
             //{50376},
             //{50377},
             //{50378},
             //{50379},
-            {50400, srs::dpar::parameters<>(proj_longlat)(a,2409400)(b,2409300)(no_defs)},
-            {50401, srs::dpar::parameters<>(proj_longlat)(a,2409400)(b,2409300)(no_defs)},
+            {50400, 1660, 4},
+            {50401, 1664, 4},
             //{50410},
             //{50411},
             //{50412},
             //{50413},
-            {50414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
+            {50414, 1668, 8},
+            {50415, 1676, 8},
+            {50416, 1684, 8},
+            {50417, 1692, 8},
+            {50418, 1700, 10},
+            {50419, 1710, 10},
+            {50420, 1720, 10},
+            {50421, 1730, 10},
+            {50460, 1740, 8},
+            {50461, 1748, 8},
+            {50462, 1756, 10},
+            {50463, 1766, 10},
+            {50464, 1776, 10},
+            {50465, 1786, 10},
+            {50466, 1796, 9},
+            {50467, 1805, 9},
             //{50468},
             //{50469},
             //{50470},
             //{50471},
-            {50472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
-            {50473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,2409400)(b,2409300)(units_m)(no_defs)},
+            {50472, 1814, 9},
+            {50473, 1823, 9},
             //{50474},
             //{50475},
             //{50476},
             //{50477},
             //{50478},
             //{50479},
-            {50500, srs::dpar::parameters<>(proj_longlat)(a,125000)(b,64000)(no_defs)},
-            {50501, srs::dpar::parameters<>(proj_longlat)(a,125000)(b,64000)(no_defs)},
+            {50500, 1832, 4},
+            {50501, 1836, 4},
             //{50510},
             //{50511},
             //{50512},
             //{50513},
-            {50514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
+            {50514, 1840, 8},
+            {50515, 1848, 8},
+            {50516, 1856, 8},
+            {50517, 1864, 8},
+            {50518, 1872, 10},
+            {50519, 1882, 10},
+            {50520, 1892, 10},
+            {50521, 1902, 10},
+            {50560, 1912, 8},
+            {50561, 1920, 8},
+            {50562, 1928, 10},
+            {50563, 1938, 10},
+            {50564, 1948, 10},
+            {50565, 1958, 10},
+            {50566, 1968, 9},
+            {50567, 1977, 9},
             //{50568},
             //{50569},
             //{50570},
             //{50571},
-            {50572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
-            {50573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,125000)(b,64000)(units_m)(no_defs)},
+            {50572, 1986, 9},
+            {50573, 1995, 9},
             //{50574},
             //{50575},
             //{50576},
             //{50577},
             //{50578},
             //{50579},
-            {50600, srs::dpar::parameters<>(proj_longlat)(r,85000)(no_defs)},
-            {50601, srs::dpar::parameters<>(proj_longlat)(r,85000)(no_defs)},
+            {50600, 2004, 3},
+            {50601, 2007, 3},
             //{50610},
             //{50611},
             //{50612},
             //{50613},
-            {50614, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50615, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50616, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50617, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50618, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50619, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50620, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50621, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50660, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50661, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50662, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50663, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50664, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50665, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50666, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50667, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
+            {50614, 2010, 7},
+            {50615, 2017, 7},
+            {50616, 2024, 7},
+            {50617, 2031, 7},
+            {50618, 2038, 9},
+            {50619, 2047, 9},
+            {50620, 2056, 9},
+            {50621, 2065, 9},
+            {50660, 2074, 7},
+            {50661, 2081, 7},
+            {50662, 2088, 9},
+            {50663, 2097, 9},
+            {50664, 2106, 9},
+            {50665, 2115, 9},
+            {50666, 2124, 8},
+            {50667, 2132, 8},
             //{50668},
             //{50669},
             //{50670},
             //{50671},
-            {50672, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
-            {50673, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,85000)(units_m)(no_defs)},
+            {50672, 2140, 8},
+            {50673, 2148, 8},
             //{50674},
             //{50675},
             //{50676},
             //{50677},
             //{50678},
             //{50679},
-            {50700, srs::dpar::parameters<>(proj_longlat)(r,40000)(no_defs)},
-            {50701, srs::dpar::parameters<>(proj_longlat)(r,40000)(no_defs)},
+            {50700, 2156, 3},
+            {50701, 2159, 3},
             //{50710},
             //{50711},
             //{50712},
             //{50713},
-            {50714, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50715, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50716, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50717, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50718, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50719, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50720, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50721, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50760, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50761, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50762, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50763, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50764, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50765, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50766, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50767, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
+            {50714, 2162, 7},
+            {50715, 2169, 7},
+            {50716, 2176, 7},
+            {50717, 2183, 7},
+            {50718, 2190, 9},
+            {50719, 2199, 9},
+            {50720, 2208, 9},
+            {50721, 2217, 9},
+            {50760, 2226, 7},
+            {50761, 2233, 7},
+            {50762, 2240, 9},
+            {50763, 2249, 9},
+            {50764, 2258, 9},
+            {50765, 2267, 9},
+            {50766, 2276, 8},
+            {50767, 2284, 8},
             //{50768},
             //{50769},
             //{50770},
             //{50771},
-            {50772, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {50773, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
+            {50772, 2292, 8},
+            {50773, 2300, 8},
             //{50774},
             //{50775},
             //{50776},
             //{50777},
             //{50778},
             //{50779},
-            {50800, srs::dpar::parameters<>(proj_longlat)(r,18000)(no_defs)},
-            {50801, srs::dpar::parameters<>(proj_longlat)(r,18000)(no_defs)},
+            {50800, 2308, 3},
+            {50801, 2311, 3},
             //{50810},
             //{50811},
             //{50812},
             //{50813},
-            {50814, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50815, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50816, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50817, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50818, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50819, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50820, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50821, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50860, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50861, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50862, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50863, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50864, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50865, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50866, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50867, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
+            {50814, 2314, 7},
+            {50815, 2321, 7},
+            {50816, 2328, 7},
+            {50817, 2335, 7},
+            {50818, 2342, 9},
+            {50819, 2351, 9},
+            {50820, 2360, 9},
+            {50821, 2369, 9},
+            {50860, 2378, 7},
+            {50861, 2385, 7},
+            {50862, 2392, 9},
+            {50863, 2401, 9},
+            {50864, 2410, 9},
+            {50865, 2419, 9},
+            {50866, 2428, 8},
+            {50867, 2436, 8},
             //{50868},
             //{50869},
             //{50870},
             //{50871},
-            {50872, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
-            {50873, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,18000)(units_m)(no_defs)},
+            {50872, 2444, 8},
+            {50873, 2452, 8},
             //{50874},
             //{50875},
             //{50876},
             //{50877},
             //{50878},
             //{50879},
-            {50900, srs::dpar::parameters<>(proj_longlat)(r,14000)(no_defs)},
-            {50901, srs::dpar::parameters<>(proj_longlat)(r,14000)(no_defs)},
+            {50900, 2460, 3},
+            {50901, 2463, 3},
             //{50910},
             //{50911},
             //{50912},
             //{50913},
-            {50914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
+            {50914, 2466, 7},
+            {50915, 2473, 7},
+            {50916, 2480, 7},
+            {50917, 2487, 7},
+            {50918, 2494, 9},
+            {50919, 2503, 9},
+            {50920, 2512, 9},
+            {50921, 2521, 9},
+            {50960, 2530, 7},
+            {50961, 2537, 7},
+            {50962, 2544, 9},
+            {50963, 2553, 9},
+            {50964, 2562, 9},
+            {50965, 2571, 9},
+            {50966, 2580, 8},
+            {50967, 2588, 8},
             //{50968},
             //{50969},
             //{50970},
             //{50971},
-            {50972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
-            {50973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,14000)(units_m)(no_defs)},
+            {50972, 2596, 8},
+            {50973, 2604, 8},
             //{50974},
             //{50975},
             //{50976},
             //{50977},
             //{50978},
             //{50979},
-            {51000, srs::dpar::parameters<>(proj_longlat)(r,12000)(no_defs)},
-            {51001, srs::dpar::parameters<>(proj_longlat)(r,12000)(no_defs)},
+            {51000, 2612, 3},
+            {51001, 2615, 3},
             //{51010},
             //{51011},
             //{51012},
             //{51013},
-            {51014, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51015, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51016, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51017, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51018, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51019, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51020, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51021, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51060, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51061, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51062, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51063, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51064, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51065, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51066, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51067, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
+            {51014, 2618, 7},
+            {51015, 2625, 7},
+            {51016, 2632, 7},
+            {51017, 2639, 7},
+            {51018, 2646, 9},
+            {51019, 2655, 9},
+            {51020, 2664, 9},
+            {51021, 2673, 9},
+            {51060, 2682, 7},
+            {51061, 2689, 7},
+            {51062, 2696, 9},
+            {51063, 2705, 9},
+            {51064, 2714, 9},
+            {51065, 2723, 9},
+            {51066, 2732, 8},
+            {51067, 2740, 8},
             //{51068},
             //{51069},
             //{51070},
             //{51071},
-            {51072, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
-            {51073, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,12000)(units_m)(no_defs)},
+            {51072, 2748, 8},
+            {51073, 2756, 8},
             //{51074},
             //{51075},
             //{51076},
             //{51077},
             //{51078},
             //{51079},
-            {51100, srs::dpar::parameters<>(proj_longlat)(r,15000)(no_defs)},
-            {51101, srs::dpar::parameters<>(proj_longlat)(r,15000)(no_defs)},
+            {51100, 2764, 3},
+            {51101, 2767, 3},
             //{51110},
             //{51111},
             //{51112},
             //{51113},
-            {51114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
+            {51114, 2770, 7},
+            {51115, 2777, 7},
+            {51116, 2784, 7},
+            {51117, 2791, 7},
+            {51118, 2798, 9},
+            {51119, 2807, 9},
+            {51120, 2816, 9},
+            {51121, 2825, 9},
+            {51160, 2834, 7},
+            {51161, 2841, 7},
+            {51162, 2848, 9},
+            {51163, 2857, 9},
+            {51164, 2866, 9},
+            {51165, 2875, 9},
+            {51166, 2884, 8},
+            {51167, 2892, 8},
             //{51168},
             //{51169},
             //{51170},
             //{51171},
-            {51172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {51173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
+            {51172, 2900, 8},
+            {51173, 2908, 8},
             //{51174},
             //{51175},
             //{51176},
             //{51177},
             //{51178},
             //{51179},
-            {51200, srs::dpar::parameters<>(proj_longlat)(r,10000)(no_defs)},
-            {51201, srs::dpar::parameters<>(proj_longlat)(r,10000)(no_defs)},
+            {51200, 2916, 3},
+            {51201, 2919, 3},
             //{51210},
             //{51211},
             //{51212},
             //{51213},
-            {51214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
+            {51214, 2922, 7},
+            {51215, 2929, 7},
+            {51216, 2936, 7},
+            {51217, 2943, 7},
+            {51218, 2950, 9},
+            {51219, 2959, 9},
+            {51220, 2968, 9},
+            {51221, 2977, 9},
+            {51260, 2986, 7},
+            {51261, 2993, 7},
+            {51262, 3000, 9},
+            {51263, 3009, 9},
+            {51264, 3018, 9},
+            {51265, 3027, 9},
+            {51266, 3036, 8},
+            {51267, 3044, 8},
             //{51268},
             //{51269},
             //{51270},
             //{51271},
-            {51272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {51273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
+            {51272, 3052, 8},
+            {51273, 3060, 8},
             //{51274},
             //{51275},
             //{51276},
             //{51277},
             //{51278},
             //{51279},
-            {51300, srs::dpar::parameters<>(proj_longlat)(r,5000)(no_defs)},
-            {51301, srs::dpar::parameters<>(proj_longlat)(r,5000)(no_defs)},
+            {51300, 3068, 3},
+            {51301, 3071, 3},
             //{51310},
             //{51311},
             //{51312},
             //{51313},
-            {51314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
+            {51314, 3074, 7},
+            {51315, 3081, 7},
+            {51316, 3088, 7},
+            {51317, 3095, 7},
+            {51318, 3102, 9},
+            {51319, 3111, 9},
+            {51320, 3120, 9},
+            {51321, 3129, 9},
+            {51360, 3138, 7},
+            {51361, 3145, 7},
+            {51362, 3152, 9},
+            {51363, 3161, 9},
+            {51364, 3170, 9},
+            {51365, 3179, 9},
+            {51366, 3188, 8},
+            {51367, 3196, 8},
             //{51368},
             //{51369},
             //{51370},
             //{51371},
-            {51372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
-            {51373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,5000)(units_m)(no_defs)},
+            {51372, 3204, 8},
+            {51373, 3212, 8},
             //{51374},
             //{51375},
             //{51376},
             //{51377},
             //{51378},
             //{51379},
-            {51400, srs::dpar::parameters<>(proj_longlat)(a,58000)(b,42000)(no_defs)},
-            {51401, srs::dpar::parameters<>(proj_longlat)(a,58000)(b,42000)(no_defs)},
+            {51400, 3220, 4},
+            {51401, 3224, 4},
             //{51410},
             //{51411},
             //{51412},
             //{51413},
-            {51414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
+            {51414, 3228, 8},
+            {51415, 3236, 8},
+            {51416, 3244, 8},
+            {51417, 3252, 8},
+            {51418, 3260, 10},
+            {51419, 3270, 10},
+            {51420, 3280, 10},
+            {51421, 3290, 10},
+            {51460, 3300, 8},
+            {51461, 3308, 8},
+            {51462, 3316, 10},
+            {51463, 3326, 10},
+            {51464, 3336, 10},
+            {51465, 3346, 10},
+            {51466, 3356, 9},
+            {51467, 3365, 9},
             //{51468},
             //{51469},
             //{51470},
             //{51471},
-            {51472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
-            {51473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,58000)(b,42000)(units_m)(no_defs)},
+            {51472, 3374, 9},
+            {51473, 3383, 9},
             //{51474},
             //{51475},
             //{51476},
             //{51477},
             //{51478},
             //{51479},
-            {51500, srs::dpar::parameters<>(proj_longlat)(a,10000)(b,7000)(no_defs)},
-            {51501, srs::dpar::parameters<>(proj_longlat)(a,10000)(b,7000)(no_defs)},
+            {51500, 3392, 4},
+            {51501, 3396, 4},
             //{51510},
             //{51511},
             //{51512},
             //{51513},
-            {51514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
+            {51514, 3400, 8},
+            {51515, 3408, 8},
+            {51516, 3416, 8},
+            {51517, 3424, 8},
+            {51518, 3432, 10},
+            {51519, 3442, 10},
+            {51520, 3452, 10},
+            {51521, 3462, 10},
+            {51560, 3472, 8},
+            {51561, 3480, 8},
+            {51562, 3488, 10},
+            {51563, 3498, 10},
+            {51564, 3508, 10},
+            {51565, 3518, 10},
+            {51566, 3528, 9},
+            {51567, 3537, 9},
             //{51568},
             //{51569},
             //{51570},
             //{51571},
-            {51572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
-            {51573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,10000)(b,7000)(units_m)(no_defs)},
+            {51572, 3546, 9},
+            {51573, 3555, 9},
             //{51574},
             //{51575},
             //{51576},
             //{51577},
             //{51578},
             //{51579},
-            {51600, srs::dpar::parameters<>(proj_longlat)(r,21500)(no_defs)},
-            {51601, srs::dpar::parameters<>(proj_longlat)(r,21500)(no_defs)},
+            {51600, 3564, 3},
+            {51601, 3567, 3},
             //{51610},
             //{51611},
             //{51612},
             //{51613},
-            {51614, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51615, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51616, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51617, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51618, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51619, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51620, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51621, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51660, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51661, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51662, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51663, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51664, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51665, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51666, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51667, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
+            {51614, 3570, 7},
+            {51615, 3577, 7},
+            {51616, 3584, 7},
+            {51617, 3591, 7},
+            {51618, 3598, 9},
+            {51619, 3607, 9},
+            {51620, 3616, 9},
+            {51621, 3625, 9},
+            {51660, 3634, 7},
+            {51661, 3641, 7},
+            {51662, 3648, 9},
+            {51663, 3657, 9},
+            {51664, 3666, 9},
+            {51665, 3675, 9},
+            {51666, 3684, 8},
+            {51667, 3692, 8},
             //{51668},
             //{51669},
             //{51670},
             //{51671},
-            {51672, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
-            {51673, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21500)(units_m)(no_defs)},
+            {51672, 3700, 8},
+            {51673, 3708, 8},
             //{51674},
             //{51675},
             //{51676},
             //{51677},
             //{51678},
             //{51679},
-            {59900, srs::dpar::parameters<>(proj_longlat)(a,71492000)(b,66854000)(no_defs)},
-            {59901, srs::dpar::parameters<>(proj_longlat)(a,71492000)(b,66854000)(no_defs)},
+            {59900, 3716, 4},
+            {59901, 3720, 4},
             //{59910},
             //{59911},
             //{59912},
             //{59913},
-            {59914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
+            {59914, 3724, 8},
+            {59915, 3732, 8},
+            {59916, 3740, 8},
+            {59917, 3748, 8},
+            {59918, 3756, 10},
+            {59919, 3766, 10},
+            {59920, 3776, 10},
+            {59921, 3786, 10},
+            {59960, 3796, 8},
+            {59961, 3804, 8},
+            {59962, 3812, 10},
+            {59963, 3822, 10},
+            {59964, 3832, 10},
+            {59965, 3842, 10},
+            {59966, 3852, 9},
+            {59967, 3861, 9},
             //{59968},
             //{59969},
             //{59970},
             //{59971},
-            {59972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
-            {59973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,71492000)(b,66854000)(units_m)(no_defs)},
+            {59972, 3870, 9},
+            {59973, 3879, 9},
             //{59974},
             //{59975},
             //{59976},
             //{59977},
             //{59978},
             //{59979},
-            {60100, srs::dpar::parameters<>(proj_longlat)(a,209100)(b,191400)(no_defs)},
-            {60101, srs::dpar::parameters<>(proj_longlat)(a,209100)(b,191400)(no_defs)},
+            {60100, 3888, 4},
+            {60101, 3892, 4},
             //{60110},
             //{60111},
             //{60112},
             //{60113},
-            {60114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
+            {60114, 3896, 8},
+            {60115, 3904, 8},
+            {60116, 3912, 8},
+            {60117, 3920, 8},
+            {60118, 3928, 10},
+            {60119, 3938, 10},
+            {60120, 3948, 10},
+            {60121, 3958, 10},
+            {60160, 3968, 8},
+            {60161, 3976, 8},
+            {60162, 3984, 10},
+            {60163, 3994, 10},
+            {60164, 4004, 10},
+            {60165, 4014, 10},
+            {60166, 4024, 9},
+            {60167, 4033, 9},
             //{60168},
             //{60169},
             //{60170},
             //{60171},
-            {60172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
-            {60173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,209100)(b,191400)(units_m)(no_defs)},
+            {60172, 4042, 9},
+            {60173, 4051, 9},
             //{60174},
             //{60175},
             //{60176},
             //{60177},
             //{60178},
             //{60179},
-            {60200, srs::dpar::parameters<>(proj_longlat)(a,256300)(b,244600)(no_defs)},
-            {60201, srs::dpar::parameters<>(proj_longlat)(a,256300)(b,244600)(no_defs)},
+            {60200, 4060, 4},
+            {60201, 4064, 4},
             //{60210},
             //{60211},
             //{60212},
             //{60213},
-            {60214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
+            {60214, 4068, 8},
+            {60215, 4076, 8},
+            {60216, 4084, 8},
+            {60217, 4092, 8},
+            {60218, 4100, 10},
+            {60219, 4110, 10},
+            {60220, 4120, 10},
+            {60221, 4130, 10},
+            {60260, 4140, 8},
+            {60261, 4148, 8},
+            {60262, 4156, 10},
+            {60263, 4166, 10},
+            {60264, 4176, 10},
+            {60265, 4186, 10},
+            {60266, 4196, 9},
+            {60267, 4205, 9},
             //{60268},
             //{60269},
             //{60270},
             //{60271},
-            {60272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
-            {60273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,256300)(b,244600)(units_m)(no_defs)},
+            {60272, 4214, 9},
+            {60273, 4223, 9},
             //{60274},
             //{60275},
             //{60276},
             //{60277},
             //{60278},
             //{60279},
-            {60300, srs::dpar::parameters<>(proj_longlat)(a,535600)(b,525800)(no_defs)},
-            {60301, srs::dpar::parameters<>(proj_longlat)(a,535600)(b,525800)(no_defs)},
+            {60300, 4232, 4},
+            {60301, 4236, 4},
             //{60310},
             //{60311},
             //{60312},
             //{60313},
-            {60314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
+            {60314, 4240, 8},
+            {60315, 4248, 8},
+            {60316, 4256, 8},
+            {60317, 4264, 8},
+            {60318, 4272, 10},
+            {60319, 4282, 10},
+            {60320, 4292, 10},
+            {60321, 4302, 10},
+            {60360, 4312, 8},
+            {60361, 4320, 8},
+            {60362, 4328, 10},
+            {60363, 4338, 10},
+            {60364, 4348, 10},
+            {60365, 4358, 10},
+            {60366, 4368, 9},
+            {60367, 4377, 9},
             //{60368},
             //{60369},
             //{60370},
             //{60371},
-            {60372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
-            {60373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,535600)(b,525800)(units_m)(no_defs)},
+            {60372, 4386, 9},
+            {60373, 4395, 9},
             //{60374},
             //{60375},
             //{60376},
             //{60377},
             //{60378},
             //{60379},
-            {60400, srs::dpar::parameters<>(proj_longlat)(r,560000)(no_defs)},
-            {60401, srs::dpar::parameters<>(proj_longlat)(r,560000)(no_defs)},
+            {60400, 4404, 3},
+            {60401, 4407, 3},
             //{60410},
             //{60411},
             //{60412},
             //{60413},
-            {60414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
+            {60414, 4410, 7},
+            {60415, 4417, 7},
+            {60416, 4424, 7},
+            {60417, 4431, 7},
+            {60418, 4438, 9},
+            {60419, 4447, 9},
+            {60420, 4456, 9},
+            {60421, 4465, 9},
+            {60460, 4474, 7},
+            {60461, 4481, 7},
+            {60462, 4488, 9},
+            {60463, 4497, 9},
+            {60464, 4506, 9},
+            {60465, 4515, 9},
+            {60466, 4524, 8},
+            {60467, 4532, 8},
             //{60468},
             //{60469},
             //{60470},
             //{60471},
-            {60472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
-            {60473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,560000)(units_m)(no_defs)},
+            {60472, 4540, 8},
+            {60473, 4548, 8},
             //{60474},
             //{60475},
             //{60476},
             //{60477},
             //{60478},
             //{60479},
-            {60500, srs::dpar::parameters<>(proj_longlat)(r,764000)(no_defs)},
-            {60501, srs::dpar::parameters<>(proj_longlat)(r,764000)(no_defs)},
+            {60500, 4556, 3},
+            {60501, 4559, 3},
             //{60510},
             //{60511},
             //{60512},
             //{60513},
-            {60514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
+            {60514, 4562, 7},
+            {60515, 4569, 7},
+            {60516, 4576, 7},
+            {60517, 4583, 7},
+            {60518, 4590, 9},
+            {60519, 4599, 9},
+            {60520, 4608, 9},
+            {60521, 4617, 9},
+            {60560, 4626, 7},
+            {60561, 4633, 7},
+            {60562, 4640, 9},
+            {60563, 4649, 9},
+            {60564, 4658, 9},
+            {60565, 4667, 9},
+            {60566, 4676, 8},
+            {60567, 4684, 8},
             //{60568},
             //{60569},
             //{60570},
             //{60571},
-            {60572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
-            {60573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,764000)(units_m)(no_defs)},
+            {60572, 4692, 8},
+            {60573, 4700, 8},
             //{60574},
             //{60575},
             //{60576},
             //{60577},
             //{60578},
             //{60579},
-            {60600, srs::dpar::parameters<>(proj_longlat)(r,2575000)(no_defs)},
-            {60601, srs::dpar::parameters<>(proj_longlat)(r,2575000)(no_defs)},
+            {60600, 4708, 3},
+            {60601, 4711, 3},
             //{60610},
             //{60611},
             //{60612},
             //{60613},
-            {60614, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60615, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60616, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60617, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60618, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60619, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60620, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60621, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60660, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60661, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60662, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60663, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60664, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60665, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60666, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60667, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
+            {60614, 4714, 7},
+            {60615, 4721, 7},
+            {60616, 4728, 7},
+            {60617, 4735, 7},
+            {60618, 4742, 9},
+            {60619, 4751, 9},
+            {60620, 4760, 9},
+            {60621, 4769, 9},
+            {60660, 4778, 7},
+            {60661, 4785, 7},
+            {60662, 4792, 9},
+            {60663, 4801, 9},
+            {60664, 4810, 9},
+            {60665, 4819, 9},
+            {60666, 4828, 8},
+            {60667, 4836, 8},
             //{60668},
             //{60669},
             //{60670},
             //{60671},
-            {60672, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
-            {60673, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,2575000)(units_m)(no_defs)},
+            {60672, 4844, 8},
+            {60673, 4852, 8},
             //{60674},
             //{60675},
             //{60676},
             //{60677},
             //{60678},
             //{60679},
-            {60700, srs::dpar::parameters<>(proj_longlat)(a,164000)(b,107000)(no_defs)},
-            {60701, srs::dpar::parameters<>(proj_longlat)(a,164000)(b,107000)(no_defs)},
+            {60700, 4860, 4},
+            {60701, 4864, 4},
             //{60710},
             //{60711},
             //{60712},
             //{60713},
-            {60714, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60715, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60716, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60717, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60718, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60719, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60720, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60721, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60760, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60761, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60762, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60763, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60764, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60765, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60766, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60767, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
+            {60714, 4868, 8},
+            {60715, 4876, 8},
+            {60716, 4884, 8},
+            {60717, 4892, 8},
+            {60718, 4900, 10},
+            {60719, 4910, 10},
+            {60720, 4920, 10},
+            {60721, 4930, 10},
+            {60760, 4940, 8},
+            {60761, 4948, 8},
+            {60762, 4956, 10},
+            {60763, 4966, 10},
+            {60764, 4976, 10},
+            {60765, 4986, 10},
+            {60766, 4996, 9},
+            {60767, 5005, 9},
             //{60768},
             //{60769},
             //{60770},
             //{60771},
-            {60772, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
-            {60773, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,164000)(b,107000)(units_m)(no_defs)},
+            {60772, 5014, 9},
+            {60773, 5023, 9},
             //{60774},
             //{60775},
             //{60776},
             //{60777},
             //{60778},
             //{60779},
-            {60800, srs::dpar::parameters<>(proj_longlat)(r,718000)(no_defs)},
-            {60801, srs::dpar::parameters<>(proj_longlat)(r,718000)(no_defs)},
+            {60800, 5032, 3},
+            {60801, 5035, 3},
             //{60810},
             //{60811},
             //{60812},
             //{60813},
-            {60814, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60815, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60816, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60817, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60818, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60819, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60820, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60821, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60860, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60861, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60862, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60863, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60864, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60865, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60866, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60867, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
+            {60814, 5038, 7},
+            {60815, 5045, 7},
+            {60816, 5052, 7},
+            {60817, 5059, 7},
+            {60818, 5066, 9},
+            {60819, 5075, 9},
+            {60820, 5084, 9},
+            {60821, 5093, 9},
+            {60860, 5102, 7},
+            {60861, 5109, 7},
+            {60862, 5116, 9},
+            {60863, 5125, 9},
+            {60864, 5134, 9},
+            {60865, 5143, 9},
+            {60866, 5152, 8},
+            {60867, 5160, 8},
             //{60868},
             //{60869},
             //{60870},
             //{60871},
-            {60872, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
-            {60873, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,718000)(units_m)(no_defs)},
+            {60872, 5168, 8},
+            {60873, 5176, 8},
             //{60874},
             //{60875},
             //{60876},
             //{60877},
             //{60878},
             //{60879},
-            {60900, srs::dpar::parameters<>(proj_longlat)(a,115000)(b,105000)(no_defs)},
-            {60901, srs::dpar::parameters<>(proj_longlat)(a,115000)(b,105000)(no_defs)},
+            {60900, 5184, 4},
+            {60901, 5188, 4},
             //{60910},
             //{60911},
             //{60912},
             //{60913},
-            {60914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
+            {60914, 5192, 8},
+            {60915, 5200, 8},
+            {60916, 5208, 8},
+            {60917, 5216, 8},
+            {60918, 5224, 10},
+            {60919, 5234, 10},
+            {60920, 5244, 10},
+            {60921, 5254, 10},
+            {60960, 5264, 8},
+            {60961, 5272, 8},
+            {60962, 5280, 10},
+            {60963, 5290, 10},
+            {60964, 5300, 10},
+            {60965, 5310, 10},
+            {60966, 5320, 9},
+            {60967, 5329, 9},
             //{60968},
             //{60969},
             //{60970},
             //{60971},
-            {60972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
-            {60973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,115000)(b,105000)(units_m)(no_defs)},
+            {60972, 5338, 9},
+            {60973, 5347, 9},
             //{60974},
             //{60975},
             //{60976},
             //{60977},
             //{60978},
             //{60979},
-            {61000, srs::dpar::parameters<>(proj_longlat)(a,97000)(b,77000)(no_defs)},
-            {61001, srs::dpar::parameters<>(proj_longlat)(a,97000)(b,77000)(no_defs)},
+            {61000, 5356, 4},
+            {61001, 5360, 4},
             //{61010},
             //{61011},
             //{61012},
             //{61013},
-            {61014, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61015, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61016, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61017, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61018, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61019, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61020, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61021, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61060, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61061, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61062, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61063, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61064, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61065, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61066, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61067, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
+            {61014, 5364, 8},
+            {61015, 5372, 8},
+            {61016, 5380, 8},
+            {61017, 5388, 8},
+            {61018, 5396, 10},
+            {61019, 5406, 10},
+            {61020, 5416, 10},
+            {61021, 5426, 10},
+            {61060, 5436, 8},
+            {61061, 5444, 8},
+            {61062, 5452, 10},
+            {61063, 5462, 10},
+            {61064, 5472, 10},
+            {61065, 5482, 10},
+            {61066, 5492, 9},
+            {61067, 5501, 9},
             //{61068},
             //{61069},
             //{61070},
             //{61071},
-            {61072, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
-            {61073, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,97000)(b,77000)(units_m)(no_defs)},
+            {61072, 5510, 9},
+            {61073, 5519, 9},
             //{61074},
             //{61075},
             //{61076},
             //{61077},
             //{61078},
             //{61079},
-            {61100, srs::dpar::parameters<>(proj_longlat)(a,69000)(b,55000)(no_defs)},
-            {61101, srs::dpar::parameters<>(proj_longlat)(a,69000)(b,55000)(no_defs)},
+            {61100, 5528, 4},
+            {61101, 5532, 4},
             //{61110},
             //{61111},
             //{61112},
             //{61113},
-            {61114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
+            {61114, 5536, 8},
+            {61115, 5544, 8},
+            {61116, 5552, 8},
+            {61117, 5560, 8},
+            {61118, 5568, 10},
+            {61119, 5578, 10},
+            {61120, 5588, 10},
+            {61121, 5598, 10},
+            {61160, 5608, 8},
+            {61161, 5616, 8},
+            {61162, 5624, 10},
+            {61163, 5634, 10},
+            {61164, 5644, 10},
+            {61165, 5654, 10},
+            {61166, 5664, 9},
+            {61167, 5673, 9},
             //{61168},
             //{61169},
             //{61170},
             //{61171},
-            {61172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
-            {61173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,69000)(b,55000)(units_m)(no_defs)},
+            {61172, 5682, 9},
+            {61173, 5691, 9},
             //{61174},
             //{61175},
             //{61176},
             //{61177},
             //{61178},
             //{61179},
-            {61200, srs::dpar::parameters<>(proj_longlat)(r,16000)(no_defs)},
-            {61201, srs::dpar::parameters<>(proj_longlat)(r,16000)(no_defs)},
+            {61200, 5700, 3},
+            {61201, 5703, 3},
             //{61210},
             //{61211},
             //{61212},
             //{61213},
-            {61214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
+            {61214, 5706, 7},
+            {61215, 5713, 7},
+            {61216, 5720, 7},
+            {61217, 5727, 7},
+            {61218, 5734, 9},
+            {61219, 5743, 9},
+            {61220, 5752, 9},
+            {61221, 5761, 9},
+            {61260, 5770, 7},
+            {61261, 5777, 7},
+            {61262, 5784, 9},
+            {61263, 5793, 9},
+            {61264, 5802, 9},
+            {61265, 5811, 9},
+            {61266, 5820, 8},
+            {61267, 5828, 8},
             //{61268},
             //{61269},
             //{61270},
             //{61271},
-            {61272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
-            {61273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,16000)(units_m)(no_defs)},
+            {61272, 5836, 8},
+            {61273, 5844, 8},
             //{61274},
             //{61275},
             //{61276},
             //{61277},
             //{61278},
             //{61279},
-            {61300, srs::dpar::parameters<>(proj_longlat)(a,15000)(b,7500)(no_defs)},
-            {61301, srs::dpar::parameters<>(proj_longlat)(a,15000)(b,7500)(no_defs)},
+            {61300, 5852, 4},
+            {61301, 5856, 4},
             //{61310},
             //{61311},
             //{61312},
             //{61313},
-            {61314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
+            {61314, 5860, 8},
+            {61315, 5868, 8},
+            {61316, 5876, 8},
+            {61317, 5884, 8},
+            {61318, 5892, 10},
+            {61319, 5902, 10},
+            {61320, 5912, 10},
+            {61321, 5922, 10},
+            {61360, 5932, 8},
+            {61361, 5940, 8},
+            {61362, 5948, 10},
+            {61363, 5958, 10},
+            {61364, 5968, 10},
+            {61365, 5978, 10},
+            {61366, 5988, 9},
+            {61367, 5997, 9},
             //{61368},
             //{61369},
             //{61370},
             //{61371},
-            {61372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
-            {61373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,7500)(units_m)(no_defs)},
+            {61372, 6006, 9},
+            {61373, 6015, 9},
             //{61374},
             //{61375},
             //{61376},
             //{61377},
             //{61378},
             //{61379},
-            {61400, srs::dpar::parameters<>(proj_longlat)(a,15000)(b,8000)(no_defs)},
-            {61401, srs::dpar::parameters<>(proj_longlat)(a,15000)(b,8000)(no_defs)},
+            {61400, 6024, 4},
+            {61401, 6028, 4},
             //{61410},
             //{61411},
             //{61412},
             //{61413},
-            {61414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
+            {61414, 6032, 8},
+            {61415, 6040, 8},
+            {61416, 6048, 8},
+            {61417, 6056, 8},
+            {61418, 6064, 10},
+            {61419, 6074, 10},
+            {61420, 6084, 10},
+            {61421, 6094, 10},
+            {61460, 6104, 8},
+            {61461, 6112, 8},
+            {61462, 6120, 10},
+            {61463, 6130, 10},
+            {61464, 6140, 10},
+            {61465, 6150, 10},
+            {61466, 6160, 9},
+            {61467, 6169, 9},
             //{61468},
             //{61469},
             //{61470},
             //{61471},
-            {61472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
-            {61473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,15000)(b,8000)(units_m)(no_defs)},
+            {61472, 6178, 9},
+            {61473, 6187, 9},
             //{61474},
             //{61475},
             //{61476},
             //{61477},
             //{61478},
             //{61479},
-            {61500, srs::dpar::parameters<>(proj_longlat)(a,18500)(b,13500)(no_defs)},
-            {61501, srs::dpar::parameters<>(proj_longlat)(a,18500)(b,13500)(no_defs)},
+            {61500, 6196, 4},
+            {61501, 6200, 4},
             //{61510},
             //{61511},
             //{61512},
             //{61513},
-            {61514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
+            {61514, 6204, 8},
+            {61515, 6212, 8},
+            {61516, 6220, 8},
+            {61517, 6228, 8},
+            {61518, 6236, 10},
+            {61519, 6246, 10},
+            {61520, 6256, 10},
+            {61521, 6266, 10},
+            {61560, 6276, 8},
+            {61561, 6284, 8},
+            {61562, 6292, 10},
+            {61563, 6302, 10},
+            {61564, 6312, 10},
+            {61565, 6322, 10},
+            {61566, 6332, 9},
+            {61567, 6341, 9},
             //{61568},
             //{61569},
             //{61570},
             //{61571},
-            {61572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
-            {61573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,18500)(b,13500)(units_m)(no_defs)},
+            {61572, 6350, 9},
+            {61573, 6359, 9},
             //{61574},
             //{61575},
             //{61576},
             //{61577},
             //{61578},
             //{61579},
-            {61600, srs::dpar::parameters<>(proj_longlat)(a,74000)(b,34000)(no_defs)},
-            {61601, srs::dpar::parameters<>(proj_longlat)(a,74000)(b,34000)(no_defs)},
+            {61600, 6368, 4},
+            {61601, 6372, 4},
             //{61610},
             //{61611},
             //{61612},
             //{61613},
-            {61614, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61615, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61616, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61617, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61618, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61619, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61620, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61621, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61660, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61661, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61662, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61663, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61664, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61665, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61666, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61667, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
+            {61614, 6376, 8},
+            {61615, 6384, 8},
+            {61616, 6392, 8},
+            {61617, 6400, 8},
+            {61618, 6408, 10},
+            {61619, 6418, 10},
+            {61620, 6428, 10},
+            {61621, 6438, 10},
+            {61660, 6448, 8},
+            {61661, 6456, 8},
+            {61662, 6464, 10},
+            {61663, 6474, 10},
+            {61664, 6484, 10},
+            {61665, 6494, 10},
+            {61666, 6504, 9},
+            {61667, 6513, 9},
             //{61668},
             //{61669},
             //{61670},
             //{61671},
-            {61672, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
-            {61673, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,74000)(b,34000)(units_m)(no_defs)},
+            {61672, 6522, 9},
+            {61673, 6531, 9},
             //{61674},
             //{61675},
             //{61676},
             //{61677},
             //{61678},
             //{61679},
-            {61700, srs::dpar::parameters<>(proj_longlat)(a,55000)(b,31000)(no_defs)},
-            {61701, srs::dpar::parameters<>(proj_longlat)(a,55000)(b,31000)(no_defs)},
+            {61700, 6540, 4},
+            {61701, 6544, 4},
             //{61710},
             //{61711},
             //{61712},
             //{61713},
-            {61714, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61715, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61716, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61717, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61718, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61719, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61720, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61721, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61760, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61761, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61762, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61763, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61764, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61765, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61766, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61767, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
+            {61714, 6548, 8},
+            {61715, 6556, 8},
+            {61716, 6564, 8},
+            {61717, 6572, 8},
+            {61718, 6580, 10},
+            {61719, 6590, 10},
+            {61720, 6600, 10},
+            {61721, 6610, 10},
+            {61760, 6620, 8},
+            {61761, 6628, 8},
+            {61762, 6636, 10},
+            {61763, 6646, 10},
+            {61764, 6656, 10},
+            {61765, 6666, 10},
+            {61766, 6676, 9},
+            {61767, 6685, 9},
             //{61768},
             //{61769},
             //{61770},
             //{61771},
-            {61772, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
-            {61773, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,55000)(b,31000)(units_m)(no_defs)},
+            {61772, 6694, 9},
+            {61773, 6703, 9},
             //{61774},
             //{61775},
             //{61776},
             //{61777},
             //{61778},
             //{61779},
-            {61800, srs::dpar::parameters<>(proj_longlat)(r,10000)(no_defs)},
-            {61801, srs::dpar::parameters<>(proj_longlat)(r,10000)(no_defs)},
+            {61800, 6712, 3},
+            {61801, 6715, 3},
             //{61810},
             //{61811},
             //{61812},
             //{61813},
-            {61814, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61815, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61816, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61817, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61818, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61819, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61820, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61821, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61860, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61861, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61862, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61863, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61864, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61865, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61866, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61867, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
+            {61814, 6718, 7},
+            {61815, 6725, 7},
+            {61816, 6732, 7},
+            {61817, 6739, 7},
+            {61818, 6746, 9},
+            {61819, 6755, 9},
+            {61820, 6764, 9},
+            {61821, 6773, 9},
+            {61860, 6782, 7},
+            {61861, 6789, 7},
+            {61862, 6796, 9},
+            {61863, 6805, 9},
+            {61864, 6814, 9},
+            {61865, 6823, 9},
+            {61866, 6832, 8},
+            {61867, 6840, 8},
             //{61868},
             //{61869},
             //{61870},
             //{61871},
-            {61872, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
-            {61873, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,10000)(units_m)(no_defs)},
+            {61872, 6848, 8},
+            {61873, 6856, 8},
             //{61874},
             //{61875},
             //{61876},
             //{61877},
             //{61878},
             //{61879},
-            {69900, srs::dpar::parameters<>(proj_longlat)(a,60268000)(b,54364000)(no_defs)},
-            {69901, srs::dpar::parameters<>(proj_longlat)(a,60268000)(b,54364000)(no_defs)},
+            {69900, 6864, 4},
+            {69901, 6868, 4},
             //{69910},
             //{69911},
             //{69912},
             //{69913},
-            {69914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
+            {69914, 6872, 8},
+            {69915, 6880, 8},
+            {69916, 6888, 8},
+            {69917, 6896, 8},
+            {69918, 6904, 10},
+            {69919, 6914, 10},
+            {69920, 6924, 10},
+            {69921, 6934, 10},
+            {69960, 6944, 8},
+            {69961, 6952, 8},
+            {69962, 6960, 10},
+            {69963, 6970, 10},
+            {69964, 6980, 10},
+            {69965, 6990, 10},
+            {69966, 7000, 9},
+            {69967, 7009, 9},
             //{69968},
             //{69969},
             //{69970},
             //{69971},
-            {69972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
-            {69973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,60268000)(b,54364000)(units_m)(no_defs)},
+            {69972, 7018, 9},
+            {69973, 7027, 9},
             //{69974},
             //{69975},
             //{69976},
             //{69977},
             //{69978},
             //{69979},
-            {70100, srs::dpar::parameters<>(proj_longlat)(a,581100)(b,577700)(no_defs)},
-            {70101, srs::dpar::parameters<>(proj_longlat)(a,581100)(b,577700)(no_defs)},
+            {70100, 7036, 4},
+            {70101, 7040, 4},
             //{70110},
             //{70111},
             //{70112},
             //{70113},
-            {70114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
+            {70114, 7044, 8},
+            {70115, 7052, 8},
+            {70116, 7060, 8},
+            {70117, 7068, 8},
+            {70118, 7076, 10},
+            {70119, 7086, 10},
+            {70120, 7096, 10},
+            {70121, 7106, 10},
+            {70160, 7116, 8},
+            {70161, 7124, 8},
+            {70162, 7132, 10},
+            {70163, 7142, 10},
+            {70164, 7152, 10},
+            {70165, 7162, 10},
+            {70166, 7172, 9},
+            {70167, 7181, 9},
             //{70168},
             //{70169},
             //{70170},
             //{70171},
-            {70172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
-            {70173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,581100)(b,577700)(units_m)(no_defs)},
+            {70172, 7190, 9},
+            {70173, 7199, 9},
             //{70174},
             //{70175},
             //{70176},
             //{70177},
             //{70178},
             //{70179},
-            {70200, srs::dpar::parameters<>(proj_longlat)(r,584700)(no_defs)},
-            {70201, srs::dpar::parameters<>(proj_longlat)(r,584700)(no_defs)},
+            {70200, 7208, 3},
+            {70201, 7211, 3},
             //{70210},
             //{70211},
             //{70212},
             //{70213},
-            {70214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
+            {70214, 7214, 7},
+            {70215, 7221, 7},
+            {70216, 7228, 7},
+            {70217, 7235, 7},
+            {70218, 7242, 9},
+            {70219, 7251, 9},
+            {70220, 7260, 9},
+            {70221, 7269, 9},
+            {70260, 7278, 7},
+            {70261, 7285, 7},
+            {70262, 7292, 9},
+            {70263, 7301, 9},
+            {70264, 7310, 9},
+            {70265, 7319, 9},
+            {70266, 7328, 8},
+            {70267, 7336, 8},
             //{70268},
             //{70269},
             //{70270},
             //{70271},
-            {70272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
-            {70273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,584700)(units_m)(no_defs)},
+            {70272, 7344, 8},
+            {70273, 7352, 8},
             //{70274},
             //{70275},
             //{70276},
             //{70277},
             //{70278},
             //{70279},
-            {70300, srs::dpar::parameters<>(proj_longlat)(r,788900)(no_defs)},
-            {70301, srs::dpar::parameters<>(proj_longlat)(r,788900)(no_defs)},
+            {70300, 7360, 3},
+            {70301, 7363, 3},
             //{70310},
             //{70311},
             //{70312},
             //{70313},
-            {70314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
+            {70314, 7366, 7},
+            {70315, 7373, 7},
+            {70316, 7380, 7},
+            {70317, 7387, 7},
+            {70318, 7394, 9},
+            {70319, 7403, 9},
+            {70320, 7412, 9},
+            {70321, 7421, 9},
+            {70360, 7430, 7},
+            {70361, 7437, 7},
+            {70362, 7444, 9},
+            {70363, 7453, 9},
+            {70364, 7462, 9},
+            {70365, 7471, 9},
+            {70366, 7480, 8},
+            {70367, 7488, 8},
             //{70368},
             //{70369},
             //{70370},
             //{70371},
-            {70372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
-            {70373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,788900)(units_m)(no_defs)},
+            {70372, 7496, 8},
+            {70373, 7504, 8},
             //{70374},
             //{70375},
             //{70376},
             //{70377},
             //{70378},
             //{70379},
-            {70400, srs::dpar::parameters<>(proj_longlat)(r,761400)(no_defs)},
-            {70401, srs::dpar::parameters<>(proj_longlat)(r,761400)(no_defs)},
+            {70400, 7512, 3},
+            {70401, 7515, 3},
             //{70410},
             //{70411},
             //{70412},
             //{70413},
-            {70414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
+            {70414, 7518, 7},
+            {70415, 7525, 7},
+            {70416, 7532, 7},
+            {70417, 7539, 7},
+            {70418, 7546, 9},
+            {70419, 7555, 9},
+            {70420, 7564, 9},
+            {70421, 7573, 9},
+            {70460, 7582, 7},
+            {70461, 7589, 7},
+            {70462, 7596, 9},
+            {70463, 7605, 9},
+            {70464, 7614, 9},
+            {70465, 7623, 9},
+            {70466, 7632, 8},
+            {70467, 7640, 8},
             //{70468},
             //{70469},
             //{70470},
             //{70471},
-            {70472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
-            {70473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,761400)(units_m)(no_defs)},
+            {70472, 7648, 8},
+            {70473, 7656, 8},
             //{70474},
             //{70475},
             //{70476},
             //{70477},
             //{70478},
             //{70479},
-            {70500, srs::dpar::parameters<>(proj_longlat)(a,240400)(b,232900)(no_defs)},
-            {70501, srs::dpar::parameters<>(proj_longlat)(a,240400)(b,232900)(no_defs)},
+            {70500, 7664, 4},
+            {70501, 7668, 4},
             //{70510},
             //{70511},
             //{70512},
             //{70513},
-            {70514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
+            {70514, 7672, 8},
+            {70515, 7680, 8},
+            {70516, 7688, 8},
+            {70517, 7696, 8},
+            {70518, 7704, 10},
+            {70519, 7714, 10},
+            {70520, 7724, 10},
+            {70521, 7734, 10},
+            {70560, 7744, 8},
+            {70561, 7752, 8},
+            {70562, 7760, 10},
+            {70563, 7770, 10},
+            {70564, 7780, 10},
+            {70565, 7790, 10},
+            {70566, 7800, 9},
+            {70567, 7809, 9},
             //{70568},
             //{70569},
             //{70570},
             //{70571},
-            {70572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
-            {70573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,240400)(b,232900)(units_m)(no_defs)},
+            {70572, 7818, 9},
+            {70573, 7827, 9},
             //{70574},
             //{70575},
             //{70576},
             //{70577},
             //{70578},
             //{70579},
-            {70600, srs::dpar::parameters<>(proj_longlat)(r,13000)(no_defs)},
-            {70601, srs::dpar::parameters<>(proj_longlat)(r,13000)(no_defs)},
+            {70600, 7836, 3},
+            {70601, 7839, 3},
             //{70610},
             //{70611},
             //{70612},
             //{70613},
-            {70614, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70615, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70616, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70617, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70618, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70619, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70620, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70621, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70660, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70661, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70662, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70663, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70664, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70665, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70666, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70667, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
+            {70614, 7842, 7},
+            {70615, 7849, 7},
+            {70616, 7856, 7},
+            {70617, 7863, 7},
+            {70618, 7870, 9},
+            {70619, 7879, 9},
+            {70620, 7888, 9},
+            {70621, 7897, 9},
+            {70660, 7906, 7},
+            {70661, 7913, 7},
+            {70662, 7920, 9},
+            {70663, 7929, 9},
+            {70664, 7938, 9},
+            {70665, 7947, 9},
+            {70666, 7956, 8},
+            {70667, 7964, 8},
             //{70668},
             //{70669},
             //{70670},
             //{70671},
-            {70672, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
-            {70673, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,13000)(units_m)(no_defs)},
+            {70672, 7972, 8},
+            {70673, 7980, 8},
             //{70674},
             //{70675},
             //{70676},
             //{70677},
             //{70678},
             //{70679},
-            {70700, srs::dpar::parameters<>(proj_longlat)(r,15000)(no_defs)},
-            {70701, srs::dpar::parameters<>(proj_longlat)(r,15000)(no_defs)},
+            {70700, 7988, 3},
+            {70701, 7991, 3},
             //{70710},
             //{70711},
             //{70712},
             //{70713},
-            {70714, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70715, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70716, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70717, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70718, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70719, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70720, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70721, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70760, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70761, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70762, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70763, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70764, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70765, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70766, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70767, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
+            {70714, 7994, 7},
+            {70715, 8001, 7},
+            {70716, 8008, 7},
+            {70717, 8015, 7},
+            {70718, 8022, 9},
+            {70719, 8031, 9},
+            {70720, 8040, 9},
+            {70721, 8049, 9},
+            {70760, 8058, 7},
+            {70761, 8065, 7},
+            {70762, 8072, 9},
+            {70763, 8081, 9},
+            {70764, 8090, 9},
+            {70765, 8099, 9},
+            {70766, 8108, 8},
+            {70767, 8116, 8},
             //{70768},
             //{70769},
             //{70770},
             //{70771},
-            {70772, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
-            {70773, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,15000)(units_m)(no_defs)},
+            {70772, 8124, 8},
+            {70773, 8132, 8},
             //{70774},
             //{70775},
             //{70776},
             //{70777},
             //{70778},
             //{70779},
-            {70800, srs::dpar::parameters<>(proj_longlat)(r,21000)(no_defs)},
-            {70801, srs::dpar::parameters<>(proj_longlat)(r,21000)(no_defs)},
+            {70800, 8140, 3},
+            {70801, 8143, 3},
             //{70810},
             //{70811},
             //{70812},
             //{70813},
-            {70814, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70815, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70816, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70817, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70818, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70819, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70820, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70821, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70860, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70861, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70862, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70863, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70864, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70865, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70866, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70867, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
+            {70814, 8146, 7},
+            {70815, 8153, 7},
+            {70816, 8160, 7},
+            {70817, 8167, 7},
+            {70818, 8174, 9},
+            {70819, 8183, 9},
+            {70820, 8192, 9},
+            {70821, 8201, 9},
+            {70860, 8210, 7},
+            {70861, 8217, 7},
+            {70862, 8224, 9},
+            {70863, 8233, 9},
+            {70864, 8242, 9},
+            {70865, 8251, 9},
+            {70866, 8260, 8},
+            {70867, 8268, 8},
             //{70868},
             //{70869},
             //{70870},
             //{70871},
-            {70872, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
-            {70873, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,21000)(units_m)(no_defs)},
+            {70872, 8276, 8},
+            {70873, 8284, 8},
             //{70874},
             //{70875},
             //{70876},
             //{70877},
             //{70878},
             //{70879},
-            {70900, srs::dpar::parameters<>(proj_longlat)(r,31000)(no_defs)},
-            {70901, srs::dpar::parameters<>(proj_longlat)(r,31000)(no_defs)},
+            {70900, 8292, 3},
+            {70901, 8295, 3},
             //{70910},
             //{70911},
             //{70912},
             //{70913},
-            {70914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
+            {70914, 8298, 7},
+            {70915, 8305, 7},
+            {70916, 8312, 7},
+            {70917, 8319, 7},
+            {70918, 8326, 9},
+            {70919, 8335, 9},
+            {70920, 8344, 9},
+            {70921, 8353, 9},
+            {70960, 8362, 7},
+            {70961, 8369, 7},
+            {70962, 8376, 9},
+            {70963, 8385, 9},
+            {70964, 8394, 9},
+            {70965, 8403, 9},
+            {70966, 8412, 8},
+            {70967, 8420, 8},
             //{70968},
             //{70969},
             //{70970},
             //{70971},
-            {70972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
-            {70973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,31000)(units_m)(no_defs)},
+            {70972, 8428, 8},
+            {70973, 8436, 8},
             //{70974},
             //{70975},
             //{70976},
             //{70977},
             //{70978},
             //{70979},
-            {71000, srs::dpar::parameters<>(proj_longlat)(r,27000)(no_defs)},
-            {71001, srs::dpar::parameters<>(proj_longlat)(r,27000)(no_defs)},
+            {71000, 8444, 3},
+            {71001, 8447, 3},
             //{71010},
             //{71011},
             //{71012},
             //{71013},
-            {71014, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71015, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71016, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71017, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71018, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71019, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71020, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71021, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71060, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71061, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71062, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71063, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71064, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71065, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71066, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71067, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
+            {71014, 8450, 7},
+            {71015, 8457, 7},
+            {71016, 8464, 7},
+            {71017, 8471, 7},
+            {71018, 8478, 9},
+            {71019, 8487, 9},
+            {71020, 8496, 9},
+            {71021, 8505, 9},
+            {71060, 8514, 7},
+            {71061, 8521, 7},
+            {71062, 8528, 9},
+            {71063, 8537, 9},
+            {71064, 8546, 9},
+            {71065, 8555, 9},
+            {71066, 8564, 8},
+            {71067, 8572, 8},
             //{71068},
             //{71069},
             //{71070},
             //{71071},
-            {71072, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71073, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
+            {71072, 8580, 8},
+            {71073, 8588, 8},
             //{71074},
             //{71075},
             //{71076},
             //{71077},
             //{71078},
             //{71079},
-            {71100, srs::dpar::parameters<>(proj_longlat)(r,42000)(no_defs)},
-            {71101, srs::dpar::parameters<>(proj_longlat)(r,42000)(no_defs)},
+            {71100, 8596, 3},
+            {71101, 8599, 3},
             //{71110},
             //{71111},
             //{71112},
             //{71113},
-            {71114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
+            {71114, 8602, 7},
+            {71115, 8609, 7},
+            {71116, 8616, 7},
+            {71117, 8623, 7},
+            {71118, 8630, 9},
+            {71119, 8639, 9},
+            {71120, 8648, 9},
+            {71121, 8657, 9},
+            {71160, 8666, 7},
+            {71161, 8673, 7},
+            {71162, 8680, 9},
+            {71163, 8689, 9},
+            {71164, 8698, 9},
+            {71165, 8707, 9},
+            {71166, 8716, 8},
+            {71167, 8724, 8},
             //{71168},
             //{71169},
             //{71170},
             //{71171},
-            {71172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
-            {71173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,42000)(units_m)(no_defs)},
+            {71172, 8732, 8},
+            {71173, 8740, 8},
             //{71174},
             //{71175},
             //{71176},
             //{71177},
             //{71178},
             //{71179},
-            {71200, srs::dpar::parameters<>(proj_longlat)(r,54000)(no_defs)},
-            {71201, srs::dpar::parameters<>(proj_longlat)(r,54000)(no_defs)},
+            {71200, 8748, 3},
+            {71201, 8751, 3},
             //{71210},
             //{71211},
             //{71212},
             //{71213},
-            {71214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
+            {71214, 8754, 7},
+            {71215, 8761, 7},
+            {71216, 8768, 7},
+            {71217, 8775, 7},
+            {71218, 8782, 9},
+            {71219, 8791, 9},
+            {71220, 8800, 9},
+            {71221, 8809, 9},
+            {71260, 8818, 7},
+            {71261, 8825, 7},
+            {71262, 8832, 9},
+            {71263, 8841, 9},
+            {71264, 8850, 9},
+            {71265, 8859, 9},
+            {71266, 8868, 8},
+            {71267, 8876, 8},
             //{71268},
             //{71269},
             //{71270},
             //{71271},
-            {71272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
-            {71273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,54000)(units_m)(no_defs)},
+            {71272, 8884, 8},
+            {71273, 8892, 8},
             //{71274},
             //{71275},
             //{71276},
             //{71277},
             //{71278},
             //{71279},
-            {71300, srs::dpar::parameters<>(proj_longlat)(r,27000)(no_defs)},
-            {71301, srs::dpar::parameters<>(proj_longlat)(r,27000)(no_defs)},
+            {71300, 8900, 3},
+            {71301, 8903, 3},
             //{71310},
             //{71311},
             //{71312},
             //{71313},
-            {71314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
+            {71314, 8906, 7},
+            {71315, 8913, 7},
+            {71316, 8920, 7},
+            {71317, 8927, 7},
+            {71318, 8934, 9},
+            {71319, 8943, 9},
+            {71320, 8952, 9},
+            {71321, 8961, 9},
+            {71360, 8970, 7},
+            {71361, 8977, 7},
+            {71362, 8984, 9},
+            {71363, 8993, 9},
+            {71364, 9002, 9},
+            {71365, 9011, 9},
+            {71366, 9020, 8},
+            {71367, 9028, 8},
             //{71368},
             //{71369},
             //{71370},
             //{71371},
-            {71372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
-            {71373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,27000)(units_m)(no_defs)},
+            {71372, 9036, 8},
+            {71373, 9044, 8},
             //{71374},
             //{71375},
             //{71376},
             //{71377},
             //{71378},
             //{71379},
-            {71400, srs::dpar::parameters<>(proj_longlat)(r,33000)(no_defs)},
-            {71401, srs::dpar::parameters<>(proj_longlat)(r,33000)(no_defs)},
+            {71400, 9052, 3},
+            {71401, 9055, 3},
             //{71410},
             //{71411},
             //{71412},
             //{71413},
-            {71414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
+            {71414, 9058, 7},
+            {71415, 9065, 7},
+            {71416, 9072, 7},
+            {71417, 9079, 7},
+            {71418, 9086, 9},
+            {71419, 9095, 9},
+            {71420, 9104, 9},
+            {71421, 9113, 9},
+            {71460, 9122, 7},
+            {71461, 9129, 7},
+            {71462, 9136, 9},
+            {71463, 9145, 9},
+            {71464, 9154, 9},
+            {71465, 9163, 9},
+            {71466, 9172, 8},
+            {71467, 9180, 8},
             //{71468},
             //{71469},
             //{71470},
             //{71471},
-            {71472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
-            {71473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,33000)(units_m)(no_defs)},
+            {71472, 9188, 8},
+            {71473, 9196, 8},
             //{71474},
             //{71475},
             //{71476},
             //{71477},
             //{71478},
             //{71479},
-            {71500, srs::dpar::parameters<>(proj_longlat)(r,77000)(no_defs)},
-            {71501, srs::dpar::parameters<>(proj_longlat)(r,77000)(no_defs)},
+            {71500, 9204, 3},
+            {71501, 9207, 3},
             //{71510},
             //{71511},
             //{71512},
             //{71513},
-            {71514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
+            {71514, 9210, 7},
+            {71515, 9217, 7},
+            {71516, 9224, 7},
+            {71517, 9231, 7},
+            {71518, 9238, 9},
+            {71519, 9247, 9},
+            {71520, 9256, 9},
+            {71521, 9265, 9},
+            {71560, 9274, 7},
+            {71561, 9281, 7},
+            {71562, 9288, 9},
+            {71563, 9297, 9},
+            {71564, 9306, 9},
+            {71565, 9315, 9},
+            {71566, 9324, 8},
+            {71567, 9332, 8},
             //{71568},
             //{71569},
             //{71570},
             //{71571},
-            {71572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
-            {71573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,77000)(units_m)(no_defs)},
+            {71572, 9340, 8},
+            {71573, 9348, 8},
             //{71574},
             //{71575},
             //{71576},
             //{71577},
             //{71578},
             //{71579},
-            {79900, srs::dpar::parameters<>(proj_longlat)(a,25559000)(b,24973000)(no_defs)},
-            {79901, srs::dpar::parameters<>(proj_longlat)(a,25559000)(b,24973000)(no_defs)},
+            {79900, 9356, 4},
+            {79901, 9360, 4},
             //{79910},
             //{79911},
             //{79912},
             //{79913},
-            {79914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
+            {79914, 9364, 8},
+            {79915, 9372, 8},
+            {79916, 9380, 8},
+            {79917, 9388, 8},
+            {79918, 9396, 10},
+            {79919, 9406, 10},
+            {79920, 9416, 10},
+            {79921, 9426, 10},
+            {79960, 9436, 8},
+            {79961, 9444, 8},
+            {79962, 9452, 10},
+            {79963, 9462, 10},
+            {79964, 9472, 10},
+            {79965, 9482, 10},
+            {79966, 9492, 9},
+            {79967, 9501, 9},
             //{79968},
             //{79969},
             //{79970},
             //{79971},
-            {79972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
-            {79973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,25559000)(b,24973000)(units_m)(no_defs)},
+            {79972, 9510, 9},
+            {79973, 9519, 9},
             //{79974},
             //{79975},
             //{79976},
             //{79977},
             //{79978},
             //{79979},
-            {80100, srs::dpar::parameters<>(proj_longlat)(r,1352600)(no_defs)},
-            {80101, srs::dpar::parameters<>(proj_longlat)(r,1352600)(no_defs)},
+            {80100, 9528, 3},
+            {80101, 9531, 3},
             //{80110},
             //{80111},
             //{80112},
             //{80113},
-            {80114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
+            {80114, 9534, 7},
+            {80115, 9541, 7},
+            {80116, 9548, 7},
+            {80117, 9555, 7},
+            {80118, 9562, 9},
+            {80119, 9571, 9},
+            {80120, 9580, 9},
+            {80121, 9589, 9},
+            {80160, 9598, 7},
+            {80161, 9605, 7},
+            {80162, 9612, 9},
+            {80163, 9621, 9},
+            {80164, 9630, 9},
+            {80165, 9639, 9},
+            {80166, 9648, 8},
+            {80167, 9656, 8},
             //{80168},
             //{80169},
             //{80170},
             //{80171},
-            {80172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
-            {80173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1352600)(units_m)(no_defs)},
+            {80172, 9664, 8},
+            {80173, 9672, 8},
             //{80174},
             //{80175},
             //{80176},
             //{80177},
             //{80178},
             //{80179},
-            {80200, srs::dpar::parameters<>(proj_longlat)(r,170000)(no_defs)},
-            {80201, srs::dpar::parameters<>(proj_longlat)(r,170000)(no_defs)},
+            {80200, 9680, 3},
+            {80201, 9683, 3},
             //{80210},
             //{80211},
             //{80212},
             //{80213},
-            {80214, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80215, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80216, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80217, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80218, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80219, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80220, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80221, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80260, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80261, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80262, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80263, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80264, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80265, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80266, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80267, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
+            {80214, 9686, 7},
+            {80215, 9693, 7},
+            {80216, 9700, 7},
+            {80217, 9707, 7},
+            {80218, 9714, 9},
+            {80219, 9723, 9},
+            {80220, 9732, 9},
+            {80221, 9741, 9},
+            {80260, 9750, 7},
+            {80261, 9757, 7},
+            {80262, 9764, 9},
+            {80263, 9773, 9},
+            {80264, 9782, 9},
+            {80265, 9791, 9},
+            {80266, 9800, 8},
+            {80267, 9808, 8},
             //{80268},
             //{80269},
             //{80270},
             //{80271},
-            {80272, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
-            {80273, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,170000)(units_m)(no_defs)},
+            {80272, 9816, 8},
+            {80273, 9824, 8},
             //{80274},
             //{80275},
             //{80276},
             //{80277},
             //{80278},
             //{80279},
-            {80300, srs::dpar::parameters<>(proj_longlat)(r,29000)(no_defs)},
-            {80301, srs::dpar::parameters<>(proj_longlat)(r,29000)(no_defs)},
+            {80300, 9832, 3},
+            {80301, 9835, 3},
             //{80310},
             //{80311},
             //{80312},
             //{80313},
-            {80314, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80315, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80316, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80317, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80318, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80319, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80320, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80321, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80360, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80361, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80362, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80363, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80364, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80365, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80366, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80367, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
+            {80314, 9838, 7},
+            {80315, 9845, 7},
+            {80316, 9852, 7},
+            {80317, 9859, 7},
+            {80318, 9866, 9},
+            {80319, 9875, 9},
+            {80320, 9884, 9},
+            {80321, 9893, 9},
+            {80360, 9902, 7},
+            {80361, 9909, 7},
+            {80362, 9916, 9},
+            {80363, 9925, 9},
+            {80364, 9934, 9},
+            {80365, 9943, 9},
+            {80366, 9952, 8},
+            {80367, 9960, 8},
             //{80368},
             //{80369},
             //{80370},
             //{80371},
-            {80372, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
-            {80373, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,29000)(units_m)(no_defs)},
+            {80372, 9968, 8},
+            {80373, 9976, 8},
             //{80374},
             //{80375},
             //{80376},
             //{80377},
             //{80378},
             //{80379},
-            {80400, srs::dpar::parameters<>(proj_longlat)(r,40000)(no_defs)},
-            {80401, srs::dpar::parameters<>(proj_longlat)(r,40000)(no_defs)},
+            {80400, 9984, 3},
+            {80401, 9987, 3},
             //{80410},
             //{80411},
             //{80412},
             //{80413},
-            {80414, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80415, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80416, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80417, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80418, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80419, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80420, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80421, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80460, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80461, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80462, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80463, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80464, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80465, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80466, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80467, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
+            {80414, 9990, 7},
+            {80415, 9997, 7},
+            {80416, 10004, 7},
+            {80417, 10011, 7},
+            {80418, 10018, 9},
+            {80419, 10027, 9},
+            {80420, 10036, 9},
+            {80421, 10045, 9},
+            {80460, 10054, 7},
+            {80461, 10061, 7},
+            {80462, 10068, 9},
+            {80463, 10077, 9},
+            {80464, 10086, 9},
+            {80465, 10095, 9},
+            {80466, 10104, 8},
+            {80467, 10112, 8},
             //{80468},
             //{80469},
             //{80470},
             //{80471},
-            {80472, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
-            {80473, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,40000)(units_m)(no_defs)},
+            {80472, 10120, 8},
+            {80473, 10128, 8},
             //{80474},
             //{80475},
             //{80476},
             //{80477},
             //{80478},
             //{80479},
-            {80500, srs::dpar::parameters<>(proj_longlat)(r,74000)(no_defs)},
-            {80501, srs::dpar::parameters<>(proj_longlat)(r,74000)(no_defs)},
+            {80500, 10136, 3},
+            {80501, 10139, 3},
             //{80510},
             //{80511},
             //{80512},
             //{80513},
-            {80514, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80515, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80516, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80517, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80518, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80519, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80520, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80521, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80560, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80561, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80562, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80563, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80564, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80565, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80566, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80567, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
+            {80514, 10142, 7},
+            {80515, 10149, 7},
+            {80516, 10156, 7},
+            {80517, 10163, 7},
+            {80518, 10170, 9},
+            {80519, 10179, 9},
+            {80520, 10188, 9},
+            {80521, 10197, 9},
+            {80560, 10206, 7},
+            {80561, 10213, 7},
+            {80562, 10220, 9},
+            {80563, 10229, 9},
+            {80564, 10238, 9},
+            {80565, 10247, 9},
+            {80566, 10256, 8},
+            {80567, 10264, 8},
             //{80568},
             //{80569},
             //{80570},
             //{80571},
-            {80572, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
-            {80573, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,74000)(units_m)(no_defs)},
+            {80572, 10272, 8},
+            {80573, 10280, 8},
             //{80574},
             //{80575},
             //{80576},
             //{80577},
             //{80578},
             //{80579},
-            {80600, srs::dpar::parameters<>(proj_longlat)(r,79000)(no_defs)},
-            {80601, srs::dpar::parameters<>(proj_longlat)(r,79000)(no_defs)},
+            {80600, 10288, 3},
+            {80601, 10291, 3},
             //{80610},
             //{80611},
             //{80612},
             //{80613},
-            {80614, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80615, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80616, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80617, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80618, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80619, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80620, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80621, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80660, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80661, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80662, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80663, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80664, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80665, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80666, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80667, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
+            {80614, 10294, 7},
+            {80615, 10301, 7},
+            {80616, 10308, 7},
+            {80617, 10315, 7},
+            {80618, 10322, 9},
+            {80619, 10331, 9},
+            {80620, 10340, 9},
+            {80621, 10349, 9},
+            {80660, 10358, 7},
+            {80661, 10365, 7},
+            {80662, 10372, 9},
+            {80663, 10381, 9},
+            {80664, 10390, 9},
+            {80665, 10399, 9},
+            {80666, 10408, 8},
+            {80667, 10416, 8},
             //{80668},
             //{80669},
             //{80670},
             //{80671},
-            {80672, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
-            {80673, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,79000)(units_m)(no_defs)},
+            {80672, 10424, 8},
+            {80673, 10432, 8},
             //{80674},
             //{80675},
             //{80676},
             //{80677},
             //{80678},
             //{80679},
-            {80700, srs::dpar::parameters<>(proj_longlat)(r,96000)(no_defs)},
-            {80701, srs::dpar::parameters<>(proj_longlat)(r,96000)(no_defs)},
+            {80700, 10440, 3},
+            {80701, 10443, 3},
             //{80710},
             //{80711},
             //{80712},
             //{80713},
-            {80714, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80715, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80716, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80717, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80718, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80719, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80720, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80721, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80760, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80761, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80762, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80763, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80764, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80765, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80766, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80767, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
+            {80714, 10446, 7},
+            {80715, 10453, 7},
+            {80716, 10460, 7},
+            {80717, 10467, 7},
+            {80718, 10474, 9},
+            {80719, 10483, 9},
+            {80720, 10492, 9},
+            {80721, 10501, 9},
+            {80760, 10510, 7},
+            {80761, 10517, 7},
+            {80762, 10524, 9},
+            {80763, 10533, 9},
+            {80764, 10542, 9},
+            {80765, 10551, 9},
+            {80766, 10560, 8},
+            {80767, 10568, 8},
             //{80768},
             //{80769},
             //{80770},
             //{80771},
-            {80772, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
-            {80773, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,96000)(units_m)(no_defs)},
+            {80772, 10576, 8},
+            {80773, 10584, 8},
             //{80774},
             //{80775},
             //{80776},
             //{80777},
             //{80778},
             //{80779},
-            {80800, srs::dpar::parameters<>(proj_longlat)(a,218000)(b,201000)(no_defs)},
-            {80801, srs::dpar::parameters<>(proj_longlat)(a,218000)(b,201000)(no_defs)},
+            {80800, 10592, 4},
+            {80801, 10596, 4},
             //{80810},
             //{80811},
             //{80812},
             //{80813},
-            {80814, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80815, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80816, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80817, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80818, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80819, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80820, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80821, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80860, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80861, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80862, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80863, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80864, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80865, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80866, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80867, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
+            {80814, 10600, 8},
+            {80815, 10608, 8},
+            {80816, 10616, 8},
+            {80817, 10624, 8},
+            {80818, 10632, 10},
+            {80819, 10642, 10},
+            {80820, 10652, 10},
+            {80821, 10662, 10},
+            {80860, 10672, 8},
+            {80861, 10680, 8},
+            {80862, 10688, 10},
+            {80863, 10698, 10},
+            {80864, 10708, 10},
+            {80865, 10718, 10},
+            {80866, 10728, 9},
+            {80867, 10737, 9},
             //{80868},
             //{80869},
             //{80870},
             //{80871},
-            {80872, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
-            {80873, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,218000)(b,201000)(units_m)(no_defs)},
+            {80872, 10746, 9},
+            {80873, 10755, 9},
             //{80874},
             //{80875},
             //{80876},
             //{80877},
             //{80878},
             //{80879},
-            {89900, srs::dpar::parameters<>(proj_longlat)(a,24764000)(b,24341000)(no_defs)},
-            {89901, srs::dpar::parameters<>(proj_longlat)(a,24764000)(b,24341000)(no_defs)},
+            {89900, 10764, 4},
+            {89901, 10768, 4},
             //{89910},
             //{89911},
             //{89912},
             //{89913},
-            {89914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
+            {89914, 10772, 8},
+            {89915, 10780, 8},
+            {89916, 10788, 8},
+            {89917, 10796, 8},
+            {89918, 10804, 10},
+            {89919, 10814, 10},
+            {89920, 10824, 10},
+            {89921, 10834, 10},
+            {89960, 10844, 8},
+            {89961, 10852, 8},
+            {89962, 10860, 10},
+            {89963, 10870, 10},
+            {89964, 10880, 10},
+            {89965, 10890, 10},
+            {89966, 10900, 9},
+            {89967, 10909, 9},
             //{89968},
             //{89969},
             //{89970},
             //{89971},
-            {89972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
-            {89973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(a,24764000)(b,24341000)(units_m)(no_defs)},
+            {89972, 10918, 9},
+            {89973, 10927, 9},
             //{89974},
             //{89975},
             //{89976},
             //{89977},
             //{89978},
             //{89979},
-            {90100, srs::dpar::parameters<>(proj_longlat)(r,593000)(no_defs)},
-            {90101, srs::dpar::parameters<>(proj_longlat)(r,593000)(no_defs)},
+            {90100, 10936, 3},
+            {90101, 10939, 3},
             //{90110},
             //{90111},
             //{90112},
             //{90113},
-            {90114, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90115, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90116, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90117, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90118, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90119, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90120, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90121, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90160, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90161, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90162, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90163, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90164, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90165, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90166, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90167, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
+            {90114, 10942, 7},
+            {90115, 10949, 7},
+            {90116, 10956, 7},
+            {90117, 10963, 7},
+            {90118, 10970, 9},
+            {90119, 10979, 9},
+            {90120, 10988, 9},
+            {90121, 10997, 9},
+            {90160, 11006, 7},
+            {90161, 11013, 7},
+            {90162, 11020, 9},
+            {90163, 11029, 9},
+            {90164, 11038, 9},
+            {90165, 11047, 9},
+            {90166, 11056, 8},
+            {90167, 11064, 8},
             //{90168},
             //{90169},
             //{90170},
             //{90171},
-            {90172, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
-            {90173, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,593000)(units_m)(no_defs)},
+            {90172, 11072, 8},
+            {90173, 11080, 8},
             //{90174},
             //{90175},
             //{90176},
             //{90177},
             //{90178},
             //{90179},
-            {99900, srs::dpar::parameters<>(proj_longlat)(r,1195000)(no_defs)},
-            {99901, srs::dpar::parameters<>(proj_longlat)(r,1195000)(no_defs)},
+            {99900, 11088, 3},
+            {99901, 11091, 3},
             //{99910},
             //{99911},
             //{99912},
             //{99913},
-            {99914, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99915, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99916, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99917, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99918, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99919, srs::dpar::parameters<>(proj_stere)(lat_0,90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99920, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99921, srs::dpar::parameters<>(proj_stere)(lat_0,-90)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99960, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99961, srs::dpar::parameters<>(proj_sinu)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99962, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99963, srs::dpar::parameters<>(proj_stere)(lat_0,0)(lon_0,0)(k,1)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99964, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99965, srs::dpar::parameters<>(proj_tmerc)(lat_0,0)(lon_0,0)(k,0.9996)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99966, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99967, srs::dpar::parameters<>(proj_ortho)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
+            {99914, 11094, 7},
+            {99915, 11101, 7},
+            {99916, 11108, 7},
+            {99917, 11115, 7},
+            {99918, 11122, 9},
+            {99919, 11131, 9},
+            {99920, 11140, 9},
+            {99921, 11149, 9},
+            {99960, 11158, 7},
+            {99961, 11165, 7},
+            {99962, 11172, 9},
+            {99963, 11181, 9},
+            {99964, 11190, 9},
+            {99965, 11199, 9},
+            {99966, 11208, 8},
+            {99967, 11216, 8},
             //{99968},
             //{99969},
             //{99970},
             //{99971},
-            {99972, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
-            {99973, srs::dpar::parameters<>(proj_laea)(lat_0,90)(lon_0,0)(x_0,0)(y_0,0)(r,1195000)(units_m)(no_defs)},
+            {99972, 11224, 8},
+            {99973, 11232, 8}
             //{99974},
             //{99975},
             //{99976},
@@ -2410,11 +3813,7 @@ namespace detail
             //{99979}
         };
 
-        const code_element * first = arr;
-        const code_element * last = arr + sizeof(arr) / sizeof(code_element);
-        const code_element * el = binary_find_code_element(first, last, code);
-
-        return el != last ? el->parameters : srs::dpar::parameters<>();
+        return code_to_parameters(elements, parameters, code);
     }
 
 }
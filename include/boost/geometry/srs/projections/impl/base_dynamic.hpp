@@ -13,9 +13,12 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_inv.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
 namespace boost { namespace geometry { namespace projections
@@ -48,6 +51,14 @@ public :
     /// Inverse projection using x / y and lon / lat
     virtual void inv(P const& par, CT const& xy_x, CT const& xy_y, CT& lp_lon, CT& lp_lat) const = 0;
 
+    /// Forward projection of count coordinates, stride elements apart
+    virtual bool fwd(P const& par, std::size_t count, CT const* lons, CT const* lats,
+                     CT* xs, CT* ys, std::size_t stride, CT const& to_radian) const = 0;
+
+    /// Inverse projection of count coordinates, stride elements apart
+    virtual bool inv(P const& par, std::size_t count, CT const* xs, CT const* ys,
+                     CT* lons, CT* lats, std::size_t stride, CT const& from_radian) const = 0;
+
     /// Forward projection, from Latitude-Longitude to Cartesian
     template <typename LL, typename XY>
     inline bool forward(LL const& lp, XY& xy) const
@@ -82,6 +93,20 @@ public :
         }
     }
 
+    /// Forward projection of arrays, with one virtual call for all coordinates
+    inline bool forward(std::size_t count, CT const* lons, CT const* lats,
+                        CT* xs, CT* ys, std::size_t stride, CT const& to_radian) const
+    {
+        return fwd(m_par, count, lons, lats, xs, ys, stride, to_radian);
+    }
+
+    /// Inverse projection of arrays, with one virtual call for all coordinates
+    inline bool inverse(std::size_t count, CT const* xs, CT const* ys,
+                        CT* lons, CT* lats, std::size_t stride, CT const& from_radian) const
+    {
+        return inv(m_par, count, xs, ys, lons, lats, stride, from_radian);
+    }
+
     /// Returns name of projection
     std::string name() const { return m_par.id.name; }
 
@@ -121,11 +146,23 @@ public:
         prj().fwd(par, lp_lon, lp_lat, xy_x, xy_y);
     }
 
+    virtual bool fwd(P const& par, std::size_t count, CT const* lons, CT const* lats,
+                     CT* xs, CT* ys, std::size_t stride, CT const& to_radian) const
+    {
+        return pj_fwd_n(prj(), par, count, lons, lats, xs, ys, stride, to_radian);
+    }
+
     virtual void inv(P const& , CT const& , CT const& , CT& , CT& ) const
     {
         BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
     }
 
+    virtual bool inv(P const& , std::size_t , CT const* , CT const* ,
+                     CT* , CT* , std::size_t , CT const& ) const
+    {
+        BOOST_THROW_EXCEPTION(projection_not_invertible_exception(this->name()));
+    }
+
 protected:
     Prj const& prj() const { return *this; }
 };
@@ -151,6 +188,12 @@ public:
     {
         this->prj().inv(par, xy_x, xy_y, lp_lon, lp_lat);
     }
+
+    virtual bool inv(P const& par, std::size_t count, CT const* xs, CT const* ys,
+                     CT* lons, CT* lats, std::size_t stride, CT const& from_radian) const
+    {
+        return pj_inv_n(this->prj(), par, count, xs, ys, lons, lats, stride, from_radian);
+    }
 };
 
 } // namespace detail
@@ -19,6 +19,7 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/core/assert.hpp>
@@ -125,6 +126,13 @@ public:
         }
     }
 
+    template <typename T>
+    inline bool forward(std::size_t count, T const* lons, T const* lats,
+                        T* xs, T* ys, std::size_t stride, T const& to_radian) const
+    {
+        return pj_fwd_n(*this, this->m_par, count, lons, lats, xs, ys, stride, to_radian);
+    }
+
     template <typename XY, typename LL>
     inline bool inverse(XY const&, LL&) const
     {
@@ -133,6 +141,16 @@ public:
             Prj);
         return false;
     }
+
+    template <typename T>
+    inline bool inverse(std::size_t, T const*, T const*,
+                        T*, T*, std::size_t, T const&) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT_FALSE(
+            "This projection is not invertable.",
+            Prj);
+        return false;
+    }
 };
 
 // Forward/inverse
@@ -159,6 +177,13 @@ public:
             return false;
         }
     }
+
+    template <typename T>
+    inline bool inverse(std::size_t count, T const* xs, T const* ys,
+                        T* lons, T* lats, std::size_t stride, T const& from_radian) const
+    {
+        return pj_inv_n(*this, this->m_par, count, xs, ys, lons, lats, stride, from_radian);
+    }
 };
 
 } // namespace detail
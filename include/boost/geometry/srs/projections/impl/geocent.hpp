@@ -89,6 +89,9 @@
 #define BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_GEOCENT_HPP
 
 
+#include <cmath>
+#include <cstddef>
+
 #include <boost/geometry/util/math.hpp>
 
 
@@ -478,6 +481,167 @@ static const int maxiter = 30;
 } /* END OF Convert_Geocentric_To_Geodetic */
 
 
+/*
+ * Conversions of arrays of points, used by pj_transform() and by the
+ * transformation pipeline. Points with Longitude == HUGE_VAL are invalid,
+ * they are not converted. The arrays should not overlap.
+ *
+ * The points are checked in a separate loop, the conversions themselves
+ * are loops without branches, using selections which the compiler can
+ * translate to conditional moves or blends. The trigonometric functions
+ * are calls to the math library.
+ */
+
+/*
+ * Returns GEOCENT_LAT_ERROR if the latitude of a point is out of range,
+ * its Longitude and Latitude are then set to HUGE_VAL. Latitudes just
+ * outside of the range are rounded to the poles, in place. The results
+ * are equal to the ones of pj_Convert_Geodetic_To_Geocentric().
+ */
+template <typename T>
+inline long pj_Convert_Geodetic_To_Geocentric_n(GeocentricInfo<T> const& gi,
+                                                std::size_t count,
+                                                T * Longitude, T * Latitude,
+                                                T const* Height,
+                                                T * X, T * Y, T * Z)
+{
+    static const T PI = math::pi<T>();
+    static const T PI_OVER_2 = math::half_pi<T>();
+
+    long Error_Code = GEOCENT_NO_ERROR;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (Longitude[i] == HUGE_VAL)
+        {
+            continue;
+        }
+
+        T & lat = Latitude[i];
+        if (lat < -PI_OVER_2 && lat > -1.001 * PI_OVER_2)
+        {
+            lat = -PI_OVER_2;
+        }
+        else if (lat > PI_OVER_2 && lat < 1.001 * PI_OVER_2)
+        {
+            lat = PI_OVER_2;
+        }
+        else if (lat < -PI_OVER_2 || lat > PI_OVER_2)
+        {
+            Longitude[i] = Latitude[i] = HUGE_VAL;
+            Error_Code |= GEOCENT_LAT_ERROR;
+        }
+    }
+
+    T const a = gi.Geocent_a;
+    T const e2 = gi.Geocent_e2;
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        // Invalid points are converted as (0, 0, 0)
+        bool const valid = Longitude[i] != HUGE_VAL;
+        T const lon = ! valid ? T(0)
+                    : Longitude[i] > PI ? Longitude[i] - 2 * PI
+                    : Longitude[i];
+        T const lat = valid ? Latitude[i] : T(0);
+        T const h = valid ? Height[i] : T(0);
+
+        T const sin_lat = sin(lat);
+        T const cos_lat = cos(lat);
+        T const rn = a / sqrt(1.0 - e2 * (sin_lat * sin_lat));
+
+        X[i] = (rn + h) * cos_lat * cos(lon);
+        Y[i] = (rn + h) * cos_lat * sin(lon);
+        Z[i] = ((rn * (1 - e2)) + h) * sin_lat;
+    }
+
+    return Error_Code;
+}
+
+// False for points close to the axis or to the center of the earth, and
+// for NaN coordinates, these are converted as before
+template <typename T>
+inline bool bowring_applicable(T const& p2, T const& z, T const& min_p2, T const& min_r2)
+{
+    return p2 >= min_p2 && p2 + z * z >= min_r2;
+}
+
+/*
+ * The latitude is calculated with two iterations of Bowring's formula
+ * (Bowring 1976, 'Transformation from spatial to geographical
+ * coordinates', Survey Review 23(181)), without trigonometric functions
+ * in the iterations. For heights from -1000 km to beyond the geostationary
+ * orbit this is as accurate as the iterative method of
+ * pj_Convert_Geocentric_To_Geodetic(): the difference is within 1e-15
+ * radians and 1e-8 meters. Points closer to the center of the earth or
+ * to its axis are converted by pj_Convert_Geocentric_To_Geodetic().
+ */
+template <typename T>
+inline void pj_Convert_Geocentric_To_Geodetic_n(GeocentricInfo<T> const& gi,
+                                                std::size_t count,
+                                                T const* X, T const* Y, T const* Z,
+                                                T * Longitude, T * Latitude,
+                                                T * Height)
+{
+    static const T genau = 1.E-12;
+
+    T const a = gi.Geocent_a;
+    T const b = gi.Geocent_b;
+    T const e2 = gi.Geocent_e2;
+    T const ep2 = gi.Geocent_ep2;
+    T const b_a = b / a;
+    T const min_p2 = (genau * a) * (genau * a);
+    T const min_r2 = (b - 1.0e6) * (b - 1.0e6);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        T const p2 = X[i] * X[i] + Y[i] * Y[i];
+        bool const valid = Longitude[i] != HUGE_VAL
+                        && bowring_applicable(p2, Z[i], min_p2, min_r2);
+
+        // Other points are converted as a point on the equator
+        T const x = valid ? X[i] : a;
+        T const y = valid ? Y[i] : T(0);
+        T const z = valid ? Z[i] : T(0);
+        T const p = sqrt(valid ? p2 : a * a);
+
+        // Tangent of the reduced latitude, first estimated as geocentric
+        T tan_beta = (z * a) / (p * b);
+        T num = 0, den = 1;
+        for (int iter = 0; iter < 2; iter++)
+        {
+            T const cos_beta = 1.0 / sqrt(1.0 + tan_beta * tan_beta);
+            T const sin_beta = tan_beta * cos_beta;
+            num = z + ep2 * b * (sin_beta * sin_beta * sin_beta);
+            den = p - e2 * a * (cos_beta * cos_beta * cos_beta);
+            tan_beta = b_a * num / den;
+        }
+
+        T const norm = sqrt(num * num + den * den);
+        T const sin_lat = num / norm;
+        T const cos_lat = den / norm;
+        T const h = p * cos_lat + z * sin_lat
+                  - a * sqrt(1.0 - e2 * (sin_lat * sin_lat));
+        T const lon = atan2(y, x);
+        T const lat = atan2(num, den);
+
+        Longitude[i] = valid ? lon : Longitude[i];
+        Latitude[i] = valid ? lat : Latitude[i];
+        Height[i] = valid ? h : Height[i];
+    }
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (Longitude[i] != HUGE_VAL
+            && ! bowring_applicable(X[i] * X[i] + Y[i] * Y[i], Z[i], min_p2, min_r2))
+        {
+            pj_Convert_Geocentric_To_Geodetic(gi, X[i], Y[i], Z[i],
+                                              Longitude[i], Latitude[i], Height[i]);
+        }
+    }
+}
+
+
 } // namespace detail
 
 
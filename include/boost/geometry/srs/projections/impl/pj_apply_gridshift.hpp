@@ -58,10 +58,11 @@ namespace detail
 {
 
 // Originally implemented in nad_intr.c
-template <typename CalcT>
+// The cells are ct.cvs or the shifts accessed in place
+template <typename CalcT, typename Cells>
 inline void nad_intr(CalcT in_lon, CalcT in_lat,
                      CalcT & out_lon, CalcT & out_lat,
-                     pj_ctable const& ct)
+                     pj_ctable const& ct, Cells const& cells)
 {
 	pj_ctable::lp_t frct;
 	pj_ctable::ilp_t indx;
@@ -100,11 +101,11 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 			return;
 	}
 	boost::int32_t index = indx.phi * ct.lim.lam + indx.lam;
-	pj_ctable::flp_t const& f00 = ct.cvs[index++];
-	pj_ctable::flp_t const& f10 = ct.cvs[index];
+	pj_ctable::flp_t const& f00 = cells[index++];
+	pj_ctable::flp_t const& f10 = cells[index];
 	index += ct.lim.lam;
-	pj_ctable::flp_t const& f11 = ct.cvs[index--];
-	pj_ctable::flp_t const& f01 = ct.cvs[index];
+	pj_ctable::flp_t const& f11 = cells[index--];
+	pj_ctable::flp_t const& f01 = cells[index];
     CalcT m00, m10, m01, m11;
 	m11 = m10 = frct.lam;
 	m00 = m01 = 1. - frct.lam;
@@ -120,10 +121,10 @@ inline void nad_intr(CalcT in_lon, CalcT in_lat,
 }
 
 // Originally implemented in nad_cvt.c
-template <bool Inverse, typename CalcT>
+template <bool Inverse, typename CalcT, typename Cells>
 inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
                     CalcT & out_lon, CalcT & out_lat,
-                    pj_gi const& gi)
+                    pj_gi const& gi, Cells const& cells)
 {
     static const int max_iterations = 10;
     static const CalcT tol = 1e-12;
@@ -151,7 +152,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     tb.lam = adjlon (tb.lam - pi) + pi;
 
     pj_ctable::lp_t t;
-    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct);
+    nad_intr(tb.lam, tb.phi, t.lam, t.phi, ct, cells);
     if (t.lam == HUGE_VAL)
     {
         out_lon = HUGE_VAL;
@@ -173,7 +174,7 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     pj_ctable::lp_t del, dif;
     do
     {
-        nad_intr(t.lam, t.phi, del.lam, del.phi, ct);
+        nad_intr(t.lam, t.phi, del.lam, del.phi, ct, cells);
 
         // This case used to return failure, but I have
         // changed it to return the first order approximation
@@ -210,6 +211,14 @@ inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
     out_lat = t.phi + ct.ll.phi;
 }
 
+template <bool Inverse, typename CalcT>
+inline void nad_cvt(CalcT const& in_lon, CalcT const& in_lat,
+                    CalcT & out_lon, CalcT & out_lat,
+                    pj_gi const& gi)
+{
+    nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, gi, gi.ct.cvs);
+}
+
 
 /************************************************************************/
 /*                             find_grid()                              */
@@ -265,18 +274,21 @@ inline pj_gi * find_grid(T const& lam,
     return gip;
 }
 
-template <typename T>
+// The index of the top-level grid containing the found grid is returned
+// in gridindex
+template <typename T, typename Grids>
 inline pj_gi * find_grid(T const& lam,
                          T const& phi,
-                         pj_gridinfo & grids,
-                         std::vector<std::size_t> const& gridindexes)
+                         Grids & grids,
+                         std::vector<std::size_t> const& gridindexes,
+                         std::size_t & gridindex)
 {
     pj_gi * gip = NULL;
 
     // keep trying till we find a table that works
     for (std::size_t i = 0 ; i < gridindexes.size() ; ++i)
     {
-        pj_gi & gi = grids[gridindexes[i]];
+        pj_gi & gi = pj_gridinfo_at(grids, gridindexes[i]);
 
         // skip tables that don't match our point at all.
         if (! grid_disjoint(lam, phi, gi.ct))
@@ -285,6 +297,7 @@ inline pj_gi * find_grid(T const& lam,
             if (gi.format != pj_gi::gtx)
             {
                 gip = boost::addressof(gi);
+                gridindex = gridindexes[i];
                 break;
             }
         }
@@ -302,6 +315,16 @@ inline pj_gi * find_grid(T const& lam,
     return gip;
 }
 
+template <typename T>
+inline pj_gi * find_grid(T const& lam,
+                         T const& phi,
+                         pj_gridinfo & grids,
+                         std::vector<std::size_t> const& gridindexes)
+{
+    std::size_t gridindex = 0;
+    return find_grid(lam, phi, grids, gridindexes, gridindex);
+}
+
 
 template <typename StreamPolicy>
 inline bool load_grid(StreamPolicy const& stream_policy, pj_gi_load & gi)
@@ -480,6 +503,109 @@ inline bool pj_apply_gridshift_3(StreamPolicy const& stream_policy,
     return true;
 }
 
+// Grids shared in snapshots, the grids are loaded so no lock is taken
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename SnapshotGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& ,
+                                 Range & range,
+                                 SnapshotGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 shared_grids_snapshot_tag)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        return false;
+    }
+
+    typename SnapshotGrids::snapshot_type const& snapshot = grids.snapshot();
+
+    size_type point_count = boost::size(range);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        std::size_t gridindex = 0;
+        pj_gi * gip = find_grid(in_lon, in_lat, snapshot, gridindexes, gridindex);
+
+        if ( gip != NULL )
+        {
+            // TODO: use set_invalid_point() or similar mechanism
+            CalcT out_lon = HUGE_VAL;
+            CalcT out_lat = HUGE_VAL;
+
+            nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip);
+
+            // TODO: check differently
+            if ( out_lon != HUGE_VAL )
+            {
+                geometry::set_from_radian<0>(point, out_lon);
+                geometry::set_from_radian<1>(point, out_lat);
+            }
+        }
+    }
+
+    return true;
+}
+
+// Mapped grids, the shifts are read from the mapped files in place so
+// nothing is loaded and the grids are not modified
+template <bool Inverse, typename CalcT, typename StreamPolicy, typename Range, typename MappedGrids>
+inline bool pj_apply_gridshift_3(StreamPolicy const& ,
+                                 Range & range,
+                                 MappedGrids & grids,
+                                 std::vector<std::size_t> const& gridindexes,
+                                 mapped_grids_tag)
+{
+    typedef typename boost::range_size<Range>::type size_type;
+
+    // If the grids are empty the indexes are as well
+    if (gridindexes.empty())
+    {
+        return false;
+    }
+
+    size_type point_count = boost::size(range);
+
+    for (size_type i = 0 ; i < point_count ; ++i)
+    {
+        typename boost::range_reference<Range>::type
+            point = range::at(range, i);
+
+        CalcT in_lon = geometry::get_as_radian<0>(point);
+        CalcT in_lat = geometry::get_as_radian<1>(point);
+
+        std::size_t gridindex = 0;
+        pj_gi * gip = find_grid(in_lon, in_lat, grids.gridinfo, gridindexes, gridindex);
+
+        if ( gip != NULL )
+        {
+            pj_gridinfo_mapped_cells const cells(*gip, grids.files[gridindex]->data());
+
+            // TODO: use set_invalid_point() or similar mechanism
+            CalcT out_lon = HUGE_VAL;
+            CalcT out_lat = HUGE_VAL;
+
+            nad_cvt<Inverse>(in_lon, in_lat, out_lon, out_lat, *gip, cells);
+
+            // TODO: check differently
+            if ( out_lon != HUGE_VAL )
+            {
+                geometry::set_from_radian<0>(point, out_lon);
+                geometry::set_from_radian<1>(point, out_lat);
+            }
+        }
+    }
+
+    return true;
+}
+
 
 /************************************************************************/
 /*                        pj_apply_gridshift_2()                        */
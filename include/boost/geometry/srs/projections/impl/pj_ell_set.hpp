@@ -208,6 +208,66 @@ inline bool pj_ell_init_ellps(srs::spar::parameters<Ps...> const& params,
         >::apply(params, a, b);
 }
 
+/************************************************************************/
+/*                       pj_ell_init_datum_ellps()                      */
+/************************************************************************/
+
+template <typename Params, typename T>
+inline bool pj_ell_init_datum_ellps(Params const& params, T &a, T &b)
+{
+    const pj_datums_type<T>* datum = pj_datum_find_datum<T>(params);
+    if (datum != NULL)
+    {
+        pj_ellps_type<T> const& pj_ellp = pj_get_ellps<T>().first[datum->ellps];
+        a = pj_ellp.a;
+        b = pj_ellp.b;
+        return true;
+    }
+    return false;
+}
+
+template
+<
+    typename Params,
+    typename Param = typename geometry::tuples::find_if
+        <
+            Params,
+            srs::spar::detail::is_param_tr<srs::spar::detail::datum_traits>::pred
+        >::type,
+    bool IsFound = geometry::tuples::is_found<Param>::value
+>
+struct pj_ell_init_datum_ellps_static
+{
+    template <typename T>
+    static bool apply(Params const& , T &a, T &b)
+    {
+        typedef typename srs::spar::detail::datum_traits<Param>::ellps_type ellps_type;
+        typedef srs::spar::detail::ellps_traits<ellps_type> traits_type;
+        a = traits_type::template a<T>();
+        b = traits_type::template b<T>();
+        return true;
+    }
+};
+template <typename Params, typename Param>
+struct pj_ell_init_datum_ellps_static<Params, Param, false>
+{
+    template <typename T>
+    static bool apply(Params const& , T & , T & )
+    {
+        return false;
+    }
+};
+
+template <typename T, typename ...Ps>
+inline bool pj_ell_init_datum_ellps(srs::spar::parameters<Ps...> const& params,
+                                    T &a, T &b)
+{
+    return pj_ell_init_datum_ellps_static
+        <
+            srs::spar::parameters<Ps...>
+        >::apply(params, a, b);
+}
+
 /************************************************************************/
 /*                             pj_ell_init()                            */
 /************************************************************************/
@@ -283,16 +343,15 @@ inline void pj_ell_init(Params const& params, T &a, T &es)
         //   use ellps defined by datum parameter
         if (! is_a_set || ! is_ell_set)
         {
-            const pj_datums_type<T>* datum = pj_datum_find_datum<T>(params);
-            if (datum != NULL)
+            T datum_a = 0, datum_b = 0;
+            if (pj_ell_init_datum_ellps(params, datum_a, datum_b))
             {
-                pj_ellps_type<T> const& pj_ellp = pj_get_ellps<T>().first[datum->ellps];
                 if (! is_a_set) {
-                    a = pj_ellp.a;
+                    a = datum_a;
                     is_a_set = true;
                 }
                 if (! is_ell_set) {
-                    es = pj_ell_b_to_es(pj_ellp.a, pj_ellp.b);
+                    es = pj_ell_b_to_es(datum_a, datum_b);
                     is_ell_set = true;
                 }
             }
@@ -303,13 +362,15 @@ inline void pj_ell_init(Params const& params, T &a, T &es)
         if ((! is_a_set || ! is_ell_set)
          && ! pj_get_param_b<srs::spar::no_defs>(params, "no_defs", srs::dpar::no_defs))
         {
-            pj_ellps_type<T> const& pj_ellp = pj_get_ellps<T>().first[srs::dpar::ellps_wgs84];
+            typedef srs::spar::detail::ellps_traits<srs::spar::ellps_wgs84> wgs84_traits;
+            T const wgs84_a = wgs84_traits::template a<T>();
+            T const wgs84_b = wgs84_traits::template b<T>();
             if (! is_a_set) {
-                a = pj_ellp.a;
+                a = wgs84_a;
                 is_a_set = true;
             }
             if (! is_ell_set) {
-                es = pj_ell_b_to_es(pj_ellp.a, pj_ellp.b);
+                es = pj_ell_b_to_es(wgs84_a, wgs84_b);
                 is_ell_set = true;
             }
         }
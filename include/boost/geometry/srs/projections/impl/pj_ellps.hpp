@@ -58,7 +58,7 @@ struct pj_ellps_type
     //std::string name;  /* comments */
 };
 
-inline double b_from_a_rf(double a, double rf)
+constexpr double b_from_a_rf(double a, double rf)
 {
     return a * (1.0 - 1.0 / rf);
 }
@@ -39,9 +39,13 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 
+#include <algorithm>
+#include <cstddef>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
@@ -96,6 +100,101 @@ inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
     geometry::set<1>(xy, par.fr_meter * (par.a * y + par.y0));
 }
 
+/* forward projection of lon/lat coordinates in blocks: the input is
+   checked and adjusted for the whole block, then the projection is applied
+   to the whole block, then the output is scaled. Coordinates are stride
+   elements apart and multiplied by to_radian. Coordinates which can not be
+   projected are set to HUGE_VAL; returns false if there were any. */
+template <typename Prj, typename P, typename T>
+inline bool pj_fwd_n(Prj const& prj, P const& par, std::size_t count,
+                     T const* lons, T const* lats, T* xs, T* ys,
+                     std::size_t stride, T const& to_radian)
+{
+    typedef typename P::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+
+    calc_t lam[pj_batch_size];
+    calc_t phi[pj_batch_size];
+    calc_t x[pj_batch_size];
+    calc_t y[pj_batch_size];
+    bool valid[pj_batch_size];
+
+    bool result = true;
+    for (std::size_t first = 0; first < count; first += pj_batch_size)
+    {
+        std::size_t const n = (std::min)(count - first, pj_batch_size);
+        std::size_t const offset = first * stride;
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            calc_t lp_lon = lons[offset + i * stride] * to_radian;
+            calc_t lp_lat = lats[offset + i * stride] * to_radian;
+            calc_t const t = geometry::math::abs(lp_lat) - geometry::math::half_pi<calc_t>();
+
+            /* check for forward and latitude or longitude overange */
+            valid[i] = ! (t > EPS || geometry::math::abs(lp_lon) > 10.);
+            if (! valid[i])
+            {
+                lp_lon = lp_lat = 0;
+            }
+            else if (geometry::math::abs(t) <= EPS)
+            {
+                lp_lat = lp_lat < 0. ? -geometry::math::half_pi<calc_t>() : geometry::math::half_pi<calc_t>();
+            }
+            else if (par.geoc)
+            {
+                lp_lat = atan(par.rone_es * tan(lp_lat));
+            }
+
+            lp_lon -= par.lam0;    /* compute del lp.lam */
+            if (! par.over)
+            {
+                lp_lon = adjlon(lp_lon); /* post_forward del longitude */
+            }
+
+            lam[i] = lp_lon;
+            phi[i] = lp_lat;
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            x[i] = 0;
+            y[i] = 0;
+            if (valid[i])
+            {
+                try
+                {
+                    prj.fwd(par, lam[i], phi[i], x[i], y[i]);
+                }
+                catch (projection_exception const& e)
+                {
+                    if (! pj_transient_error(e.code()))
+                    {
+                        BOOST_RETHROW
+                    }
+                    valid[i] = false;
+                }
+            }
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            std::size_t const k = offset + i * stride;
+            if (valid[i])
+            {
+                xs[k] = par.fr_meter * (par.a * x[i] + par.x0);
+                ys[k] = par.fr_meter * (par.a * y[i] + par.y0);
+            }
+            else
+            {
+                xs[k] = ys[k] = HUGE_VAL;
+                result = false;
+            }
+        }
+    }
+    return result;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
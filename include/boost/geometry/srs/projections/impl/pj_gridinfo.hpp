@@ -178,6 +178,22 @@ struct pj_gi
 
 typedef std::vector<pj_gi> pj_gridinfo;
 
+// Access to the grids stored in pj_gridinfo or referenced by pointers
+inline pj_gi & pj_gridinfo_at(pj_gridinfo & grids, std::size_t i)
+{
+    return grids[i];
+}
+
+inline pj_gi const& pj_gridinfo_at(pj_gridinfo const& grids, std::size_t i)
+{
+    return grids[i];
+}
+
+inline pj_gi & pj_gridinfo_at(std::vector<pj_gi *> const& grids, std::size_t i)
+{
+    return *grids[i];
+}
+
 
 /************************************************************************/
 /*                   pj_gridinfo_load_ctable()                          */
@@ -185,6 +201,15 @@ typedef std::vector<pj_gi> pj_gridinfo;
 /*      Load the data portion of a ctable formatted grid.               */
 /************************************************************************/
 
+// Size of the proj4 original CTABLE written at the beginning of the file
+inline std::size_t pj_gridinfo_ctable_header_size()
+{
+    return 80
+         + 2 * sizeof(pj_ctable::lp_t)
+         + sizeof(pj_ctable::ilp_t)
+         + sizeof(pj_ctable::flp_t*);
+}
+
 // Originally nad_ctable_load() defined in nad_init.c
 template <typename IStream>
 bool pj_gridinfo_load_ctable(IStream & is, pj_gi_load & gi)
@@ -192,11 +217,7 @@ bool pj_gridinfo_load_ctable(IStream & is, pj_gi_load & gi)
     pj_ctable & ct = gi.ct;
     
     // Move the input stream by the size of the proj4 original CTABLE
-    std::size_t header_size = 80
-                            + 2 * sizeof(pj_ctable::lp_t)
-                            + sizeof(pj_ctable::ilp_t)
-                            + sizeof(pj_ctable::flp_t*);
-    is.seekg(header_size);
+    is.seekg(pj_gridinfo_ctable_header_size());
     
     // read all the actual shift values
     std::size_t a_size = ct.lim.lam * ct.lim.phi;
@@ -442,6 +463,117 @@ inline bool pj_gridinfo_load(IStream & is, pj_gi_load & gi)
     }
 }
 
+/************************************************************************/
+/*                     pj_gridinfo_mapped_cells                         */
+/*                                                                      */
+/*      Access to the shifts of a grid stored in a file mapped into     */
+/*      memory.  Only the cells being used are read and converted       */
+/*      the same way as in pj_gridinfo_load(), so the whole grid is     */
+/*      never loaded.                                                   */
+/************************************************************************/
+
+// Offset of the shifts of a grid in the file
+inline std::size_t pj_gridinfo_mapped_offset(pj_gi_load const& gi)
+{
+    return gi.format == pj_gi::ctable ? pj_gridinfo_ctable_header_size()
+         : gi.format == pj_gi::ctable2 ? 160
+         : std::size_t(gi.grid_offset);
+}
+
+class pj_gridinfo_mapped_cells
+{
+public:
+    pj_gridinfo_mapped_cells(pj_gi_load const& gi, const char * file_data)
+        : m_gi(gi)
+        , m_data(file_data + pj_gridinfo_mapped_offset(gi))
+    {}
+
+    // Returns the cell at the index of ct.cvs of the loaded grid
+    inline pj_ctable::flp_t operator[](boost::int32_t index) const
+    {
+        static const double s2r = math::d2r<double>() / 3600.0;
+
+        pj_ctable::flp_t result;
+
+        if (m_gi.format == pj_gi::ntv2)
+        {
+            float cell[2];
+            memcpy(cell, m_data + reversed_row_index(index) * 16, sizeof(cell));
+            if (m_gi.must_swap)
+            {
+                swap_words(reinterpret_cast<char*>(cell), 4, 2);
+            }
+            result.phi = (float) (cell[0] * s2r);
+            result.lam = (float) (cell[1] * s2r);
+        }
+        else if (m_gi.format == pj_gi::ntv1)
+        {
+            double cell[2];
+            memcpy(cell, m_data + reversed_row_index(index) * 16, sizeof(cell));
+            if (is_lsb())
+            {
+                swap_words(reinterpret_cast<char*>(cell), 8, 2);
+            }
+            result.phi = (float) (cell[0] * s2r);
+            result.lam = (float) (cell[1] * s2r);
+        }
+        else
+        {
+            BOOST_GEOMETRY_ASSERT(m_gi.format == pj_gi::ctable
+                               || m_gi.format == pj_gi::ctable2);
+
+            memcpy(&result, m_data + std::size_t(index) * sizeof(result), sizeof(result));
+            if (m_gi.format == pj_gi::ctable2 && ! is_lsb())
+            {
+                swap_words(reinterpret_cast<char*>(&result), 4, 2);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    // NTv1 and NTv2 rows are stored from east to west
+    inline std::size_t reversed_row_index(boost::int32_t index) const
+    {
+        boost::int32_t const row = index / m_gi.ct.lim.lam;
+        boost::int32_t const col = index % m_gi.ct.lim.lam;
+        return std::size_t(row) * m_gi.ct.lim.lam + (m_gi.ct.lim.lam - col - 1);
+    }
+
+    pj_gi_load const& m_gi;
+    const char * m_data;
+};
+
+// Checks if the file is large enough to contain the shifts of a grid
+// and of its children, otherwise they cannot be accessed in place
+inline bool pj_gridinfo_mapped_fits(pj_gi const& gi, std::size_t file_size)
+{
+    std::size_t const cells = std::size_t(gi.ct.lim.lam) * std::size_t(gi.ct.lim.phi);
+    std::size_t const cell_size = gi.format == pj_gi::gtx ? 4
+                                : gi.format == pj_gi::ntv1 || gi.format == pj_gi::ntv2 ? 16
+                                : 8;
+    std::size_t const offset = pj_gridinfo_mapped_offset(gi);
+
+    if (gi.format == pj_gi::missing
+        || gi.ct.lim.lam < 1 || gi.ct.lim.phi < 1
+        || offset > file_size
+        || cells > (file_size - offset) / cell_size)
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+    {
+        if (! pj_gridinfo_mapped_fits(gi.children[i], file_size))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /************************************************************************/
 /*                        pj_gridinfo_parent()                          */
 /*                                                                      */
@@ -64,14 +64,15 @@ namespace detail
 // Originally one function, here divided into several functions
 // with overloads for various types of grids and stream policies
 
+template <typename Grids>
 inline bool pj_gridlist_find_all(std::string const& gridname,
-                                 pj_gridinfo const& grids,
+                                 Grids const& grids,
                                  std::vector<std::size_t> & gridindexes)
 {
     bool result = false;
     for (std::size_t i = 0 ; i < grids.size() ; ++i)
     {
-        if (grids[i].gridname == gridname)
+        if (pj_gridinfo_at(grids, i).gridname == gridname)
         {
             result = true;
             gridindexes.push_back(i);
@@ -177,6 +178,125 @@ inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
     return true;
 }
 
+// Loads the grid and its children
+template <typename StreamPolicy>
+inline bool pj_gridlist_load_all(StreamPolicy const& stream_policy, pj_gi & gi)
+{
+    typename StreamPolicy::stream_type is;
+    stream_policy.open(is, gi.gridname);
+
+    if (! pj_gridinfo_load(is, gi))
+        return false;
+
+    for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+    {
+        if (! pj_gridlist_load_all(stream_policy, gi.children[i]))
+            return false;
+    }
+
+    return true;
+}
+
+// Generic stream policy and grids shared in snapshots, the grids are loaded
+// before they are published so they are never modified afterwards
+template <typename StreamPolicy, typename SnapshotGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       StreamPolicy const& stream_policy,
+                                       SnapshotGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       shared_grids_snapshot_tag)
+{
+    if (pj_gridlist_find_all(gridname, grids.snapshot(), gridindexes))
+        return true;
+
+    // Try to load the named grid.
+    pj_gridinfo new_grids;
+
+    {
+        typename StreamPolicy::stream_type is;
+        stream_policy.open(is, gridname);
+
+        if (! pj_gridinfo_init(gridname, is, new_grids))
+        {
+            return false;
+        }
+    }
+
+    for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+    {
+        if (! pj_gridlist_load_all(stream_policy, new_grids[i]))
+            return false;
+    }
+
+    // Publish the grids now that they are loaded.
+
+    std::size_t orig_size = 0;
+    std::size_t new_size = 0;
+
+    {
+        typename SnapshotGrids::write_locked lck_grids(grids);
+
+        // Try to find in the existing list of loaded grids again
+        // in case other thread already added it.
+        if (pj_gridlist_find_all(gridname, lck_grids.snapshot(), gridindexes))
+            return true;
+
+        orig_size = lck_grids.snapshot().size();
+        new_size = orig_size + new_grids.size();
+
+        lck_grids.publish(new_grids);
+    }
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, new_size);
+
+    return true;
+}
+
+// Mapped file policy and mapped grids, only the headers are read,
+// the file stays mapped as long as the grids are used
+template <typename MappedFilePolicy, typename MappedGrids>
+inline bool pj_gridlist_merge_gridfile(std::string const& gridname,
+                                       MappedFilePolicy const& stream_policy,
+                                       MappedGrids & grids,
+                                       std::vector<std::size_t> & gridindexes,
+                                       mapped_grids_tag)
+{
+    if (pj_gridlist_find_all(gridname, grids.gridinfo, gridindexes))
+        return true;
+
+    typename MappedFilePolicy::stream_type is;
+    stream_policy.open(is, gridname);
+
+    pj_gridinfo new_grids;
+
+    if (! pj_gridinfo_init(gridname, is, new_grids))
+    {
+        return false;
+    }
+
+    // The shifts are accessed in place so check the size of the file
+    // instead of failing while the grids are applied
+    for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+    {
+        if (! pj_gridinfo_mapped_fits(new_grids[i], is.size()))
+        {
+            return false;
+        }
+    }
+
+    std::size_t orig_size = grids.gridinfo.size();
+    std::size_t new_size = orig_size + new_grids.size();
+
+    grids.gridinfo.resize(new_size);
+    for (std::size_t i = 0 ; i < new_grids.size() ; ++ i)
+        new_grids[i].swap(grids.gridinfo[i + orig_size]);
+    grids.files.resize(new_size, is.file());
+
+    pj_gridlist_add_seq_inc(gridindexes, orig_size, new_size);
+
+    return true;
+}
+
 
 /************************************************************************/
 /*                     pj_gridlist_from_nadgrids()                      */
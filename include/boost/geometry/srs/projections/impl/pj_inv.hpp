@@ -40,11 +40,16 @@
 #define BOOST_GEOMETRY_PROJECTIONS_PJ_INV_HPP
 
 
+#include <algorithm>
+#include <cstddef>
 
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/srs/projections/exception.hpp>
+#include <boost/geometry/srs/projections/impl/projects.hpp>
+
 /* general inverse projection */
 
 namespace boost { namespace geometry { namespace projections
@@ -78,6 +83,87 @@ inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
     geometry::set_from_radian<1>(ll, lat);
 }
 
+/* inverse projection of x/y coordinates in blocks, see pj_fwd_n. The
+   resulting lon/lat coordinates are multiplied by from_radian. */
+template <typename PRJ, typename PAR, typename T>
+inline bool pj_inv_n(PRJ const& prj, PAR const& par, std::size_t count,
+                     T const* xs, T const* ys, T* lons, T* lats,
+                     std::size_t stride, T const& from_radian)
+{
+    typedef typename PAR::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+
+    calc_t x[pj_batch_size];
+    calc_t y[pj_batch_size];
+    calc_t lam[pj_batch_size];
+    calc_t phi[pj_batch_size];
+    bool valid[pj_batch_size];
+
+    bool result = true;
+    for (std::size_t first = 0; first < count; first += pj_batch_size)
+    {
+        std::size_t const n = (std::min)(count - first, pj_batch_size);
+        std::size_t const offset = first * stride;
+
+        /* descale and de-offset, invalid points (HUGE_VAL) are skipped,
+           as in pj_transform */
+        for (std::size_t i = 0; i < n; i++)
+        {
+            valid[i] = xs[offset + i * stride] != HUGE_VAL;
+            x[i] = (xs[offset + i * stride] * par.to_meter - par.x0) * par.ra;
+            y[i] = (ys[offset + i * stride] * par.to_meter - par.y0) * par.ra;
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            lam[i] = 0;
+            phi[i] = 0;
+            if (! valid[i])
+            {
+                continue;
+            }
+            try
+            {
+                prj.inv(par, x[i], y[i], lam[i], phi[i]); /* inverse project */
+            }
+            catch (projection_not_invertible_exception &)
+            {
+                BOOST_RETHROW
+            }
+            catch (projection_exception const& e)
+            {
+                if (! pj_transient_error(e.code()))
+                {
+                    BOOST_RETHROW
+                }
+                valid[i] = false;
+            }
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            std::size_t const k = offset + i * stride;
+            if (! valid[i])
+            {
+                lons[k] = lats[k] = HUGE_VAL;
+                result = false;
+                continue;
+            }
+
+            calc_t lon = lam[i] + par.lam0; /* reduce from del lp.lam */
+            calc_t lat = phi[i];
+            if (!par.over)
+                lon = adjlon(lon); /* adjust longitude to CM */
+            if (par.geoc && geometry::math::abs(geometry::math::abs(lat)-geometry::math::half_pi<calc_t>()) > EPS)
+                lat = atan(par.one_es * tan(lat));
+
+            lons[k] = lon * from_radian;
+            lats[k] = lat * from_radian;
+        }
+    }
+    return result;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -66,6 +66,11 @@ inline bool pj_param_pred(srs::detail::proj4_parameter const& p, std::string con
     return p.name == name;
 }
 
+inline bool pj_param_pred(srs::detail::proj4_parameter const& p, char const* name)
+{
+    return p.name == name;
+}
+
 template
 <
     typename T, typename Id,
@@ -430,42 +435,42 @@ inline std::string pj_get_param_s(srs::detail::proj4_parameters const& pl, std::
 
 template <typename Param, typename Name>
 inline bool pj_param_exists(srs::detail::proj4_parameters const& pl,
-                            std::string const& sn,
+                            char const* sn,
                             Name const& )
 {
     return pj_param_exists(pl, sn);
 }
 template <template <typename> class Param, typename Name>
 inline bool pj_param_exists(srs::detail::proj4_parameters const& pl,
-                            std::string const& sn,
+                            char const* sn,
                             Name const& )
 {
     return pj_param_exists(pl, sn);
 }
 template <typename Param, typename T, typename Name>
 inline bool pj_param_exists(srs::dpar::parameters<T> const& pl,
-                            std::string const& ,
+                            char const* ,
                             Name const& n)
 {
     return pj_param_exists(pl, n);
 }
 template <template <typename> class Param, typename T, typename Name>
 inline bool pj_param_exists(srs::dpar::parameters<T> const& pl,
-                            std::string const& ,
+                            char const* ,
                             Name const& n)
 {
     return pj_param_exists(pl, n);
 }
 template <typename Param, typename ...Ps, typename Name>
 inline bool pj_param_exists(srs::spar::parameters<Ps...> const& pl,
-                            std::string const& ,
+                            char const* ,
                             Name const& )
 {
     return pj_param_exists<Param>(pl);
 }
 template <template <typename> class Param, typename ...Ps, typename Name>
 inline bool pj_param_exists(srs::spar::parameters<Ps...> const& pl,
-                            std::string const& ,
+                            char const* ,
                             Name const& )
 {
     return pj_param_exists<Param>(pl);
@@ -473,21 +478,21 @@ inline bool pj_param_exists(srs::spar::parameters<Ps...> const& pl,
 
 template <typename Param>
 inline bool pj_get_param_b(srs::detail::proj4_parameters const& pl,
-                           std::string const& sn,
+                           char const* sn,
                            srs::dpar::name_be const& )
 {
     return _pj_get_param_b(pl, sn);
 }
 template <typename Param, typename T>
 inline bool pj_get_param_b(srs::dpar::parameters<T> const& pl,
-                           std::string const& ,
+                           char const* ,
                            srs::dpar::name_be const& n)
 {
     return _pj_get_param_b(pl, n);
 }
 template <typename Param, typename ...Ps>
 inline bool pj_get_param_b(srs::spar::parameters<Ps...> const& pl,
-                           std::string const& ,
+                           char const* ,
                            srs::dpar::name_be const& )
 {
     return _pj_get_param_b<Param>(pl);
@@ -497,7 +502,7 @@ inline bool pj_get_param_b(srs::spar::parameters<Ps...> const& pl,
 
 template <template <int> class Param>
 inline bool pj_param_i(srs::detail::proj4_parameters const& pl,
-                       std::string const& sn,
+                       char const* sn,
                        srs::dpar::name_i const& ,
                        int & par)
 {
@@ -505,7 +510,7 @@ inline bool pj_param_i(srs::detail::proj4_parameters const& pl,
 }
 template <template <int> class Param, typename T>
 inline bool pj_param_i(srs::dpar::parameters<T> const& pl,
-                       std::string const& ,
+                       char const* ,
                        srs::dpar::name_i const& n,
                        int & par)
 {
@@ -513,7 +518,7 @@ inline bool pj_param_i(srs::dpar::parameters<T> const& pl,
 }
 template <template <int> class Param, typename ...Ps>
 inline bool pj_param_i(srs::spar::parameters<Ps...> const& pl,
-                       std::string const& ,
+                       char const* ,
                        srs::dpar::name_i const& ,
                        int & par)
 {
@@ -524,21 +529,21 @@ inline bool pj_param_i(srs::spar::parameters<Ps...> const& pl,
 
 template <template <int> class Param>
 inline int pj_get_param_i(srs::detail::proj4_parameters const& pl,
-                          std::string const& sn,
+                          char const* sn,
                           srs::dpar::name_i const& )
 {
     return _pj_get_param_i(pl, sn);
 }
 template <template <int> class Param, typename T>
 inline int pj_get_param_i(srs::dpar::parameters<T> const& pl,
-                          std::string const& ,
+                          char const* ,
                           srs::dpar::name_i const& n)
 {
     return _pj_get_param_i(pl, n);
 }
 template <template <int> class Param, typename ...Ps>
 inline bool pj_get_param_i(srs::spar::parameters<Ps...> const& pl,
-                           std::string const& ,
+                           char const* ,
                            srs::dpar::name_i const& )
 {
     return _pj_get_param_i<Param>(pl);
@@ -548,7 +553,7 @@ inline bool pj_get_param_i(srs::spar::parameters<Ps...> const& pl,
 
 template <template <typename> class Param, typename T>
 inline bool pj_param_f(srs::detail::proj4_parameters const& pl,
-                       std::string const& sn,
+                       char const* sn,
                        srs::dpar::name_f const& ,
                        T & par)
 {
@@ -556,7 +561,7 @@ inline bool pj_param_f(srs::detail::proj4_parameters const& pl,
 }
 template <template <typename> class Param, typename T>
 inline bool pj_param_f(srs::dpar::parameters<T> const& pl,
-                       std::string const& ,
+                       char const* ,
                        srs::dpar::name_f const& n,
                        T & par)
 {
@@ -564,7 +569,7 @@ inline bool pj_param_f(srs::dpar::parameters<T> const& pl,
 }
 template <template <typename> class Param, typename ...Ps, typename T>
 inline bool pj_param_f(srs::spar::parameters<Ps...> const& pl,
-                       std::string const& ,
+                       char const* ,
                        srs::dpar::name_f const& ,
                        T & par)
 {
@@ -575,21 +580,21 @@ inline bool pj_param_f(srs::spar::parameters<Ps...> const& pl,
 
 template <typename T, template <typename> class Param>
 inline T pj_get_param_f(srs::detail::proj4_parameters const& pl,
-                        std::string const& sn,
+                        char const* sn,
                         srs::dpar::name_f const& )
 {
     return _pj_get_param_f<T>(pl, sn);
 }
 template <typename T, template <typename> class Param>
 inline T pj_get_param_f(srs::dpar::parameters<T> const& pl,
-                        std::string const& ,
+                        char const* ,
                         srs::dpar::name_f const& n)
 {
     return _pj_get_param_f<T>(pl, n);
 }
 template <typename T, template <typename> class Param, typename ...Ps>
 inline T pj_get_param_f(srs::spar::parameters<Ps...> const& pl,
-                        std::string const& ,
+                        char const* ,
                         srs::dpar::name_f const& )
 {
     return _pj_get_param_f<T, Param>(pl);
@@ -600,7 +605,7 @@ inline T pj_get_param_f(srs::spar::parameters<Ps...> const& pl,
 
 template <template <typename> class Param, typename T>
 inline bool pj_param_r(srs::detail::proj4_parameters const& pl,
-                       std::string const& sn,
+                       char const* sn,
                        srs::dpar::name_r const& ,
                        T & par)
 {
@@ -608,7 +613,7 @@ inline bool pj_param_r(srs::detail::proj4_parameters const& pl,
 }
 template <template <typename> class Param, typename T>
 inline bool pj_param_r(srs::dpar::parameters<T> const& pl,
-                       std::string const& ,
+                       char const* ,
                        srs::dpar::name_r const& n,
                        T & par)
 {
@@ -616,7 +621,7 @@ inline bool pj_param_r(srs::dpar::parameters<T> const& pl,
 }
 template <template <typename> class Param, typename ...Ps, typename T>
 inline bool pj_param_r(srs::spar::parameters<Ps...> const& pl,
-                       std::string const& ,
+                       char const* ,
                        srs::dpar::name_r const& ,
                        T & par)
 {
@@ -627,21 +632,21 @@ inline bool pj_param_r(srs::spar::parameters<Ps...> const& pl,
 
 template <typename T, template <typename> class Param>
 inline T pj_get_param_r(srs::detail::proj4_parameters const& pl,
-                        std::string const& sn,
+                        char const* sn,
                         srs::dpar::name_r const& )
 {
     return _pj_get_param_r<T>(pl, sn);
 }
 template <typename T, template <typename> class Param>
 inline T pj_get_param_r(srs::dpar::parameters<T> const& pl,
-                        std::string const& ,
+                        char const* ,
                         srs::dpar::name_r const& n)
 {
     return _pj_get_param_r<T>(pl, n);
 }
 template <typename T, template <typename> class Param, typename ...Ps>
 inline T pj_get_param_r(srs::spar::parameters<Ps...> const& pl,
-                        std::string const& ,
+                        char const* ,
                         srs::dpar::name_r const& )
 {
     return _pj_get_param_r<T, Param>(pl);
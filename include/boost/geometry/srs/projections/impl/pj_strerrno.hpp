@@ -160,7 +160,7 @@ pj_err_list[] = {
     "argument not numerical or out of range",                          /* -58 */
 
     /* When adding error messages, remember to update ID defines in
-    projects.h, and transient_error array in pj_transform                  */
+    projects.h, and transient_error array below                            */
 };
 
 inline std::string pj_generic_strerrno(std::string const& msg, int err)
@@ -212,6 +212,41 @@ inline std::string pj_strerrno(int err) {
     }
 }
 
+/*
+** This table is intended to indicate for any given error code in
+** the range 0 to -56, whether that error will occur for all locations (ie.
+** it is a problem with the coordinate system as a whole) in which case the
+** value would be 0, or if the problem is with the point being transformed
+** in which case the value is 1.
+**
+** NOTE (2017-10-01): Non-transient errors really should have resulted in a
+** PJ==0 during initialization, and hence should be handled at the level
+** before calling pj_transform. The only obvious example of the contrary
+** appears to be the PJD_ERR_GRID_AREA case, which may also be taken to
+** mean "no grids available"
+**
+**
+*/
+
+static const int transient_error[60] = {
+    /*             0  1  2  3  4  5  6  7  8  9   */
+    /* 0 to 9 */   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 10 to 19 */ 0, 0, 0, 0, 1, 1, 0, 1, 1, 1,
+    /* 20 to 29 */ 1, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    /* 30 to 39 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 40 to 49 */ 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    /* 50 to 59 */ 1, 0, 1, 0, 1, 1, 1, 1, 0, 0 };
+
+// Returns true if the error is caused by the point being transformed, which
+// is then set to invalid, and false if the error is a problem with the
+// coordinate system as a whole, which is rethrown (as pj_transform does)
+inline bool pj_transient_error(int err)
+{
+    return err == 33 /*EDOM*/
+        || err == 34 /*ERANGE*/
+        || (err <= 0 && err >= -44 && transient_error[-err] != 0);
+}
+
 } // namespace detail
 
 }}} // namespace boost::geometry::projections
@@ -174,34 +174,6 @@ inline typename Par::type Rz_BF(Par const& defn) { return defn.datum_params[5];
 template <typename Par>
 inline typename Par::type M_BF(Par const& defn) { return defn.datum_params[6]; }
 
-/*
-** This table is intended to indicate for any given error code in
-** the range 0 to -56, whether that error will occur for all locations (ie.
-** it is a problem with the coordinate system as a whole) in which case the
-** value would be 0, or if the problem is with the point being transformed
-** in which case the value is 1.
-**
-** At some point we might want to move this array in with the error message
-** list or something, but while experimenting with it this should be fine.
-**
-**
-** NOTE (2017-10-01): Non-transient errors really should have resulted in a
-** PJ==0 during initialization, and hence should be handled at the level
-** before calling pj_transform. The only obvious example of the contrary
-** appears to be the PJD_ERR_GRID_AREA case, which may also be taken to
-** mean "no grids available"
-**
-**
-*/
-
-static const int transient_error[60] = {
-    /*             0  1  2  3  4  5  6  7  8  9   */
-    /* 0 to 9 */   0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    /* 10 to 19 */ 0, 0, 0, 0, 1, 1, 0, 1, 1, 1,
-    /* 20 to 29 */ 1, 0, 0, 0, 0, 0, 0, 1, 0, 0,
-    /* 30 to 39 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-    /* 40 to 49 */ 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
-    /* 50 to 59 */ 1, 0, 1, 0, 1, 1, 1, 1, 0, 0 };
 
 
 template <typename T, typename Range>
@@ -370,11 +342,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                 }
                 catch(projection_exception const& e)
                 {
-                    if( (e.code() != 33 /*EDOM*/
-                        && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
+                    if( ! pj_transient_error(e.code()) ) {
                         BOOST_RETHROW
                     } else {
                         set_invalid_point(point);
@@ -542,11 +510,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                     pj_fwd(dstprj, dstdefn, point, point);
                 } catch (projection_exception const& e) {
 
-                    if( (e.code() != 33 /*EDOM*/
-                         && e.code() != 34 /*ERANGE*/ )
-                        && (e.code() > 0
-                            || e.code() < -44 /*|| point_count == 1*/
-                            || transient_error[-e.code()] == 0) ) {
+                    if( ! pj_transient_error(e.code()) ) {
                         BOOST_RETHROW
                     } else {
                         set_invalid_point(point);
@@ -613,9 +577,7 @@ inline int pj_geodetic_to_geocentric( T const& a, T const& es,
                                       range_wrapper<Range, AddZ> & range_wrapper )
 
 {
-    //typedef typename boost::range_iterator<Range>::type iterator;
     typedef typename boost::range_value<Range>::type point_type;
-    //typedef typename coordinate_type<point_type>::type coord_t;
 
     Range & rng = range_wrapper.get_range();
     std::size_t point_count = boost::size(rng);
@@ -630,29 +592,47 @@ inline int pj_geodetic_to_geocentric( T const& a, T const& es,
         return error_geocentric;
     }
 
-    for( std::size_t i = 0 ; i < point_count ; ++i )
+    // The points are converted in blocks, see pj_Convert_Geodetic_To_Geocentric_n()
+    T lon[pj_batch_size], lat[pj_batch_size], height[pj_batch_size];
+    T X[pj_batch_size], Y[pj_batch_size], Z[pj_batch_size];
+    std::size_t indexes[pj_batch_size];
+
+    for( std::size_t i = 0 ; i < point_count ; )
     {
-        point_type & point = range::at(rng, i);
+        std::size_t count = 0;
+        for( ; i < point_count && count < pj_batch_size ; ++i )
+        {
+            point_type const& point = range::at(rng, i);
 
-        if( is_invalid_point(point) )
-            continue;
+            if( is_invalid_point(point) )
+                continue;
 
-        T X = 0, Y = 0, Z = 0;
-        if( pj_Convert_Geodetic_To_Geocentric( gi,
-                                               get_as_radian<0>(point),
-                                               get_as_radian<1>(point),
-                                               range_wrapper.get_z(i), // Height
-                                               X, Y, Z ) != 0 )
+            lon[count] = get_as_radian<0>(point);
+            lat[count] = get_as_radian<1>(point);
+            height[count] = range_wrapper.get_z(i);
+            indexes[count++] = i;
+        }
+
+        if( pj_Convert_Geodetic_To_Geocentric_n( gi, count, lon, lat, height,
+                                                 X, Y, Z ) != 0 )
         {
             ret_errno = error_lat_or_lon_exceed_limit;
-            set_invalid_point(point);
             /* but keep processing points! */
         }
-        else
+
+        for( std::size_t j = 0 ; j < count ; ++j )
         {
-            set<0>(point, X);
-            set<1>(point, Y);
-            range_wrapper.set_z(i, Z);
+            point_type & point = range::at(rng, indexes[j]);
+
+            if( lon[j] == HUGE_VAL )
+            {
+                set_invalid_point(point);
+                continue;
+            }
+
+            set<0>(point, X[j]);
+            set<1>(point, Y[j]);
+            range_wrapper.set_z(indexes[j], Z[j]);
         }
     }
 
@@ -668,9 +648,7 @@ inline int pj_geocentric_to_geodetic( T const& a, T const& es,
                                       range_wrapper<Range, AddZ> & range_wrapper )
 
 {
-    //typedef typename boost::range_iterator<Range>::type iterator;
     typedef typename boost::range_value<Range>::type point_type;
-    //typedef typename coordinate_type<point_type>::type coord_t;
 
     Range & rng = range_wrapper.get_range();
     std::size_t point_count = boost::size(rng);
@@ -683,23 +661,39 @@ inline int pj_geocentric_to_geodetic( T const& a, T const& es,
         return error_geocentric;
     }
 
-    for( std::size_t i = 0 ; i < point_count ; ++i )
+    // The points are converted in blocks, see pj_Convert_Geocentric_To_Geodetic_n()
+    T X[pj_batch_size], Y[pj_batch_size], Z[pj_batch_size];
+    T Longitude[pj_batch_size], Latitude[pj_batch_size], Height[pj_batch_size];
+    std::size_t indexes[pj_batch_size];
+
+    for( std::size_t i = 0 ; i < point_count ; )
     {
-        point_type & point = range::at(rng, i);
+        std::size_t count = 0;
+        for( ; i < point_count && count < pj_batch_size ; ++i )
+        {
+            point_type const& point = range::at(rng, i);
 
-        if( is_invalid_point(point) )
-            continue;
+            if( is_invalid_point(point) )
+                continue;
 
-        T Longitude = 0, Latitude = 0, Height = 0;
-        pj_Convert_Geocentric_To_Geodetic( gi,
-                                           get<0>(point),
-                                           get<1>(point),
-                                           range_wrapper.get_z(i), // z
-                                           Longitude, Latitude, Height );
+            X[count] = get<0>(point);
+            Y[count] = get<1>(point);
+            Z[count] = range_wrapper.get_z(i);
+            Longitude[count] = Latitude[count] = Height[count] = 0;
+            indexes[count++] = i;
+        }
+
+        pj_Convert_Geocentric_To_Geodetic_n( gi, count, X, Y, Z,
+                                             Longitude, Latitude, Height );
+
+        for( std::size_t j = 0 ; j < count ; ++j )
+        {
+            point_type & point = range::at(rng, indexes[j]);
 
-        set_from_radian<0>(point, Longitude);
-        set_from_radian<1>(point, Latitude);
-        range_wrapper.set_z(i, Height); // Height
+            set_from_radian<0>(point, Longitude[j]);
+            set_from_radian<1>(point, Latitude[j]);
+            range_wrapper.set_z(indexes[j], Height[j]); // Height
+        }
     }
 
     return 0;
@@ -751,121 +745,204 @@ inline bool pj_compare_datums( Par & srcdefn, Par & dstdefn )
 }
 
 /************************************************************************/
-/*                       pj_geocentic_to_wgs84()                        */
+/*                             pj_helmert                               */
+/*                                                                      */
+/*      The shift, the rotation and the scale of a 3 or 7 parameter     */
+/*      datum. 3 parameter datums have no rotation and a scale of 1,    */
+/*      the 7 parameter formulas then give the same results as adding   */
+/*      the shift.                                                      */
 /************************************************************************/
 
-template <typename Par, typename Range, bool AddZ>
-inline int pj_geocentric_to_wgs84( Par const& defn,
-                                   range_wrapper<Range, AddZ> & range_wrapper )
+template <typename T>
+struct pj_helmert
+{
+    T dx, dy, dz;
+    T rx, ry, rz;
+    T m;
+};
 
+template <typename T, typename Par>
+inline pj_helmert<T> pj_helmert_params( Par const& defn )
 {
-    typedef typename boost::range_value<Range>::type point_type;
-    typedef typename coordinate_type<point_type>::type coord_t;
+    pj_helmert<T> result = { 0, 0, 0, 0, 0, 0, 1 };
+    if( defn.datum_type == datum_3param || defn.datum_type == datum_7param )
+    {
+        result.dx = Dx_BF(defn);
+        result.dy = Dy_BF(defn);
+        result.dz = Dz_BF(defn);
+    }
+    if( defn.datum_type == datum_7param )
+    {
+        result.rx = Rx_BF(defn);
+        result.ry = Ry_BF(defn);
+        result.rz = Rz_BF(defn);
+        result.m = M_BF(defn);
+    }
+    return result;
+}
 
-    Range & rng = range_wrapper.get_range();
-    std::size_t point_count = boost::size(rng);
+/************************************************************************/
+/*                      pj_geocentic_to_wgs84_n()                       */
+/*                                                                      */
+/*      Applies the Helmert transformation to arrays of geocentric      */
+/*      coordinates, in a loop without branches. Only the shift is      */
+/*      applied for 3 parameter datums, as pj_geocentric_to_wgs84()     */
+/*      did before.                                                     */
+/************************************************************************/
+
+template <typename T>
+inline bool pj_helmert_is_shift( pj_helmert<T> const& p )
+{
+    return p.rx == 0 && p.ry == 0 && p.rz == 0 && p.m == 1;
+}
+
+template <typename T>
+inline void pj_geocentric_to_wgs84_n( pj_helmert<T> const& p, std::size_t count,
+                                      T * x, T * y, T * z )
+{
+    // Copied, the arrays could alias the parameters
+    T const dx = p.dx, dy = p.dy, dz = p.dz;
 
-    if( defn.datum_type == datum_3param )
+    if( pj_helmert_is_shift(p) )
     {
-        for(std::size_t i = 0; i < point_count; i++ )
+        for( std::size_t i = 0 ; i < count ; ++i )
         {
-            point_type & point = range::at(rng, i);
-            
-            if( is_invalid_point(point) )
-                continue;
-
-            set<0>(point,                   get<0>(point) + Dx_BF(defn));
-            set<1>(point,                   get<1>(point) + Dy_BF(defn));
-            range_wrapper.set_z(i, range_wrapper.get_z(i) + Dz_BF(defn));
+            x[i] += dx;
+            y[i] += dy;
+            z[i] += dz;
         }
+        return;
     }
-    else if( defn.datum_type == datum_7param )
-    {
-        for(std::size_t i = 0; i < point_count; i++ )
-        {
-            point_type & point = range::at(rng, i);
 
-            if( is_invalid_point(point) )
-                continue;
+    T const rx = p.rx, ry = p.ry, rz = p.rz, m = p.m;
 
-            coord_t x = get<0>(point);
-            coord_t y = get<1>(point);
-            coord_t z = range_wrapper.get_z(i);
+    for( std::size_t i = 0 ; i < count ; ++i )
+    {
+        T const x_in = x[i];
+        T const y_in = y[i];
+        T const z_in = z[i];
 
-            coord_t x_out, y_out, z_out;
+        x[i] = m*(     x_in - rz*y_in + ry*z_in) + dx;
+        y[i] = m*( rz*x_in +    y_in - rx*z_in) + dy;
+        z[i] = m*(-ry*x_in + rx*y_in +    z_in) + dz;
+    }
+}
 
-            x_out = M_BF(defn)*(             x - Rz_BF(defn)*y + Ry_BF(defn)*z) + Dx_BF(defn);
-            y_out = M_BF(defn)*( Rz_BF(defn)*x +             y - Rx_BF(defn)*z) + Dy_BF(defn);
-            z_out = M_BF(defn)*(-Ry_BF(defn)*x + Rx_BF(defn)*y +             z) + Dz_BF(defn);
+/************************************************************************/
+/*                     pj_geocentic_from_wgs84_n()                      */
+/************************************************************************/
 
-            set<0>(point, x_out);
-            set<1>(point, y_out);
-            range_wrapper.set_z(i, z_out);
+template <typename T>
+inline void pj_geocentric_from_wgs84_n( pj_helmert<T> const& p, std::size_t count,
+                                        T * x, T * y, T * z )
+{
+    T const dx = p.dx, dy = p.dy, dz = p.dz;
+
+    if( pj_helmert_is_shift(p) )
+    {
+        for( std::size_t i = 0 ; i < count ; ++i )
+        {
+            x[i] -= dx;
+            y[i] -= dy;
+            z[i] -= dz;
         }
+        return;
     }
 
-    return 0;
+    T const rx = p.rx, ry = p.ry, rz = p.rz, m = p.m;
+
+    for( std::size_t i = 0 ; i < count ; ++i )
+    {
+        T const x_tmp = (x[i] - dx) / m;
+        T const y_tmp = (y[i] - dy) / m;
+        T const z_tmp = (z[i] - dz) / m;
+
+        x[i] =     x_tmp + rz*y_tmp - ry*z_tmp;
+        y[i] = -rz*x_tmp +    y_tmp + rx*z_tmp;
+        z[i] =  ry*x_tmp - rx*y_tmp +    z_tmp;
+    }
 }
 
 /************************************************************************/
-/*                      pj_geocentic_from_wgs84()                       */
+/*                        pj_geocentric_wgs84()                         */
 /************************************************************************/
 
-template <typename Par, typename Range, bool AddZ>
-inline int pj_geocentric_from_wgs84( Par const& defn,
-                                     range_wrapper<Range, AddZ> & range_wrapper )
+template <bool ToWgs84, typename Par, typename Range, bool AddZ>
+inline int pj_geocentric_wgs84( Par const& defn,
+                                range_wrapper<Range, AddZ> & range_wrapper )
 
 {
     typedef typename boost::range_value<Range>::type point_type;
     typedef typename coordinate_type<point_type>::type coord_t;
 
+    if( defn.datum_type != datum_3param && defn.datum_type != datum_7param )
+        return 0;
+
+    pj_helmert<coord_t> const params = pj_helmert_params<coord_t>(defn);
+
     Range & rng = range_wrapper.get_range();
     std::size_t point_count = boost::size(rng);
 
-    if( defn.datum_type == datum_3param )
-    {
-        for(std::size_t i = 0; i < point_count; i++ )
-        {
-            point_type & point = range::at(rng, i);
-
-            if( is_invalid_point(point) )
-                continue;
+    // The points are transformed in blocks
+    coord_t x[pj_batch_size], y[pj_batch_size], z[pj_batch_size];
+    std::size_t indexes[pj_batch_size];
 
-            set<0>(point,                   get<0>(point) - Dx_BF(defn));
-            set<1>(point,                   get<1>(point) - Dy_BF(defn));
-            range_wrapper.set_z(i, range_wrapper.get_z(i) - Dz_BF(defn));
-        }
-    }
-    else if( defn.datum_type == datum_7param )
+    for( std::size_t i = 0 ; i < point_count ; )
     {
-        for(std::size_t i = 0; i < point_count; i++ )
+        std::size_t count = 0;
+        for( ; i < point_count && count < pj_batch_size ; ++i )
         {
-            point_type & point = range::at(rng, i);
+            point_type const& point = range::at(rng, i);
 
             if( is_invalid_point(point) )
                 continue;
 
-            coord_t x = get<0>(point);
-            coord_t y = get<1>(point);
-            coord_t z = range_wrapper.get_z(i);
+            x[count] = get<0>(point);
+            y[count] = get<1>(point);
+            z[count] = range_wrapper.get_z(i);
+            indexes[count++] = i;
+        }
 
-            coord_t x_tmp = (x - Dx_BF(defn)) / M_BF(defn);
-            coord_t y_tmp = (y - Dy_BF(defn)) / M_BF(defn);
-            coord_t z_tmp = (z - Dz_BF(defn)) / M_BF(defn);
+        if( ToWgs84 )
+            pj_geocentric_to_wgs84_n( params, count, x, y, z );
+        else
+            pj_geocentric_from_wgs84_n( params, count, x, y, z );
 
-            x =              x_tmp + Rz_BF(defn)*y_tmp - Ry_BF(defn)*z_tmp;
-            y = -Rz_BF(defn)*x_tmp +             y_tmp + Rx_BF(defn)*z_tmp;
-            z =  Ry_BF(defn)*x_tmp - Rx_BF(defn)*y_tmp +             z_tmp;
+        for( std::size_t j = 0 ; j < count ; ++j )
+        {
+            point_type & point = range::at(rng, indexes[j]);
 
-            set<0>(point, x);
-            set<1>(point, y);
-            range_wrapper.set_z(i, z);
+            set<0>(point, x[j]);
+            set<1>(point, y[j]);
+            range_wrapper.set_z(indexes[j], z[j]);
         }
     }
 
     return 0;
 }
 
+/************************************************************************/
+/*                       pj_geocentic_to_wgs84()                        */
+/************************************************************************/
+
+template <typename Par, typename Range, bool AddZ>
+inline int pj_geocentric_to_wgs84( Par const& defn,
+                                   range_wrapper<Range, AddZ> & range_wrapper )
+{
+    return pj_geocentric_wgs84<true>( defn, range_wrapper );
+}
+
+/************************************************************************/
+/*                      pj_geocentic_from_wgs84()                       */
+/************************************************************************/
+
+template <typename Par, typename Range, bool AddZ>
+inline int pj_geocentric_from_wgs84( Par const& defn,
+                                     range_wrapper<Range, AddZ> & range_wrapper )
+{
+    return pj_geocentric_wgs84<false>( defn, range_wrapper );
+}
+
 
 inline bool pj_datum_check_error(int err)
 {
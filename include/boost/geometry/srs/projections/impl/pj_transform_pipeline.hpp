@@ -0,0 +1,331 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_PJ_TRANSFORM_PIPELINE_HPP
+#define BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_PJ_TRANSFORM_PIPELINE_HPP
+
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/util/math.hpp>
+
+#include <boost/geometry/srs/projections/impl/base_dynamic.hpp>
+#include <boost/geometry/srs/projections/impl/geocent.hpp>
+#include <boost/geometry/srs/projections/impl/pj_fwd.hpp>
+#include <boost/geometry/srs/projections/impl/pj_inv.hpp>
+#include <boost/geometry/srs/projections/impl/pj_transform.hpp>
+#include <boost/geometry/srs/projections/impl/projects.hpp>
+#include <boost/geometry/srs/projections/invalid_point.hpp>
+
+
+namespace boost { namespace geometry { namespace projections
+{
+
+namespace detail
+{
+
+// Projection of arrays of radians, inlined for static projections and with
+// one virtual call per array for dynamic projections
+template <typename Prj, typename Par, typename T>
+inline bool pj_transform_fwd_n(Prj const& prj, Par const& par, std::size_t count,
+                               T const* lons, T const* lats, T* xs, T* ys)
+{
+    return pj_fwd_n(prj, par, count, lons, lats, xs, ys, 1, T(1));
+}
+
+template <typename T, typename Par>
+inline bool pj_transform_fwd_n(dynamic_wrapper_b<T, Par> const& prj, Par const& par,
+                               std::size_t count,
+                               T const* lons, T const* lats, T* xs, T* ys)
+{
+    return prj.fwd(par, count, lons, lats, xs, ys, 1, T(1));
+}
+
+template <typename Prj, typename Par, typename T>
+inline bool pj_transform_inv_n(Prj const& prj, Par const& par, std::size_t count,
+                               T const* xs, T const* ys, T* lons, T* lats)
+{
+    return pj_inv_n(prj, par, count, xs, ys, lons, lats, 1, T(1));
+}
+
+template <typename T, typename Par>
+inline bool pj_transform_inv_n(dynamic_wrapper_b<T, Par> const& prj, Par const& par,
+                               std::size_t count,
+                               T const* xs, T const* ys, T* lons, T* lats)
+{
+    return prj.inv(par, count, xs, ys, lons, lats, 1, T(1));
+}
+
+/*
+    The steps of pj_transform() for a pair of source and destination
+    parameters, resolved once. Identity steps are left out: no inverse
+    projection for lat/long sources, no datum shift for equal or unknown
+    datums, and so on. The remaining steps are applied to blocks of points
+    which are kept in radians in between.
+
+    Geocentric source or destination coordinates and grid shifts are not
+    fused, is_fused() returns false for them and pj_transform() should be
+    used instead.
+*/
+template <typename T>
+class pj_transform_pipeline
+{
+public:
+    pj_transform_pipeline(parameters<T> const& srcdefn,
+                          parameters<T> const& dstdefn)
+        : m_fused(! srcdefn.is_geocent && ! dstdefn.is_geocent)
+        , m_identity(false)
+        , m_src_inverse(! srcdefn.is_latlong)
+        , m_dst_forward(! dstdefn.is_latlong)
+        , m_geocentric(false)
+        , m_long_wrap(dstdefn.is_latlong && dstdefn.is_long_wrap_set)
+        , m_src_vto_meter(srcdefn.vto_meter)
+        , m_dst_vfr_meter(dstdefn.vto_meter != 1.0 ? dstdefn.vfr_meter : T(1))
+        , m_src_from_greenwich(srcdefn.from_greenwich)
+        , m_dst_from_greenwich(dstdefn.from_greenwich)
+        , m_long_wrap_center(dstdefn.long_wrap_center)
+        , m_src_datum(srcdefn.datum_type)
+        , m_dst_datum(dstdefn.datum_type)
+        , m_src_helmert(pj_helmert_params<T>(srcdefn))
+        , m_dst_helmert(pj_helmert_params<T>(dstdefn))
+        , m_src_gi()
+        , m_dst_gi()
+    {
+        // See pj_datum_transform()
+        if (m_src_datum != datum_unknown
+            && m_dst_datum != datum_unknown
+            && ! pj_compare_datums(srcdefn, dstdefn))
+        {
+            if (m_src_datum == datum_gridshift || m_dst_datum == datum_gridshift)
+            {
+                m_fused = false;
+            }
+            else if (srcdefn.es_orig != dstdefn.es_orig
+                || srcdefn.a_orig != dstdefn.a_orig
+                || is_helmert(m_src_datum)
+                || is_helmert(m_dst_datum))
+            {
+                m_geocentric = true;
+                if (! init_geocentric(m_src_gi, srcdefn.a_orig, srcdefn.es_orig)
+                    || ! init_geocentric(m_dst_gi, dstdefn.a_orig, dstdefn.es_orig))
+                {
+                    m_fused = false;
+                }
+            }
+        }
+
+        m_identity = m_fused
+            && ! m_src_inverse && ! m_dst_forward
+            && ! m_geocentric && ! m_long_wrap
+            && m_src_vto_meter == 1.0 && m_dst_vfr_meter == 1.0
+            && m_src_from_greenwich == 0.0 && m_dst_from_greenwich == 0.0;
+    }
+
+    inline bool is_fused() const { return m_fused; }
+
+    // The coordinates of the points are not changed, e.g. for a transformation
+    // between two lat/long systems with the same datum
+    inline bool is_identity() const { return m_identity; }
+
+    // The points are in the same units as passed to pj_transform()
+    template <typename SrcPrj, typename DstPrj, typename Range>
+    inline bool apply(SrcPrj const& srcprj, DstPrj const& dstprj,
+                      Range & range) const
+    {
+        typedef typename boost::range_iterator<Range>::type iterator;
+
+        if (m_identity)
+        {
+            return true;
+        }
+
+        T x[pj_batch_size];
+        T y[pj_batch_size];
+        T lon[pj_batch_size];
+        T lat[pj_batch_size];
+        T z[pj_batch_size];
+        iterator points[pj_batch_size];
+
+        bool result = true;
+        iterator it = boost::begin(range);
+        iterator const end = boost::end(range);
+        while (it != end)
+        {
+            // Load the valid points of the next block
+            std::size_t count = 0;
+            for ( ; it != end && count < pj_batch_size ; ++it)
+            {
+                if (is_invalid_point(*it))
+                {
+                    continue;
+                }
+
+                if (m_src_inverse)
+                {
+                    x[count] = geometry::get<0>(*it);
+                    y[count] = geometry::get<1>(*it);
+                }
+                else
+                {
+                    lon[count] = geometry::get_as_radian<0>(*it);
+                    lat[count] = geometry::get_as_radian<1>(*it);
+                }
+                z[count] = get_z(*it) * m_src_vto_meter;
+                points[count++] = it;
+            }
+
+            // Points which can not be transformed get lon = HUGE_VAL
+            if (m_src_inverse)
+            {
+                pj_transform_inv_n(srcprj, srcprj.params(), count, x, y, lon, lat);
+            }
+
+            if (m_src_from_greenwich != 0.0)
+            {
+                add_longitude(count, lon, m_src_from_greenwich);
+            }
+            if (m_geocentric)
+            {
+                datum_shift(count, lon, lat, z, x, y);
+            }
+            if (m_dst_from_greenwich != 0.0)
+            {
+                add_longitude(count, lon, -m_dst_from_greenwich);
+            }
+            if (m_long_wrap)
+            {
+                wrap_longitude(count, lon);
+            }
+
+            if (m_dst_forward)
+            {
+                pj_transform_fwd_n(dstprj, dstprj.params(), count, lon, lat, x, y);
+            }
+
+            // Store the block
+            for (std::size_t i = 0; i < count; i++)
+            {
+                typename std::iterator_traits<iterator>::reference point = *points[i];
+                if ((m_dst_forward ? x[i] : lon[i]) == HUGE_VAL)
+                {
+                    set_invalid_point(point);
+                    result = false;
+                    continue;
+                }
+
+                if (m_dst_forward)
+                {
+                    geometry::set<0>(point, x[i]);
+                    geometry::set<1>(point, y[i]);
+                }
+                else
+                {
+                    geometry::set_from_radian<0>(point, lon[i]);
+                    geometry::set_from_radian<1>(point, lat[i]);
+                }
+                set_z(point, z[i] * m_dst_vfr_meter);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    static inline bool is_helmert(datum_type type)
+    {
+        return type == datum_3param || type == datum_7param;
+    }
+
+    static inline bool init_geocentric(GeocentricInfo<T> & gi,
+                                       T const& a, T const& es)
+    {
+        T const b = (es == 0.0) ? a : a * sqrt(1 - es);
+        return pj_Set_Geocentric_Parameters(gi, a, b) == 0;
+    }
+
+    // The steps are applied to the whole block, one after the other, like
+    // in pj_transform(). This is faster than applying all of them to one
+    // point after the other.
+
+    static inline void add_longitude(std::size_t count, T* lon, T const& offset)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (lon[i] != HUGE_VAL)
+            {
+                lon[i] += offset;
+            }
+        }
+    }
+
+    inline void wrap_longitude(std::size_t count, T* lon) const
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (lon[i] == HUGE_VAL)
+            {
+                continue;
+            }
+            while (lon[i] < m_long_wrap_center - math::pi<T>())
+                lon[i] += math::two_pi<T>();
+            while (lon[i] > m_long_wrap_center + math::pi<T>())
+                lon[i] -= math::two_pi<T>();
+        }
+    }
+
+    // See pj_datum_transform(), x and y are used as buffers. Each step is
+    // a loop over the block, see pj_Convert_Geodetic_To_Geocentric_n()
+    inline void datum_shift(std::size_t count, T* lon, T* lat, T* z,
+                            T* x, T* y) const
+    {
+        T gz[pj_batch_size];
+
+        // Points which can not be converted get lon = HUGE_VAL
+        pj_Convert_Geodetic_To_Geocentric_n(m_src_gi, count, lon, lat, z, x, y, gz);
+
+        if (is_helmert(m_src_datum))
+        {
+            pj_geocentric_to_wgs84_n(m_src_helmert, count, x, y, gz);
+        }
+        if (is_helmert(m_dst_datum))
+        {
+            pj_geocentric_from_wgs84_n(m_dst_helmert, count, x, y, gz);
+        }
+
+        pj_Convert_Geocentric_To_Geodetic_n(m_dst_gi, count, x, y, gz, lon, lat, z);
+    }
+
+    bool m_fused;
+    bool m_identity;
+    bool m_src_inverse;
+    bool m_dst_forward;
+    bool m_geocentric;
+    bool m_long_wrap;
+    T m_src_vto_meter;
+    T m_dst_vfr_meter;
+    T m_src_from_greenwich;
+    T m_dst_from_greenwich;
+    T m_long_wrap_center;
+    datum_type m_src_datum;
+    datum_type m_dst_datum;
+    pj_helmert<T> m_src_helmert;
+    pj_helmert<T> m_dst_helmert;
+    GeocentricInfo<T> m_src_gi;
+    GeocentricInfo<T> m_dst_gi;
+};
+
+} // namespace detail
+
+}}} // namespace boost::geometry::projections
+
+#endif // BOOST_GEOMETRY_SRS_PROJECTIONS_IMPL_PJ_TRANSFORM_PIPELINE_HPP
@@ -40,6 +40,7 @@
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PROJECTS_HPP
 
 
+#include <cstddef>
 #include <cstring>
 #include <string>
 #include <vector>
@@ -80,6 +81,9 @@ enum datum_type
 /* Maximum latitudinal overshoot accepted */
 //static const double pj_epsilon_lat = 1e-12;
 
+/* Number of coordinates projected at once by pj_fwd_n and pj_inv_n */
+static const std::size_t pj_batch_size = 256;
+
 template <typename T>
 struct pj_consts
 {
@@ -556,9 +556,9 @@ struct ellps_traits<spar::ellps<E> >
     }
 };
 
-// TODO: Implement as RadiusType-agnostic, member struct template defining model
-//       and function template returning it
-#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(NAME) \
+// The axes are constant expressions, the same as in pj_get_ellps(),
+// so static parameters need no lookup in the table of ellipsoids
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B(NAME, A, B) \
 template <> \
 struct ellps_traits<spar::NAME> \
 { \
@@ -568,13 +568,19 @@ struct ellps_traits<spar::NAME> \
         typedef srs::spheroid<T> type; \
     }; \
     template <typename T> \
+    static constexpr T a() { return T(A); } \
+    template <typename T> \
+    static constexpr T b() { return T(B); } \
+    template <typename T> \
     static srs::spheroid<T> model(spar::NAME const&) { \
-        return srs::spheroid<T>(projections::detail::pj_get_ellps<T>().first[dpar::NAME].a, \
-                                projections::detail::pj_get_ellps<T>().first[dpar::NAME].b); \
+        return srs::spheroid<T>(a<T>(), b<T>()); \
     } \
 };
 
-#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_SPHERE(NAME) \
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF(NAME, A, RF) \
+    BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B(NAME, A, projections::detail::b_from_a_rf(A, RF))
+
+#define BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_SPHERE(NAME, R) \
 template <> \
 struct ellps_traits<spar::NAME> \
 { \
@@ -584,54 +590,58 @@ struct ellps_traits<spar::NAME> \
         typedef srs::sphere<T> type; \
     }; \
     template <typename T> \
+    static constexpr T a() { return T(R); } \
+    template <typename T> \
+    static constexpr T b() { return T(R); } \
+    template <typename T> \
     static srs::sphere<T> model(spar::NAME const&) { \
-        return srs::sphere<T>(projections::detail::pj_get_ellps<T>().first[dpar::NAME].a); \
+        return srs::sphere<T>(a<T>()); \
     } \
 };
 
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_merit)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_sgs85)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_grs80)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_iau76)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_airy)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_apl4_9)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_nwl9d)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_mod_airy)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_andrae)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_aust_sa)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_grs67)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_bessel)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_bess_nam)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_clrk66)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_clrk80)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_clrk80ign)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_cpm)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_delmbr)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_engelis)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_evrst30)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_evrst48)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_evrst56)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_evrst69)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_evrstss)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_fschr60)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_fschr60m)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_fschr68)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_helmert)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_hough)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_intl)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_krass)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_kaula)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_lerch)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_mprts)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_new_intl)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_plessis)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_seasia)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_walbeck)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_wgs60)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_wgs66)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_wgs72)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS(ellps_wgs84)
-BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_SPHERE(ellps_sphere)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_merit,     6378137.0,    298.257)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_sgs85,     6378136.0,    298.257)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_grs80,     6378137.0,    298.257222101)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_iau76,     6378140.0,    298.257)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_airy,      6377563.396,  6356256.910)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_apl4_9,    6378137.0,    298.25)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_nwl9d,     6378145.0,    298.25)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_mod_airy,  6377340.189,  6356034.446)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_andrae,    6377104.43,   300.0)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_aust_sa,   6378160.0,    298.25)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_grs67,     6378160.0,    298.2471674270)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_bessel,    6377397.155,  299.1528128)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_bess_nam,  6377483.865,  299.1528128)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_clrk66,    6378206.4,    6356583.8)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_clrk80,    6378249.145,  293.4663)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_clrk80ign, 6378249.2,    293.4660212936269)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_cpm,       6375738.7,    334.29)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_delmbr,    6376428.0,    311.5)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_engelis,   6378136.05,   298.2566)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_evrst30,   6377276.345,  300.8017)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_evrst48,   6377304.063,  300.8017)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_evrst56,   6377301.243,  300.8017)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_evrst69,   6377295.664,  300.8017)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_evrstss,   6377298.556,  300.8017)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_fschr60,   6378166.0,    298.3)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_fschr60m,  6378155.0,    298.3)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_fschr68,   6378150.0,    298.3)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_helmert,   6378200.0,    298.3)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_hough,     6378270.0,    297.0)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_intl,      6378388.0,    297.0)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_krass,     6378245.0,    298.3)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_kaula,     6378163.0,    298.24)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_lerch,     6378139.0,    298.257)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_mprts,     6397300.0,    191.0)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_new_intl,  6378157.5,    6356772.2)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_plessis,   6376523.0,    6355863.0)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_seasia,    6378155.0,    6356773.3205)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_walbeck,   6376896.0,    6355834.8467)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_wgs60,     6378165.0,    298.3)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_wgs66,     6378145.0,    298.25)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_RF  (ellps_wgs72,     6378135.0,    298.26)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_ELLPS_B   (ellps_wgs84,     6378137.0,    6356752.3142451793)
+BOOST_GEOMETRY_PROJECTIONS_DETAIL_REGISTER_SPHERE    (ellps_sphere,    6370997.0)
 
 template <typename M>
 struct mode_traits
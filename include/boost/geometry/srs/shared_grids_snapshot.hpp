@@ -0,0 +1,117 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_SHARED_GRIDS_SNAPSHOT_HPP
+#define BOOST_GEOMETRY_SRS_SHARED_GRIDS_SNAPSHOT_HPP
+
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || defined(BOOST_NO_CXX11_HDR_MUTEX)
+#error "C++11 <atomic> and <mutex> headers required."
+#endif
+
+#include <boost/geometry/srs/projections/grids.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace boost { namespace geometry
+{
+
+namespace srs
+{
+
+// Grids shared by threads, loaded completely when they are initialized and
+// published in immutable snapshots. Readers take no lock, they load the
+// pointer to the current snapshot. A new snapshot is published for each
+// grid file added, the older ones are kept until the grids are destroyed.
+class shared_grids_snapshot
+{
+public:
+    // The grids of a snapshot are never modified, the snapshots published
+    // later contain the same grids at the same indexes followed by new ones
+    typedef std::vector<projections::detail::pj_gi *> snapshot_type;
+
+    shared_grids_snapshot()
+        : m_snapshot(NULL)
+    {}
+
+    shared_grids_snapshot(shared_grids_snapshot const&) = delete;
+    shared_grids_snapshot& operator=(shared_grids_snapshot const&) = delete;
+
+    std::size_t size() const
+    {
+        snapshot_type const* s = m_snapshot.load(std::memory_order_acquire);
+        return s == NULL ? 0 : s->size();
+    }
+
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    typedef projections::detail::shared_grids_snapshot_tag tag;
+
+    snapshot_type const& snapshot() const
+    {
+        static const snapshot_type empty_snapshot;
+        snapshot_type const* s = m_snapshot.load(std::memory_order_acquire);
+        return s == NULL ? empty_snapshot : *s;
+    }
+
+    struct write_locked
+    {
+        write_locked(shared_grids_snapshot & g)
+            : grids(g)
+            , lock(g.m_mutex)
+        {}
+
+        snapshot_type const& snapshot() const
+        {
+            return grids.snapshot();
+        }
+
+        // Moves the grids into the storage and publishes a new snapshot
+        void publish(projections::detail::pj_gridinfo & new_grids)
+        {
+            std::unique_ptr<snapshot_type> s(new snapshot_type(snapshot()));
+            for (std::size_t i = 0 ; i < new_grids.size() ; ++i)
+            {
+                grids.m_grids.push_back(projections::detail::pj_gi());
+                grids.m_grids.back().swap(new_grids[i]);
+                s->push_back(&grids.m_grids.back());
+            }
+            grids.m_snapshots.push_back(std::move(s));
+            grids.m_snapshot.store(grids.m_snapshots.back().get(),
+                                   std::memory_order_release);
+        }
+
+    private:
+        shared_grids_snapshot & grids;
+        std::lock_guard<std::mutex> lock;
+    };
+
+private:
+    std::atomic<snapshot_type const*> m_snapshot;
+    // Stable addresses of the grids and all published snapshots
+    std::deque<projections::detail::pj_gi> m_grids;
+    std::vector<std::unique_ptr<snapshot_type const> > m_snapshots;
+    std::mutex m_mutex;
+};
+
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_SHARED_GRIDS_SNAPSHOT_HPP
@@ -11,12 +11,15 @@
 #define BOOST_GEOMETRY_SRS_TRANSFORMATION_HPP
 
 
+#include <cstddef>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <boost/throw_exception.hpp>
 
 #include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
 
 #include <boost/geometry/core/coordinate_dimension.hpp>
 #include <boost/geometry/core/static_assert.hpp>
@@ -30,6 +33,7 @@
 #include <boost/geometry/srs/projection.hpp>
 #include <boost/geometry/srs/projections/grids.hpp>
 #include <boost/geometry/srs/projections/impl/pj_transform.hpp>
+#include <boost/geometry/srs/projections/impl/pj_transform_pipeline.hpp>
 
 #include <boost/geometry/views/detail/indexed_point_view.hpp>
 
@@ -285,30 +289,74 @@ private:
     OutGeometry & m_out;
 };
 
+// Transforms ranges of points with the pipeline resolved when the
+// transformation was constructed, or with pj_transform() if the steps
+// could not be fused
+template <typename Proj1, typename Proj2, typename Pipeline, typename Grids>
+struct transformer
+{
+    transformer(Proj1 const& proj1, Proj2 const& proj2,
+                Pipeline const& pipeline,
+                Grids const& grids1, Grids const& grids2)
+        : m_proj1(proj1)
+        , m_proj2(proj2)
+        , m_pipeline(pipeline)
+        , m_grids1(grids1)
+        , m_grids2(grids2)
+    {}
+
+    // NOTE: this has to be consistent with pj_transform()
+    bool input_angles() const
+    {
+        return ! m_proj1.params().is_geocent && m_proj1.params().is_latlong;
+    }
+
+    template <typename Range>
+    bool apply(Range & range) const
+    {
+        if (m_pipeline.is_fused())
+        {
+            return m_pipeline.apply(m_proj1, m_proj2, range);
+        }
+
+        return pj_transform(m_proj1, m_proj1.params(),
+                            m_proj2, m_proj2.params(),
+                            range, m_grids1, m_grids2);
+    }
+
+private:
+    Proj1 const& m_proj1;
+    Proj2 const& m_proj2;
+    Pipeline const& m_pipeline;
+    Grids const& m_grids1;
+    Grids const& m_grids2;
+};
+
+template <typename Proj1, typename Proj2, typename Pipeline, typename Grids>
+inline transformer<Proj1, Proj2, Pipeline, Grids>
+make_transformer(Proj1 const& proj1, Proj2 const& proj2,
+                 Pipeline const& pipeline,
+                 Grids const& grids1, Grids const& grids2)
+{
+    return transformer<Proj1, Proj2, Pipeline, Grids>(proj1, proj2, pipeline,
+                                                      grids1, grids2);
+}
+
 template <typename CT>
 struct transform_range
 {
-    template
-    <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
-        typename RangeIn, typename RangeOut,
-        typename Grids
-    >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
-                             RangeIn const& in, RangeOut & out,
-                             Grids const& grids1, Grids const& grids2)
+    template <typename Transformer, typename RangeIn, typename RangeOut>
+    static inline bool apply(Transformer const& transformer,
+                             RangeIn const& in, RangeOut & out)
     {
-        // NOTE: this has to be consistent with pj_transform()
-        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+        bool const input_angles = transformer.input_angles();
 
         transform_geometry_wrapper<RangeOut, CT> wrapper(in, out, input_angles);
 
         bool res = true;
         try
         {
-            res = pj_transform(proj1, par1, proj2, par2, wrapper.get(), grids1, grids2);
+            res = transformer.apply(wrapper.get());
         }
         catch (projection_exception const&)
         {
@@ -328,44 +376,27 @@ struct transform_range
 template <typename Policy>
 struct transform_multi
 {
-    template
-    <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
-        typename MultiIn, typename MultiOut,
-        typename Grids
-    >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
-                             MultiIn const& in, MultiOut & out,
-                             Grids const& grids1, Grids const& grids2)
+    template <typename Transformer, typename MultiIn, typename MultiOut>
+    static inline bool apply(Transformer const& transformer,
+                             MultiIn const& in, MultiOut & out)
     {
         if (! same_object(in, out))
             range::resize(out, boost::size(in));
 
-        return apply(proj1, par1, proj2, par2,
+        return apply(transformer,
                      boost::begin(in), boost::end(in),
-                     boost::begin(out),
-                     grids1, grids2);
+                     boost::begin(out));
     }
 
 private:
-    template
-    <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
-        typename InIt, typename OutIt,
-        typename Grids
-    >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
-                             InIt in_first, InIt in_last, OutIt out_first,
-                             Grids const& grids1, Grids const& grids2)
+    template <typename Transformer, typename InIt, typename OutIt>
+    static inline bool apply(Transformer const& transformer,
+                             InIt in_first, InIt in_last, OutIt out_first)
     {
         bool res = true;
         for ( ; in_first != in_last ; ++in_first, ++out_first )
         {
-            if ( ! Policy::apply(proj1, par1, proj2, par2, *in_first, *out_first, grids1, grids2) )
+            if ( ! Policy::apply(transformer, *in_first, *out_first) )
             {
                 res = false;
             }
@@ -387,20 +418,11 @@ struct transform
 template <typename Point, typename CT>
 struct transform<Point, CT, point_tag>
 {
-    template
-    <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
-        typename PointIn, typename PointOut,
-        typename Grids
-    >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
-                             PointIn const& in, PointOut & out,
-                             Grids const& grids1, Grids const& grids2)
+    template <typename Transformer, typename PointIn, typename PointOut>
+    static inline bool apply(Transformer const& transformer,
+                             PointIn const& in, PointOut & out)
     {
-        // NOTE: this has to be consistent with pj_transform()
-        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+        bool const input_angles = transformer.input_angles();
 
         transform_geometry_wrapper<PointOut, CT> wrapper(in, out, input_angles);
 
@@ -412,7 +434,7 @@ struct transform<Point, CT, point_tag>
         bool res = true;
         try
         {
-            res = pj_transform(proj1, par1, proj2, par2, range, grids1, grids2);
+            res = transformer.apply(range);
         }
         catch (projection_exception const&)
         {
@@ -437,20 +459,11 @@ struct transform<MultiPoint, CT, multi_point_tag>
 template <typename Segment, typename CT>
 struct transform<Segment, CT, segment_tag>
 {
-    template
-    <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
-        typename SegmentIn, typename SegmentOut,
-        typename Grids
-    >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
-                             SegmentIn const& in, SegmentOut & out,
-                             Grids const& grids1, Grids const& grids2)
+    template <typename Transformer, typename SegmentIn, typename SegmentOut>
+    static inline bool apply(Transformer const& transformer,
+                             SegmentIn const& in, SegmentOut & out)
     {
-        // NOTE: this has to be consistent with pj_transform()
-        bool const input_angles = !par1.is_geocent && par1.is_latlong;
+        bool const input_angles = transformer.input_angles();
 
         transform_geometry_wrapper<SegmentOut, CT> wrapper(in, out, input_angles);
 
@@ -469,7 +482,7 @@ struct transform<Segment, CT, segment_tag>
         bool res = true;
         try
         {
-            res = pj_transform(proj1, par1, proj2, par2, range, grids1, grids2);
+            res = transformer.apply(range);
         }
         catch (projection_exception const&)
         {
@@ -507,32 +520,22 @@ struct transform<Ring, CT, ring_tag>
 template <typename Polygon, typename CT>
 struct transform<Polygon, CT, polygon_tag>
 {
-    template
-    <
-        typename Proj1, typename Par1,
-        typename Proj2, typename Par2,
-        typename PolygonIn, typename PolygonOut,
-        typename Grids
-    >
-    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
-                             Proj2 const& proj2, Par2 const& par2,
-                             PolygonIn const& in, PolygonOut & out,
-                             Grids const& grids1, Grids const& grids2)
+    template <typename Transformer, typename PolygonIn, typename PolygonOut>
+    static inline bool apply(Transformer const& transformer,
+                             PolygonIn const& in, PolygonOut & out)
     {
         bool r1 = transform_range
                     <
                         CT
-                    >::apply(proj1, par1, proj2, par2,
+                    >::apply(transformer,
                              geometry::exterior_ring(in),
-                             geometry::exterior_ring(out),
-                             grids1, grids2);
+                             geometry::exterior_ring(out));
         bool r2 = transform_multi
                     <
                         transform_range<CT>
-                     >::apply(proj1, par1, proj2, par2,
+                     >::apply(transformer,
                               geometry::interior_rings(in),
-                              geometry::interior_rings(out),
-                              grids1, grids2);
+                              geometry::interior_rings(out));
         return r1 && r2;
     }
 };
@@ -551,6 +554,227 @@ struct transform<MultiPolygon, CT, multi_polygon_tag>
 {};
 
 
+
+// Number of points transformed together by one thread, each block is
+// copied into its own buffer
+static const std::size_t parallel_block_size = 4096;
+
+template <typename Range>
+inline bool all_succeeded(Range const& results)
+{
+    for (char r : results)
+    {
+        if (! r)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Transforms the points of a range in blocks, distributed over threads.
+// The output has the order and closure of the input, otherwise the range
+// is transformed sequentially.
+template
+<
+    typename CT,
+    typename RangeIn,
+    typename RangeOut,
+    bool Indexed = geometry::point_order<RangeIn>::value == geometry::point_order<RangeOut>::value
+                && geometry::closure<RangeIn>::value == geometry::closure<RangeOut>::value
+>
+struct transform_range_parallel
+{
+    template <typename Transformer>
+    static inline bool apply(Transformer const& transformer,
+                             RangeIn const& in, RangeOut & out,
+                             std::size_t thread_count)
+    {
+        typedef typename transform_geometry_point<RangeOut, CT>::type point_type;
+
+        std::size_t const count = boost::size(in);
+        if (! same_object(in, out))
+            range::resize(out, count);
+
+        if (geometry::detail::parallel::thread_count(thread_count, count) <= 1
+         || count <= parallel_block_size)
+        {
+            return transform_range<CT>::apply(transformer, in, out);
+        }
+
+        bool const input_angles = transformer.input_angles();
+        std::vector<char> results((count + parallel_block_size - 1) / parallel_block_size, 1);
+
+        geometry::detail::parallel::for_each_block(count, thread_count,
+            parallel_block_size,
+            [&](std::size_t first, std::size_t last)
+            {
+                std::vector<point_type> buffer(last - first);
+                for (std::size_t i = first; i < last; i++)
+                {
+                    transform_geometry_point<RangeOut, CT>::apply(
+                        range::at(in, i), buffer[i - first], input_angles);
+                }
+
+                std::pair<point_type *, point_type *> block
+                    = std::make_pair(buffer.data(), buffer.data() + buffer.size());
+
+                bool res = true;
+                try
+                {
+                    res = transformer.apply(block);
+                }
+                catch (projection_exception const&)
+                {
+                    res = false;
+                }
+
+                for (std::size_t i = first; i < last; i++)
+                {
+                    geometry::convert(buffer[i - first], range::at(out, i));
+                }
+                results[first / parallel_block_size] = res;
+            });
+
+        return all_succeeded(results);
+    }
+};
+
+template <typename CT, typename RangeIn, typename RangeOut>
+struct transform_range_parallel<CT, RangeIn, RangeOut, false>
+{
+    template <typename Transformer>
+    static inline bool apply(Transformer const& transformer,
+                             RangeIn const& in, RangeOut & out,
+                             std::size_t )
+    {
+        return transform_range<CT>::apply(transformer, in, out);
+    }
+};
+
+// Transforms the elements of a multi geometry, distributed over threads
+template <typename Policy>
+struct transform_multi_parallel
+{
+    template <typename Transformer, typename MultiIn, typename MultiOut>
+    static inline bool apply(Transformer const& transformer,
+                             MultiIn const& in, MultiOut & out,
+                             std::size_t thread_count)
+    {
+        std::size_t const count = boost::size(in);
+        if (! same_object(in, out))
+            range::resize(out, count);
+
+        std::vector<char> results(count, 1);
+
+        geometry::detail::parallel::for_each_index(count, thread_count,
+            [&](std::size_t i)
+            {
+                results[i] = Policy::apply(transformer,
+                                           range::at(in, i), range::at(out, i));
+            });
+
+        return all_succeeded(results);
+    }
+};
+
+// Points and segments are transformed sequentially
+template
+<
+    typename Geometry,
+    typename CT,
+    typename Tag = typename geometry::tag<Geometry>::type
+>
+struct transform_parallel
+{
+    template <typename Transformer, typename GeometryIn, typename GeometryOut>
+    static inline bool apply(Transformer const& transformer,
+                             GeometryIn const& in, GeometryOut & out,
+                             std::size_t )
+    {
+        return transform<Geometry, CT>::apply(transformer, in, out);
+    }
+};
+
+template <typename CT>
+struct transform_parallel_range
+{
+    template <typename Transformer, typename RangeIn, typename RangeOut>
+    static inline bool apply(Transformer const& transformer,
+                             RangeIn const& in, RangeOut & out,
+                             std::size_t thread_count)
+    {
+        return transform_range_parallel
+            <
+                CT, RangeIn, RangeOut
+            >::apply(transformer, in, out, thread_count);
+    }
+};
+
+template <typename MultiPoint, typename CT>
+struct transform_parallel<MultiPoint, CT, multi_point_tag>
+    : transform_parallel_range<CT>
+{};
+
+template <typename Linestring, typename CT>
+struct transform_parallel<Linestring, CT, linestring_tag>
+    : transform_parallel_range<CT>
+{};
+
+template <typename Ring, typename CT>
+struct transform_parallel<Ring, CT, ring_tag>
+    : transform_parallel_range<CT>
+{};
+
+template <typename MultiLinestring, typename CT>
+struct transform_parallel<MultiLinestring, CT, multi_linestring_tag>
+    : transform_multi_parallel<transform_range<CT> >
+{};
+
+// The exterior ring is divided into blocks, the interior rings are
+// distributed over the threads
+template <typename Polygon, typename CT>
+struct transform_parallel<Polygon, CT, polygon_tag>
+{
+    template <typename Transformer, typename PolygonIn, typename PolygonOut>
+    static inline bool apply(Transformer const& transformer,
+                             PolygonIn const& in, PolygonOut & out,
+                             std::size_t thread_count)
+    {
+        bool r1 = transform_range_parallel
+                    <
+                        CT,
+                        typename geometry::ring_type<PolygonIn>::type,
+                        typename geometry::ring_type<PolygonOut>::type
+                    >::apply(transformer,
+                             geometry::exterior_ring(in),
+                             geometry::exterior_ring(out),
+                             thread_count);
+        bool r2 = transform_multi_parallel
+                    <
+                        transform_range<CT>
+                    >::apply(transformer,
+                             geometry::interior_rings(in),
+                             geometry::interior_rings(out),
+                             thread_count);
+        return r1 && r2;
+    }
+};
+
+template <typename MultiPolygon, typename CT>
+struct transform_parallel<MultiPolygon, CT, multi_polygon_tag>
+    : transform_multi_parallel
+        <
+            transform
+                <
+                    typename boost::range_value<MultiPolygon>::type,
+                    CT,
+                    polygon_tag
+                >
+        >
+{};
+
+
 }} // namespace projections::detail
     
 namespace srs
@@ -578,6 +802,8 @@ class transformation
 public:
     // Both static and default constructed
     transformation()
+        : m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     // First dynamic, second static and default constructed
@@ -593,11 +819,15 @@ public:
     >
     explicit transformation(Parameters1 const& parameters1)
         : m_proj1(parameters1)
+        , m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     // First static, second static and default constructed
     explicit transformation(Proj1 const& parameters1)
         : m_proj1(parameters1)
+        , m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     // Both dynamic
@@ -617,6 +847,8 @@ public:
                    Parameters2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     // First dynamic, second static
@@ -634,6 +866,8 @@ public:
                    Proj2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     // First static, second dynamic
@@ -651,6 +885,8 @@ public:
                    Parameters2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     // Both static
@@ -658,6 +894,8 @@ public:
                    Proj2 const& parameters2)
         : m_proj1(parameters1)
         , m_proj2(parameters2)
+        , m_forward(m_proj1.proj().params(), m_proj2.proj().params())
+        , m_inverse(m_proj2.proj().params(), m_proj1.proj().params())
     {}
 
     template <typename GeometryIn, typename GeometryOut>
@@ -685,11 +923,10 @@ public:
                 <
                     GeometryOut,
                     calc_t
-                >::apply(m_proj1.proj(), m_proj1.proj().params(),
-                         m_proj2.proj(), m_proj2.proj().params(),
-                         in, out,
-                         grids.src_grids,
-                         grids.dst_grids);
+                >::apply(projections::detail::make_transformer(
+                            m_proj1.proj(), m_proj2.proj(), m_forward,
+                            grids.src_grids, grids.dst_grids),
+                         in, out);
     }
 
     template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
@@ -705,11 +942,80 @@ public:
                 <
                     GeometryOut,
                     calc_t
-                >::apply(m_proj2.proj(), m_proj2.proj().params(),
-                         m_proj1.proj(), m_proj1.proj().params(),
-                         in, out,
-                         grids.dst_grids,
-                         grids.src_grids);
+                >::apply(projections::detail::make_transformer(
+                            m_proj2.proj(), m_proj1.proj(), m_inverse,
+                            grids.dst_grids, grids.src_grids),
+                         in, out);
+    }
+
+    /*!
+    \brief Transforms a geometry forward, using several threads
+    \details The points of large linestrings, rings, multi points and
+        exterior rings are transformed in blocks, each block in its own
+        buffer. The elements of multi geometries and the interior rings of
+        polygons are distributed over the threads. Points and segments are
+        transformed sequentially. The results are the same as of forward().
+        0 threads means as many as the hardware supports, 1 (the default)
+        means sequentially, as for transform_all.
+    */
+    template <typename GeometryIn, typename GeometryOut>
+    bool forward_parallel(GeometryIn const& in, GeometryOut & out,
+                          std::size_t thread_count = 1) const
+    {
+        return forward_parallel(in, out,
+                                transformation_grids<detail::empty_grids_storage>(),
+                                thread_count);
+    }
+
+    //! Transforms a geometry inverse, using several threads
+    template <typename GeometryIn, typename GeometryOut>
+    bool inverse_parallel(GeometryIn const& in, GeometryOut & out,
+                          std::size_t thread_count = 1) const
+    {
+        return inverse_parallel(in, out,
+                                transformation_grids<detail::empty_grids_storage>(),
+                                thread_count);
+    }
+
+    //! The grids are accessed by several threads, so shared grids should be used
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool forward_parallel(GeometryIn const& in, GeometryOut & out,
+                          transformation_grids<GridsStorage> const& grids,
+                          std::size_t thread_count = 1) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(projections::detail::make_transformer(
+                            m_proj1.proj(), m_proj2.proj(), m_forward,
+                            grids.src_grids, grids.dst_grids),
+                         in, out, thread_count);
+    }
+
+    template <typename GeometryIn, typename GeometryOut, typename GridsStorage>
+    bool inverse_parallel(GeometryIn const& in, GeometryOut & out,
+                          transformation_grids<GridsStorage> const& grids,
+                          std::size_t thread_count = 1) const
+    {
+        BOOST_GEOMETRY_STATIC_ASSERT(
+            (projections::detail::same_tags<GeometryIn, GeometryOut>::value),
+            "Not supported combination of Geometries.",
+            GeometryIn, GeometryOut);
+
+        return projections::detail::transform_parallel
+                <
+                    GeometryOut,
+                    calc_t
+                >::apply(projections::detail::make_transformer(
+                            m_proj2.proj(), m_proj1.proj(), m_inverse,
+                            grids.dst_grids, grids.src_grids),
+                         in, out, thread_count);
     }
 
     template <typename GridsStorage>
@@ -729,6 +1035,9 @@ public:
 private:
     projections::proj_wrapper<Proj1, CT> m_proj1;
     projections::proj_wrapper<Proj2, CT> m_proj2;
+    // The steps from proj1 to proj2 and back, resolved once
+    projections::detail::pj_transform_pipeline<calc_t> m_forward;
+    projections::detail::pj_transform_pipeline<calc_t> m_inverse;
 };
 
 
@@ -0,0 +1,245 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_AGNOSTIC_BUFFER_DISTANCE_PER_VERTEX_HPP
+#define BOOST_GEOMETRY_STRATEGIES_AGNOSTIC_BUFFER_DISTANCE_PER_VERTEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace buffer
+{
+
+
+/*!
+\brief Let the buffer use a different distance at each vertex
+\ingroup strategies
+\tparam NumericType \tparam_numeric
+\tparam DistanceFunction Function object returning the distance
+    (of type NumericType) for a point, which is a vertex of the input
+\details This strategy can be used as DistanceStrategy for the buffer algorithm.
+    It can be applied for all geometries. It calls the DistanceFunction for
+    each vertex of the input. The sides of the buffer then taper from the
+    distance at their first vertex to the distance at their second vertex,
+    joins and ends are generated with the distance at their vertex.
+    A tapered side is offset along the common tangent of the circles at
+    its two vertices, so it connects to round joins and ends without notches.
+    With flat ends, the end is then shifted along the last segment, by
+    the buffer distance times the sine of the angle of the tangent.
+    The buffer is smaller than the union of the circles around the input,
+    if the distance of two consecutive vertices differs more than the
+    length of their segment (then there is no tangent and the side is
+    perpendicular to the segment), and at concave vertices where the
+    distance is larger than at both neighbouring vertices.
+    So the buffer is created in one pass, instead of buffering each segment
+    separately and unioning the results.
+    The distances should all be positive, or all be negative. They should
+    be within the specified minimum and maximum. If they are negative and used
+    with a (multi)polygon or ring, the polygon will be deflated.
+    The function is also called for intersection points of the buffer,
+    which are not a vertex of the input.
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.buffer.buffer_7_with_strategies buffer (with strategies)]
+\* [link geometry.reference.strategies.strategy_buffer_distance_symmetric distance_symmetric]
+\* [link geometry.reference.strategies.strategy_buffer_distance_asymmetric distance_asymmetric]
+}
+ */
+template<typename NumericType, typename DistanceFunction>
+class distance_per_vertex
+{
+public :
+    //! \brief Constructs the strategy
+    //! \param function The function returning the distance for a vertex
+    //! \param min_distance The smallest distance the function returns
+    //! \param max_distance The largest distance the function returns
+    distance_per_vertex(DistanceFunction const& function,
+                NumericType const& min_distance,
+                NumericType const& max_distance)
+        : m_function(function)
+        , m_min(min_distance)
+        , m_max(max_distance)
+    {
+        BOOST_GEOMETRY_ASSERT(! (m_min < 0 && m_max > 0));
+    }
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    //! Returns the distance-value at the vertex
+    template <typename Point>
+    inline NumericType apply(Point const& vertex,
+                buffer_side_selector )  const
+    {
+        NumericType const result = m_function(vertex);
+        return negative() ? geometry::math::abs(result) : result;
+    }
+
+    //! Returns the distance-value at the first point, used for points
+    //! and for strategies not asking the distance per vertex
+    template <typename Point>
+    inline NumericType apply(Point const& p, Point const& ,
+                buffer_side_selector side)  const
+    {
+        return apply(p, side);
+    }
+
+    //! Used internally, returns -1 for deflate, 1 for inflate
+    inline int factor() const
+    {
+        return negative() ? -1 : 1;
+    }
+
+    //! Returns true if the distances are negative (aka deflate)
+    inline bool negative() const
+    {
+        return m_max < 0;
+    }
+
+    //! Returns the max distance distance up to the buffer will reach
+    template <typename JoinStrategy, typename EndStrategy>
+    inline NumericType max_distance(JoinStrategy const& join_strategy,
+            EndStrategy const& end_strategy) const
+    {
+        boost::ignore_unused(join_strategy, end_strategy);
+
+        NumericType const dist = (std::max)(geometry::math::abs(m_min),
+                                            geometry::math::abs(m_max));
+        return (std::max)(join_strategy.max_distance(dist),
+                          end_strategy.max_distance(dist));
+    }
+
+    //! Returns the distance at which the input is simplified before the buffer process
+    inline NumericType simplify_distance() const
+    {
+        return (std::min)(geometry::math::abs(m_min),
+                          geometry::math::abs(m_max)) / 1000.0;
+    }
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private :
+    DistanceFunction m_function;
+    NumericType m_min;
+    NumericType m_max;
+};
+
+
+#ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
+template <typename NumericType, typename DistanceFunction>
+struct is_distance_per_vertex<distance_per_vertex<NumericType, DistanceFunction> >
+    : std::true_type
+{};
+#endif
+
+
+/*!
+\brief Function object to be used with distance_per_vertex, looking up
+    the distance of each vertex in a table
+\ingroup strategies
+\tparam Point \tparam_point
+\tparam NumericType \tparam_numeric
+\details The table is constructed from a range of points and a range with
+    the distance of each point, for example the points of a linestring and
+    a range with the same number of distances. Points which are not in the
+    table get the distance with the largest absolute value.
+ */
+template<typename Point, typename NumericType = double>
+class vertex_distances
+{
+    typedef std::pair<Point, NumericType> entry_type;
+
+    struct less_by_point
+    {
+        inline bool operator()(entry_type const& left, entry_type const& right) const
+        {
+            return geometry::less<Point>()(left.first, right.first);
+        }
+    };
+
+public :
+    //! \brief Constructs the table
+    //! \param points The points, for example of a linestring
+    //! \param distances The distance of each point (in the same order)
+    template <typename Points, typename Distances>
+    vertex_distances(Points const& points, Distances const& distances)
+        : m_min(0)
+        , m_max(0)
+    {
+        typename boost::range_iterator<Distances const>::type
+            dit = boost::begin(distances);
+        for (typename boost::range_iterator<Points const>::type
+                pit = boost::begin(points);
+             pit != boost::end(points) && dit != boost::end(distances);
+             ++pit, ++dit)
+        {
+            NumericType const distance = *dit;
+            if (m_entries.empty() || distance < m_min)
+            {
+                m_min = distance;
+            }
+            if (m_entries.empty() || distance > m_max)
+            {
+                m_max = distance;
+            }
+            m_entries.push_back(entry_type(*pit, distance));
+        }
+
+        // A point occurring more than once gets its first distance
+        std::stable_sort(m_entries.begin(), m_entries.end(), less_by_point());
+    }
+
+    //! Returns the distance of the specified point
+    inline NumericType operator()(Point const& point) const
+    {
+        typename std::vector<entry_type>::const_iterator it
+            = std::lower_bound(m_entries.begin(), m_entries.end(),
+                               entry_type(point, NumericType()),
+                               less_by_point());
+        if (it != m_entries.end()
+            && ! geometry::less<Point>()(point, it->first))
+        {
+            return it->second;
+        }
+        return geometry::math::abs(m_min) > geometry::math::abs(m_max)
+            ? m_min : m_max;
+    }
+
+    //! Returns the smallest distance in the table
+    inline NumericType min_distance() const { return m_min; }
+
+    //! Returns the largest distance in the table
+    inline NumericType max_distance() const { return m_max; }
+
+private :
+    std::vector<entry_type> m_entries;
+    NumericType m_min;
+    NumericType m_max;
+};
+
+
+}} // namespace strategy::buffer
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_AGNOSTIC_BUFFER_DISTANCE_PER_VERTEX_HPP
@@ -153,6 +153,100 @@ inline void sort(Range& range, Less const& less)
     std::sort(boost::begin(range), boost::end(range), less);
 }
 
+
+template <int Factor, typename Point, typename Container, typename SideStrategy>
+inline void add_to_hull(Point const& p, Container& output,
+                        SideStrategy const& side)
+{
+    output.push_back(p);
+    std::size_t output_size = output.size();
+    while (output_size >= 3)
+    {
+        auto rit = output.rbegin();
+        Point const last = *rit++;
+        Point const& last2 = *rit++;
+
+        if (Factor * side.apply(*rit, last, last2) <= 0)
+        {
+            // Remove last two points from stack, and add last again
+            // This is much faster then erasing the one but last.
+            output.pop_back();
+            output.pop_back();
+            output.push_back(last);
+            output_size--;
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+
+// Builds the lower (Factor -1) or upper (Factor 1) half of the hull
+// from the sorted points between left and right
+template <int Factor, typename Container, typename Point, typename SideStrategy>
+inline void build_half_hull(Container const& input, Container& output,
+                            Point const& left, Point const& right,
+                            SideStrategy const& side)
+{
+    output.push_back(left);
+    for (auto it = boost::begin(input); it != boost::end(input); ++it)
+    {
+        add_to_hull<Factor>(*it, output, side);
+    }
+    add_to_hull<Factor>(right, output, side);
+}
+
+
+template <typename Container, typename OutputIterator>
+inline void output_ranges(Container const& first, Container const& second,
+                          OutputIterator out, bool closed)
+{
+    std::copy(boost::begin(first), boost::end(first), out);
+
+    BOOST_GEOMETRY_ASSERT(closed ? !boost::empty(second) : boost::size(second) > 1);
+    std::copy(++boost::rbegin(second), // skip the first Point
+              closed ? boost::rend(second) : --boost::rend(second), // skip the last Point if open
+              out);
+
+    typedef typename boost::range_size<Container>::type size_type;
+    size_type const count = boost::size(first) + boost::size(second) - 1;
+    // count describes a closed case but comparison with min size of closed
+    // gives the result compatible also with open
+    // here core_detail::closure::minimum_ring_size<closed> could be used
+    if (count < 4)
+    {
+        // there should be only one missing
+        *out++ = *boost::begin(first);
+    }
+}
+
+
+/*!
+\brief The lower and upper half of a hull, both from the most left
+    to the most right point, as state of hull strategies
+*/
+template <typename Point>
+struct hull_halves
+{
+    std::vector<Point> m_lower_hull;
+    std::vector<Point> m_upper_hull;
+
+    template <typename OutputIterator>
+    inline void result(OutputIterator out, bool clockwise, bool closed) const
+    {
+        if (clockwise)
+        {
+            output_ranges(m_upper_hull, m_lower_hull, out, closed);
+        }
+        else
+        {
+            output_ranges(m_lower_hull, m_upper_hull, out, closed);
+        }
+    }
+};
+
 } // namespace detail
 #endif // DOXYGEN_NO_DETAIL
 
@@ -173,25 +267,12 @@ private:
     typedef typename cs_tag<point_type>::type cs_tag;
 
     typedef typename std::vector<point_type> container_type;
-    typedef typename std::vector<point_type>::const_iterator iterator;
-    typedef typename std::vector<point_type>::const_reverse_iterator rev_iterator;
-
-
-    class partitions
-    {
-        friend class graham_andrew;
-
-        container_type m_lower_hull;
-        container_type m_upper_hull;
-        container_type m_copied_input;
-    };
-
 
 public:
-    typedef partitions state_type;
+    typedef detail::hull_halves<point_type> state_type;
 
 
-    inline void apply(InputGeometry const& geometry, partitions& state) const
+    inline void apply(InputGeometry const& geometry, state_type& state) const
     {
         // First pass.
         // Get min/max (in most cases left / right) points
@@ -231,99 +312,22 @@ public:
         detail::sort(upper_points, less);
 
         // And decide which point should be in the final hull
-        build_half_hull<-1>(lower_points, state.m_lower_hull,
-                            most_left, most_right,
-                            side);
-        build_half_hull<1>(upper_points, state.m_upper_hull,
-                           most_left, most_right,
-                           side);
+        detail::build_half_hull<-1>(lower_points, state.m_lower_hull,
+                                    most_left, most_right,
+                                    side);
+        detail::build_half_hull<1>(upper_points, state.m_upper_hull,
+                                   most_left, most_right,
+                                   side);
     }
 
 
     template <typename OutputIterator>
-    inline void result(partitions const& state,
+    inline void result(state_type const& state,
                        OutputIterator out,
                        bool clockwise,
                        bool closed) const
     {
-        if (clockwise)
-        {
-            output_ranges(state.m_upper_hull, state.m_lower_hull, out, closed);
-        }
-        else
-        {
-            output_ranges(state.m_lower_hull, state.m_upper_hull, out, closed);
-        }
-    }
-
-
-private:
-
-    template <int Factor, typename SideStrategy>
-    static inline void build_half_hull(container_type const& input,
-            container_type& output,
-            point_type const& left, point_type const& right,
-            SideStrategy const& side)
-    {
-        output.push_back(left);
-        for(iterator it = input.begin(); it != input.end(); ++it)
-        {
-            add_to_hull<Factor>(*it, output, side);
-        }
-        add_to_hull<Factor>(right, output, side);
-    }
-
-
-    template <int Factor, typename SideStrategy>
-    static inline void add_to_hull(point_type const& p, container_type& output,
-                                   SideStrategy const& side)
-    {
-        output.push_back(p);
-        std::size_t output_size = output.size();
-        while (output_size >= 3)
-        {
-            rev_iterator rit = output.rbegin();
-            point_type const last = *rit++;
-            point_type const& last2 = *rit++;
-
-            if (Factor * side.apply(*rit, last, last2) <= 0)
-            {
-                // Remove last two points from stack, and add last again
-                // This is much faster then erasing the one but last.
-                output.pop_back();
-                output.pop_back();
-                output.push_back(last);
-                output_size--;
-            }
-            else
-            {
-                return;
-            }
-        }
-    }
-
-
-    template <typename OutputIterator>
-    static inline void output_ranges(container_type const& first, container_type const& second,
-                                     OutputIterator out, bool closed)
-    {
-        std::copy(boost::begin(first), boost::end(first), out);
-
-        BOOST_GEOMETRY_ASSERT(closed ? !boost::empty(second) : boost::size(second) > 1);
-        std::copy(++boost::rbegin(second), // skip the first Point
-                  closed ? boost::rend(second) : --boost::rend(second), // skip the last Point if open
-                  out);
-
-        typedef typename boost::range_size<container_type>::type size_type;
-        size_type const count = boost::size(first) + boost::size(second) - 1;
-        // count describes a closed case but comparison with min size of closed
-        // gives the result compatible also with open
-        // here core_detail::closure::minimum_ring_size<closed> could be used
-        if (count < 4)
-        {
-            // there should be only one missing
-            *out++ = *boost::begin(first);
-        }
+        state.result(out, clockwise, closed);
     }
 };
 
@@ -19,15 +19,20 @@
 #define BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_DOUGLAS_PEUCKER_HPP
 
 
+#include <algorithm>
 #include <cstddef>
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
 #include <iostream>
 #endif
+#include <utility>
 #include <vector>
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
 
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/strategies/distance.hpp>
 
@@ -48,29 +53,49 @@ namespace strategy { namespace simplify
 namespace detail
 {
 
-    /*!
-        \brief Small wrapper around a point, with an extra member "included"
-        \details
-            It has a const-reference to the original point (so no copy here)
-        \tparam the enclosed point type
-    */
-    template<typename Point>
-    struct douglas_peucker_point
+    // Handles a part of a range, and the parts resulting from it, using an
+    // explicit stack instead of recursion. A part is a pair of the indices
+    // of its first and last point, split(part, candidate) returns true if
+    // the part is split at candidate. Of the two resulting parts, the
+    // larger part is pushed first, such that the smaller part is handled
+    // first. Then all parts above a part on the stack come from a sibling
+    // of at most half of their parent, and the stack holds at most
+    // log2(n) + 1 parts, wherever the parts are split.
+    // Returns the largest number of parts on the stack.
+    template <typename Split>
+    inline std::size_t douglas_peucker_split_parts(
+            std::pair<std::size_t, std::size_t> const& part,
+            Split const& split)
     {
-        Point const& p;
-        bool included;
-
-        inline douglas_peucker_point(Point const& ap)
-            : p(ap)
-            , included(false)
-        {}
+        typedef std::pair<std::size_t, std::size_t> part_type;
 
-        // Necessary for proper compilation
-        inline douglas_peucker_point<Point> operator=(douglas_peucker_point<Point> const& )
+        std::vector<part_type> stack(1, part);
+        std::size_t max_size = 1;
+        while (! stack.empty())
         {
-            return douglas_peucker_point<Point>(*this);
+            part_type const current = stack.back();
+            stack.pop_back();
+
+            std::size_t candidate = 0;
+            if (split(current, candidate))
+            {
+                part_type const first_part(current.first, candidate);
+                part_type const second_part(candidate, current.second);
+                if (candidate - current.first < current.second - candidate)
+                {
+                    stack.push_back(second_part);
+                    stack.push_back(first_part);
+                }
+                else
+                {
+                    stack.push_back(first_part);
+                    stack.push_back(second_part);
+                }
+                max_size = (std::max)(max_size, stack.size());
+            }
         }
-    };
+        return max_size;
+    }
 
     template
     <
@@ -111,93 +136,199 @@ namespace detail
         {}
 
     private :
-        typedef detail::douglas_peucker_point<Point> dp_point_type;
-        typedef typename std::vector<dp_point_type>::iterator iterator_type;
-
+        // Range of indices, of the first and the last point of a part
+        typedef std::pair<std::size_t, std::size_t> part_type;
 
         LessCompare const& less() const
         {
             return *this;
         }
 
-        inline void consider(iterator_type begin,
-                             iterator_type end,
-                             distance_type const& max_dist,
-                             int& n,
-                             distance_strategy_type const& ps_distance_strategy) const
+        // Finds the point furthest from the segment between the first and
+        // the last point of the part, within [from, to)
+        template <typename Iterator>
+        inline void furthest(Iterator begin, part_type const& part,
+                             std::size_t from, std::size_t to,
+                             distance_strategy_type const& ps_distance_strategy,
+                             distance_type& max_dist,
+                             std::size_t& candidate) const
         {
-            std::size_t size = end - begin;
+            Point const& first = *(begin + part.first);
+            Point const& last = *(begin + part.second);
 
-            // size must be at least 3
-            // because we want to consider a candidate point in between
-            if (size <= 2)
+            max_dist = distance_type(-1.0); // any value < 0
+            for (std::size_t i = from; i < to; i++)
             {
+                distance_type const dist
+                    = ps_distance_strategy.apply(*(begin + i), first, last);
+
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                if (begin != end)
+                std::cout << "consider " << dsv(*(begin + i))
+                    << " at " << double(dist) << std::endl;
+#endif
+                if (less()(max_dist, dist))
                 {
-                    std::cout << "ignore between " << dsv(begin->p)
-                        << " and " << dsv((end - 1)->p)
-                        << " size=" << size << std::endl;
+                    max_dist = dist;
+                    candidate = i;
                 }
-                std::cout << "return because size=" << size << std::endl;
-#endif
-                return;
+            }
+        }
+
+        // Returns true if a point of the part is further away than the
+        // specified distance. Large parts are scanned in parallel.
+        template <typename Iterator>
+        inline bool split(Iterator begin, part_type const& part,
+                          distance_type const& max_dist,
+                          distance_strategy_type const& ps_distance_strategy,
+                          std::size_t thread_count,
+                          std::size_t& candidate) const
+        {
+            std::size_t const from = part.first + 1;
+            std::size_t const to = part.second;
+            if (to <= from)
+            {
+                return false;
             }
 
-            iterator_type last = end - 1;
+            distance_type md;
+            std::size_t const grain = 1 << 16;
+            if (thread_count == 1 || to - from <= grain)
+            {
+                furthest(begin, part, from, to, ps_distance_strategy,
+                         md, candidate);
+                return less()(max_dist, md);
+            }
 
+            // Every block finds its furthest point, then the first of the
+            // furthest points of the blocks is taken, like it is sequentially
+            std::size_t const block_count = (to - from + grain - 1) / grain;
+            std::vector<distance_type> block_dist(block_count);
+            std::vector<std::size_t> block_candidate(block_count);
+            geometry::detail::parallel::for_each_block(block_count,
+                thread_count, 1,
+                [&](std::size_t first_block, std::size_t last_block)
+                {
+                    for (std::size_t b = first_block; b < last_block; b++)
+                    {
+                        std::size_t const block_from = from + b * grain;
+                        furthest(begin, part, block_from,
+                                 (std::min)(block_from + grain, to),
+                                 ps_distance_strategy,
+                                 block_dist[b], block_candidate[b]);
+                    }
+                });
+
+            md = block_dist.front();
+            candidate = block_candidate.front();
+            for (std::size_t b = 1; b < block_count; b++)
+            {
+                if (less()(md, block_dist[b]))
+                {
+                    md = block_dist[b];
+                    candidate = block_candidate[b];
+                }
+            }
+            return less()(max_dist, md);
+        }
+
+        // Handles the part, and the parts resulting from it. The order
+        // does not matter, the included points are marked by their index.
+        template <typename Iterator, typename Visitor>
+        inline void consider(Iterator begin, part_type const& part,
+                             distance_type const& max_dist,
+                             distance_strategy_type const& ps_distance_strategy,
+                             Visitor& include) const
+        {
+            douglas_peucker_split_parts(part,
+                [&](part_type const& current, std::size_t& candidate)
+                {
+                    if (! split(begin, current, max_dist, ps_distance_strategy,
+                                1, candidate))
+                    {
+                        return false;
+                    }
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-            std::cout << "find between " << dsv(begin->p)
-                << " and " << dsv(last->p)
-                << " size=" << size << std::endl;
+                    std::cout << "use " << dsv(*(begin + candidate)) << std::endl;
 #endif
+                    include(candidate);
+                    return true;
+                });
+        }
 
-
-            // Find most far point, compare to the current segment
-            //geometry::segment<Point const> s(begin->p, last->p);
-            distance_type md(-1.0); // any value < 0
-            iterator_type candidate;
-            for(iterator_type it = begin + 1; it != last; ++it)
+        struct include_in_bitset
+        {
+            std::vector<bool>& included;
+            inline void operator()(std::size_t index) const
             {
-                distance_type dist = ps_distance_strategy.apply(it->p, begin->p, last->p);
+                included[index] = true;
+            }
+        };
 
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "consider " << dsv(it->p)
-                    << " at " << double(dist)
-                    << ((dist > max_dist) ? " maybe" : " no")
-                    << std::endl;
+        struct include_in_list
+        {
+            std::vector<std::size_t>& indices;
+            inline void operator()(std::size_t index) const
+            {
+                indices.push_back(index);
+            }
+        };
 
-#endif
-                if ( less()(md, dist) )
+        // Splits the parts level by level, scanning large parts in parallel,
+        // until there are enough parts to handle them in parallel
+        template <typename Iterator>
+        inline void consider_parallel(Iterator begin, std::size_t size,
+                             distance_type const& max_dist,
+                             distance_strategy_type const& ps_distance_strategy,
+                             std::size_t thread_count,
+                             std::vector<bool>& included) const
+        {
+            std::size_t const min_part_count = thread_count * 8;
+            std::vector<part_type> parts(1, part_type(0, size - 1));
+            while (! parts.empty() && parts.size() < min_part_count)
+            {
+                std::vector<part_type> next_parts;
+                for (part_type const& part : parts)
                 {
-                    md = dist;
-                    candidate = it;
+                    std::size_t candidate = 0;
+                    if (split(begin, part, max_dist, ps_distance_strategy,
+                              thread_count, candidate))
+                    {
+                        included[candidate] = true;
+                        next_parts.push_back(part_type(part.first, candidate));
+                        next_parts.push_back(part_type(candidate, part.second));
+                    }
                 }
+                parts.swap(next_parts);
             }
 
-            // If a point is found, set the include flag
-            // and handle segments in between recursively
-            if ( less()(max_dist, md) )
-            {
-#ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
-                std::cout << "use " << dsv(candidate->p) << std::endl;
-#endif
-
-                candidate->included = true;
-                n++;
+            // Threads may not write to the same bitset,
+            // so every part collects its indices separately
+            std::vector<std::vector<std::size_t> > indices(parts.size());
+            geometry::detail::parallel::for_each_index(parts.size(),
+                thread_count,
+                [&](std::size_t i)
+                {
+                    include_in_list include = { indices[i] };
+                    consider(begin, parts[i], max_dist,
+                             ps_distance_strategy, include);
+                });
 
-                consider(begin, candidate + 1, max_dist, n, ps_distance_strategy);
-                consider(candidate, end, max_dist, n, ps_distance_strategy);
+            for (std::vector<std::size_t> const& list : indices)
+            {
+                for (std::size_t index : list)
+                {
+                    included[index] = true;
+                }
             }
         }
 
-
     public :
 
         template <typename Range, typename OutputIterator>
         inline OutputIterator apply(Range const& range,
                                     OutputIterator out,
-                                    distance_type max_distance) const
+                                    distance_type max_distance,
+                                    std::size_t thread_count = 1) const
         {
 #ifdef BOOST_GEOMETRY_DEBUG_DOUGLAS_PEUCKER
                 std::cout << "max distance: " << max_distance
@@ -205,32 +336,44 @@ namespace detail
 #endif
             distance_strategy_type strategy;
 
-            // Copy coordinates, a vector of references to all points
-            std::vector<dp_point_type> ref_candidates(boost::begin(range),
-                            boost::end(range));
+            // The range is random access, the points are accessed by index
+            // and only one bit per point is kept
+            typename boost::range_iterator<Range const>::type const
+                begin = boost::begin(range);
+            std::size_t const size = boost::size(range);
+            if (size == 0)
+            {
+                return out;
+            }
 
             // Include first and last point of line,
             // they are always part of the line
-            int n = 2;
-            ref_candidates.front().included = true;
-            ref_candidates.back().included = true;
+            std::vector<bool> included(size, false);
+            included.front() = true;
+            included.back() = true;
 
-            // Get points, recursively, including them if they are further away
+            // Get points, including them if they are further away
             // than the specified distance
-            consider(boost::begin(ref_candidates), boost::end(ref_candidates), max_distance, n, strategy);
+            thread_count = geometry::detail::parallel::thread_count(
+                thread_count, size);
+            if (thread_count > 1)
+            {
+                consider_parallel(begin, size, max_distance, strategy,
+                                  thread_count, included);
+            }
+            else
+            {
+                include_in_bitset include = { included };
+                consider(begin, part_type(0, size - 1), max_distance,
+                         strategy, include);
+            }
 
             // Copy included elements to the output
-            for(typename std::vector<dp_point_type>::const_iterator it
-                            = boost::begin(ref_candidates);
-                it != boost::end(ref_candidates);
-                ++it)
+            for (std::size_t i = 0; i < size; i++)
             {
-                if (it->included)
+                if (included[i])
                 {
-                    // copy-coordinates does not work because OutputIterator
-                    // does not model Point (??)
-                    //geometry::convert(it->p, *out);
-                    *out = it->p;
+                    *out = *(begin + i);
                     out++;
                 }
             }
@@ -303,18 +446,83 @@ public :
 
 };
 
-}} // namespace strategy::simplify
-
 
-namespace traits {
+/*!
+\brief Implements the simplify algorithm, using several threads.
+\ingroup strategies
+\details The parallel_douglas_peucker strategy simplifies a linestring, ring
+    or vector of points using the Douglas-Peucker algorithm, resulting in the
+    same output as the douglas_peucker strategy. The furthest point of large
+    parts of the range is searched in parallel, and when the range is split
+    into enough parts, these parts are simplified in parallel. It only pays
+    off for ranges of many (hundreds of thousands) points.
+\tparam Point the point type
+\tparam PointDistanceStrategy point-segment distance strategy to be used
+\note Without thread support (or with BOOST_GEOMETRY_NO_THREADS defined)
+    it is the same as the douglas_peucker strategy
 
-template <typename P>
-struct point_type<geometry::strategy::simplify::detail::douglas_peucker_point<P> >
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.simplify.simplify_4_with_strategy simplify (with strategy)]
+}
+*/
+template
+<
+    typename Point,
+    typename PointDistanceStrategy
+>
+class parallel_douglas_peucker
 {
-    typedef P type;
+public :
+
+    typedef PointDistanceStrategy distance_strategy_type;
+
+    typedef typename detail::douglas_peucker
+        <
+            Point,
+            PointDistanceStrategy
+        >::distance_type distance_type;
+
+    /*!
+    \brief Constructor
+    \param thread_count the maximal number of threads, 0 means as many
+        as the hardware supports, 1 (the default) means sequentially
+    */
+    explicit parallel_douglas_peucker(std::size_t thread_count = 1)
+        : m_thread_count(thread_count)
+    {}
+
+    template <typename Range, typename OutputIterator>
+    inline OutputIterator apply(Range const& range,
+                                OutputIterator out,
+                                distance_type const& max_distance) const
+    {
+        namespace services = strategy::distance::services;
+
+        typedef typename services::comparable_type
+            <
+                PointDistanceStrategy
+            >::type comparable_distance_strategy_type;
+
+        return detail::douglas_peucker
+            <
+                Point, comparable_distance_strategy_type
+            >().apply(range, out,
+                      services::result_from_distance
+                          <
+                              comparable_distance_strategy_type, Point, Point
+                          >::apply(comparable_distance_strategy_type(),
+                                   max_distance),
+                      m_thread_count);
+    }
+
+private :
+    std::size_t m_thread_count;
 };
 
-} // namespace traits
+}} // namespace strategy::simplify
+
+
 
 
 }} // namespace boost::geometry
@@ -0,0 +1,218 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_RADIAL_DISTANCE_HPP
+#define BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_RADIAL_DISTANCE_HPP
+
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/strategies/distance.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace simplify
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+    template
+    <
+        typename Point,
+        typename PointDistanceStrategy
+    >
+    struct radial_distance_filter
+    {
+        typedef typename strategy::distance::services::return_type
+                         <
+                             PointDistanceStrategy,
+                             Point, Point
+                         >::type distance_type;
+
+        // Outputs the first point, and then each point which is further
+        // than the specified distance from the previous point in the output,
+        // and the last point
+        template <typename Range, typename OutputIterator>
+        static inline OutputIterator apply(Range const& range,
+                                           OutputIterator out,
+                                           distance_type const& max_distance)
+        {
+            typedef typename boost::range_iterator<Range const>::type iterator_type;
+
+            PointDistanceStrategy strategy;
+
+            iterator_type it = boost::begin(range);
+            iterator_type const end = boost::end(range);
+            if (it == end)
+            {
+                return out;
+            }
+
+            iterator_type previous = it;
+            *out = *it;
+            out++;
+
+            for (++it; it != end; ++it)
+            {
+                iterator_type next = it;
+                bool const is_last = ++next == end;
+
+                // Point-segment distance of a degenerate segment results
+                // in the point-point distance
+                if (is_last
+                    || max_distance < strategy.apply(*it, *previous, *previous))
+                {
+                    previous = it;
+                    *out = *it;
+                    out++;
+                }
+            }
+            return out;
+        }
+    };
+
+    template <typename Strategy>
+    struct radial_distance_next
+    {
+        template
+        <
+            typename Point,
+            typename Filter,
+            typename Range,
+            typename OutputIterator,
+            typename ComparableDistance,
+            typename Distance
+        >
+        static inline OutputIterator apply(Range const& range,
+                                           OutputIterator out,
+                                           ComparableDistance const& comparable_distance,
+                                           Distance const& max_distance)
+        {
+            std::vector<Point> filtered;
+            Filter::apply(range, std::back_inserter(filtered),
+                          comparable_distance);
+            if (filtered.size() <= 2)
+            {
+                return std::copy(filtered.begin(), filtered.end(), out);
+            }
+            return Strategy().apply(filtered, out, max_distance);
+        }
+    };
+
+    template <>
+    struct radial_distance_next<void>
+    {
+        template
+        <
+            typename Point,
+            typename Filter,
+            typename Range,
+            typename OutputIterator,
+            typename ComparableDistance,
+            typename Distance
+        >
+        static inline OutputIterator apply(Range const& range,
+                                           OutputIterator out,
+                                           ComparableDistance const& comparable_distance,
+                                           Distance const& )
+        {
+            return Filter::apply(range, out, comparable_distance);
+        }
+    };
+
+}
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Implements the simplify algorithm.
+\ingroup strategies
+\details The radial_distance strategy simplifies a linestring, ring or
+    vector of points by removing each point which is closer than the
+    specified distance to the previous point which is kept. The first
+    and the last point are always kept. It visits each point once, and
+    is therefore much cheaper than the other simplify strategies. It can
+    be used as a prefilter, before another strategy, which is then applied
+    to the remaining points with the same distance. For example with
+    Douglas-Peucker, this significantly reduces the time for densely
+    sampled input, because most points are removed by the prefilter.
+\tparam Point the point type
+\tparam PointDistanceStrategy point-segment distance strategy to be used,
+    it is used with a degenerate segment to get the point-point distance
+\tparam Strategy the simplify strategy to be applied after the prefilter,
+    or void to apply only the radial distance filter
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.simplify.simplify_4_with_strategy simplify (with strategy)]
+}
+*/
+template
+<
+    typename Point,
+    typename PointDistanceStrategy,
+    typename Strategy = void
+>
+class radial_distance
+{
+public :
+
+    typedef PointDistanceStrategy distance_strategy_type;
+
+    typedef typename detail::radial_distance_filter
+        <
+            Point,
+            PointDistanceStrategy
+        >::distance_type distance_type;
+
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       distance_type const& max_distance)
+    {
+        namespace services = strategy::distance::services;
+
+        typedef typename services::comparable_type
+            <
+                PointDistanceStrategy
+            >::type comparable_distance_strategy_type;
+
+        typedef detail::radial_distance_filter
+            <
+                Point, comparable_distance_strategy_type
+            > filter_type;
+
+        typename filter_type::distance_type const comparable_distance
+            = services::result_from_distance
+                <
+                    comparable_distance_strategy_type, Point, Point
+                >::apply(comparable_distance_strategy_type(), max_distance);
+
+        return detail::radial_distance_next
+            <
+                Strategy
+            >::template apply<Point, filter_type>(range, out,
+                comparable_distance, max_distance);
+    }
+
+};
+
+}} // namespace strategy::simplify
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_RADIAL_DISTANCE_HPP
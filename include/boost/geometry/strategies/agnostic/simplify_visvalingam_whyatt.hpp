@@ -0,0 +1,346 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+#define BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/strategies/distance.hpp>
+#include <boost/geometry/strategy/area.hpp>
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace simplify
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+    template
+    <
+        typename Point,
+        typename PointDistanceStrategy
+    >
+    class visvalingam_whyatt
+    {
+    public :
+
+        typedef PointDistanceStrategy distance_strategy_type;
+
+        typedef typename strategy::distance::services::return_type
+                         <
+                             distance_strategy_type,
+                             Point, Point
+                         >::type distance_type;
+
+    private :
+
+        // Vertex with its effective area, in the heap
+        struct vertex_area
+        {
+            distance_type area;
+            std::size_t index;
+
+            inline vertex_area(distance_type const& a, std::size_t i)
+                : area(a)
+                , index(i)
+            {}
+
+            // The smallest area is on top of the heap,
+            // and for equal areas the first vertex
+            inline bool operator<(vertex_area const& other) const
+            {
+                return area < other.area
+                    || (area == other.area && index < other.index);
+            }
+        };
+
+        // Binary min-heap, keeping the position of each vertex in the heap
+        // such that the area of a vertex can be updated in place. So the heap
+        // never contains more entries than vertices.
+        class vertex_heap
+        {
+        public :
+            inline vertex_heap(std::vector<vertex_area> const& entries,
+                               std::size_t size)
+                : m_entries(entries)
+                , m_positions(size, 0)
+            {
+                for (std::size_t i = 0; i < m_entries.size(); i++)
+                {
+                    m_positions[m_entries[i].index] = i;
+                }
+                for (std::size_t i = m_entries.size() / 2; i > 0; i--)
+                {
+                    sift_down(i - 1);
+                }
+            }
+
+            inline bool empty() const { return m_entries.empty(); }
+            inline vertex_area const& top() const { return m_entries.front(); }
+
+            inline void pop()
+            {
+                move(m_entries.size() - 1, 0);
+                m_entries.pop_back();
+                if (! m_entries.empty())
+                {
+                    sift_down(0);
+                }
+            }
+
+            inline void update(std::size_t index, distance_type const& area)
+            {
+                std::size_t const position = m_positions[index];
+                bool const smaller = area < m_entries[position].area;
+                m_entries[position].area = area;
+                if (smaller)
+                {
+                    sift_up(position);
+                }
+                else
+                {
+                    sift_down(position);
+                }
+            }
+
+        private :
+            inline void move(std::size_t from, std::size_t to)
+            {
+                m_entries[to] = m_entries[from];
+                m_positions[m_entries[to].index] = to;
+            }
+
+            inline void sift_up(std::size_t position)
+            {
+                vertex_area const entry = m_entries[position];
+                while (position > 0)
+                {
+                    std::size_t const parent = (position - 1) / 2;
+                    if (! (entry < m_entries[parent]))
+                    {
+                        break;
+                    }
+                    move(parent, position);
+                    position = parent;
+                }
+                m_entries[position] = entry;
+                m_positions[entry.index] = position;
+            }
+
+            inline void sift_down(std::size_t position)
+            {
+                vertex_area const entry = m_entries[position];
+                std::size_t const size = m_entries.size();
+                for (;;)
+                {
+                    std::size_t child = 2 * position + 1;
+                    if (child >= size)
+                    {
+                        break;
+                    }
+                    if (child + 1 < size
+                        && m_entries[child + 1] < m_entries[child])
+                    {
+                        child++;
+                    }
+                    if (! (m_entries[child] < entry))
+                    {
+                        break;
+                    }
+                    move(child, position);
+                    position = child;
+                }
+                m_entries[position] = entry;
+                m_positions[entry.index] = position;
+            }
+
+            std::vector<vertex_area> m_entries;
+            std::vector<std::size_t> m_positions;
+        };
+
+        typedef typename strategy::area::services::default_strategy
+            <
+                typename cs_tag<Point>::type
+            >::type area_strategy_type;
+
+        // The area of the triangle formed by a vertex and its neighbours.
+        // It is calculated by the area strategy of the coordinate system,
+        // and not from distances, because the distance strategy can be
+        // a comparable strategy (e.g. returning squared distances)
+        static inline distance_type triangle_area(Point const& previous,
+                    Point const& point, Point const& next,
+                    area_strategy_type const& strategy)
+        {
+            typename area_strategy_type::template state<Point> state;
+            strategy.apply(previous, point, state);
+            strategy.apply(point, next, state);
+            strategy.apply(next, previous, state);
+            return geometry::math::abs(distance_type(strategy.result(state)));
+        }
+
+    public :
+
+        template <typename Range, typename OutputIterator>
+        inline OutputIterator apply(Range const& range,
+                                    OutputIterator out,
+                                    distance_type const& max_area) const
+        {
+            area_strategy_type strategy;
+
+            std::vector<Point const*> points;
+            for (typename boost::range_iterator<Range const>::type
+                    it = boost::begin(range); it != boost::end(range); ++it)
+            {
+                points.push_back(&(*it));
+            }
+
+            std::size_t const size = points.size();
+            if (size <= 2)
+            {
+                return std::copy(boost::begin(range), boost::end(range), out);
+            }
+
+            // Links to the neighbours of the vertices which are not removed
+            std::vector<std::size_t> previous(size);
+            std::vector<std::size_t> next(size);
+            std::vector<bool> removed(size, false);
+
+            std::vector<vertex_area> initial;
+            initial.reserve(size - 2);
+            for (std::size_t i = 1; i + 1 < size; i++)
+            {
+                previous[i] = i - 1;
+                next[i] = i + 1;
+                initial.push_back(vertex_area(triangle_area(*points[i - 1],
+                    *points[i], *points[i + 1], strategy), i));
+            }
+            next[0] = 1;
+            previous[size - 1] = size - 2;
+
+            vertex_heap heap(initial, size);
+
+            while (! heap.empty() && heap.top().area < max_area)
+            {
+                vertex_area const top = heap.top();
+                heap.pop();
+                removed[top.index] = true;
+
+                std::size_t const p = previous[top.index];
+                std::size_t const n = next[top.index];
+                next[p] = n;
+                previous[n] = p;
+
+                // Recalculate the areas of the neighbours. They never get
+                // a smaller area than the vertex just removed, otherwise
+                // they would be removed before vertices with a smaller area
+                // which were already removed
+                if (p > 0)
+                {
+                    heap.update(p, (std::max)(top.area, triangle_area(
+                        *points[previous[p]], *points[p], *points[n], strategy)));
+                }
+                if (n + 1 < size)
+                {
+                    heap.update(n, (std::max)(top.area, triangle_area(
+                        *points[p], *points[n], *points[next[n]], strategy)));
+                }
+            }
+
+            for (std::size_t i = 0; i < size; i++)
+            {
+                if (! removed[i])
+                {
+                    *out = *points[i];
+                    out++;
+                }
+            }
+            return out;
+        }
+    };
+
+}
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Implements the simplify algorithm.
+\ingroup strategies
+\details The visvalingam_whyatt strategy simplifies a linestring, ring or
+    vector of points using the Visvalingam-Whyatt algorithm. It repeatedly
+    removes the vertex with the smallest effective area, the area of the
+    triangle it forms with its two neighbours, until all remaining vertices
+    have an effective area of at least the square of the specified
+    distance. It uses a priority queue and runs in O(n log n). It removes
+    small details more evenly than Douglas-Peucker, which makes it suitable
+    for generalization for several zoom levels.
+\tparam Point the point type
+\tparam PointDistanceStrategy point-segment distance strategy to be used,
+    its distance type is the type of the effective area, which is calculated
+    with the default area strategy of the coordinate system
+\note The specified distance is the side of a square with the area below
+    which vertices are removed
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.simplify.simplify_4_with_strategy simplify (with strategy)]
+}
+*/
+
+/*
+For the algorithm, see:
+ - M. Visvalingam and J.D. Whyatt, Line generalisation by repeated
+   elimination of points, The Cartographic Journal 30 (1), 1993
+*/
+template
+<
+    typename Point,
+    typename PointDistanceStrategy
+>
+class visvalingam_whyatt
+{
+public :
+
+    typedef PointDistanceStrategy distance_strategy_type;
+
+    typedef typename detail::visvalingam_whyatt
+        <
+            Point,
+            PointDistanceStrategy
+        >::distance_type distance_type;
+
+    template <typename Range, typename OutputIterator>
+    static inline OutputIterator apply(Range const& range,
+                                       OutputIterator out,
+                                       distance_type const& max_distance)
+    {
+        return detail::visvalingam_whyatt
+            <
+                Point, PointDistanceStrategy
+            >().apply(range, out, max_distance * max_distance);
+    }
+
+};
+
+}} // namespace strategy::simplify
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGY_AGNOSTIC_SIMPLIFY_VISVALINGAM_WHYATT_HPP
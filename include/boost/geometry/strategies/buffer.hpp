@@ -9,6 +9,8 @@
 #ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_HPP
 #define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_HPP
 
+#include <type_traits>
+
 namespace boost { namespace geometry
 {
 
@@ -83,6 +85,25 @@ enum join_selector
     join_spike     // collinear, with overlap, next segment goes back
 };
 
+/*!
+\brief Enumerates how the round buffer strategies (join_round, end_round,
+    point_circle) calculate the points on their circles
+\ingroup enum
+\details With circle_by_table the cosines and sines of the angles between
+    consecutive points are tabulated once for each points_per_circle, and
+    the points are generated by rotating a vector (a complex multiplication).
+    The points of point_circle and end_round then differ from the points
+    calculated by cos and sin by less than points_per_circle * 1e-15 times
+    the buffer distance. The points of join_round are placed at the
+    tabulated angles from the start of the join, instead of dividing the
+    join into equal angles, so its last step can be smaller.
+*/
+enum circle_generation
+{
+    circle_by_trigonometry,
+    circle_by_table
+};
+
 /*!
 \brief Enumerates types of result codes from buffer strategies
 \ingroup enum
@@ -94,10 +115,69 @@ enum result_code
     result_no_output
 };
 
+/*!
+\brief Traits class indicating if a DistanceStrategy has a distance per vertex
+\ingroup strategies
+\details A DistanceStrategy returns the distance for a segment with
+    apply(p1, p2, side). A strategy for which this trait is true also has
+    apply(vertex, side), returning the distance at one vertex. The side
+    strategies then use the distance at both vertices of a segment, and joins
+    and ends the distance at their vertex. Other strategies are called with
+    the two points of the segment, as before.
+*/
+template <typename DistanceStrategy>
+struct is_distance_per_vertex : std::false_type
+{};
+
 
 }} // namespace strategy::buffer
 
 
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+template <bool PerVertex>
+struct distance_at_vertex_dispatch
+{
+    template <typename DistanceStrategy, typename Point>
+    static inline auto apply(DistanceStrategy const& distance,
+            Point const& p1, Point const& p2, Point const& ,
+            strategy::buffer::buffer_side_selector side)
+    {
+        return distance.apply(p1, p2, side);
+    }
+};
+
+template <>
+struct distance_at_vertex_dispatch<true>
+{
+    template <typename DistanceStrategy, typename Point>
+    static inline auto apply(DistanceStrategy const& distance,
+            Point const& , Point const& , Point const& vertex,
+            strategy::buffer::buffer_side_selector side)
+    {
+        return distance.apply(vertex, side);
+    }
+};
+
+// Returns the distance at a vertex of the segment (p1, p2). For a strategy
+// without a distance per vertex, it is the distance of the segment.
+template <typename DistanceStrategy, typename Point>
+inline auto distance_at_vertex(DistanceStrategy const& distance,
+        Point const& p1, Point const& p2, Point const& vertex,
+        strategy::buffer::buffer_side_selector side)
+{
+    return distance_at_vertex_dispatch
+        <
+            strategy::buffer::is_distance_per_vertex<DistanceStrategy>::value
+        >::apply(distance, p1, p2, vertex, side);
+}
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_HPP
@@ -71,8 +71,10 @@ public :
             double
         >::type promoted_type;
 
-        promoted_type const dist_left = distance.apply(penultimate_point, ultimate_point, buffer_side_left);
-        promoted_type const dist_right = distance.apply(penultimate_point, ultimate_point, buffer_side_right);
+        promoted_type const dist_left = geometry::detail::buffer::distance_at_vertex(
+            distance, penultimate_point, ultimate_point, ultimate_point, buffer_side_left);
+        promoted_type const dist_right = geometry::detail::buffer::distance_at_vertex(
+            distance, penultimate_point, ultimate_point, ultimate_point, buffer_side_right);
 
         bool reversed = (side == buffer_side_left && dist_right < 0 && -dist_right > dist_left)
                     || (side == buffer_side_right && dist_left < 0 && -dist_left > dist_right)
@@ -14,7 +14,11 @@
 #ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_END_ROUND_HPP
 #define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_END_ROUND_HPP
 
-#include <boost/core/ignore_unused.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#include <boost/range/value_type.hpp>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/strategies/tags.hpp>
@@ -22,6 +26,7 @@
 #include <boost/geometry/util/select_most_precise.hpp>
 
 #include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_unit_circle.hpp>
 
 
 #include <boost/geometry/io/wkt/wkt.hpp>
@@ -56,6 +61,7 @@ class end_round
 {
 private :
     std::size_t m_points_per_circle;
+    std::shared_ptr<geometry::detail::buffer::unit_circle const> m_table;
 
     template
     <
@@ -79,6 +85,26 @@ private :
         point_buffer_count /= 2;
         point_buffer_count++;
 
+        if (m_table)
+        {
+            // Rotate the first vector over the tabulated angles
+            PromotedType const cos_alpha = cos(alpha);
+            PromotedType const sin_alpha = sin(alpha);
+            for (std::size_t i = 0; i < point_buffer_count; i++)
+            {
+                PromotedType x = cos_alpha;
+                PromotedType y = sin_alpha;
+                geometry::detail::buffer::rotate(x, y, PromotedType(m_table->cos_at(i)),
+                               PromotedType(m_table->sin_at(i)));
+
+                typename boost::range_value<RangeOut>::type p;
+                set<0>(p, get<0>(point) + buffer_distance * x);
+                set<1>(p, get<1>(point) + buffer_distance * y);
+                range_out.push_back(p);
+            }
+            return;
+        }
+
         for (std::size_t i = 0; i < point_buffer_count; i++, alpha -= diff)
         {
             typename boost::range_value<RangeOut>::type p;
@@ -88,6 +114,71 @@ private :
         }
     }
 
+    // Generates the points of an arc around point, from the angle of
+    // from_point clockwise to the angle of to_point
+    template
+    <
+        typename Point,
+        typename PromotedType,
+        typename DistanceType,
+        typename RangeOut
+    >
+    inline void generate_arc(Point const& point,
+                Point const& from_point,
+                Point const& to_point,
+                DistanceType const& buffer_distance,
+                RangeOut& range_out) const
+    {
+        PromotedType const two_pi = geometry::math::two_pi<PromotedType>();
+
+        PromotedType const angle1 = calculate_angle<PromotedType>(from_point, point);
+        PromotedType angle2 = calculate_angle<PromotedType>(to_point, point);
+        while (angle2 > angle1)
+        {
+            angle2 -= two_pi;
+        }
+        PromotedType const angle_diff = angle1 - angle2;
+
+        std::size_t const n = (std::max)(static_cast<std::size_t>(
+            ceil(m_points_per_circle * angle_diff / two_pi)), std::size_t(1));
+
+        range_out.push_back(from_point);
+
+        if (m_table)
+        {
+            // Rotate the unit vector towards from_point over the tabulated
+            // angles, the last step (to to_point) is at most one table step
+            PromotedType const dx = get<0>(from_point) - get<0>(point);
+            PromotedType const dy = get<1>(from_point) - get<1>(point);
+            PromotedType const length = geometry::math::sqrt(dx * dx + dy * dy);
+            for (std::size_t i = 1; i < n; i++)
+            {
+                PromotedType x = dx / length;
+                PromotedType y = dy / length;
+                geometry::detail::buffer::rotate(x, y, PromotedType(m_table->cos_at(i)),
+                               PromotedType(m_table->sin_at(i)));
+
+                typename boost::range_value<RangeOut>::type p;
+                set<0>(p, get<0>(point) + buffer_distance * x);
+                set<1>(p, get<1>(point) + buffer_distance * y);
+                range_out.push_back(p);
+            }
+            range_out.push_back(to_point);
+            return;
+        }
+
+        PromotedType const diff = angle_diff / static_cast<PromotedType>(n);
+        PromotedType a = angle1 - diff;
+        for (std::size_t i = 1; i < n; i++, a -= diff)
+        {
+            typename boost::range_value<RangeOut>::type p;
+            set<0>(p, get<0>(point) + buffer_distance * cos(a));
+            set<1>(p, get<1>(point) + buffer_distance * sin(a));
+            range_out.push_back(p);
+        }
+        range_out.push_back(to_point);
+    }
+
     template <typename T, typename P1, typename P2>
     static inline T calculate_angle(P1 const& from_point, P2 const& to_point)
     {
@@ -102,8 +193,12 @@ public :
     //! \brief Constructs the strategy
     //! \param points_per_circle points which would be used for a full circle
     //! (if points_per_circle is smaller than 4, it is internally set to 4)
-    explicit inline end_round(std::size_t points_per_circle = 90)
+    //! \param generation circle_by_table to generate the points from
+    //! a table calculated once, instead of calling cos and sin per point
+    explicit inline end_round(std::size_t points_per_circle = 90,
+                              circle_generation generation = circle_by_trigonometry)
         : m_points_per_circle((points_per_circle < 4u) ? 4u : points_per_circle)
+        , m_table(geometry::detail::buffer::unit_circle::create(generation, m_points_per_circle))
     {}
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -118,7 +213,6 @@ public :
                 DistanceStrategy const& distance,
                 RangeOut& range_out) const
     {
-        boost::ignore_unused(perp_left_point);
         typedef typename coordinate_type<Point>::type coordinate_type;
 
         typedef typename geometry::select_most_precise
@@ -127,13 +221,24 @@ public :
             double
         >::type promoted_type;
 
-        promoted_type const dist_left = distance.apply(penultimate_point, ultimate_point, buffer_side_left);
-        promoted_type const dist_right = distance.apply(penultimate_point, ultimate_point, buffer_side_right);
+        promoted_type const dist_left = geometry::detail::buffer::distance_at_vertex(
+            distance, penultimate_point, ultimate_point, ultimate_point, buffer_side_left);
+        promoted_type const dist_right = geometry::detail::buffer::distance_at_vertex(
+            distance, penultimate_point, ultimate_point, ultimate_point, buffer_side_right);
         promoted_type const alpha
                 = calculate_angle<promoted_type>(penultimate_point, ultimate_point)
                     - geometry::math::half_pi<promoted_type>();
 
-        if (geometry::math::equals(dist_left, dist_right))
+        if (is_distance_per_vertex<DistanceStrategy>::value
+            && geometry::math::equals(dist_left, dist_right))
+        {
+            // The sides are tapered and their ends are not perpendicular
+            // to the segment, so the arc is generated between their ends
+            generate_arc<Point, promoted_type>(ultimate_point,
+                perp_left_point, perp_right_point, dist_left, range_out);
+            return;
+        }
+        else if (geometry::math::equals(dist_left, dist_right))
         {
             generate_points(ultimate_point, alpha, dist_left, range_out);
         }
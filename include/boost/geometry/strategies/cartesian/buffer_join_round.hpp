@@ -15,10 +15,13 @@
 #define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_JOIN_ROUND_HPP
 
 #include <algorithm>
+#include <cstddef>
+#include <memory>
 
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/policies/compare.hpp>
 #include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_unit_circle.hpp>
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/select_most_precise.hpp>
 
@@ -59,8 +62,13 @@ public :
 
     //! \brief Constructs the strategy
     //! \param points_per_circle points which would be used for a full circle
-    explicit inline join_round(std::size_t points_per_circle = 90)
+    //! \param generation circle_by_table to generate the points from
+    //! a table calculated once, instead of calling cos and sin per point
+    explicit inline join_round(std::size_t points_per_circle = 90,
+                               circle_generation generation = circle_by_trigonometry)
         : m_points_per_circle(points_per_circle)
+        , m_table(geometry::detail::buffer::unit_circle::create(generation,
+                    (std::max)(points_per_circle, std::size_t(1))))
     {}
 
 private :
@@ -103,6 +111,26 @@ private :
         std::size_t const n = (std::max)(static_cast<std::size_t>(
             ceil(m_points_per_circle * angle_diff / two_pi)), std::size_t(1));
 
+        if (m_table)
+        {
+            // Rotate the unit vector towards perp1 over the tabulated
+            // angles, the last step (to perp2) is at most one table step
+            PromotedType const length = geometry::math::sqrt(dx1 * dx1 + dy1 * dy1);
+            for (std::size_t i = 1; i < n; i++)
+            {
+                PromotedType x = dx1 / length;
+                PromotedType y = dy1 / length;
+                geometry::detail::buffer::rotate(x, y, PromotedType(m_table->cos_at(i)),
+                               PromotedType(m_table->sin_at(i)));
+
+                Point p;
+                set<0>(p, get<0>(vertex) + buffer_distance * x);
+                set<1>(p, get<1>(vertex) + buffer_distance * y);
+                range_out.push_back(p);
+            }
+            return;
+        }
+
         PromotedType const diff = angle_diff / static_cast<PromotedType>(n);
         PromotedType a = angle1 - diff;
 
@@ -177,6 +205,7 @@ public :
 
 private :
     std::size_t m_points_per_circle;
+    std::shared_ptr<geometry::detail::buffer::unit_circle const> m_table;
 };
 
 
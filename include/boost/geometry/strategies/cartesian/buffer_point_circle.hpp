@@ -16,6 +16,7 @@
 #define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_POINT_CIRCLE_HPP
 
 #include <cstddef>
+#include <memory>
 
 #include <boost/range/value_type.hpp>
 
@@ -23,6 +24,7 @@
 #include <boost/geometry/core/coordinate_type.hpp>
 
 #include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/cartesian/buffer_unit_circle.hpp>
 
 #include <boost/geometry/util/math.hpp>
 #include <boost/geometry/util/select_most_precise.hpp>
@@ -59,8 +61,12 @@ public :
     //! \brief Constructs the strategy
     //! \param count number of points for the created circle (if count
     //! is smaller than 3, count is internally set to 3)
-    explicit point_circle(std::size_t count = 90)
+    //! \param generation circle_by_table to generate the points from
+    //! a table calculated once, instead of calling cos and sin per point
+    explicit point_circle(std::size_t count = 90,
+                          circle_generation generation = circle_by_trigonometry)
         : m_count((count < 3u) ? 3u : count)
+        , m_table(geometry::detail::buffer::unit_circle::create(generation, m_count))
     {}
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -90,17 +96,30 @@ public :
         promoted_type const buffer_distance = distance_strategy.apply(point, point,
                         strategy::buffer::buffer_side_left);
 
-        promoted_type const two_pi = geometry::math::two_pi<promoted_type>();
-
-        promoted_type const diff = two_pi / promoted_type(m_count);
-        promoted_type a = 0;
-
-        for (std::size_t i = 0; i < m_count; i++, a -= diff)
+        if (m_table)
+        {
+            for (std::size_t i = 0; i < m_count; i++)
+            {
+                output_point_type p;
+                set<0>(p, get<0>(point) + buffer_distance * promoted_type(m_table->cos_at(i)));
+                set<1>(p, get<1>(point) + buffer_distance * promoted_type(m_table->sin_at(i)));
+                output_range.push_back(p);
+            }
+        }
+        else
         {
-            output_point_type p;
-            set<0>(p, get<0>(point) + buffer_distance * cos(a));
-            set<1>(p, get<1>(point) + buffer_distance * sin(a));
-            output_range.push_back(p);
+            promoted_type const two_pi = geometry::math::two_pi<promoted_type>();
+
+            promoted_type const diff = two_pi / promoted_type(m_count);
+            promoted_type a = 0;
+
+            for (std::size_t i = 0; i < m_count; i++, a -= diff)
+            {
+                output_point_type p;
+                set<0>(p, get<0>(point) + buffer_distance * cos(a));
+                set<1>(p, get<1>(point) + buffer_distance * sin(a));
+                output_range.push_back(p);
+            }
         }
 
         // Close it:
@@ -110,6 +129,7 @@ public :
 
 private :
     std::size_t m_count;
+    std::shared_ptr<geometry::detail::buffer::unit_circle const> m_table;
 };
 
 
@@ -95,11 +95,32 @@ public :
             return result_no_output;
         }
 
-        promoted_type const d = distance.apply(input_p1, input_p2, side);
+        // The distance at both vertices, which can differ if the distance
+        // strategy varies per vertex
+        promoted_type const d1 = geometry::detail::buffer::distance_at_vertex(
+            distance, input_p1, input_p2, input_p1, side);
+        promoted_type const d2 = geometry::detail::buffer::distance_at_vertex(
+            distance, input_p1, input_p2, input_p2, side);
 
         // Generate the normalized perpendicular p, to the left (ccw)
-        promoted_type const px = -dy / length;
-        promoted_type const py = dx / length;
+        promoted_type px = -dy / length;
+        promoted_type py = dx / length;
+
+        // If the distances differ, rotate p by angle a, with sin(a) = (d1-d2)/length,
+        // towards the direction of the segment. The side is then the common
+        // tangent of the circles at both vertices, and it meets the joins and
+        // ends without notches. If one circle contains the other, there is
+        // no tangent and p is kept.
+        promoted_type const sin_a = (d1 - d2) / length;
+        if (! geometry::math::equals(d1, d2)
+            && geometry::math::abs(sin_a) < 1)
+        {
+            promoted_type const cos_a = geometry::math::sqrt(1 - sin_a * sin_a);
+            promoted_type const tx = dx / length;
+            promoted_type const ty = dy / length;
+            px = cos_a * px + sin_a * tx;
+            py = cos_a * py + sin_a * ty;
+        }
 
         if (geometry::math::equals(px, 0)
             && geometry::math::equals(py, 0))
@@ -110,7 +131,7 @@ public :
             std::cout << "Error in perpendicular calculation for points "
                 << geometry::wkt(input_p1) << " " << geometry::wkt(input_p2)
                 << " length: " << length
-                << " distance: " << d
+                << " distance: " << d1
                 << std::endl;
 #endif
             return result_no_output;
@@ -118,10 +139,10 @@ public :
 
         output_range.resize(2);
 
-        set<0>(output_range.front(), get<0>(input_p1) + px * d);
-        set<1>(output_range.front(), get<1>(input_p1) + py * d);
-        set<0>(output_range.back(), get<0>(input_p2) + px * d);
-        set<1>(output_range.back(), get<1>(input_p2) + py * d);
+        set<0>(output_range.front(), get<0>(input_p1) + px * d1);
+        set<1>(output_range.front(), get<1>(input_p1) + py * d1);
+        set<0>(output_range.back(), get<0>(input_p2) + px * d2);
+        set<1>(output_range.back(), get<1>(input_p2) + py * d2);
 
         return result_normal;
     }
@@ -0,0 +1,96 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_UNIT_CIRCLE_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_UNIT_CIRCLE_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <boost/geometry/core/assert.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/util/math.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace buffer
+{
+
+// Cosines and sines of the angles -i * 2 * pi / count (so clockwise,
+// the direction in which the buffer strategies generate their points)
+class unit_circle
+{
+public :
+    explicit inline unit_circle(std::size_t count)
+    {
+        BOOST_GEOMETRY_ASSERT(count > 0);
+
+        double const diff = geometry::math::two_pi<double>() / count;
+        m_cos.reserve(count);
+        m_sin.reserve(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_cos.push_back(std::cos(i * diff));
+            m_sin.push_back(-std::sin(i * diff));
+        }
+    }
+
+    // Returns the table for circle_by_table, and an empty pointer otherwise.
+    // Tables are calculated once per count, and shared by all strategies
+    // (of all threads) using that count, for the lifetime of the program.
+    static inline std::shared_ptr<unit_circle const>
+        create(strategy::buffer::circle_generation generation, std::size_t count)
+    {
+        if (generation != strategy::buffer::circle_by_table)
+        {
+            return std::shared_ptr<unit_circle const>();
+        }
+
+        static std::mutex mutex;
+        static std::map<std::size_t, std::shared_ptr<unit_circle const> > tables;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<unit_circle const>& table = tables[count];
+        if (! table)
+        {
+            table = std::make_shared<unit_circle const>(count);
+        }
+        return table;
+    }
+
+    inline std::size_t size() const { return m_cos.size(); }
+    inline double cos_at(std::size_t i) const { return m_cos[i]; }
+    inline double sin_at(std::size_t i) const { return m_sin[i]; }
+
+private :
+    std::vector<double> m_cos;
+    std::vector<double> m_sin;
+};
+
+// Rotates the vector (x, y) counter clockwise over the angle having the
+// specified cosine and sine, as the complex multiplication (x + iy)(c + is)
+template <typename T>
+inline void rotate(T& x, T& y, T const& c, T const& s)
+{
+    T const rotated_x = x * c - y * s;
+    y = x * s + y * c;
+    x = rotated_x;
+}
+
+}} // namespace detail::buffer
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_BUFFER_UNIT_CIRCLE_HPP
@@ -0,0 +1,434 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_AKL_TOUSSAINT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_AKL_TOUSSAINT_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/for_each_range.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace convex_hull
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+// The extreme points of a set of points in eight directions, in counter
+// clockwise order of the directions, starting with the most left point.
+// They form a polygon inside the convex hull.
+template <typename Point>
+struct extreme_points
+{
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+
+    Point points[8];
+    bool initialized = false;
+
+    template <typename Less>
+    inline void add(Point const& p, Less const& less)
+    {
+        if (! initialized)
+        {
+            for (Point& point : points)
+            {
+                point = p;
+            }
+            initialized = true;
+            return;
+        }
+
+        coordinate_type const x = geometry::get<0>(p);
+        coordinate_type const y = geometry::get<1>(p);
+
+        // Most left and most right are decided by less, like for the
+        // lower and upper halves of the hull
+        if (less(p, points[0]))
+        {
+            points[0] = p;
+        }
+        if (x + y < sum(points[1]))
+        {
+            points[1] = p;
+        }
+        if (y < geometry::get<1>(points[2]))
+        {
+            points[2] = p;
+        }
+        if (x - y > difference(points[3]))
+        {
+            points[3] = p;
+        }
+        if (less(points[4], p))
+        {
+            points[4] = p;
+        }
+        if (x + y > sum(points[5]))
+        {
+            points[5] = p;
+        }
+        if (y > geometry::get<1>(points[6]))
+        {
+            points[6] = p;
+        }
+        if (x - y < difference(points[7]))
+        {
+            points[7] = p;
+        }
+    }
+
+    template <typename Less>
+    inline void add(extreme_points const& other, Less const& less)
+    {
+        if (other.initialized)
+        {
+            for (Point const& point : other.points)
+            {
+                add(point, less);
+            }
+        }
+    }
+
+    Point const& most_left() const { return points[0]; }
+    Point const& most_right() const { return points[4]; }
+
+private :
+    static inline coordinate_type sum(Point const& p)
+    {
+        return geometry::get<0>(p) + geometry::get<1>(p);
+    }
+
+    static inline coordinate_type difference(Point const& p)
+    {
+        return geometry::get<0>(p) - geometry::get<1>(p);
+    }
+};
+
+
+// Akl-Toussaint heuristic: points strictly inside the polygon formed
+// by the extreme points can never be part of the hull
+template <typename Point, typename SideStrategy>
+class interior_filter
+{
+public :
+    inline interior_filter(extreme_points<Point> const& extremes,
+                           SideStrategy const& side)
+        : m_side(side)
+        , m_has_box(false)
+    {
+        for (Point const& point : extremes.points)
+        {
+            if (m_polygon.empty() || ! equals(point, m_polygon.back()))
+            {
+                m_polygon.push_back(point);
+            }
+        }
+        while (m_polygon.size() > 1 && equals(m_polygon.front(), m_polygon.back()))
+        {
+            m_polygon.pop_back();
+        }
+        if (m_polygon.size() < 3)
+        {
+            // Nothing can be inside
+            m_polygon.clear();
+            return;
+        }
+
+        // The box inside the polygon, bounded by the extremes on each side,
+        // such that most points can be checked with four comparisons
+        Point const* p = extremes.points;
+        m_min_x = (std::max)((std::max)(geometry::get<0>(p[7]), geometry::get<0>(p[0])), geometry::get<0>(p[1]));
+        m_min_y = (std::max)((std::max)(geometry::get<1>(p[1]), geometry::get<1>(p[2])), geometry::get<1>(p[3]));
+        m_max_x = (std::min)((std::min)(geometry::get<0>(p[3]), geometry::get<0>(p[4])), geometry::get<0>(p[5]));
+        m_max_y = (std::min)((std::min)(geometry::get<1>(p[5]), geometry::get<1>(p[6])), geometry::get<1>(p[7]));
+
+        // The box is only used if its corners are inside. The region inside
+        // all edges is convex, so then the whole box is inside. Otherwise
+        // the box is shrunk, a few times.
+        coordinate_type const width = m_max_x - m_min_x;
+        coordinate_type const height = m_max_y - m_min_y;
+        for (int shrink = 0; shrink <= 10 && ! m_has_box; shrink += 2)
+        {
+            // Shrink by 1/1024, 1/256, .. 1/4 on each side
+            coordinate_type const dx = shrink == 0 ? 0 : width / (1 << (12 - shrink));
+            coordinate_type const dy = shrink == 0 ? 0 : height / (1 << (12 - shrink));
+            if (! (m_min_x + dx < m_max_x - dx && m_min_y + dy < m_max_y - dy))
+            {
+                break;
+            }
+
+            Point corner;
+            m_has_box = true;
+            for (int i = 0; i < 4 && m_has_box; i++)
+            {
+                geometry::set<0>(corner, i == 0 || i == 3 ? m_min_x + dx : m_max_x - dx);
+                geometry::set<1>(corner, i < 2 ? m_min_y + dy : m_max_y - dy);
+                m_has_box = is_inside_polygon(corner);
+            }
+            if (m_has_box)
+            {
+                m_min_x += dx;
+                m_min_y += dy;
+                m_max_x -= dx;
+                m_max_y -= dy;
+            }
+        }
+    }
+
+    // Returns true if the point is strictly at the left side of all edges.
+    // This is also correct if rounding in the choice of the extremes
+    // resulted in a polygon which is not convex: a point outside the hull
+    // is always at the right side of (or on) at least one of the edges.
+    inline bool is_inside(Point const& p) const
+    {
+        if (m_has_box
+            && geometry::get<0>(p) > m_min_x && geometry::get<0>(p) < m_max_x
+            && geometry::get<1>(p) > m_min_y && geometry::get<1>(p) < m_max_y)
+        {
+            return true;
+        }
+        return is_inside_polygon(p);
+    }
+
+private :
+    static inline bool equals(Point const& a, Point const& b)
+    {
+        return geometry::get<0>(a) == geometry::get<0>(b)
+            && geometry::get<1>(a) == geometry::get<1>(b);
+    }
+
+    inline bool is_inside_polygon(Point const& p) const
+    {
+        std::size_t const size = m_polygon.size();
+        for (std::size_t i = 0; i < size; i++)
+        {
+            if (m_side.apply(m_polygon[i], m_polygon[(i + 1) % size], p) <= 0)
+            {
+                return false;
+            }
+        }
+        return size > 0;
+    }
+
+    typedef typename geometry::coordinate_type<Point>::type coordinate_type;
+
+    std::vector<Point> m_polygon;
+    SideStrategy const& m_side;
+    bool m_has_box;
+    coordinate_type m_min_x, m_min_y, m_max_x, m_max_y;
+};
+
+
+// Collects the points of the geometry which can be part of the hull,
+// in the lower or upper points, using several threads for large ranges
+template
+<
+    typename Geometry,
+    typename Point,
+    typename Container,
+    typename Less,
+    typename SideStrategy
+>
+inline void assign_filtered_ranges(Geometry const& geometry,
+                                   extreme_points<Point>& extremes,
+                                   Container& lower_points,
+                                   Container& upper_points,
+                                   Less const& less,
+                                   SideStrategy const& side,
+                                   std::size_t thread_count)
+{
+    std::size_t const grain = 1 << 16;
+
+    // First pass: get the extremes
+    geometry::detail::for_each_range(geometry, [&](auto const& range)
+    {
+        auto const begin = boost::begin(range);
+        std::size_t const size = boost::size(range);
+        std::size_t const block_count = (size + grain - 1) / grain;
+        std::vector<extreme_points<Point> > block_extremes(block_count);
+        geometry::detail::parallel::for_each_block(block_count, thread_count, 1,
+            [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t b = first; b < last; b++)
+                {
+                    std::size_t const end = (std::min)((b + 1) * grain, size);
+                    for (std::size_t i = b * grain; i < end; i++)
+                    {
+                        block_extremes[b].add(*(begin + i), less);
+                    }
+                }
+            });
+        for (extreme_points<Point> const& e : block_extremes)
+        {
+            extremes.add(e, less);
+        }
+    });
+
+    if (! extremes.initialized)
+    {
+        return;
+    }
+
+    interior_filter<Point, SideStrategy> const filter(extremes, side);
+    Point const& most_left = extremes.most_left();
+    Point const& most_right = extremes.most_right();
+
+    // Second pass: put the points which are not inside in one of the two
+    // output sequences. Each block collects its own points, such that
+    // the order does not depend on the number of threads.
+    geometry::detail::for_each_range(geometry, [&](auto const& range)
+    {
+        auto const begin = boost::begin(range);
+        std::size_t const size = boost::size(range);
+        std::size_t const block_count = (size + grain - 1) / grain;
+        std::vector<Container> block_lower(block_count);
+        std::vector<Container> block_upper(block_count);
+        geometry::detail::parallel::for_each_block(block_count, thread_count, 1,
+            [&](std::size_t first, std::size_t last)
+            {
+                for (std::size_t b = first; b < last; b++)
+                {
+                    std::size_t const end = (std::min)((b + 1) * grain, size);
+                    for (std::size_t i = b * grain; i < end; i++)
+                    {
+                        Point const& p = *(begin + i);
+                        if (filter.is_inside(p))
+                        {
+                            continue;
+                        }
+
+                        // 0: on line most_left-most_right,
+                        //    or most_left, or most_right,
+                        //    -> all never part of hull
+                        int const dir = side.apply(most_left, most_right, p);
+                        if (dir == 1)
+                        {
+                            block_upper[b].push_back(p);
+                        }
+                        else if (dir == -1)
+                        {
+                            block_lower[b].push_back(p);
+                        }
+                    }
+                }
+            });
+        for (std::size_t b = 0; b < block_count; b++)
+        {
+            lower_points.insert(lower_points.end(),
+                block_lower[b].begin(), block_lower[b].end());
+            upper_points.insert(upper_points.end(),
+                block_upper[b].begin(), block_upper[b].end());
+        }
+    });
+}
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Convex hull strategy discarding interior points early,
+    using several threads
+\ingroup strategies
+\details The akl_toussaint strategy first finds the extreme points of the
+    input in eight directions. Points strictly inside the polygon formed
+    by these points (Akl-Toussaint heuristic) are discarded, which are
+    usually almost all points for large inputs. The remaining points are
+    sorted, in parallel, and the hull is built from them like the
+    graham_andrew strategy does. Both passes over the input are done in
+    parallel for large ranges (of more than 64K points).
+\note The resulting hull is the same as the hull of graham_andrew.
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.convex_hull.convex_hull_3_with_strategy convex_hull (with strategy)]
+}
+ */
+template <typename InputGeometry, typename OutputPoint>
+class akl_toussaint
+{
+public :
+    typedef OutputPoint point_type;
+    typedef InputGeometry geometry_type;
+    typedef detail::hull_halves<point_type> state_type;
+
+    /*!
+    \brief Constructor
+    \param thread_count the maximal number of threads, 0 means as many
+        as the hardware supports
+    */
+    explicit akl_toussaint(std::size_t thread_count = 1)
+        : m_thread_count(thread_count)
+    {}
+
+    inline void apply(InputGeometry const& geometry, state_type& state) const
+    {
+        geometry::less<point_type> less;
+        side::side_by_triangle<> side;
+
+        detail::extreme_points<point_type> extremes;
+        std::vector<point_type> lower_points, upper_points;
+        detail::assign_filtered_ranges(geometry, extremes,
+                                       lower_points, upper_points,
+                                       less, side, m_thread_count);
+        if (! extremes.initialized)
+        {
+            return;
+        }
+
+        geometry::detail::parallel::sort(lower_points.begin(),
+            lower_points.end(), less, m_thread_count);
+        geometry::detail::parallel::sort(upper_points.begin(),
+            upper_points.end(), less, m_thread_count);
+
+        detail::build_half_hull<-1>(lower_points, state.m_lower_hull,
+                                    extremes.most_left(), extremes.most_right(),
+                                    side);
+        detail::build_half_hull<1>(upper_points, state.m_upper_hull,
+                                   extremes.most_left(), extremes.most_right(),
+                                   side);
+    }
+
+    template <typename OutputIterator>
+    inline void result(state_type const& state,
+                       OutputIterator out,
+                       bool clockwise,
+                       bool closed) const
+    {
+        state.result(out, clockwise, closed);
+    }
+
+private :
+    std::size_t m_thread_count;
+};
+
+
+}} // namespace strategy::convex_hull
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_AKL_TOUSSAINT_HPP
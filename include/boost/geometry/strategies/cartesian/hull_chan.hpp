@@ -0,0 +1,358 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_CHAN_HPP
+#define BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_CHAN_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/strategies/agnostic/hull_graham_andrew.hpp>
+#include <boost/geometry/strategies/cartesian/hull_akl_toussaint.hpp>
+#include <boost/geometry/strategies/cartesian/side_by_triangle.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace convex_hull
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail
+{
+
+
+// The wrapping compares points of different group hulls, which can be
+// far apart. The side is therefore calculated without tolerance: with a
+// tolerance, a point close to p can be considered collinear with a far
+// point, which is then taken, skipping a part of the hull.
+template <typename Point, typename Less>
+class chan_wrapper
+{
+    typedef typename geometry::select_most_precise
+        <
+            typename geometry::coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+    typedef std::vector<Point> hull_type;
+
+public :
+    inline chan_wrapper(Less const& less, std::size_t thread_count)
+        : m_less(less)
+        , m_thread_count(thread_count)
+    {}
+
+    // Calculates the hull of the points, counter clockwise, starting at
+    // the most left point, without collinear points and duplicates.
+    // Points are grouped, the hulls of the groups are calculated, and these
+    // hulls are wrapped (Jarvis march), finding the tangent of each group
+    // hull. If the wrap does not finish in as many steps as the group size,
+    // the group size is squared, and all is repeated.
+    inline void apply(std::vector<Point>& points, Point const& most_left,
+                      hull_type& result) const
+    {
+        std::size_t const count = points.size();
+        for (std::size_t group_size = 4; ; group_size *= group_size)
+        {
+            group_size = (std::min)(group_size, count);
+
+            std::size_t const group_count = (count + group_size - 1) / group_size;
+            std::vector<hull_type> hulls(group_count);
+            geometry::detail::parallel::for_each_index(group_count,
+                m_thread_count,
+                [&](std::size_t i)
+                {
+                    auto const first = points.begin() + i * group_size;
+                    auto const last = (i + 1) * group_size < count
+                        ? first + group_size : points.end();
+                    group_hull(first, last, hulls[i]);
+                });
+
+            result.clear();
+            if (wrap(hulls, most_left, group_size, result)
+                || group_size == count)
+            {
+                return;
+            }
+        }
+    }
+
+private :
+
+    static inline bool equals(Point const& a, Point const& b)
+    {
+        return geometry::get<0>(a) == geometry::get<0>(b)
+            && geometry::get<1>(a) == geometry::get<1>(b);
+    }
+
+    static inline calculation_type comparable_distance(Point const& a,
+                                                       Point const& b)
+    {
+        calculation_type const dx = calculation_type(geometry::get<0>(b))
+                                  - calculation_type(geometry::get<0>(a));
+        calculation_type const dy = calculation_type(geometry::get<1>(b))
+                                  - calculation_type(geometry::get<1>(a));
+        return dx * dx + dy * dy;
+    }
+
+    // Returns 1 if p is left of p1-p2, -1 if it is right, and 0 if
+    // it is collinear
+    static inline int side(Point const& p1, Point const& p2, Point const& p)
+    {
+        calculation_type const x1 = geometry::get<0>(p1);
+        calculation_type const y1 = geometry::get<1>(p1);
+        calculation_type const s
+            = (calculation_type(geometry::get<0>(p2)) - x1)
+                * (calculation_type(geometry::get<1>(p)) - y1)
+            - (calculation_type(geometry::get<1>(p2)) - y1)
+                * (calculation_type(geometry::get<0>(p)) - x1);
+        return s > 0 ? 1 : s < 0 ? -1 : 0;
+    }
+
+    // Returns true if, seen from p, b is a better next point of the hull
+    // than a: it is more clockwise, or collinear and further away
+    inline bool better(Point const& p, Point const& a, Point const& b) const
+    {
+        if (equals(a, p))
+        {
+            return ! equals(b, p);
+        }
+        if (equals(b, p))
+        {
+            return false;
+        }
+        int const s = side(p, a, b);
+        return s < 0
+            || (s == 0 && comparable_distance(p, a) < comparable_distance(p, b));
+    }
+
+    // Monotone chain (Andrew), counter clockwise
+    template <typename Iterator>
+    inline void group_hull(Iterator first, Iterator last, hull_type& hull) const
+    {
+        std::sort(first, last, m_less);
+        last = std::unique(first, last, &chan_wrapper::equals);
+
+        std::size_t const size = last - first;
+        hull.reserve(size + 1);
+        if (size <= 2)
+        {
+            hull.assign(first, last);
+            return;
+        }
+
+        // Lower half
+        for (Iterator it = first; it != last; ++it)
+        {
+            add(hull, *it, 2);
+        }
+
+        // Upper half, without the most right point and the most left point
+        std::size_t const lower_size = hull.size() + 1;
+        for (Iterator it = last - 1; it != first; --it)
+        {
+            add(hull, *(it - 1), lower_size);
+        }
+        hull.pop_back();
+    }
+
+    inline void add(hull_type& hull, Point const& p, std::size_t min_size) const
+    {
+        while (hull.size() >= min_size
+               && side(hull[hull.size() - 2], hull.back(), p) <= 0)
+        {
+            hull.pop_back();
+        }
+        hull.push_back(p);
+    }
+
+    // Moves the index of the group hull to its tangent seen from p.
+    // The tangents only move forward while wrapping.
+    inline void advance(hull_type const& hull, Point const& p,
+                        std::size_t& index) const
+    {
+        std::size_t const size = hull.size();
+        for (std::size_t i = 0; i < size; i++)
+        {
+            std::size_t const next = index + 1 < size ? index + 1 : 0;
+            if (! better(p, hull[index], hull[next]))
+            {
+                return;
+            }
+            index = next;
+        }
+    }
+
+    inline bool wrap(std::vector<hull_type> const& hulls,
+                     Point const& most_left, std::size_t max_size,
+                     hull_type& result) const
+    {
+        // Initial tangents, from the most left point, which is on the hull
+        std::vector<std::size_t> tangents(hulls.size(), 0);
+        for (std::size_t g = 0; g < hulls.size(); g++)
+        {
+            hull_type const& hull = hulls[g];
+            for (std::size_t i = 1; i < hull.size(); i++)
+            {
+                if (better(most_left, hull[tangents[g]], hull[i]))
+                {
+                    tangents[g] = i;
+                }
+            }
+        }
+
+        Point p = most_left;
+        result.push_back(p);
+        while (result.size() <= max_size)
+        {
+            Point const* next = nullptr;
+            for (std::size_t g = 0; g < hulls.size(); g++)
+            {
+                advance(hulls[g], p, tangents[g]);
+                Point const& candidate = hulls[g][tangents[g]];
+                if (next == nullptr || better(p, *next, candidate))
+                {
+                    next = &candidate;
+                }
+            }
+
+            if (next == nullptr || equals(*next, p) || equals(*next, most_left))
+            {
+                return true;
+            }
+            p = *next;
+            result.push_back(p);
+        }
+        return false;
+    }
+
+    Less const& m_less;
+    std::size_t m_thread_count;
+};
+
+
+} // namespace detail
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Output sensitive convex hull strategy (Chan's algorithm)
+\ingroup strategies
+\details The chan strategy calculates the convex hull in O(n log h) time,
+    where h is the number of points of the hull. Points are grouped, the
+    hulls of the groups are calculated in parallel, and these hulls are
+    wrapped, finding the tangent of each group hull in every step. It first
+    discards interior points like the akl_toussaint strategy. It is faster
+    than akl_toussaint if there are many points left after that, but the
+    hull has only few points.
+\note The resulting hull is the same as the hull of graham_andrew. The
+    wrapping only selects the candidate points, its lower and upper halves
+    are rebuilt from these points as graham_andrew builds them, so nearly
+    collinear points are kept or discarded in the same way.
+
+\qbk{
+[heading See also]
+[link geometry.reference.algorithms.convex_hull.convex_hull_3_with_strategy convex_hull (with strategy)]
+}
+ */
+template <typename InputGeometry, typename OutputPoint>
+class chan
+{
+public :
+    typedef OutputPoint point_type;
+    typedef InputGeometry geometry_type;
+    typedef detail::hull_halves<point_type> state_type;
+
+    /*!
+    \brief Constructor
+    \param thread_count the maximal number of threads, 0 means as many
+        as the hardware supports
+    */
+    explicit chan(std::size_t thread_count = 1)
+        : m_thread_count(thread_count)
+    {}
+
+    inline void apply(InputGeometry const& geometry, state_type& state) const
+    {
+        typedef geometry::less<point_type> less_type;
+        typedef side::side_by_triangle<> side_type;
+
+        less_type less;
+        side_type side;
+
+        detail::extreme_points<point_type> extremes;
+        std::vector<point_type> points, other_points;
+        detail::assign_filtered_ranges(geometry, extremes,
+                                       points, other_points,
+                                       less, side, m_thread_count);
+        if (! extremes.initialized)
+        {
+            return;
+        }
+
+        points.insert(points.end(), other_points.begin(), other_points.end());
+        points.push_back(extremes.most_left());
+        points.push_back(extremes.most_right());
+
+        std::vector<point_type> hull;
+        detail::chan_wrapper<point_type, less_type>(less, m_thread_count)
+            .apply(points, extremes.most_left(), hull);
+
+        // Divide the hull into its lower and upper half, both from left to
+        // right, and build them like graham_andrew does, such that nearly
+        // collinear points are handled in the same way
+        point_type const& most_right = extremes.most_right();
+        std::size_t right_index = 0;
+        while (right_index < hull.size()
+               && ! (geometry::get<0>(hull[right_index]) == geometry::get<0>(most_right)
+                     && geometry::get<1>(hull[right_index]) == geometry::get<1>(most_right)))
+        {
+            right_index++;
+        }
+
+        std::vector<point_type> lower_points, upper_points;
+        if (right_index > 0 && right_index < hull.size())
+        {
+            lower_points.assign(hull.begin() + 1, hull.begin() + right_index);
+            upper_points.assign(hull.rbegin(), hull.rend() - right_index - 1);
+        }
+
+        detail::build_half_hull<-1>(lower_points, state.m_lower_hull,
+                                    extremes.most_left(), most_right,
+                                    side);
+        detail::build_half_hull<1>(upper_points, state.m_upper_hull,
+                                   extremes.most_left(), most_right,
+                                   side);
+    }
+
+    template <typename OutputIterator>
+    inline void result(state_type const& state,
+                       OutputIterator out,
+                       bool clockwise,
+                       bool closed) const
+    {
+        state.result(out, clockwise, closed);
+    }
+
+private :
+    std::size_t m_thread_count;
+};
+
+
+}} // namespace strategy::convex_hull
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_CARTESIAN_HULL_CHAN_HPP
@@ -18,6 +18,8 @@
 
 #include <algorithm>
 
+#include <boost/config.hpp>
+
 #include <boost/geometry/core/exception.hpp>
 
 #include <boost/geometry/geometries/concepts/point_concept.hpp>
@@ -74,13 +76,14 @@ namespace strategy { namespace intersection
  */
 template
 <
-    typename CalculationType = void
+    typename CalculationType = void,
+    typename SideStrategy = side::side_by_triangle<CalculationType>
 >
 struct cartesian_segments
 {
     typedef cartesian_tag cs_tag;
 
-    typedef side::side_by_triangle<CalculationType> side_strategy_type;
+    typedef SideStrategy side_strategy_type;
 
     static inline side_strategy_type get_side_strategy()
     {
@@ -775,6 +778,52 @@ private:
 };
 
 
+/*!
+\brief Segment intersection strategy, the same as cartesian_segments,
+    but self-turns (used by is_valid, is_simple and self_turns) are found
+    by a sweep line over sections of one segment instead of by partition
+\details This is beneficial for geometries with many long, nearly horizontal
+    sections (e.g. coastlines), for which the section boxes overlap heavily.
+    The number of segment pairs which are compared is proportional to the
+    number of pairs of overlapping segment boxes.
+ */
+template
+<
+    typename CalculationType = void
+>
+struct cartesian_segments_sweep
+    : cartesian_segments<CalculationType>
+{
+    static bool const self_turns_by_sweep = true;
+};
+
+
+#if defined(BOOST_HAS_INT128)
+/*!
+\brief Segment intersection strategy for integral (fixed-point) coordinates,
+    for example 64 bit integers containing millimeters
+\details Sides are calculated exactly in 128 bit integers, segment ratios
+    are stored as exact integral fractions and intersection points are
+    calculated in 128 bit integers and rounded towards the first point of
+    the segment. Integral coordinates are never rescaled, so overlay
+    (intersection, union, difference) of input which is snapped to a grid
+    is robust (only the intersection points are rounded) and it skips
+    the rescaling which is necessary for floating point input.
+\note The differences between coordinates should be smaller than 2^31
+    (e.g. coordinates within [-2^30, 2^30]) such that the determinants of
+    the segment ratios, which are calculated in the coordinate type,
+    do not overflow.
+ */
+struct cartesian_segments_fixed_point
+    : cartesian_segments
+        <
+            boost::int128_type,
+            side::side_by_triangle_exact<boost::int128_type>
+        >
+{};
+#endif
+
+
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 namespace services
 {
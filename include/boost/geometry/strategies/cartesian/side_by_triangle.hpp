@@ -224,6 +224,16 @@ public :
 
     template <typename P1, typename P2, typename P>
     static inline int apply(P1 const& p1, P2 const& p2, P const& p)
+    {
+        return apply_promoted<false>(p1, p2, p);
+    }
+
+protected:
+    // If IsExact is true, all coordinates are integral and an integral
+    // CalculationType is given, the side is calculated in the
+    // CalculationType instead of promoting it to double
+    template <bool IsExact, typename P1, typename P2, typename P>
+    static inline int apply_promoted(P1 const& p1, P2 const& p2, P const& p)
     {
         typedef typename coordinate_type<P1>::type coordinate_type1;
         typedef typename coordinate_type<P2>::type coordinate_type2;
@@ -241,18 +251,26 @@ public :
                 CalculationType
             > coordinate_type;
 
-        // Promote float->double, small int->int
-        typedef typename select_most_precise
-            <
-                coordinate_type,
-                double
-            >::type promoted_type;
-
         bool const are_all_integral_coordinates =
             std::is_integral<coordinate_type1>::value
             && std::is_integral<coordinate_type2>::value
             && std::is_integral<coordinate_type3>::value;
 
+        // Promote float->double, small int->int
+        typedef std::conditional_t
+            <
+                IsExact
+                    && are_all_integral_coordinates
+                    && ! std::is_void<CalculationType>::value
+                    && ! std::is_floating_point<CalculationType>::value,
+                coordinate_type,
+                typename select_most_precise
+                    <
+                        coordinate_type,
+                        double
+                    >::type
+            > promoted_type;
+
         eps_policy< math::detail::equals_factor_policy<promoted_type> > epsp;
         promoted_type s = compute_side_value
             <
@@ -275,6 +293,29 @@ private:
 };
 
 
+/*!
+\brief Check at which side of a segment a point lies, as side_by_triangle,
+    but exact for integral coordinates
+\ingroup strategies
+\details If all coordinates are integral and an integral CalculationType
+    is given, the side is calculated in the CalculationType instead of in
+    double. For 64 bit coordinates a 128 bit integral CalculationType
+    should be used, for 32 bit coordinates a 64 bit integral type.
+\tparam CalculationType \tparam_calculation
+ */
+template <typename CalculationType = void>
+class side_by_triangle_exact
+    : public side_by_triangle<CalculationType>
+{
+public :
+    template <typename P1, typename P2, typename P>
+    static inline int apply(P1 const& p1, P2 const& p2, P const& p)
+    {
+        return side_by_triangle<CalculationType>::template apply_promoted<true>(p1, p2, p);
+    }
+};
+
+
 #ifndef DOXYGEN_NO_STRATEGY_SPECIALIZATIONS
 namespace services
 {
@@ -0,0 +1,243 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_END_ROUND_HPP
+#define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_END_ROUND_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace buffer
+{
+
+/*!
+\brief Let the buffer create rounded ends, on the Earth
+\ingroup strategies
+\details This strategy can be used as EndStrategy for the buffer algorithm.
+    It creates a rounded end for each linestring-end, with points at the
+    buffer distance (in meters) from the end point, calculated with the
+    direct formula of the FormulaPolicy. It can be applied
+    for (multi)linestrings. Also it is applicable for spikes in (multi)polygons.
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.buffer.buffer_7_with_strategies buffer (with strategies)]
+\* [link geometry.reference.strategies.strategy_buffer_end_round end_round]
+}
+ */
+template
+<
+    typename FormulaPolicy = strategy::andoyer,
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_end_round
+{
+public :
+
+    //! \brief Constructs the strategy
+    //! \param points_per_circle points which would be used for a full circle
+    //! (if points_per_circle is smaller than 4, it is internally set to 4)
+    explicit geographic_end_round(std::size_t points_per_circle = 90)
+        : m_points_per_circle((points_per_circle < 4u) ? 4u : points_per_circle)
+    {}
+
+    //! \brief Constructs the strategy with a spheroid
+    //! \param spheroid The spheroid to be used
+    //! \param points_per_circle points which would be used for a full circle
+    //! (if points_per_circle is smaller than 4, it is internally set to 4)
+    explicit geographic_end_round(Spheroid const& spheroid,
+                                  std::size_t points_per_circle = 90)
+        : m_points_per_circle((points_per_circle < 4u) ? 4u : points_per_circle)
+        , m_spheroid(spheroid)
+    {}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+
+    //! Fills output_range with a round end
+    template <typename Point, typename RangeOut, typename DistanceStrategy>
+    inline void apply(Point const& penultimate_point,
+                Point const& perp_left_point,
+                Point const& ultimate_point,
+                Point const& perp_right_point,
+                buffer_side_selector side,
+                DistanceStrategy const& distance,
+                RangeOut& range_out) const
+    {
+        typedef typename boost::range_value<RangeOut>::type output_point_type;
+
+        typedef typename select_calculation_type
+            <
+                Point, output_point_type,
+                CalculationType
+            >::type calculation_type;
+
+        typedef typename FormulaPolicy::template inverse
+            <
+                calculation_type, false, false, true, false, false
+            > inverse_t;
+
+        calculation_type const dist_left = geometry::detail::buffer::distance_at_vertex(
+            distance, penultimate_point, ultimate_point, ultimate_point, buffer_side_left);
+        calculation_type const dist_right = geometry::detail::buffer::distance_at_vertex(
+            distance, penultimate_point, ultimate_point, ultimate_point, buffer_side_right);
+
+        calculation_type const lon = get_as_radian<0>(ultimate_point);
+        calculation_type const lat = get_as_radian<1>(ultimate_point);
+
+        // The azimuth of the geodesic at the ultimate point, and the
+        // azimuth perpendicular to the left, where the end starts
+        calculation_type const azimuth = inverse_t::apply(
+            get_as_radian<0>(penultimate_point), get_as_radian<1>(penultimate_point),
+            lon, lat, m_spheroid).reverse_azimuth;
+        calculation_type const alpha
+            = azimuth - geometry::math::half_pi<calculation_type>();
+
+        // The end starts and ends exactly at the perpendicular points of the
+        // sides, such that differences between the formulas of the side and
+        // the end strategy do not cause tiny spikes
+        range_out.push_back(perp_left_point);
+
+        // For a half circle, excluding its first and last point
+        calculation_type const diff = geometry::math::two_pi<calculation_type>()
+            / calculation_type(m_points_per_circle);
+        std::size_t const count = (m_points_per_circle + 1) / 2;
+
+        if (is_distance_per_vertex<DistanceStrategy>::value
+            && geometry::math::equals(dist_left, dist_right))
+        {
+            // The sides are tapered and their ends are not perpendicular
+            // to the geodesic, so the arc is generated between their ends
+            typedef typename FormulaPolicy::template inverse
+                <
+                    calculation_type, false, true, false, false, false
+                > azimuth_inverse_t;
+
+            calculation_type const azimuth1 = azimuth_inverse_t::apply(lon, lat,
+                get_as_radian<0>(perp_left_point), get_as_radian<1>(perp_left_point),
+                m_spheroid).azimuth;
+            calculation_type azimuth2 = azimuth_inverse_t::apply(lon, lat,
+                get_as_radian<0>(perp_right_point), get_as_radian<1>(perp_right_point),
+                m_spheroid).azimuth;
+            while (azimuth2 < azimuth1)
+            {
+                azimuth2 += geometry::math::two_pi<calculation_type>();
+            }
+            calculation_type const angle_diff = azimuth2 - azimuth1;
+
+            std::size_t const n = (std::max)(static_cast<std::size_t>(
+                std::ceil(angle_diff / diff)), std::size_t(1));
+
+            generate_points<output_point_type>(lon, lat, azimuth1,
+                angle_diff / calculation_type(n), n, dist_left, range_out);
+        }
+        else if (geometry::math::equals(dist_left, dist_right))
+        {
+            generate_points<output_point_type>(lon, lat, alpha,
+                diff, count, dist_left, range_out);
+        }
+        else
+        {
+            static calculation_type const two = 2.0;
+            calculation_type const dist_average = (dist_left + dist_right) / two;
+            calculation_type const dist_half
+                    = (side == buffer_side_right
+                    ? (dist_right - dist_left)
+                    : (dist_left - dist_right)) / two;
+
+            // Shift the center of the end to the left (or right, if negative)
+            typedef typename FormulaPolicy::template direct
+                <
+                    calculation_type, true, false, false, false
+                > direct_t;
+
+            calculation_type shift_azimuth = dist_half < 0
+                ? alpha + geometry::math::pi<calculation_type>()
+                : alpha;
+            math::normalize_azimuth<radian>(shift_azimuth);
+
+            typename direct_t::result_type const shifted
+                = direct_t::apply(lon, lat, geometry::math::abs(dist_half),
+                                  shift_azimuth, m_spheroid);
+
+            generate_points<output_point_type>(shifted.lon2, shifted.lat2,
+                                               alpha, diff, count,
+                                               dist_average, range_out);
+        }
+
+        range_out.push_back(perp_right_point);
+    }
+
+    template <typename NumericType>
+    static inline NumericType max_distance(NumericType const& distance)
+    {
+        return distance;
+    }
+
+    //! Returns the piece_type (round end)
+    static inline piece_type get_piece_type()
+    {
+        return buffered_round_end;
+    }
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private :
+
+    // Generates the points of an arc in between the left and the right
+    // of the linestring, clockwise (so with increasing azimuth), excluding
+    // its first and last point
+    template <typename OutputPoint, typename T, typename RangeOut>
+    inline void generate_points(T const& lon, T const& lat,
+                T const& first_azimuth,
+                T const& diff,
+                std::size_t count,
+                T const& buffer_distance,
+                RangeOut& range_out) const
+    {
+        typedef typename FormulaPolicy::template direct
+            <
+                T, true, false, false, false
+            > direct_t;
+
+        for (std::size_t i = 1; i < count; i++)
+        {
+            T azimuth = first_azimuth + diff * T(i);
+            math::normalize_azimuth<radian>(azimuth);
+
+            typename direct_t::result_type const dir
+                = direct_t::apply(lon, lat, buffer_distance, azimuth, m_spheroid);
+            OutputPoint p;
+            set_from_radian<0>(p, dir.lon2);
+            set_from_radian<1>(p, dir.lat2);
+            range_out.push_back(p);
+        }
+    }
+
+    std::size_t m_points_per_circle;
+    Spheroid m_spheroid;
+};
+
+
+}} // namespace strategy::buffer
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_END_ROUND_HPP
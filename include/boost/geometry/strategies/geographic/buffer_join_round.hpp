@@ -0,0 +1,166 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_JOIN_ROUND_HPP
+#define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_JOIN_ROUND_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/policies/compare.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace buffer
+{
+
+/*!
+\brief Let the buffer create rounded corners, on the Earth
+\ingroup strategies
+\details This strategy can be used as JoinStrategy for the buffer algorithm.
+    It creates a rounded corner around each convex vertex, with points at
+    the buffer distance (in meters) from the vertex, calculated with the
+    direct formula of the FormulaPolicy. It can be applied
+    for (multi)linestrings and (multi)polygons.
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.buffer.buffer_7_with_strategies buffer (with strategies)]
+\* [link geometry.reference.strategies.strategy_buffer_join_round join_round]
+}
+ */
+template
+<
+    typename FormulaPolicy = strategy::andoyer,
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_join_round
+{
+public :
+    //! \brief Constructs the strategy
+    //! \param points_per_circle points which would be used for a full circle
+    explicit geographic_join_round(std::size_t points_per_circle = 90)
+        : m_points_per_circle(points_per_circle)
+    {}
+
+    //! \brief Constructs the strategy with a spheroid
+    //! \param spheroid The spheroid to be used
+    //! \param points_per_circle points which would be used for a full circle
+    explicit geographic_join_round(Spheroid const& spheroid,
+                                   std::size_t points_per_circle = 90)
+        : m_points_per_circle(points_per_circle)
+        , m_spheroid(spheroid)
+    {}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    //! Fills output_range with a rounded shape around a vertex
+    template <typename Point, typename DistanceType, typename RangeOut>
+    inline bool apply(Point const& ip, Point const& vertex,
+                Point const& perp1, Point const& perp2,
+                DistanceType const& buffer_distance,
+                RangeOut& range_out) const
+    {
+        boost::ignore_unused(ip);
+
+        typedef typename boost::range_value<RangeOut>::type output_point_type;
+
+        typedef typename select_calculation_type
+            <
+                Point, output_point_type,
+                CalculationType
+            >::type calculation_type;
+
+        typedef typename FormulaPolicy::template inverse
+            <
+                calculation_type, false, true, false, false, false
+            > inverse_t;
+
+        typedef typename FormulaPolicy::template direct
+            <
+                calculation_type, true, false, false, false
+            > direct_t;
+
+        geometry::equal_to<Point> equals;
+        if (equals(perp1, perp2))
+        {
+            return false;
+        }
+
+        calculation_type const lon = get_as_radian<0>(vertex);
+        calculation_type const lat = get_as_radian<1>(vertex);
+
+        calculation_type const azimuth1 = inverse_t::apply(lon, lat,
+            get_as_radian<0>(perp1), get_as_radian<1>(perp1), m_spheroid).azimuth;
+        calculation_type azimuth2 = inverse_t::apply(lon, lat,
+            get_as_radian<0>(perp2), get_as_radian<1>(perp2), m_spheroid).azimuth;
+
+        // The join is generated clockwise, so with increasing azimuth
+        calculation_type const two_pi = geometry::math::two_pi<calculation_type>();
+        while (azimuth2 < azimuth1)
+        {
+            azimuth2 += two_pi;
+        }
+        calculation_type const angle_diff = azimuth2 - azimuth1;
+
+        // Divide the angle into an integer amount of steps,
+        // as the cartesian join_round does
+        std::size_t const n = (std::max)(static_cast<std::size_t>(
+            std::ceil(m_points_per_circle * angle_diff / two_pi)), std::size_t(1));
+
+        calculation_type const diff = angle_diff / static_cast<calculation_type>(n);
+        calculation_type const distance = geometry::math::abs(buffer_distance);
+
+        range_out.push_back(perp1);
+
+        for (std::size_t i = 1; i < n; i++)
+        {
+            calculation_type azimuth = azimuth1 + diff * i;
+            math::normalize_azimuth<radian>(azimuth);
+
+            typename direct_t::result_type const dir
+                = direct_t::apply(lon, lat, distance, azimuth, m_spheroid);
+            output_point_type p;
+            set_from_radian<0>(p, dir.lon2);
+            set_from_radian<1>(p, dir.lat2);
+            range_out.push_back(p);
+        }
+
+        range_out.push_back(perp2);
+        return true;
+    }
+
+    template <typename NumericType>
+    static inline NumericType max_distance(NumericType const& distance)
+    {
+        return distance;
+    }
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+private :
+    std::size_t m_points_per_circle;
+    Spheroid m_spheroid;
+};
+
+
+}} // namespace strategy::buffer
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_JOIN_ROUND_HPP
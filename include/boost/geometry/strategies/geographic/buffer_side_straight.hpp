@@ -0,0 +1,188 @@
+// Boost.Geometry
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_SIDE_STRAIGHT_HPP
+#define BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_SIDE_STRAIGHT_HPP
+
+#include <cmath>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/radian_access.hpp>
+#include <boost/geometry/srs/spheroid.hpp>
+#include <boost/geometry/strategies/buffer.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace buffer
+{
+
+/*!
+\brief Let the buffer use straight sides along segments, on the Earth
+\ingroup strategies
+\details This strategy can be used as SideStrategy for the buffer algorithm.
+    It creates a side to the left of each segment, by moving both of its
+    points perpendicular to the geodesic over the buffer distance (in meters).
+    The azimuths are calculated with the inverse formula and the offsetted
+    points with the direct formula of the FormulaPolicy (for example
+    strategy::andoyer, strategy::thomas or strategy::vincenty). It can be
+    applied for (multi)linestrings and (multi)polygons.
+
+\qbk{
+[heading See also]
+\* [link geometry.reference.algorithms.buffer.buffer_7_with_strategies buffer (with strategies)]
+\* [link geometry.reference.strategies.strategy_buffer_side_straight side_straight]
+}
+ */
+template
+<
+    typename FormulaPolicy = strategy::andoyer,
+    typename Spheroid = srs::spheroid<double>,
+    typename CalculationType = void
+>
+class geographic_side_straight
+{
+public :
+    typedef Spheroid model_type;
+
+    //! \brief Constructs the strategy
+    geographic_side_straight()
+    {}
+
+    //! \brief Constructs the strategy with a spheroid
+    //! \param spheroid The spheroid to be used
+    explicit geographic_side_straight(Spheroid const& spheroid)
+        : m_spheroid(spheroid)
+    {}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+    template
+    <
+        typename Point,
+        typename OutputRange,
+        typename DistanceStrategy
+    >
+    inline result_code apply(
+                Point const& input_p1, Point const& input_p2,
+                buffer_side_selector side,
+                DistanceStrategy const& distance,
+                OutputRange& output_range) const
+    {
+        typedef typename boost::range_value<OutputRange>::type output_point_type;
+
+        typedef typename select_calculation_type
+            <
+                Point, output_point_type,
+                CalculationType
+            >::type calculation_type;
+
+        typedef typename FormulaPolicy::template inverse
+            <
+                calculation_type, false, true, true, false, false
+            > inverse_t;
+
+        typedef typename FormulaPolicy::template direct
+            <
+                calculation_type, true, false, false, false
+            > direct_t;
+
+        calculation_type const lon1 = get_as_radian<0>(input_p1);
+        calculation_type const lat1 = get_as_radian<1>(input_p1);
+        calculation_type const lon2 = get_as_radian<0>(input_p2);
+        calculation_type const lat2 = get_as_radian<1>(input_p2);
+
+        if (geometry::math::equals(lon1, lon2)
+            && geometry::math::equals(lat1, lat2))
+        {
+            // As for cartesian, a side cannot be generated for equal points
+            return result_no_output;
+        }
+
+        typename inverse_t::result_type const inv
+            = inverse_t::apply(lon1, lat1, lon2, lat2, m_spheroid);
+
+        if (! boost::math::isfinite(inv.azimuth)
+            || ! boost::math::isfinite(inv.reverse_azimuth))
+        {
+            return result_error_numerical;
+        }
+
+        calculation_type const half_pi
+            = geometry::math::half_pi<calculation_type>();
+        calculation_type const d1 = geometry::detail::buffer::distance_at_vertex(
+            distance, input_p1, input_p2, input_p1, side);
+        calculation_type const d2 = geometry::detail::buffer::distance_at_vertex(
+            distance, input_p1, input_p2, input_p2, side);
+
+        // The side is generated to the left, perpendicular to the geodesic,
+        // at the first point and at the second point (where the azimuth
+        // of the geodesic is different)
+        calculation_type azimuth1 = inv.azimuth - half_pi;
+        calculation_type azimuth2 = inv.reverse_azimuth - half_pi;
+
+        if (! geometry::math::equals(d1, d2))
+        {
+            // As for cartesian, the perpendiculars are rotated towards the
+            // direction of the geodesic, over angle a with
+            // sin(a) = (d1-d2)/length, such that the side is tangent to
+            // the circles at both points
+            typedef typename FormulaPolicy::template inverse
+                <
+                    calculation_type, true, false, false, false, false
+                > distance_inverse_t;
+
+            calculation_type const length = distance_inverse_t::apply(
+                lon1, lat1, lon2, lat2, m_spheroid).distance;
+            calculation_type const sin_a = (d1 - d2) / length;
+            if (geometry::math::abs(sin_a) < 1)
+            {
+                calculation_type const a = std::asin(sin_a);
+                azimuth1 += a;
+                azimuth2 += a;
+            }
+        }
+        math::normalize_azimuth<radian>(azimuth1);
+        math::normalize_azimuth<radian>(azimuth2);
+
+        typename direct_t::result_type const dir1
+            = direct_t::apply(lon1, lat1, d1, azimuth1, m_spheroid);
+        typename direct_t::result_type const dir2
+            = direct_t::apply(lon2, lat2, d2, azimuth2, m_spheroid);
+
+        output_range.resize(2);
+
+        set_from_radian<0>(output_range.front(), dir1.lon2);
+        set_from_radian<1>(output_range.front(), dir1.lat2);
+        set_from_radian<0>(output_range.back(), dir2.lon2);
+        set_from_radian<1>(output_range.back(), dir2.lat2);
+
+        return result_normal;
+    }
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+    //! \brief Returns the spheroid
+    inline model_type const& model() const
+    {
+        return m_spheroid;
+    }
+
+private :
+    Spheroid m_spheroid;
+};
+
+
+}} // namespace strategy::buffer
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_STRATEGIES_GEOGRAPHIC_BUFFER_SIDE_STRAIGHT_HPP
@@ -0,0 +1,279 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_STRATEGIES_TRANSFORM_SRS_APPROXIMATE_TRANSFORMER_HPP
+#define BOOST_GEOMETRY_STRATEGIES_TRANSFORM_SRS_APPROXIMATE_TRANSFORMER_HPP
+
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <boost/math/special_functions/fpclassify.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/static_assert.hpp>
+#include <boost/geometry/util/promote_floating_point.hpp>
+#include <boost/geometry/util/select_calculation_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace strategy { namespace transform
+{
+
+/*!
+    \brief Transformation strategy approximating another transformation
+           by bilinear interpolation of its results.
+    \ingroup transform
+    \details The extent is divided into four cells recursively, until the
+        interpolation of the exact results at the corners of a cell is within
+        the maximal error at the middles of its edges and at its center, like
+        in GDAL's approximate transformer. Points in the cells are then
+        interpolated. The error is checked only at these points, not
+        everywhere, and is measured separately for each output coordinate, in
+        the units of PointOut. Points out of the extent, and points in cells
+        still not within the error at the maximal depth or where the exact
+        transformation fails, are transformed exactly.
+        Only the first two coordinates are transformed.
+    \tparam Transformer Transformation strategy transforming points exactly,
+        e.g. srs_forward_transformer or srs_inverse_transformer
+    \tparam PointIn Type of the input points used to divide the extent
+    \tparam PointOut Type of the output points used to divide the extent
+ */
+template
+<
+    typename Transformer,
+    typename PointIn,
+    typename PointOut,
+    typename CalculationType = void
+>
+class srs_approximate_transformer
+{
+    BOOST_GEOMETRY_STATIC_ASSERT(
+        (dimension<PointIn>::value == 2 && dimension<PointOut>::value == 2),
+        "Only two-dimensional points are supported.",
+        PointIn, PointOut);
+
+    typedef typename promote_floating_point
+        <
+            typename select_calculation_type_alt
+                <
+                    CalculationType, PointIn, PointOut
+                >::type
+        >::type calc_t;
+
+    // Exact results at the corners of a cell, in the order
+    // min/min, max/min, min/max, max/max
+    struct node
+    {
+        // Index of the first of four children, 0 for leaves
+        std::size_t children;
+        bool interpolated;
+        calc_t x[4];
+        calc_t y[4];
+    };
+
+public:
+    template <typename Box>
+    inline srs_approximate_transformer(Transformer const& transformer,
+                                       Box const& extent,
+                                       calc_t const& max_error,
+                                       std::size_t max_depth = 8)
+        : m_transformer(transformer)
+        , m_min_x(geometry::get<min_corner, 0>(extent))
+        , m_min_y(geometry::get<min_corner, 1>(extent))
+        , m_max_x(geometry::get<max_corner, 0>(extent))
+        , m_max_y(geometry::get<max_corner, 1>(extent))
+        , m_max_error(max_error)
+        , m_max_depth(max_depth)
+    {
+        result_type corners[4];
+        for (int i = 0; i < 4; i++)
+        {
+            corners[i] = exact((i & 1) ? m_max_x : m_min_x,
+                               (i & 2) ? m_max_y : m_min_y);
+        }
+
+        m_nodes.push_back(node());
+        build(0, m_min_x, m_min_y, m_max_x, m_max_y, corners, 0);
+    }
+
+    template <typename Point1, typename Point2>
+    inline bool apply(Point1 const& p1, Point2 & p2) const
+    {
+        calc_t const x = geometry::get<0>(p1);
+        calc_t const y = geometry::get<1>(p1);
+
+        // Also false for NaN
+        if (! (x >= m_min_x && x <= m_max_x && y >= m_min_y && y <= m_max_y))
+        {
+            return m_transformer.apply(p1, p2);
+        }
+
+        calc_t min_x = m_min_x;
+        calc_t min_y = m_min_y;
+        calc_t max_x = m_max_x;
+        calc_t max_y = m_max_y;
+        node const* n = &m_nodes[0];
+        while (n->children != 0)
+        {
+            calc_t const mid_x = (min_x + max_x) / 2;
+            calc_t const mid_y = (min_y + max_y) / 2;
+            std::size_t quadrant = 0;
+            if (x >= mid_x) { quadrant |= 1; min_x = mid_x; } else { max_x = mid_x; }
+            if (y >= mid_y) { quadrant |= 2; min_y = mid_y; } else { max_y = mid_y; }
+            n = &m_nodes[n->children + quadrant];
+        }
+
+        if (! n->interpolated)
+        {
+            return m_transformer.apply(p1, p2);
+        }
+
+        calc_t const fx = max_x > min_x ? (x - min_x) / (max_x - min_x) : calc_t(0);
+        calc_t const fy = max_y > min_y ? (y - min_y) / (max_y - min_y) : calc_t(0);
+        geometry::set<0>(p2, interpolate(n->x, fx, fy));
+        geometry::set<1>(p2, interpolate(n->y, fx, fy));
+        return true;
+    }
+
+    //! Number of cells, for diagnostics
+    inline std::size_t size() const
+    {
+        return m_nodes.size();
+    }
+
+private:
+    struct result_type
+    {
+        calc_t x, y;
+        bool valid;
+    };
+
+    inline result_type exact(calc_t const& x, calc_t const& y) const
+    {
+        PointIn p1;
+        geometry::set<0>(p1, x);
+        geometry::set<1>(p1, y);
+        PointOut p2;
+        geometry::set<0>(p2, 0);
+        geometry::set<1>(p2, 0);
+
+        result_type result;
+        result.valid = m_transformer.apply(p1, p2);
+        result.x = geometry::get<0>(p2);
+        result.y = geometry::get<1>(p2);
+        result.valid = result.valid
+                    && boost::math::isfinite(result.x)
+                    && boost::math::isfinite(result.y);
+        return result;
+    }
+
+    static inline calc_t interpolate(calc_t const* v, calc_t const& fx, calc_t const& fy)
+    {
+        calc_t const v0 = v[0] + (v[1] - v[0]) * fx;
+        calc_t const v1 = v[2] + (v[3] - v[2]) * fx;
+        return v0 + (v1 - v0) * fy;
+    }
+
+    inline bool within_error(calc_t const& ex, calc_t const& ey,
+                             result_type const& r) const
+    {
+        return std::abs(ex - r.x) <= m_max_error
+            && std::abs(ey - r.y) <= m_max_error;
+    }
+
+    // Checks the cell with the corners known from its parent, at the 3x3
+    // points of the cell, which are the corners of the children if needed
+    void build(std::size_t index,
+               calc_t const& min_x, calc_t const& min_y,
+               calc_t const& max_x, calc_t const& max_y,
+               result_type const* corners, std::size_t depth)
+    {
+        calc_t const mid_x = (min_x + max_x) / 2;
+        calc_t const mid_y = (min_y + max_y) / 2;
+
+        // 0 1 2 from min_y, 3 4 5 at mid_y, 6 7 8 at max_y
+        result_type grid[9];
+        grid[0] = corners[0];
+        grid[2] = corners[1];
+        grid[6] = corners[2];
+        grid[8] = corners[3];
+        grid[1] = exact(mid_x, min_y);
+        grid[3] = exact(min_x, mid_y);
+        grid[4] = exact(mid_x, mid_y);
+        grid[5] = exact(max_x, mid_y);
+        grid[7] = exact(mid_x, max_y);
+
+        std::size_t valid_count = 0;
+        for (int i = 0; i < 9; i++)
+        {
+            valid_count += grid[i].valid ? 1 : 0;
+        }
+
+        node & n = m_nodes[index];
+        n.children = 0;
+        n.interpolated = false;
+        for (int i = 0; i < 4; i++)
+        {
+            n.x[i] = corners[i].x;
+            n.y[i] = corners[i].y;
+        }
+
+        if (valid_count == 9)
+        {
+            calc_t const* x = n.x;
+            calc_t const* y = n.y;
+            n.interpolated
+                = within_error((x[0] + x[1]) / 2, (y[0] + y[1]) / 2, grid[1])
+               && within_error((x[0] + x[2]) / 2, (y[0] + y[2]) / 2, grid[3])
+               && within_error((x[0] + x[1] + x[2] + x[3]) / 4,
+                               (y[0] + y[1] + y[2] + y[3]) / 4, grid[4])
+               && within_error((x[1] + x[3]) / 2, (y[1] + y[3]) / 2, grid[5])
+               && within_error((x[2] + x[3]) / 2, (y[2] + y[3]) / 2, grid[7]);
+        }
+
+        // Cells where nothing can be transformed are not divided
+        if (n.interpolated || valid_count == 0 || depth >= m_max_depth)
+        {
+            return;
+        }
+
+        std::size_t const children = m_nodes.size();
+        m_nodes[index].children = children;
+        m_nodes.resize(children + 4);
+
+        for (std::size_t quadrant = 0; quadrant < 4; quadrant++)
+        {
+            // Index of the min/min corner of the child in the 3x3 points
+            std::size_t const first = (quadrant & 1) + ((quadrant & 2) ? 3 : 0);
+            result_type const child_corners[4] = {
+                grid[first], grid[first + 1], grid[first + 3], grid[first + 4]
+            };
+            build(children + quadrant,
+                  (quadrant & 1) ? mid_x : min_x, (quadrant & 2) ? mid_y : min_y,
+                  (quadrant & 1) ? max_x : mid_x, (quadrant & 2) ? max_y : mid_y,
+                  child_corners, depth + 1);
+        }
+    }
+
+    Transformer m_transformer;
+    calc_t m_min_x, m_min_y, m_max_x, m_max_y;
+    calc_t m_max_error;
+    std::size_t m_max_depth;
+    std::vector<node> m_nodes;
+};
+
+
+}} // namespace strategy::transform
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_STRATEGIES_TRANSFORM_SRS_APPROXIMATE_TRANSFORMER_HPP
@@ -0,0 +1,162 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/buffer_all.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    bg::strategy::buffer::distance_symmetric<double> distance(0.5);
+    bg::strategy::buffer::side_straight side;
+    bg::strategy::buffer::join_round join(16);
+    bg::strategy::buffer::end_round end(16);
+    bg::strategy::buffer::point_circle circle(16);
+
+    // A grid of crossing streets, and an isolated street far away
+    std::vector<linestring> streets;
+    for (int i = 0; i < 10; i++)
+    {
+        linestring horizontal, vertical;
+        bg::append(horizontal, P(0, i * 3));
+        bg::append(horizontal, P(30, i * 3 + 1));
+        bg::append(vertical, P(i * 3, 0));
+        bg::append(vertical, P(i * 3 + 1, 30));
+        streets.push_back(horizontal);
+        streets.push_back(vertical);
+    }
+    linestring isolated;
+    bg::read_wkt("LINESTRING(100 100,110 100)", isolated);
+    streets.push_back(isolated);
+    streets.push_back(linestring());
+
+    // Buffer them one by one and union them sequentially, as reference
+    multi_polygon expected;
+    std::vector<multi_polygon> expected_buffers;
+    for (linestring const& street : streets)
+    {
+        multi_polygon buffered, merged;
+        bg::buffer(street, buffered, distance, side, join, end, circle);
+        expected_buffers.push_back(buffered);
+        bg::union_(expected, buffered, merged);
+        expected = merged;
+    }
+
+    for (std::size_t threads : {1, 4})
+    {
+        std::vector<multi_polygon> buffers;
+        bg::buffer_all(streets, buffers, distance, side, join, end, circle, threads);
+        BOOST_CHECK_EQUAL(buffers.size(), streets.size());
+        for (std::size_t i = 0; i < buffers.size() && i < expected_buffers.size(); i++)
+        {
+            BOOST_CHECK_EQUAL(buffers[i].size(), expected_buffers[i].size());
+            BOOST_CHECK_CLOSE(bg::area(buffers[i]), bg::area(expected_buffers[i]), 0.001);
+        }
+
+        multi_polygon dissolved;
+        bg::buffer_dissolved(streets, dissolved, distance, side, join, end, circle, threads);
+        BOOST_CHECK_EQUAL(dissolved.size(), 2u);
+        BOOST_CHECK_EQUAL(dissolved.size(), expected.size());
+        BOOST_CHECK_CLOSE(bg::area(dissolved), bg::area(expected), 0.001);
+        BOOST_CHECK(bg::is_valid(dissolved));
+    }
+
+    // Overlapping points, dissolved as the buffer of a multi point
+    std::vector<P> points;
+    bg::model::multi_point<P> multi_point;
+    for (int i = 0; i < 50; i++)
+    {
+        P const point((i * 7919) % 20 / 4.0, (i * 104729) % 19 / 4.0);
+        points.push_back(point);
+        multi_point.push_back(point);
+    }
+    multi_polygon expected_points;
+    bg::buffer(multi_point, expected_points, distance, side, join, end, circle);
+    for (std::size_t threads : {1, 4})
+    {
+        multi_polygon dissolved;
+        bg::buffer_dissolved(points, dissolved, distance, side, join, end, circle, threads);
+        BOOST_CHECK_EQUAL(bg::num_points(dissolved), bg::num_points(expected_points));
+        BOOST_CHECK_CLOSE(bg::area(dissolved), bg::area(expected_points), 0.001);
+    }
+
+    // Empty input
+    std::vector<linestring> const none;
+    multi_polygon dissolved;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)))", dissolved);
+    bg::buffer_dissolved(none, dissolved, distance, side, join, end, circle, 4);
+    BOOST_CHECK(dissolved.empty());
+}
+
+template <typename P>
+void test_parallel_classification()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    bg::strategy::buffer::distance_symmetric<double> distance(2.0);
+    bg::strategy::buffer::side_straight side;
+    bg::strategy::buffer::join_round join(16);
+    bg::strategy::buffer::end_round end(16);
+    bg::strategy::buffer::point_circle circle(16);
+    bg::strategy::intersection::cartesian_segments<> intersection_strategy;
+    bg::detail::no_rescale_policy rescale_policy;
+
+    // Many overlapping circles, giving thousands of turns to classify
+    bg::model::multi_point<P> points;
+    for (int i = 0; i < 300; i++)
+    {
+        points.push_back(P((i * 7919) % 100 / 2.0, (i * 104729) % 97 / 2.0));
+    }
+
+    multi_polygon expected;
+    for (std::size_t threads : {1, 3, 8})
+    {
+        multi_polygon buffered;
+        bg::detail::buffer::visit_pieces_default_policy visitor;
+        bg::detail::buffer::buffer_inserter<polygon>(points,
+            bg::range::back_inserter(buffered),
+            distance, side, join, end, circle,
+            intersection_strategy, rescale_policy, visitor, threads);
+
+        if (threads == 1)
+        {
+            expected = buffered;
+            continue;
+        }
+
+        BOOST_CHECK_EQUAL(bg::num_points(buffered), bg::num_points(expected));
+        BOOST_CHECK_EQUAL(bg::area(buffered), bg::area(expected));
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_parallel_classification<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
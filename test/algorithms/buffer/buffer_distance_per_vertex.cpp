@@ -0,0 +1,168 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_buffer.hpp"
+
+#include <boost/geometry/strategies/agnostic/buffer_distance_per_vertex.hpp>
+
+static std::string const simplex = "LINESTRING(0 0,10 0)";
+static std::string const corridor = "LINESTRING(0 0,4 3,8 1,12 4,16 0)";
+static std::string const river = "LINESTRING(0 0,2 1,3 3,5 4,6 6,8 7,9 9)";
+static std::string const square = "POLYGON((0 0,0 10,10 10,10 0,0 0))";
+static std::string const square_vertices = "LINESTRING(0 0,0 10,10 10,10 0,0 0)";
+
+// Distance increasing from west to east
+template <typename Point>
+struct distance_by_x
+{
+    inline double operator()(Point const& point) const
+    {
+        return 0.5 + bg::get<0>(point) / 10.0;
+    }
+};
+
+// A distance strategy without a distance per vertex, using the second point
+// of the segment it is called for. It is called as before, with the two
+// points of the segment, so its buffer does not change.
+struct distance_by_second_point
+    : bg::strategy::buffer::distance_symmetric<double>
+{
+    distance_by_second_point()
+        : bg::strategy::buffer::distance_symmetric<double>(2.1)
+    {}
+
+    template <typename Point>
+    inline double apply(Point const& , Point const& p2,
+                bg::strategy::buffer::buffer_side_selector ) const
+    {
+        return 0.5 + bg::get<0>(p2) / 10.0;
+    }
+};
+
+template <typename Geometry, typename Polygon, typename JoinStrategy, typename EndStrategy>
+void test_table(std::string const& caseid, std::string const& wkt,
+                std::string const& vertices_wkt,
+                JoinStrategy const& join, EndStrategy const& end,
+                std::vector<double> const& distances,
+                expectation_limits const& expected_area,
+                ut_settings const& settings = ut_settings())
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::strategy::buffer::vertex_distances<point_type> table_type;
+
+    // The vertices, in the order of the distances
+    bg::model::linestring<point_type> vertices;
+    bg::read_wkt(vertices_wkt, vertices);
+
+    table_type const table(vertices, distances);
+
+    test_with_custom_strategies<Geometry, Polygon>(caseid, wkt, join, end,
+        bg::strategy::buffer::distance_per_vertex<double, table_type>(table,
+            table.min_distance(), table.max_distance()),
+        bg::strategy::buffer::side_straight(),
+        bg::strategy::buffer::point_circle(88),
+        expected_area, settings);
+}
+
+template <bool Clockwise, typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P, Clockwise> polygon;
+    typedef bg::model::ring<P, Clockwise> ring;
+
+    bg::strategy::buffer::join_round join_round(88);
+    bg::strategy::buffer::join_miter join_miter;
+    bg::strategy::buffer::end_round end_round(88);
+    bg::strategy::buffer::end_flat end_flat;
+
+    // With the same distance everywhere, it is the same as distance_symmetric
+    test_table<linestring, polygon>("simplex_1_1", simplex, simplex,
+        join_round, end_flat,
+        {1.0, 1.0}, 20.0);
+    test_table<linestring, polygon>("corridor_1", corridor, corridor,
+        join_round, end_round,
+        {1.0, 1.0, 1.0, 1.0, 1.0}, 43.1137);
+
+    // The sides are tangent to the circles at both ends. With flat ends it is
+    // a trapezoid, shifted along the segment. With round ends it is the
+    // convex hull of the two circles (38.0041 for a full circle).
+    test_table<linestring, polygon>("simplex_1_2", simplex, simplex,
+        join_round, end_flat,
+        {1.0, 2.0}, 29.5511);
+    test_table<linestring, polygon>("simplex_1_2_round", simplex, simplex,
+        join_round, end_round,
+        {1.0, 2.0}, 37.9973);
+
+    // Narrow and wide parts along a corridor
+    test_table<linestring, polygon>("corridor_var", corridor, corridor,
+        join_round, end_round,
+        {0.5, 1.5, 0.5, 2.0, 1.0}, 51.3815);
+    test_table<linestring, polygon>("corridor_var_table", corridor, corridor,
+        join_round, bg::strategy::buffer::end_round(88, bg::strategy::buffer::circle_by_table),
+        {0.5, 1.5, 0.5, 2.0, 1.0}, 51.3815);
+    test_table<linestring, polygon>("corridor_var_miter", corridor, corridor,
+        join_miter, end_flat,
+        {0.5, 1.5, 0.5, 2.0, 1.0}, 52.1584);
+
+    // Alternating narrow and wide parts, the wide joins overlap the narrow sides.
+    // The distance changes more than the segment length, so the sides are
+    // not tangent and the wide circles are not completely covered
+    test_table<linestring, polygon>("river", river, river,
+        join_round, end_round,
+        {0.2, 3.0, 0.2, 3.0, 0.2, 3.0, 0.2}, 47.6262);
+
+    // Inflate and deflate a polygon with a different distance per corner
+    test_table<polygon, polygon>("square", square, square_vertices,
+        join_round, end_flat,
+        {1.0, 2.0, 3.0, 2.0, 1.0}, 194.5250);
+    test_table<ring, polygon>("square_ring", square, square_vertices,
+        join_round, end_flat,
+        {1.0, 2.0, 3.0, 2.0, 1.0}, 194.5250);
+    test_table<polygon, polygon>("square_deflate", square, square_vertices,
+        join_round, end_flat,
+        {-1.0, -2.0, -3.0, -2.0, -1.0}, 36.9806);
+
+    // Using a function, on a linestring and on its points
+    {
+        typedef bg::strategy::buffer::distance_per_vertex
+            <
+                double, distance_by_x<P>
+            > distance_strategy;
+
+        test_with_custom_strategies<linestring, polygon>("corridor_by_x",
+            corridor, join_round, end_round,
+            distance_strategy(distance_by_x<P>(), 0.5, 2.1),
+            bg::strategy::buffer::side_straight(),
+            bg::strategy::buffer::point_circle(88), 60.2177);
+        test_with_custom_strategies<bg::model::multi_point<P>, polygon>("points_by_x",
+            "MULTIPOINT(0 0,10 0)", join_round, end_round,
+            distance_strategy(distance_by_x<P>(), 0.5, 2.1),
+            bg::strategy::buffer::side_straight(),
+            bg::strategy::buffer::point_circle(88), 7.8473);
+    }
+
+    BOOST_STATIC_ASSERT(! bg::strategy::buffer::is_distance_per_vertex
+        <
+            distance_by_second_point
+        >::value);
+    test_with_custom_strategies<linestring, polygon>("corridor_by_segment",
+        corridor, join_round, end_round,
+        distance_by_second_point(),
+        bg::strategy::buffer::side_straight(),
+        bg::strategy::buffer::point_circle(88), 61.6534);
+}
+
+int test_main(int, char* [])
+{
+    BoostGeometryWriteTestConfiguration();
+
+    test_all<true, bg::model::point<default_test_type, 2, bg::cs::cartesian> >();
+    test_all<false, bg::model::point<default_test_type, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_buffer_geo.hpp"
+
+static std::string const equator = "LINESTRING(0 0,1 0)";
+static std::string const meridian = "LINESTRING(4.9 52.0,4.9 53.0)";
+static std::string const amsterdam = "LINESTRING(4.88 52.37,4.90 52.38,4.92 52.37)";
+static std::string const zigzag = "LINESTRING(4.9 52.0,5.0 52.1,5.1 52.0,4.95 52.05,5.2 52.1)";
+static std::string const north = "LINESTRING(-20 70,0 75,20 70)";
+
+template <typename FormulaPolicy, bool Clockwise, typename PointType>
+void test_linestring()
+{
+    typedef bg::model::linestring<PointType> linestring;
+    typedef bg::model::polygon<PointType, Clockwise> polygon;
+
+    bg::strategy::buffer::geographic_join_round<FormulaPolicy> join_round(90);
+    bg::strategy::buffer::geographic_end_round<FormulaPolicy> end_round(90);
+
+    // A buffer around a (geodesic) line of one degree along the equator
+    // approaches 2 * 1000 * 111319.49 + pi * 1000 * 1000 square meters,
+    // along the meridian it is slightly smaller
+    test_one_geo<linestring, polygon>("equator", equator, join_round, end_round, 225780000.0, 1000.0);
+    test_one_geo<linestring, polygon>("meridian", meridian, join_round, end_round, 225698330.0, 1000.0);
+
+    test_one_geo<linestring, polygon>("amsterdam_10", amsterdam, join_round, end_round, 70652.87, 10.0);
+    test_one_geo<linestring, polygon>("amsterdam_100", amsterdam, join_round, end_round, 733588.4, 100.0);
+    test_one_geo<linestring, polygon>("amsterdam_1000", amsterdam, join_round, end_round, 10041857.0, 1000.0);
+    test_one_geo<linestring, polygon>("zigzag_500", zigzag, join_round, end_round, 53370580.0, 500.0);
+    test_one_geo<linestring, polygon>("zigzag_5000", zigzag, join_round, end_round, 441791600.0, 5000.0);
+    test_one_geo<linestring, polygon>("north", north, join_round, end_round, 181098980000.0, 50000.0);
+
+    // Asymmetric, 100 meters to the left and 50 meters to the right
+    test_one_geo<linestring, polygon>("amsterdam_asym", amsterdam, join_round, end_round, 550100.1, 100.0, ut_settings(), 50.0);
+}
+
+int test_main(int, char* [])
+{
+    BoostGeometryWriteTestConfiguration();
+
+    typedef bg::model::point<default_test_type, 2, bg::cs::geographic<bg::degree> > point_type;
+
+    test_linestring<bg::strategy::andoyer, true, point_type>();
+    test_linestring<bg::strategy::andoyer, false, point_type>();
+    test_linestring<bg::strategy::thomas, true, point_type>();
+    test_linestring<bg::strategy::vincenty, true, point_type>();
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_buffer_geo.hpp"
+
+static std::string const triangle = "POLYGON((4.9 52.0,5.0 52.1,5.1 52.0,4.9 52.0))";
+static std::string const concave = "POLYGON((4.9 52.0,4.9 52.2,5.0 52.1,5.1 52.2,5.1 52.0,4.9 52.0))";
+static std::string const with_hole = "POLYGON((4.8 51.9,4.8 52.3,5.2 52.3,5.2 51.9,4.8 51.9),(4.9 52.0,5.1 52.0,5.1 52.2,4.9 52.2,4.9 52.0))";
+static std::string const greenland = "POLYGON((-50 60,-55 70,-60 77,-40 83,-20 82,-20 70,-40 60,-50 60))";
+
+template <bool Clockwise, typename PointType>
+void test_polygon()
+{
+    typedef bg::model::polygon<PointType, Clockwise> polygon;
+
+    bg::strategy::buffer::geographic_join_round<> join_round(90);
+    bg::strategy::buffer::geographic_end_round<> end_round(90);
+
+    test_one_geo<polygon, polygon>("triangle_1000", triangle, join_round, end_round, 1, 0, 119402515.0, 1000.0);
+    test_one_geo<polygon, polygon>("triangle_m1000", triangle, join_round, end_round, 1, 0, 41710519.0, -1000.0);
+    test_one_geo<polygon, polygon>("concave_1000", concave, join_round, end_round, 1, 0, 315779821.0, 1000.0);
+    test_one_geo<polygon, polygon>("concave_m1000", concave, join_round, end_round, 1, 0, 154392464.0, -1000.0);
+
+    // The hole disappears for large distances
+    test_one_geo<polygon, polygon>("with_hole_1000", with_hole, join_round, end_round, 1, 1, 1129851269.0, 1000.0);
+    test_one_geo<polygon, polygon>("with_hole_10000", with_hole, join_round, end_round, 1, 0, 2972214616.0, 10000.0);
+
+    test_one_geo<polygon, polygon>("greenland", greenland, join_round, end_round, 1, 0, 3034780842372.0, 100000.0);
+}
+
+int test_main(int, char* [])
+{
+    BoostGeometryWriteTestConfiguration();
+
+    test_polygon<true, bg::model::point<default_test_type, 2, bg::cs::geographic<bg::degree> > >();
+    test_polygon<false, bg::model::point<default_test_type, 2, bg::cs::geographic<bg::degree> > >();
+
+    return 0;
+}
@@ -18,7 +18,10 @@
 // For test
 #include <boost/geometry/algorithms/area.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
 #include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
 
 
 // This unit test tests boost::geometry::buffer (overload with strategies)
@@ -131,11 +134,84 @@ void test_all()
         35.2257, 166);
 }
 
+template <typename Geometry, typename MultiPolygon>
+void test_circle_by_table(std::string const& caseid, std::string const& wkt,
+                          std::size_t points_per_circle, bool joined)
+{
+    typedef typename bg::point_type<MultiPolygon>::type point_type;
+    namespace bs = bg::strategy::buffer;
+
+    Geometry g;
+    bg::read_wkt(wkt, g);
+    bg::correct(g);
+
+    bs::distance_symmetric<double> const distance(2.5);
+    bs::side_straight const side;
+
+    MultiPolygon by_trigonometry, by_table;
+    bg::buffer(g, by_trigonometry, distance, side,
+               bs::join_round(points_per_circle),
+               bs::end_round(points_per_circle),
+               bs::point_circle(points_per_circle));
+    bg::buffer(g, by_table, distance, side,
+               bs::join_round(points_per_circle, bs::circle_by_table),
+               bs::end_round(points_per_circle, bs::circle_by_table),
+               bs::point_circle(points_per_circle, bs::circle_by_table));
+
+    std::vector<point_type> expected, detected;
+    bg::for_each_point(by_trigonometry, [&](point_type const& p) { expected.push_back(p); });
+    bg::for_each_point(by_table, [&](point_type const& p) { detected.push_back(p); });
+
+    if (joined)
+    {
+        // Joins divide their angle in other steps than the table, so their
+        // points (and the intersections of the pieces) differ. Both buffers
+        // are within the sagitta of one step from the exact buffer.
+        double const sagitta = 2.5 * (1.0 - std::cos(bg::math::pi<double>() / points_per_circle));
+        double const tolerance = bg::perimeter(by_trigonometry) * sagitta;
+        double const difference = std::fabs(bg::area(by_trigonometry) - bg::area(by_table));
+        BOOST_CHECK_MESSAGE(difference < tolerance,
+            "Buffer " << caseid << " areas differ " << difference
+            << " tolerance: " << tolerance);
+        return;
+    }
+
+    BOOST_CHECK_MESSAGE(expected.size() == detected.size(),
+        "Buffer " << caseid << " numpoints expected: " << expected.size()
+        << " detected: " << detected.size());
+
+    // The documented tolerance is points_per_circle * 1e-15 * distance
+    double const tolerance = points_per_circle * 1.0e-15 * 2.5;
+    double max_difference = 0;
+    for (std::size_t i = 0; i < expected.size() && i < detected.size(); i++)
+    {
+        max_difference = (std::max)(max_difference,
+                                    bg::distance(expected[i], detected[i]));
+    }
+    BOOST_CHECK_MESSAGE(max_difference < tolerance,
+        "Buffer " << caseid << " points differ " << max_difference);
+}
+
 int test_main(int, char* [])
 {
     BoostGeometryWriteTestConfiguration();
 
     test_all<true, bg::model::point<default_test_type, 2, bg::cs::cartesian> >();
 
+    // The tables are calculated once per number of points
+    BOOST_CHECK(bg::detail::buffer::unit_circle::create(bg::strategy::buffer::circle_by_table, 36)
+             == bg::detail::buffer::unit_circle::create(bg::strategy::buffer::circle_by_table, 36));
+
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point;
+    typedef bg::model::multi_polygon<bg::model::polygon<point> > multi_polygon;
+    for (std::size_t points_per_circle : {5, 36, 90, 360, 3600})
+    {
+        test_circle_by_table<bg::model::polygon<point>, multi_polygon>("polygon_simplex", polygon_simplex, points_per_circle, true);
+        test_circle_by_table<multi_polygon, multi_polygon>("multi_polygon_simplex", multi_polygon_simplex, points_per_circle, true);
+        test_circle_by_table<bg::model::linestring<point>, multi_polygon>("linestring", "LINESTRING(0 0,4 5,7 4,10 6)", points_per_circle, true);
+        test_circle_by_table<bg::model::linestring<point>, multi_polygon>("segment", "LINESTRING(0 0,4 5)", points_per_circle, false);
+        test_circle_by_table<point, multi_polygon>("point", "POINT(1 2)", points_per_circle, false);
+    }
+
     return 0;
 }
@@ -13,6 +13,30 @@
 
 #include "test_buffer.hpp"
 
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct JoinTestProperties
+    <
+        boost::geometry::strategy::buffer::geographic_join_round
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >
+    >
+{
+    static std::string name() { return "round"; }
+};
+
+template <typename FormulaPolicy, typename Spheroid, typename CalculationType>
+struct EndTestProperties
+    <
+        boost::geometry::strategy::buffer::geographic_end_round
+            <
+                FormulaPolicy, Spheroid, CalculationType
+            >
+    >
+{
+    static std::string name() { return "round"; }
+};
+
 template
 <
     typename Geometry,
@@ -31,7 +55,7 @@ void test_one_geo(std::string const& caseid,
     bg::read_wkt(wkt, input_geometry);
     bg::correct(input_geometry);
 
-    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::geographic_side_straight<> side_strategy;
     bg::strategy::buffer::distance_asymmetric
     <
         typename bg::coordinate_type<Geometry>::type
@@ -17,8 +17,10 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <sstream>
 #include <string>
 
 #include <algorithms/test_convex_hull.hpp>
@@ -37,6 +39,9 @@
 #include <boost/geometry/geometries/multi_linestring.hpp>
 #include <boost/geometry/geometries/multi_polygon.hpp>
 
+#include <boost/geometry/strategies/cartesian/hull_akl_toussaint.hpp>
+#include <boost/geometry/strategies/cartesian/hull_chan.hpp>
+
 
 
 
@@ -77,11 +82,97 @@ void test_all()
 }
 
 
+template <typename Geometry>
+void test_other_strategies(std::string const& caseid, Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> hull_type;
+
+    hull_type expected;
+    bg::convex_hull(geometry, expected,
+        bg::strategy::convex_hull::graham_andrew<Geometry, point_type>());
+    std::ostringstream expected_wkt;
+    expected_wkt << bg::wkt(expected);
+
+    for (std::size_t thread_count : { 1, 2, 4 })
+    {
+        hull_type hull_akl, hull_chan;
+        bg::convex_hull(geometry, hull_akl,
+            bg::strategy::convex_hull::akl_toussaint<Geometry, point_type>(thread_count));
+        bg::convex_hull(geometry, hull_chan,
+            bg::strategy::convex_hull::chan<Geometry, point_type>(thread_count));
+
+        std::ostringstream akl_wkt, chan_wkt;
+        akl_wkt << bg::wkt(hull_akl);
+        chan_wkt << bg::wkt(hull_chan);
+        BOOST_CHECK_MESSAGE(akl_wkt.str() == expected_wkt.str(),
+            caseid << " akl_toussaint threads: " << thread_count
+            << " expected: " << expected_wkt.str()
+            << " detected: " << akl_wkt.str());
+        BOOST_CHECK_MESSAGE(chan_wkt.str() == expected_wkt.str(),
+            caseid << " chan threads: " << thread_count
+            << " expected: " << expected_wkt.str()
+            << " detected: " << chan_wkt.str());
+    }
+}
+
+template <typename P>
+void test_other_strategies()
+{
+    typedef bg::model::multi_point<P> mp;
+    typedef bg::model::multi_polygon<bg::model::polygon<P> > mpoly;
+
+    std::string const wkts[] =
+    {
+        "MULTIPOINT((1 0))",
+        "MULTIPOINT((1 0),(1 0),(1 0))",
+        "MULTIPOINT((1 0),(5 0),(3 0),(4 0),(2 0))",
+        "MULTIPOINT((0 0),(5 0),(1 1),(4 1))",
+        "MULTIPOINT((2 9),(1 3),(9 4),(1 1),(1 0),(7 9),(2 5),(3 7),(3 6),(2 4))",
+        "MULTIPOINT((0 53),(0 103),(0 53),(0 3),(0 3),(0 0),(1 0),(1 1),(2 1),(2 0),(2 0),(2 0),(3 0),(3 1),(4 1),(4 0),(5 0),(0 3),(10 3),(10 2),(10 2),(10 2),(5 2),(5 0),(5 0),(55 0),(105 0))"
+    };
+    for (std::string const& wkt : wkts)
+    {
+        mp geometry;
+        bg::read_wkt(wkt, geometry);
+        test_other_strategies(wkt, geometry);
+    }
+
+    {
+        mpoly geometry;
+        bg::read_wkt("multipolygon(((1 4,1 6,2 5,3 5,4 6,4 4,1 4)), ((4 2,4 3,6 3,6 2,4 2)))", geometry);
+        test_other_strategies("mpoly", geometry);
+    }
+
+    // Large inputs, such that they are processed in parallel: random points
+    // in a square, points on a grid (with many collinear points on the hull)
+    // and points on a circle (all on the hull)
+    mp random_points, grid, circle;
+    unsigned int seed = 12345;
+    for (std::size_t i = 0; i < 200000; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        double const x = (seed >> 8) % 100000;
+        seed = seed * 1103515245u + 12345u;
+        double const y = (seed >> 8) % 100000;
+        bg::append(random_points, P(x, y));
+        bg::append(grid, P(i % 500, i / 500));
+        double const angle = i * 2.0 * 3.14159265358979323846 / 200000;
+        bg::append(circle, P(std::cos(angle), std::sin(angle)));
+    }
+    test_other_strategies("random", random_points);
+    test_other_strategies("grid", grid);
+    test_other_strategies("circle", circle);
+}
+
+
 int test_main(int, char* [])
 {
     //test_all<bg::model::d2::point_xy<int> >();
     //test_all<bg::model::d2::point_xy<float> >();
     test_all<bg::model::d2::point_xy<double> >();
 
+    test_other_strategies<bg::model::d2::point_xy<double> >();
+
     return 0;
 }
@@ -0,0 +1,126 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2026 Boost.Geometry contributors.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+
+
+namespace bgp = bg::detail::parallel;
+
+void test_blocks(std::size_t count, std::size_t threads, std::size_t grain)
+{
+    // Each block writes its own indices only
+    std::vector<std::size_t> visits(count, 0);
+    std::vector<std::size_t> block_sizes(count, 0);
+
+    bgp::for_each_block(count, threads, grain,
+        [&](std::size_t first, std::size_t last)
+        {
+            BOOST_CHECK_LT(first, last);
+            block_sizes[first] = last - first;
+            for (std::size_t i = first; i < last; i++)
+            {
+                visits[i]++;
+            }
+        });
+
+    // A grain of 0 is taken as 1
+    std::size_t const size = (std::max)(grain, std::size_t(1));
+    for (std::size_t i = 0; i < count; i++)
+    {
+        BOOST_CHECK_EQUAL(visits[i], 1u);
+        // Blocks start at multiples of grain and are at most grain long
+        if (block_sizes[i] > 0)
+        {
+            BOOST_CHECK_EQUAL(i % size, 0u);
+            BOOST_CHECK_LE(block_sizes[i], size);
+        }
+        else
+        {
+            BOOST_CHECK_NE(i % size, 0u);
+        }
+    }
+}
+
+void test_sequential_order()
+{
+    std::vector<std::size_t> firsts;
+    bgp::for_each_block(10, 1, 3,
+        [&](std::size_t first, std::size_t last)
+        {
+            BOOST_CHECK_LE(last - first, 3u);
+            firsts.push_back(first);
+        });
+
+    std::size_t const expected[] = { 0, 3, 6, 9 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(firsts.begin(), firsts.end(),
+                                  expected, expected + 4);
+}
+
+void test_exception(std::size_t threads)
+{
+    bool thrown = false;
+    try
+    {
+        bgp::for_each_index(100, threads,
+            [](std::size_t i)
+            {
+                if (i == 42)
+                {
+                    throw std::runtime_error("42");
+                }
+            });
+    }
+    catch (std::runtime_error const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+void test_sort(std::size_t count, std::size_t threads)
+{
+    std::vector<std::size_t> values(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        values[i] = (i * 7919) % 10007;
+    }
+    std::vector<std::size_t> expected(values);
+    std::sort(expected.begin(), expected.end());
+
+    bgp::sort(values.begin(), values.end(), std::less<std::size_t>(), threads);
+    BOOST_CHECK(values == expected);
+}
+
+int test_main(int, char* [])
+{
+    for (std::size_t threads : { 1, 4, 0 })
+    {
+        test_blocks(0, threads, 8);
+        test_blocks(1, threads, 8);
+        test_blocks(100, threads, 1);
+        test_blocks(100, threads, 7);
+        test_blocks(1000, threads, 1000);
+        test_blocks(1000, threads, 5000);
+        test_blocks(1000, threads, 0);
+        test_exception(threads);
+        test_sort(100000, threads);
+    }
+    test_sequential_order();
+
+    return 0;
+}
@@ -358,10 +358,41 @@ void test_large_integers()
 }
 
 
+void test_adaptive_max_count()
+{
+    typedef bg::model::d2::point_xy<double> point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+    // Small geometries use the default
+    linestring_type small;
+    bg::read_wkt("LINESTRING(0 0,1 1,2 0,3 1)", small);
+    BOOST_CHECK_EQUAL(bg::detail::sectionalize::select_max_count(small), 10u);
+
+    // Long monotonic lines, along an axis and along a diagonal
+    linestring_type axis, diagonal;
+    for (int i = 0; i < 100000; i++)
+    {
+        bg::append(axis, point_type(i, 0.0));
+        bg::append(diagonal, point_type(i, i));
+    }
+    std::size_t const axis_count = bg::detail::sectionalize::select_max_count(axis);
+    std::size_t const diagonal_count = bg::detail::sectionalize::select_max_count(diagonal);
+    BOOST_CHECK_GT(axis_count, 10u);
+    BOOST_CHECK_LT(diagonal_count, axis_count);
+
+    bg::sections<bg::model::box<point_type>, 2> sections;
+    bg::sectionalize<false, dimensions>(axis, bg::detail::no_rescale_policy(),
+        sections, 0, bg::detail::sectionalize::adaptive_max_count);
+    // Less sections than with the default of 10
+    BOOST_CHECK_LT(sections.size(), (axis.size() - 1) / 10);
+}
+
 
 int test_main(int, char* [])
 {
     test_large_integers();
+    test_adaptive_max_count();
 
     //test_all<bg::model::d2::point_xy<float> >();
     test_all<bg::model::d2::point_xy<double> >();
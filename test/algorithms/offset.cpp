@@ -0,0 +1,179 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/offset.hpp>
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/for_each.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+static std::string const simplex = "LINESTRING(0 0,1 1)";
+static std::string const one_bend = "LINESTRING(0 0,4 5,7 4)";
+static std::string const two_bends = "LINESTRING(0 0,4 5,7 4,10 6)";
+static std::string const overlapping = "LINESTRING(0 0,4 5,7 4,10 6,10 2,2 2)";
+static std::string const curve = "LINESTRING(2 7,3 5,5 4,7 5,8 7)";
+static std::string const collinear = "LINESTRING(0 0,2 0,4 0,4 0,6 0)";
+static std::string const spike = "LINESTRING(0 0,5 0,2 0)";
+static std::string const bump = "LINESTRING(0 0,10 0,10 1,11 1,11 0,20 0)";
+static std::string const zigzag = "LINESTRING(0 0,1 1,2 0,3 1,4 0,5 1,6 0,7 1,8 0)";
+static std::string const multi = "MULTILINESTRING((0 0,4 5,7 4),(12 7,13 5,15 4,17 5,18 7))";
+
+
+// Returns true if no two non-adjacent segments of the linestring(s) intersect
+template <typename Geometry>
+bool is_simple_curve(Geometry const& geometry)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::referring_segment<point_type const> segment_type;
+
+    bool result = true;
+    std::size_t index1 = 0;
+    bg::for_each_segment(geometry, [&](segment_type const& s1)
+    {
+        std::size_t index2 = 0;
+        bg::for_each_segment(geometry, [&](segment_type const& s2)
+        {
+            if (index2 > index1 + 1 && bg::intersects(s1, s2))
+            {
+                result = false;
+            }
+            index2++;
+        });
+        index1++;
+    });
+    return result;
+}
+
+template <typename Geometry, typename SideStrategy, typename JoinStrategy>
+void test_offset(std::string const& caseid, std::string const& wkt,
+        double distance, double expected_length,
+        SideStrategy const& side_strategy,
+        JoinStrategy const& join_strategy)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    Geometry offsetted;
+    bg::offset(geometry, offsetted, distance, side_strategy, join_strategy);
+
+    double const length = bg::length(offsetted);
+    BOOST_CHECK_MESSAGE(bg::math::abs(length - expected_length) < 0.001 * (1.0 + expected_length / 1000.0),
+            "offset: " << caseid
+            << std::setprecision(10) << " length expected: " << expected_length
+            << " detected: " << length
+            << " offset: " << bg::wkt(offsetted));
+
+    BOOST_CHECK_MESSAGE(is_simple_curve(offsetted),
+            "offset: " << caseid << " is not simple: " << bg::wkt(offsetted));
+
+    // All vertices are at least at the distance from the input
+    double const limit = bg::math::abs(distance) * 0.999;
+    bg::for_each_point(offsetted, [&](point_type const& point)
+    {
+        BOOST_CHECK_MESSAGE(bg::distance(point, geometry) > limit,
+                "offset: " << caseid << " vertex too close: " << bg::wkt(point));
+    });
+}
+
+template <typename Geometry>
+void test_one(std::string const& caseid, std::string const& wkt,
+        double distance, double expected_length_left, double expected_length_right)
+{
+    bg::strategy::buffer::side_straight side;
+    bg::strategy::buffer::join_round join(90);
+
+    test_offset<Geometry>(caseid + "_left", wkt, distance,
+                          expected_length_left, side, join);
+    test_offset<Geometry>(caseid + "_right", wkt, -distance,
+                          expected_length_right, side, join);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+
+    test_one<linestring>("simplex", simplex, 0.5, std::sqrt(2.0), std::sqrt(2.0));
+    test_one<linestring>("one_bend", one_bend, 0.5, 10.1733, 8.8681);
+    test_one<linestring>("two_bends", two_bends, 0.5, 13.2898, 12.9281);
+    test_one<linestring>("curve", curve, 0.5, 7.7776, 10.0507);
+    test_one<linestring>("collinear", collinear, 1.0, 6.0, 6.0);
+    test_one<linestring>("spike", spike, 1.0, 10.0, 10.0);
+
+    // The loops at the bump and at the zigzag are cut off, and for overlapping
+    // the tail of the right side, which comes too close to the first segment
+    test_one<linestring>("bump", bump, 2.0, 20.7251, 20.0110);
+    test_one<linestring>("zigzag", zigzag, 1.0, 11.5957, 8.0252);
+    test_one<linestring>("overlapping", overlapping, 0.5, 27.1551, 21.4196);
+
+    test_one<multi_linestring>("multi", multi, 0.5, 17.9509, 18.9188);
+
+    // With miter joins
+    test_offset<linestring>("one_bend_miter", one_bend, 0.5, 10.2627,
+        bg::strategy::buffer::side_straight(),
+        bg::strategy::buffer::join_miter());
+
+    // Without strategies
+    {
+        linestring ls, offsetted;
+        bg::read_wkt(one_bend, ls);
+        bg::offset(ls, offsetted, -0.5);
+        BOOST_CHECK_CLOSE(bg::length(offsetted), 8.8681, 0.01);
+    }
+}
+
+template <typename P>
+void test_geographic()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    bg::strategy::buffer::geographic_side_straight<> side;
+    bg::strategy::buffer::geographic_join_round<> join(90);
+
+    // Offsets of 100 meters along a road in Amsterdam
+    test_offset<linestring>("amsterdam_left",
+        "LINESTRING(4.88 52.37,4.90 52.38,4.92 52.37)", 100.0, 3654.56, side, join);
+    test_offset<linestring>("amsterdam_right",
+        "LINESTRING(4.88 52.37,4.90 52.38,4.92 52.37)", -100.0, 3354.26, side, join);
+
+    // The same road, shifted to the antimeridian
+    test_offset<linestring>("antimeridian_left",
+        "LINESTRING(179.99 52.37,-179.99 52.38,-179.97 52.37)", 100.0, 3654.56, side, join);
+    test_offset<linestring>("antimeridian_right",
+        "LINESTRING(179.99 52.37,-179.99 52.38,-179.97 52.37)", -100.0, 3354.26, side, join);
+
+    // Zigzag with crossings at its concave bends, at the equator and
+    // across the antimeridian
+    test_offset<linestring>("zigzag",
+        "LINESTRING(0 0,0.01 0.01,0.02 0,0.03 0.01,0.04 0,0.05 0.01,0.06 0)",
+        -100.0, 9130.87, side, join);
+    test_offset<linestring>("zigzag_antimeridian",
+        "LINESTRING(179.97 0,179.98 0.01,179.99 0,180 0.01,-179.99 0,-179.98 0.01,-179.97 0)",
+        -100.0, 9130.87, side, join);
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_geographic<bg::model::point<double, 2, bg::cs::geographic<bg::degree> > >();
+
+    return 0;
+}
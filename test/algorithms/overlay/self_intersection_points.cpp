@@ -26,6 +26,8 @@
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
 #include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_simple.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
 //#include <boost/geometry/algorithms/detail/overlay/self_intersection_points.hpp>
 #include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
 #include <boost/geometry/policies/robustness/get_rescale_policy.hpp>
@@ -73,6 +75,17 @@ static void test_self_intersection_points(std::string const& case_id,
             bg::detail::overlay::assign_null_policy
         >(geometry, strategy, rescale_policy, turns, policy);
 
+    // The sweep line should find the same turns as partition
+    std::vector<turn_info> sweep_turns;
+    bg::self_turns
+        <
+            bg::detail::overlay::assign_null_policy
+        >(geometry, bg::strategy::intersection::cartesian_segments_sweep<>(),
+          rescale_policy, sweep_turns, policy);
+    BOOST_CHECK_MESSAGE(sweep_turns.size() == turns.size(),
+        "Case " << case_id << " sweep detected: " << sweep_turns.size()
+        << " expected: " << turns.size());
+
 
     typedef typename bg::coordinate_type<Geometry>::type ct;
     ct zero = ct();
@@ -272,8 +285,66 @@ void test_self_all()
     test_self_ls<P>();
 }
 
+// Long, nearly horizontal coastlines, compare sweep line with partition
+template <typename P>
+void test_self_sweep()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::strategy::intersection::cartesian_segments<> partition_strategy;
+    typedef bg::strategy::intersection::cartesian_segments_sweep<> sweep_strategy;
+
+    int const n = 2000;
+    linestring coast;
+    for (int i = 0; i <= n; i++)
+    {
+        bg::append(coast, P(i * 0.5, (i * 7 % 11) * 0.01));
+    }
+    BOOST_CHECK_EQUAL(bg::is_simple(coast, sweep_strategy()), true);
+
+    // Fold back: overlapping the first part of the coast
+    linestring folded = coast;
+    bg::append(folded, P(n * 0.5, 1.0));
+    bg::append(folded, P(0.25, -0.1));
+    BOOST_CHECK_EQUAL(bg::is_simple(folded, sweep_strategy()), false);
+    BOOST_CHECK_EQUAL(bg::is_simple(folded, partition_strategy()), false);
+
+    // A tall section at the start, folding back only after it left
+    // the sweep line
+    linestring tall;
+    bg::append(tall, P(-1.0, 100.0));
+    bg::append(tall, coast);
+    bg::append(tall, P(n * 0.5, 1.0));
+    bg::append(tall, P(n * 0.25, -0.1));
+    BOOST_CHECK_EQUAL(bg::is_simple(tall, sweep_strategy()), false);
+    BOOST_CHECK_EQUAL(bg::is_simple(tall, partition_strategy()), false);
+
+    polygon island;
+    for (int i = 0; i <= n; i++)
+    {
+        bg::append(island.outer(), P(i * 0.5, 1.0 + (i * 7 % 11) * 0.01));
+    }
+    bg::append(island.outer(), P(n * 0.5, 0.0));
+    bg::append(island.outer(), P(0.0, 0.0));
+    bg::correct(island);
+    BOOST_CHECK_EQUAL(bg::is_valid(island, sweep_strategy()),
+                      bg::is_valid(island, partition_strategy()));
+    test_self_intersection_points("coast", 0, island, false);
+
+    // Hole crossing the coast
+    island.inners().resize(1);
+    bg::append(island, P(10.0, 0.5), 0);
+    bg::append(island, P(20.0, 1.5), 0);
+    bg::append(island, P(20.0, 0.5), 0);
+    bg::append(island, P(10.0, 0.5), 0);
+    bg::correct(island);
+    BOOST_CHECK_EQUAL(bg::is_valid(island, sweep_strategy()), false);
+    BOOST_CHECK_EQUAL(bg::is_valid(island, partition_strategy()), false);
+}
+
 int test_main(int, char* [])
 {
     test_self_all<bg::model::d2::point_xy<double> >();
+    test_self_sweep<bg::model::d2::point_xy<double> >();
     return 0;
 }
@@ -0,0 +1,296 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/prepared.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Geometry, typename Prepared>
+void check_intersects(std::string const& wkt, bg::prepared<Prepared> const& prepared)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    Prepared const& original = prepared.geometry();
+
+    BOOST_CHECK_MESSAGE(bg::intersects(geometry, prepared) == bg::intersects(geometry, original),
+        "intersects: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::intersects(prepared, geometry) == bg::intersects(original, geometry),
+        "intersects (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::disjoint(geometry, prepared) == bg::disjoint(geometry, original),
+        "disjoint: " << wkt << " with " << bg::wkt(original));
+}
+
+template <typename Geometry, typename Prepared>
+void check_predicates(std::string const& wkt, bg::prepared<Prepared> const& prepared)
+{
+    check_intersects<Geometry>(wkt, prepared);
+
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    Prepared const& original = prepared.geometry();
+    BOOST_CHECK_MESSAGE(bg::within(geometry, prepared) == bg::within(geometry, original),
+        "within: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::covered_by(geometry, prepared) == bg::covered_by(geometry, original),
+        "covered_by: " << wkt << " with " << bg::wkt(original));
+    // Not all combinations are implemented by within and covered_by,
+    // relate is used with their masks
+    typedef typename bg::detail::de9im::static_mask_within_type<Prepared, Geometry>::type within_mask;
+    typedef typename bg::detail::de9im::static_mask_covered_by_type<Prepared, Geometry>::type covered_by_mask;
+    BOOST_CHECK_MESSAGE(bg::within(prepared, geometry) == bg::relate(original, geometry, within_mask()),
+        "within (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::covered_by(prepared, geometry) == bg::relate(original, geometry, covered_by_mask()),
+        "covered_by (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::touches(geometry, prepared) == bg::touches(geometry, original),
+        "touches: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::touches(prepared, geometry) == bg::touches(original, geometry),
+        "touches (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::crosses(geometry, prepared) == bg::crosses(geometry, original),
+        "crosses: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::crosses(prepared, geometry) == bg::crosses(original, geometry),
+        "crosses (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::overlaps(geometry, prepared) == bg::overlaps(geometry, original),
+        "overlaps: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::overlaps(prepared, geometry) == bg::overlaps(original, geometry),
+        "overlaps (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::equals(geometry, prepared) == bg::equals(geometry, original),
+        "equals: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::equals(prepared, geometry) == bg::equals(original, geometry),
+        "equals (reversed): " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::relation(geometry, prepared).str() == bg::relation(geometry, original).str(),
+        "relation: " << wkt << " with " << bg::wkt(original));
+    BOOST_CHECK_MESSAGE(bg::relation(prepared, geometry).str() == bg::relation(original, geometry).str(),
+        "relation (reversed): " << wkt << " with " << bg::wkt(original));
+
+    for (char const* code : { "FF*FF****", "T*F**F***", "F***T****", "FF1FF0102" })
+    {
+        bg::de9im::mask const mask(code);
+        BOOST_CHECK_MESSAGE(bg::relate(geometry, prepared, mask) == bg::relate(geometry, original, mask),
+            "relate: " << wkt << " with " << bg::wkt(original) << " mask " << code);
+    }
+    typedef bg::de9im::static_mask<'F', 'F', '*', 'F', 'F', '*', '*', '*', '*'> disjoint_mask;
+    BOOST_CHECK_MESSAGE(bg::relate(prepared, geometry, disjoint_mask()) == bg::relate(original, geometry, disjoint_mask()),
+        "relate (static): " << wkt << " with " << bg::wkt(original));
+}
+
+template <typename P>
+void test_areal()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    polygon poly;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))", poly);
+    bg::prepared<polygon> const prepared(poly);
+
+    // Points: interior, exterior, in hole, on (inner) boundary, on vertex,
+    // on the extension of a horizontal edge
+    check_predicates<P>("POINT(1 1)", prepared);
+    check_predicates<P>("POINT(11 1)", prepared);
+    check_predicates<P>("POINT(5 5)", prepared);
+    check_predicates<P>("POINT(4 5)", prepared);
+    check_predicates<P>("POINT(10 10)", prepared);
+    check_predicates<P>("POINT(-1 10)", prepared);
+    check_predicates<P>("POINT(2 4)", prepared);
+    check_predicates<P>("POINT(2 6)", prepared);
+
+    check_predicates<bg::model::multi_point<P> >("MULTIPOINT(1 1,4 5)", prepared);
+    check_predicates<bg::model::multi_point<P> >("MULTIPOINT(0 0,4 5)", prepared);
+    check_predicates<bg::model::multi_point<P> >("MULTIPOINT(1 1,5 5)", prepared);
+
+    check_predicates<bg::model::linestring<P> >("LINESTRING(1 1,2 2)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(4.5 4.5,5.5 5.5)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(-1 5,11 5)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(-5 5,-1 12,5 12)", prepared);
+    // On the (inner) boundary, through vertices of the hole, into the hole
+    check_predicates<bg::model::linestring<P> >("LINESTRING(0 0,10 0)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(0 0,10 0,10 10)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(4 4,6 4)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(2 4,8 4)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(2 2,4 4,2 6)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(2 2,4 4,6 6)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(2 2,8 8)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(0 5,4 5)", prepared);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(1 1,1 1)", prepared);
+    check_predicates<bg::model::multi_linestring<bg::model::linestring<P> > >(
+        "MULTILINESTRING((1 1,2 2),(0 0,0 10))", prepared);
+    check_predicates<bg::model::multi_linestring<bg::model::linestring<P> > >(
+        "MULTILINESTRING((1 1,2 2),(5 5,5.5 5.5))", prepared);
+
+    check_predicates<polygon>("POLYGON((1 1,1 2,2 2,2 1,1 1))", prepared);
+    check_predicates<polygon>("POLYGON((4.5 4.5,4.5 5.5,5.5 5.5,5.5 4.5,4.5 4.5))", prepared);
+    check_predicates<polygon>("POLYGON((-1 -1,-1 11,11 11,11 -1,-1 -1))", prepared);
+    check_predicates<polygon>("POLYGON((8 8,8 12,12 12,12 8,8 8))", prepared);
+    check_predicates<polygon>("POLYGON((11 11,11 12,12 12,12 11,11 11))", prepared);
+    check_predicates<multi_polygon>("MULTIPOLYGON(((11 11,11 12,12 12,12 11,11 11)),((1 1,1 2,2 2,2 1,1 1)))", prepared);
+    // Around, equal to or touching the hole, equal to the polygon
+    check_predicates<polygon>("POLYGON((3 3,3 7,7 7,7 3,3 3))", prepared);
+    check_predicates<polygon>("POLYGON((4 4,4 6,6 6,6 4,4 4))", prepared);
+    check_predicates<polygon>("POLYGON((2 2,2 4,4 4,4 2,2 2))", prepared);
+    check_predicates<polygon>("POLYGON((2 4,2 6,4 6,4 4,2 4))", prepared);
+    check_predicates<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0))", prepared);
+    check_predicates<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))", prepared);
+    check_predicates<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(3 3,7 3,7 7,3 7,3 3))", prepared);
+    check_predicates<polygon>("POLYGON((0 0,0 5,10 5,10 0,0 0))", prepared);
+    check_predicates<multi_polygon>("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0)),((6 6,6 10,10 10,10 6,6 6)))", prepared);
+
+    check_intersects<bg::model::box<P> >("BOX(1 1,2 2)", prepared);
+    check_intersects<bg::model::box<P> >("BOX(4.5 4.5,5.5 5.5)", prepared);
+    check_intersects<bg::model::box<P> >("BOX(-1 -1,11 11)", prepared);
+    check_intersects<bg::model::box<P> >("BOX(11 11,12 12)", prepared);
+
+    // Both prepared
+    polygon inner;
+    bg::read_wkt("POLYGON((1 1,1 3,3 3,3 1,1 1))", inner);
+    bg::prepared<polygon> const prepared_inner(inner);
+    bg::model::linestring<P> ls;
+    bg::read_wkt("LINESTRING(-1 5,11 5)", ls);
+    bg::prepared<bg::model::linestring<P> > const prepared_ls(ls);
+    BOOST_CHECK(bg::within(prepared_inner, prepared));
+    BOOST_CHECK(bg::covered_by(prepared_inner, prepared));
+    BOOST_CHECK(! bg::within(prepared, prepared_inner));
+    BOOST_CHECK(! bg::touches(prepared_inner, prepared));
+    BOOST_CHECK(! bg::overlaps(prepared_inner, prepared));
+    BOOST_CHECK(bg::crosses(prepared_ls, prepared));
+    BOOST_CHECK(! bg::equals(prepared_inner, prepared));
+    BOOST_CHECK(bg::equals(prepared, prepared));
+    BOOST_CHECK(bg::relate(prepared_inner, prepared, bg::de9im::mask("2FF1FF212")));
+    BOOST_CHECK_EQUAL(bg::relation(prepared_inner, prepared).str(), bg::relation(inner, poly).str());
+    BOOST_CHECK_EQUAL(bg::relation(prepared_ls, prepared).str(), bg::relation(ls, poly).str());
+
+    // A polygon with many vertices, compare point locations
+    polygon star;
+    int const n = 2000;
+    for (int i = 0; i <= n; i++)
+    {
+        double const angle = 2.0 * bg::math::pi<double>() * (n - i % n) / n;
+        double const radius = i % 2 == 0 ? 10.0 : 4.0;
+        bg::append(star.outer(), P(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+    bg::prepared<polygon> const prepared_star(star);
+    for (int i = 0; i < 1000; i++)
+    {
+        P const point(-11.0 + (i * 7919 % 2200) / 100.0, -11.0 + (i * 104729 % 2200) / 100.0);
+        BOOST_CHECK_EQUAL(bg::within(point, prepared_star), bg::within(point, star));
+        BOOST_CHECK_EQUAL(bg::covered_by(point, prepared_star), bg::covered_by(point, star));
+    }
+
+    // Segments and triangles
+    for (int i = 0; i < 300; i++)
+    {
+        P const p1(-11.0 + (i * 7919 % 2200) / 100.0, -11.0 + (i * 104729 % 2200) / 100.0);
+        P const p2(bg::get<0>(p1) + (i % 7) - 3.0, bg::get<1>(p1) + (i % 5) - 2.0);
+        bg::model::linestring<P> ls;
+        bg::append(ls, p1);
+        bg::append(ls, p2);
+        BOOST_CHECK_EQUAL(bg::within(ls, prepared_star), bg::within(ls, star));
+        BOOST_CHECK_EQUAL(bg::covered_by(ls, prepared_star), bg::covered_by(ls, star));
+
+        polygon triangle;
+        bg::append(triangle.outer(), p1);
+        bg::append(triangle.outer(), p2);
+        bg::append(triangle.outer(), P(bg::get<0>(p1) * 0.5, bg::get<1>(p1) * 0.5));
+        bg::append(triangle.outer(), p1);
+        bg::correct(triangle);
+        BOOST_CHECK_EQUAL(bg::within(triangle, prepared_star), bg::within(triangle, star));
+        BOOST_CHECK_EQUAL(bg::covered_by(triangle, prepared_star), bg::covered_by(triangle, star));
+    }
+
+    // Segments from the center of the star to its vertices are within it
+    // (checked without the original, it does not always get this right),
+    // continuing beyond the vertices they leave it
+    for (int i = 0; i < n; i += 7)
+    {
+        P const& vertex = star.outer()[i];
+        bg::model::linestring<P> ls;
+        bg::append(ls, P(0.0, 0.0));
+        bg::append(ls, vertex);
+        BOOST_CHECK_MESSAGE(bg::within(ls, prepared_star), "vertex " << i);
+        bg::append(ls, P(bg::get<0>(vertex) * 1.5, bg::get<1>(vertex) * 1.5));
+        BOOST_CHECK_MESSAGE(! bg::covered_by(ls, prepared_star), "vertex " << i);
+    }
+}
+
+template <typename P>
+void test_gaps()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    // Two polygons touching at two points, the gap between them is on the
+    // boundary of both
+    multi_polygon corners;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 6,4 6,4 4,6 4,6 0,0 0)),((4 6,4 10,10 10,10 4,6 4,6 6,4 6)))", corners);
+    bg::prepared<multi_polygon> const prepared_corners(corners);
+
+    check_predicates<polygon>("POLYGON((4 4,4 6,6 6,6 4,4 4))", prepared_corners);
+    check_predicates<polygon>("POLYGON((4 4,4 5,5 5,5 4,4 4))", prepared_corners);
+    check_predicates<polygon>("POLYGON((0 0,0 6,4 6,4 4,6 4,6 0,0 0))", prepared_corners);
+    check_predicates<multi_polygon>("MULTIPOLYGON(((4 4,4 6,6 6,6 4,4 4)),((1 1,1 2,2 2,2 1,1 1)))", prepared_corners);
+    check_predicates<bg::model::linestring<P> >("LINESTRING(4 4,4 6,6 6)", prepared_corners);
+
+    // Two polygons enclosing a gap, a polygon around it has its boundary
+    // on the boundary of the polygons
+    multi_polygon enclosing;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,5 10,4 5,5 0,0 0)),((5 0,10 0,10 10,5 10,6 5,5 0)))", enclosing);
+    bg::prepared<multi_polygon> const prepared_enclosing(enclosing);
+
+    check_predicates<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0))", prepared_enclosing);
+    check_predicates<polygon>("POLYGON((1 1,1 9,9 9,9 1,1 1))", prepared_enclosing);
+    check_predicates<polygon>("POLYGON((5 0,4 5,5 10,6 5,5 0))", prepared_enclosing);
+    check_predicates<polygon>("POLYGON((0 0,0 10,5 10,4 5,5 0,0 0))", prepared_enclosing);
+    check_predicates<polygon>("POLYGON((1 1,1 9,3 9,3 1,1 1))", prepared_enclosing);
+    check_predicates<multi_polygon>("MULTIPOLYGON(((0 0,0 10,5 10,4 5,5 0,0 0)),((5 0,10 0,10 10,5 10,6 5,5 0)))", prepared_enclosing);
+    check_predicates<bg::model::ring<P> >("POLYGON((0 0,0 10,10 10,10 0,0 0))", prepared_enclosing);
+    check_predicates<bg::model::ring<P> >("POLYGON((1 1,1 9,3 9,3 1,1 1))", prepared_enclosing);
+}
+
+template <typename P>
+void test_linear()
+{
+    typedef bg::model::linestring<P> linestring;
+
+    linestring ls;
+    bg::read_wkt("LINESTRING(0 0,10 0,10 10)", ls);
+    bg::prepared<linestring> const prepared(ls);
+
+    check_predicates<P>("POINT(5 0)", prepared);
+    check_predicates<P>("POINT(0 0)", prepared);
+    check_predicates<P>("POINT(5 5)", prepared);
+    check_predicates<linestring>("LINESTRING(5 -5,5 5)", prepared);
+    check_predicates<linestring>("LINESTRING(1 1,5 5)", prepared);
+    check_predicates<linestring>("LINESTRING(2 0,8 0)", prepared);
+    check_predicates<linestring>("LINESTRING(5 0,10 0,10 5)", prepared);
+    check_predicates<linestring>("LINESTRING(0 0,10 0,10 10)", prepared);
+    check_predicates<linestring>("LINESTRING(5 0,11 0)", prepared);
+    check_predicates<linestring>("LINESTRING(5 0,10 1)", prepared);
+    check_predicates<linestring>("LINESTRING(20 20,30 30)", prepared);
+    check_intersects<bg::model::polygon<P> >("POLYGON((1 1,1 2,2 2,2 1,1 1))", prepared);
+    check_intersects<bg::model::polygon<P> >("POLYGON((-1 -1,-1 11,11 11,11 -1,-1 -1))", prepared);
+}
+
+
+int test_main(int, char* [])
+{
+    test_areal<bg::model::d2::point_xy<double> >();
+    test_gaps<bg::model::d2::point_xy<double> >();
+    test_linear<bg::model::d2::point_xy<double> >();
+
+    test_areal<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/prepared_clipper.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Clip polygon with a hole
+static std::string const clip_wkt
+    = "POLYGON((0 0,0 10,10 10,10 0,0 0),(4 4,6 4,6 6,4 6,4 4))";
+
+template <typename Clip, typename Geometry, typename GeometryOut>
+void check_clip(bg::prepared_clipper<Clip> const& clipper,
+                std::string const& wkt, std::size_t expected_count)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    GeometryOut prepared_out, expected_out;
+    clipper.clip(geometry, prepared_out);
+    bg::intersection(geometry, clipper.clip_geometry(), expected_out);
+
+    BOOST_CHECK_MESSAGE(boost::size(prepared_out) == expected_count,
+        "clip: " << wkt
+        << " expected count: " << expected_count
+        << " detected: " << boost::size(prepared_out));
+
+    double expected = 0, detected = 0;
+    for (auto const& g : expected_out) { expected += bg::length(g) + bg::area(g); }
+    for (auto const& g : prepared_out) { detected += bg::length(g) + bg::area(g); }
+    BOOST_CHECK_CLOSE(detected, expected, 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef std::vector<linestring> linestrings;
+
+    polygon clip;
+    bg::read_wkt(clip_wkt, clip);
+    bg::prepared_clipper<polygon> const clipper(clip);
+
+    // Linestrings: inside, outside, in the hole, crossing
+    check_clip<polygon, linestring, linestrings>(clipper, "LINESTRING(1 1,2 2,3 1)", 1);
+    check_clip<polygon, linestring, linestrings>(clipper, "LINESTRING(11 1,12 2)", 0);
+    check_clip<polygon, linestring, linestrings>(clipper, "LINESTRING(4.5 4.5,5.5 5.5)", 0);
+    check_clip<polygon, linestring, linestrings>(clipper, "LINESTRING(-1 1,11 1)", 1);
+    check_clip<polygon, linestring, linestrings>(clipper, "LINESTRING(1 5,9 5)", 2);
+    // Envelope overlaps, but the linestring is completely outside
+    check_clip<polygon, linestring, linestrings>(clipper, "LINESTRING(-5 5,-1 12,5 12)", 0);
+
+    // Polygons: inside, outside, in the hole, crossing, containing the clip
+    check_clip<polygon, polygon, multi_polygon>(clipper, "POLYGON((1 1,1 2,2 2,2 1,1 1))", 1);
+    check_clip<polygon, polygon, multi_polygon>(clipper, "POLYGON((11 1,11 2,12 2,12 1,11 1))", 0);
+    check_clip<polygon, polygon, multi_polygon>(clipper, "POLYGON((4.5 4.5,4.5 5.5,5.5 5.5,5.5 4.5,4.5 4.5))", 0);
+    check_clip<polygon, polygon, multi_polygon>(clipper, "POLYGON((8 8,8 12,12 12,12 8,8 8))", 1);
+    check_clip<polygon, polygon, multi_polygon>(clipper, "POLYGON((-1 -1,-1 11,11 11,11 -1,-1 -1))", 1);
+
+    // Multi input, both parts inside
+    check_clip<polygon, multi_polygon, multi_polygon>(clipper,
+        "MULTIPOLYGON(((1 1,1 2,2 2,2 1,1 1)),((7 7,7 8,8 8,8 7,7 7)))", 2);
+
+    // Batch, sequential and parallel results should be the same
+    std::vector<linestring> inputs;
+    for (int i = 0; i < 200; i++)
+    {
+        double const y = 0.25 + (i % 40) * 0.25;
+        linestring ls;
+        bg::append(ls, P(-2.0 + (i % 7), y));
+        bg::append(ls, P(1.0 + (i % 13), y + 0.1));
+        inputs.push_back(ls);
+    }
+
+    std::vector<linestrings> sequential, parallel;
+    clipper.clip_all(inputs, sequential);
+    clipper.clip_all(inputs, parallel, 4);
+
+    BOOST_CHECK_EQUAL(sequential.size(), inputs.size());
+    BOOST_CHECK_EQUAL(parallel.size(), inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); i++)
+    {
+        linestrings expected;
+        bg::intersection(inputs[i], clip, expected);
+        BOOST_CHECK_EQUAL(sequential[i].size(), expected.size());
+        BOOST_CHECK_EQUAL(parallel[i].size(), expected.size());
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+    test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
+
+    return 0;
+}
@@ -12,7 +12,10 @@
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cmath>
 #include <iterator>
+#include <utility>
+#include <vector>
 
 
 #include <algorithms/test_simplify.hpp>
@@ -236,6 +239,110 @@ void test_all()
 #endif
 }
 
+template <typename P>
+void test_other_strategies()
+{
+    typedef bg::strategy::distance::projected_point<double> ds;
+    typedef bg::strategy::simplify::douglas_peucker<P, ds> dp;
+    typedef bg::strategy::simplify::visvalingam_whyatt<P, ds> vw;
+    typedef bg::strategy::simplify::visvalingam_whyatt
+        <
+            P,
+            bg::strategy::distance::projected_point
+                <
+                    double, bg::strategy::distance::comparable::pythagoras<double>
+                >
+        > vw_comparable;
+    typedef bg::strategy::simplify::radial_distance<P, ds> rd;
+    typedef bg::strategy::simplify::radial_distance<P, ds, dp> rd_dp;
+
+    // Visvalingam-Whyatt removes vertices with an area less than 1x1 or 3x3
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,5 5,10 10)",
+        "LINESTRING(0 0,10 10)", 1.0, vw());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,5 5,7 5,10 10)",
+        "LINESTRING(0 0,5 5,7 5,10 10)", 1.0, vw());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,5 5,7 5,10 10)",
+        "LINESTRING(0 0,7 5,10 10)", 3.0, vw());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,0 0)",
+        "LINESTRING(0 0)", 1.0, vw());
+
+    // The areas are the same for a comparable distance strategy
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,5 5,7 5,10 10)",
+        "LINESTRING(0 0,5 5,7 5,10 10)", 1.0, vw_comparable());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,5 5,7 5,10 10)",
+        "LINESTRING(0 0,7 5,10 10)", 3.0, vw_comparable());
+    test_geometry<bg::model::ring<P> >(
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,2 1,4 0))",
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,4 0))", 1.0, vw());
+    test_geometry<bg::model::polygon<P> >(
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,2 1,4 0),(3 3,3 5,4 5,5 5,5 3,3 3))",
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,4 0),(3 3,3 5,5 5,5 3,3 3))", 1.0, vw());
+
+    // Radial distance removes points closer than 1 to the previous point,
+    // chained with Douglas-Peucker it also removes the two remaining points
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,0.5 0,1 0,1.5 0,2 0,2.5 1,3 2)",
+        "LINESTRING(0 0,1.5 0,2.5 1,3 2)", 1.0, rd());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,0.5 0,1 0,1.5 0,2 0,2.5 1,3 2)",
+        "LINESTRING(0 0,3 2)", 1.0, rd_dp());
+    test_geometry<bg::model::linestring<P> >(
+        "LINESTRING(0 0,0.5 0.5)",
+        "LINESTRING(0 0,0.5 0.5)", 1.0, rd());
+    test_geometry<bg::model::ring<P> >(
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,2 1,4 0))",
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,4 0))", 1.0, rd_dp());
+}
+
+template <typename P>
+void test_parallel()
+{
+    typedef bg::strategy::distance::projected_point<double> ds;
+    typedef bg::strategy::simplify::douglas_peucker<P, ds> dp;
+    typedef bg::strategy::simplify::parallel_douglas_peucker<P, ds> pdp;
+    typedef bg::model::linestring<P> linestring;
+
+    test_geometry<linestring>(
+        "LINESTRING(0 0,5 5,10 10)",
+        "LINESTRING(0 0,10 10)", 1.0, pdp(2));
+    test_geometry<bg::model::polygon<P> >(
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,2 1,4 0),(3 3,3 5,4 5,5 5,5 3,3 3))",
+        "POLYGON((4 0,8 2,8 7,4 9,0 7,0 2,4 0),(3 3,3 5,5 5,5 3,3 3))", 1.0, pdp());
+
+    // A large wiggly line, such that both the search for the furthest
+    // point and the simplification of the parts are done in parallel.
+    // The results should be the same as the sequential results.
+    linestring line;
+    for (std::size_t i = 0; i < 300000; i++)
+    {
+        double const x = i;
+        bg::append(line, P(x, 100.0 * std::sin(x / 1000.0) + (i * 7919 % 13) / 10.0));
+    }
+
+    for (double distance : { 0.5, 1.0, 10.0 })
+    {
+        linestring expected;
+        bg::simplify(line, expected, distance, dp());
+        for (std::size_t thread_count : { 1, 2, 4 })
+        {
+            linestring simplified;
+            bg::simplify(line, simplified, distance, pdp(thread_count));
+            BOOST_CHECK_MESSAGE(bg::equals(simplified, expected)
+                && boost::size(simplified) == boost::size(expected),
+                "parallel_douglas_peucker distance: " << distance
+                << " threads: " << thread_count
+                << " expected: " << boost::size(expected)
+                << " detected: " << boost::size(simplified));
+        }
+    }
+}
+
 template <typename P>
 void test_zigzag()
 {
@@ -283,6 +390,102 @@ void test_spherical()
 }
 
 
+// Recursive Douglas-Peucker, as a reference
+template <typename Linestring>
+void douglas_peucker_recursive(Linestring const& line,
+        std::size_t first, std::size_t last, double max_distance,
+        std::vector<bool>& included)
+{
+    typedef typename bg::point_type<Linestring>::type point_type;
+    bg::model::segment<point_type> const segment(line[first], line[last]);
+    double md = -1.0;
+    std::size_t candidate = 0;
+    for (std::size_t i = first + 1; i < last; i++)
+    {
+        double const d = bg::distance(line[i], segment);
+        if (d > md)
+        {
+            md = d;
+            candidate = i;
+        }
+    }
+    if (md > max_distance)
+    {
+        included[candidate] = true;
+        douglas_peucker_recursive(line, first, candidate, max_distance, included);
+        douglas_peucker_recursive(line, candidate, last, max_distance, included);
+    }
+}
+
+template <typename P>
+void test_degenerate()
+{
+    typedef std::pair<std::size_t, std::size_t> part_type;
+    typedef bg::strategy::distance::projected_point<double> ds;
+    typedef bg::strategy::simplify::douglas_peucker<P, ds> dp;
+    typedef bg::model::linestring<P> linestring;
+
+    // Parts always split next to their last point, next to their first
+    // point, or in the middle: the stack holds at most log2(n) + 1 parts
+    std::size_t const n = 1 << 20;
+    std::size_t const at_end = bg::strategy::simplify::detail::douglas_peucker_split_parts(
+        part_type(0, n - 1), [](part_type const& part, std::size_t& candidate)
+        {
+            candidate = part.second - 1;
+            return part.second - part.first > 1;
+        });
+    std::size_t const at_start = bg::strategy::simplify::detail::douglas_peucker_split_parts(
+        part_type(0, n - 1), [](part_type const& part, std::size_t& candidate)
+        {
+            candidate = part.first + 1;
+            return part.second - part.first > 1;
+        });
+    std::size_t const in_middle = bg::strategy::simplify::detail::douglas_peucker_split_parts(
+        part_type(0, n - 1), [](part_type const& part, std::size_t& candidate)
+        {
+            candidate = (part.first + part.second) / 2;
+            return part.second - part.first > 1;
+        });
+    BOOST_CHECK_LE(at_end, 21u);
+    BOOST_CHECK_LE(at_start, 21u);
+    BOOST_CHECK_LE(in_middle, 21u);
+
+    // On a spiral, the furthest point of a part is on its outer turn,
+    // near its end. The result is the same as the recursive result.
+    linestring spiral;
+    for (std::size_t i = 0; i < 20000; i++)
+    {
+        double const angle = i * 2.0 * bg::math::pi<double>() / 100.0;
+        double const radius = 1.0 + i / 100.0;
+        bg::append(spiral, P(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+
+    for (double distance : { 0.01, 0.1, 1.0 })
+    {
+        std::vector<bool> included(boost::size(spiral), false);
+        included.front() = true;
+        included.back() = true;
+        douglas_peucker_recursive(spiral, 0, boost::size(spiral) - 1,
+                                  distance, included);
+        linestring expected;
+        for (std::size_t i = 0; i < included.size(); i++)
+        {
+            if (included[i])
+            {
+                bg::append(expected, spiral[i]);
+            }
+        }
+
+        linestring simplified;
+        bg::simplify(spiral, simplified, distance, dp());
+        BOOST_CHECK_MESSAGE(bg::equals(simplified, expected)
+            && boost::size(simplified) == boost::size(expected),
+            "spiral distance: " << distance
+            << " expected: " << boost::size(expected)
+            << " detected: " << boost::size(simplified));
+    }
+}
+
 int test_main(int, char* [])
 {
     // Integer compiles, but simplify-process fails (due to distances)
@@ -300,6 +503,12 @@ int test_main(int, char* [])
 
     test_zigzag<bg::model::d2::point_xy<double> >();
 
+    test_other_strategies<bg::model::d2::point_xy<double> >();
+
+    test_parallel<bg::model::d2::point_xy<double> >();
+
+    test_degenerate<bg::model::d2::point_xy<double> >();
+
 #endif
 
 
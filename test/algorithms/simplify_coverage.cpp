@@ -0,0 +1,171 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/simplify_coverage.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+// Two polygons sharing a wiggly border, the right one has a hole
+// filled by an island
+static std::string const left_part
+    = "POLYGON((0 0,0 10,5 10,5.2 8,4.8 6,5.3 4,4.9 2,5 0,0 0))";
+static std::string const right_part
+    = "POLYGON((5 0,4.9 2,5.3 4,4.8 6,5.2 8,5 10,10 10,10 0,5 0),"
+      "(7 3,8 3.1,9 3,9 7,8 6.9,7 7,7 3))";
+static std::string const island
+    = "POLYGON((7 3,7 7,8 6.9,9 7,9 3,8 3.1,7 3))";
+
+// A sliver between the two parts, its borders become the same
+// straight line if both are simplified with the full distance
+static std::string const sliver
+    = "POLYGON((5 0,4.9 2,5.3 4,4.8 6,5.2 8,5 10,5.3 8,5.1 6,5.4 4,5.2 2,5 0))";
+static std::string const right_of_sliver
+    = "POLYGON((5 0,5.2 2,5.4 4,5.1 6,5.3 8,5 10,10 10,10 0,5 0))";
+
+
+template <typename Polygon, typename Strategy>
+void test_coverage(std::string const& caseid,
+        std::vector<std::string> const& wkts,
+        double distance, double expected_area,
+        std::size_t expected_point_count,
+        Strategy const& strategy)
+{
+    typedef bg::model::multi_polygon<Polygon> multi_polygon;
+
+    std::vector<Polygon> inputs(wkts.size());
+    for (std::size_t i = 0; i < wkts.size(); i++)
+    {
+        bg::read_wkt(wkts[i], inputs[i]);
+    }
+
+    std::vector<Polygon> outputs;
+    bg::simplify_coverage(inputs, outputs, distance, strategy);
+
+    BOOST_CHECK_EQUAL(outputs.size(), inputs.size());
+
+    std::size_t point_count = 0;
+    double sum_of_areas = 0;
+    multi_polygon dissolved;
+    for (Polygon const& polygon : outputs)
+    {
+        BOOST_CHECK_MESSAGE(bg::is_valid(polygon),
+            caseid << " invalid: " << bg::wkt(polygon));
+        point_count += bg::num_points(polygon);
+        sum_of_areas += bg::area(polygon);
+
+        multi_polygon merged;
+        bg::union_(dissolved, polygon, merged);
+        dissolved = merged;
+    }
+
+    // There are no overlaps if the sum of the areas is the area of the
+    // union, and no gaps if the union is one polygon without holes
+    BOOST_CHECK_CLOSE(sum_of_areas, expected_area, 0.001);
+    BOOST_CHECK_CLOSE(bg::area(dissolved), expected_area, 0.001);
+    BOOST_CHECK_MESSAGE(dissolved.size() == 1
+                        && bg::num_interior_rings(dissolved) == 0,
+        caseid << " gaps: " << bg::wkt(dissolved));
+
+    if (expected_point_count > 0)
+    {
+        BOOST_CHECK_MESSAGE(point_count == expected_point_count,
+            caseid << " point count expected: " << expected_point_count
+            << " detected: " << point_count);
+    }
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::strategy::distance::projected_point<double> ds;
+    typedef bg::strategy::simplify::douglas_peucker<P, ds> dp;
+    typedef bg::strategy::simplify::visvalingam_whyatt<P, ds> vw;
+
+    std::vector<std::string> const parts = { left_part, right_part, island };
+
+    // The shared border becomes a straight line, the hole and the
+    // island become the same square
+    test_coverage<polygon>("parts", parts, 0.5, 100.0, 20, dp());
+    test_coverage<polygon>("parts_vw", parts, 1.5, 100.0, 20, vw());
+
+    // Nothing is simplified
+    test_coverage<polygon>("parts_small", parts, 0.01, 100.0, 32, dp());
+
+    // Both borders of the sliver are simplified less, it keeps its area
+    test_coverage<polygon>("sliver",
+        { left_part, sliver, right_of_sliver }, 0.5, 100.0, 0, dp());
+
+    // Open polygons, the closing point is not repeated
+    test_coverage<bg::model::polygon<P, true, false> >("parts_open",
+        parts, 0.5, 100.0, 16, dp());
+
+    // An empty polygon stays empty
+    {
+        std::vector<polygon> inputs(2), outputs;
+        bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0))", inputs[0]);
+        bg::simplify_coverage(inputs, outputs, 0.5);
+        BOOST_CHECK_EQUAL(outputs.size(), 2u);
+        BOOST_CHECK_EQUAL(bg::num_points(outputs[0]), 5u);
+        BOOST_CHECK_EQUAL(bg::num_points(outputs[1]), 0u);
+    }
+    {
+        typedef bg::model::ring<P, true, false> open_ring;
+        std::vector<open_ring> inputs(2), outputs;
+        bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0))", inputs[1]);
+        bg::simplify_coverage(inputs, outputs, 0.5);
+        BOOST_CHECK_EQUAL(outputs.size(), 2u);
+        BOOST_CHECK_EQUAL(bg::num_points(outputs[0]), 0u);
+        BOOST_CHECK_EQUAL(bg::num_points(outputs[1]), 4u);
+    }
+
+    // A small hole inside a bulge of the exterior ring. The bulge is
+    // removed with the full distance, which would leave the hole outside.
+    {
+        std::vector<polygon> inputs(1), outputs;
+        bg::read_wkt("POLYGON((0 0,0 10,4 10,5 10.8,6 10,10 10,10 0,0 0),"
+                     "(4.9 10.3,5.1 10.3,5 10.5,4.9 10.3))", inputs[0]);
+        bg::simplify_coverage(inputs, outputs, 1.0);
+        BOOST_CHECK_EQUAL(outputs.size(), 1u);
+        BOOST_CHECK_MESSAGE(bg::is_valid(outputs[0]),
+            "bulge invalid: " << bg::wkt(outputs[0]));
+        BOOST_CHECK_EQUAL(bg::num_points(bg::interior_rings(outputs[0]).front()), 4u);
+    }
+
+    // A multi polygon
+    {
+        multi_polygon multi, simplified;
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 10,5 10,5.2 8,4.8 6,5.3 4,4.9 2,5 0,0 0)),"
+                     "((5 10,10 10,10 0,5 0,4.9 2,5.3 4,4.8 6,5.2 8,5 10)))", multi);
+        bg::simplify_coverage(multi, simplified, 0.5);
+        std::ostringstream out;
+        out << bg::wkt(simplified);
+        BOOST_CHECK_EQUAL(out.str(),
+            "MULTIPOLYGON(((0 0,0 10,5 10,5 0,0 0)),((5 10,10 10,10 0,5 0,5 10)))");
+    }
+}
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
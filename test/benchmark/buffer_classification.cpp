@@ -0,0 +1,226 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the time to buffer geometries against the number of threads
+// classifying the turns (turn in piece, turn in original). The inputs are
+// generated as in test/robustness/overlay/buffer: random multi points
+// (multi_point_growth), random squares (recursive_polygons_buffer) and
+// many rings (many_ring_buffer), plus a polygon with many vertices buffered
+// with a large distance. Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I../../include buffer_classification.cpp -lboost_program_options -pthread
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/detail/buffer/buffer_inserter.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::multi_point<point_type> multi_point_type;
+typedef boost::minstd_rand generator_type;
+typedef boost::variate_generator
+    <
+        generator_type&, boost::uniform_real<>
+    > random_type;
+
+inline multi_point_type random_points(std::size_t count, int seed)
+{
+    generator_type generator(seed);
+    random_type random(generator, boost::uniform_real<>(0.0, 100.0));
+    multi_point_type result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const x = random();
+        result.push_back(point_type(x, random()));
+    }
+    return result;
+}
+
+inline polygon_type square(double x, double y, double size)
+{
+    polygon_type result;
+    bg::append(result.outer(), point_type(x, y));
+    bg::append(result.outer(), point_type(x, y + size));
+    bg::append(result.outer(), point_type(x + size, y + size));
+    bg::append(result.outer(), point_type(x + size, y));
+    bg::append(result.outer(), point_type(x, y));
+    return result;
+}
+
+// Random squares, combined into one valid multi polygon
+inline multi_polygon_type random_squares(std::size_t count, int seed)
+{
+    generator_type generator(seed);
+    random_type random(generator, boost::uniform_real<>(0.0, 100.0));
+    std::vector<polygon_type> squares;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const x = random();
+        squares.push_back(square(x, random(), 2.0 + random() / 20.0));
+    }
+    multi_polygon_type result;
+    bg::buffer_dissolved(squares, result,
+        bg::strategy::buffer::distance_symmetric<double>(0.0),
+        bg::strategy::buffer::side_straight(),
+        bg::strategy::buffer::join_miter(),
+        bg::strategy::buffer::end_flat(),
+        bg::strategy::buffer::point_square());
+    return result;
+}
+
+// A grid of rings, each with a hole
+inline multi_polygon_type many_rings(std::size_t count)
+{
+    std::size_t const n = static_cast<std::size_t>(std::sqrt(double(count))) + 1;
+    multi_polygon_type result;
+    for (std::size_t i = 0; i < n; i++)
+    {
+        for (std::size_t j = 0; j < n; j++)
+        {
+            polygon_type polygon = square(i * 3.0, j * 3.0, 2.0);
+            polygon_type const hole = square(i * 3.0 + 0.5, j * 3.0 + 0.5, 1.0);
+            polygon.inners().push_back(hole.outer());
+            bg::reverse(polygon.inners().back());
+            result.push_back(polygon);
+        }
+    }
+    return result;
+}
+
+// A star shaped polygon with many sharp vertices
+inline polygon_type star(std::size_t count)
+{
+    polygon_type result;
+    for (std::size_t i = 0; i <= count; i++)
+    {
+        double const angle = -2.0 * bg::math::pi<double>() * (i % count) / count;
+        double const radius = i % 2 == 0 ? 100.0 : 60.0 + (i * 7 % 13);
+        bg::append(result.outer(), point_type(radius * std::cos(angle), radius * std::sin(angle)));
+    }
+    return result;
+}
+
+template <typename Geometry>
+inline void run(std::string const& name, Geometry const& geometry, double distance,
+                std::vector<std::size_t> const& thread_counts, int runs)
+{
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_round join_strategy(90);
+    bg::strategy::buffer::end_round end_strategy(90);
+    bg::strategy::buffer::point_circle point_strategy(90);
+    bg::strategy::intersection::cartesian_segments<> intersection_strategy;
+    bg::detail::no_rescale_policy rescale_policy;
+
+    for (std::size_t const thread_count : thread_counts)
+    {
+        // Report the fastest run, the others are disturbed by other processes
+        double ms = 0;
+        double area = 0;
+        for (int i = 0; i < runs; i++)
+        {
+            multi_polygon_type buffered;
+            bg::detail::buffer::visit_pieces_default_policy visitor;
+
+            auto const start = std::chrono::steady_clock::now();
+            bg::detail::buffer::buffer_inserter<polygon_type>(geometry,
+                bg::range::back_inserter(buffered),
+                distance_strategy, side_strategy, join_strategy,
+                end_strategy, point_strategy,
+                intersection_strategy, rescale_policy, visitor, thread_count);
+            auto const finish = std::chrono::steady_clock::now();
+
+            double const elapsed = std::chrono::duration<double, std::milli>(finish - start).count();
+            if (i == 0 || elapsed < ms)
+            {
+                ms = elapsed;
+            }
+            area = bg::area(buffered);
+        }
+
+        std::cout << std::setw(24) << std::left << name
+                  << std::setw(10) << std::right << bg::num_points(geometry)
+                  << std::setw(10) << thread_count
+                  << std::setw(18) << std::fixed << std::setprecision(3) << area
+                  << std::setw(12) << ms
+                  << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== buffer_classification ===\nAllowed options");
+
+        std::size_t count = 2000;
+        int seed = 12345;
+        int runs = 3;
+        std::vector<std::size_t> thread_counts{1, 2, 4, 0};
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(2000), "Number of points, squares, rings and star vertices")
+            ("seed", po::value<int>(&seed)->default_value(12345), "Initialization of random generator")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+            ("threads", po::value<std::vector<std::size_t> >(&thread_counts)->multitoken(), "Thread counts to measure (0 is hardware concurrency)")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(24) << std::left << "case"
+                  << std::setw(10) << std::right << "points"
+                  << std::setw(10) << "threads"
+                  << std::setw(18) << "area"
+                  << std::setw(12) << "ms"
+                  << std::endl;
+
+        run("multi_point_growth", random_points(count, seed), 2.0, thread_counts, runs);
+        run("recursive_polygons", random_squares(count, seed), 1.5, thread_counts, runs);
+        run("many_rings", many_rings(count), 0.8, thread_counts, runs);
+        run("star", star(count), 25.0, thread_counts, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
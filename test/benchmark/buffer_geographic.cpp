@@ -0,0 +1,308 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the time to buffer geographic linestrings and polygons with the
+// geographic side, join and end strategies, against the workaround of
+// projecting them to the UTM zone of their center, buffering them in
+// cartesian coordinates and projecting the buffer back. The area of both
+// is compared with the area of the geographic buffer calculated with the
+// Vincenty formulas (all areas are calculated with the Thomas formula,
+// because the default area strategy is not precise for small polygons).
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I../../include buffer_geographic.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/random/linear_congruential.hpp>
+#include <boost/random/uniform_real.hpp>
+#include <boost/random/variate_generator.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::linestring<point_ll> linestring_ll;
+typedef bg::model::polygon<point_ll> polygon_ll;
+typedef bg::model::multi_polygon<polygon_ll> multi_polygon_ll;
+typedef bg::strategy::area::geographic
+    <
+        bg::strategy::thomas, 5,
+        bg::srs::spheroid<long double>, long double
+    > area_strategy_type;
+typedef boost::minstd_rand generator_type;
+typedef boost::variate_generator
+    <
+        generator_type&, boost::uniform_real<>
+    > random_type;
+
+// Random walks (roads) around the specified location
+inline std::vector<linestring_ll> random_roads(std::size_t count, std::size_t vertices,
+                double lon, double lat, double step, int seed)
+{
+    generator_type generator(seed);
+    random_type random(generator, boost::uniform_real<>(-1.0, 1.0));
+    std::vector<linestring_ll> result(count);
+    for (linestring_ll& road : result)
+    {
+        double x = lon + random() * 0.2;
+        double y = lat + random() * 0.1;
+        for (std::size_t i = 0; i < vertices; i++)
+        {
+            bg::append(road, point_ll(x, y));
+            x += step * (1.0 + random()) / 2.0;
+            y += step * random() / 2.0;
+        }
+    }
+    return result;
+}
+
+// Random stars, with the vertices at a random radius
+inline std::vector<polygon_ll> random_stars(std::size_t count, std::size_t vertices,
+                double lon, double lat, double radius, int seed)
+{
+    generator_type generator(seed);
+    random_type random(generator, boost::uniform_real<>(-1.0, 1.0));
+    std::vector<polygon_ll> result(count);
+    for (polygon_ll& star : result)
+    {
+        double const x = lon + random() * 0.2;
+        double const y = lat + random() * 0.1;
+        for (std::size_t i = 0; i < vertices; i++)
+        {
+            double const angle = -2.0 * bg::math::pi<double>() * i / vertices;
+            double const r = radius * (0.6 + 0.4 * std::abs(random()));
+            bg::append(star.outer(), point_ll(x + 1.6 * r * std::cos(angle), y + r * std::sin(angle)));
+        }
+        bg::append(star.outer(), star.outer().front());
+    }
+    return result;
+}
+
+// A road from west to east, crossing several UTM zones
+inline std::vector<linestring_ll> long_road(std::size_t vertices)
+{
+    std::vector<linestring_ll> result(1);
+    for (std::size_t i = 0; i < vertices; i++)
+    {
+        double const x = 12.0 * i / (vertices - 1);
+        bg::append(result.front(), point_ll(x, 52.0 + 0.5 * std::sin(x)));
+    }
+    return result;
+}
+
+template <typename Geometry, typename Strategies>
+inline double buffer_geographic(std::vector<Geometry> const& geometries,
+                double distance, Strategies const& strategies,
+                std::vector<multi_polygon_ll>& buffers)
+{
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    buffers.resize(geometries.size());
+    for (std::size_t i = 0; i < geometries.size(); i++)
+    {
+        bg::buffer(geometries[i], buffers[i], distance_strategy,
+                   strategies.side, strategies.join, strategies.end,
+                   strategies.point);
+    }
+    double area = 0;
+    for (multi_polygon_ll const& buffer : buffers)
+    {
+        area += bg::area(buffer, area_strategy_type());
+    }
+    return area;
+}
+
+template <typename Geometry>
+inline double buffer_projected(std::vector<Geometry> const& geometries,
+                double distance, std::size_t points_per_circle,
+                std::vector<multi_polygon_ll>& buffers)
+{
+    typedef typename bg::tag<Geometry>::type tag;
+    typedef typename boost::mpl::if_
+        <
+            boost::is_same<tag, bg::linestring_tag>,
+            bg::model::linestring<point_xy>,
+            bg::model::polygon<point_xy>
+        >::type geometry_xy;
+    typedef bg::model::multi_polygon<bg::model::polygon<point_xy> > multi_polygon_xy;
+
+    bg::strategy::buffer::distance_symmetric<double> distance_strategy(distance);
+    bg::strategy::buffer::side_straight side_strategy;
+    bg::strategy::buffer::join_round join_strategy(points_per_circle);
+    bg::strategy::buffer::end_round end_strategy(points_per_circle);
+    bg::strategy::buffer::point_circle point_strategy(points_per_circle);
+
+    buffers.resize(geometries.size());
+    for (std::size_t i = 0; i < geometries.size(); i++)
+    {
+        // Project to the UTM zone of the center of the geometry
+        point_ll center;
+        bg::centroid(bg::return_envelope<bg::model::box<point_ll> >(geometries[i]), center);
+        int const zone = static_cast<int>(std::floor((bg::get<0>(center) + 180.0) / 6.0)) + 1;
+        std::ostringstream out;
+        out << "+proj=utm +zone=" << zone << " +ellps=WGS84 +units=m";
+        bg::srs::projection<> const projection = bg::srs::proj4(out.str());
+
+        geometry_xy projected;
+        multi_polygon_xy buffered;
+        projection.forward(geometries[i], projected);
+        bg::buffer(projected, buffered, distance_strategy, side_strategy,
+                   join_strategy, end_strategy, point_strategy);
+        projection.inverse(buffered, buffers[i]);
+    }
+    double area = 0;
+    for (multi_polygon_ll const& buffer : buffers)
+    {
+        area += bg::area(buffer, area_strategy_type());
+    }
+    return area;
+}
+
+template <typename FormulaPolicy>
+struct geographic_strategies
+{
+    explicit geographic_strategies(std::size_t points_per_circle)
+        : join(points_per_circle)
+        , end(points_per_circle)
+        , point(points_per_circle)
+    {}
+
+    bg::strategy::buffer::geographic_side_straight<FormulaPolicy> side;
+    bg::strategy::buffer::geographic_join_round<FormulaPolicy> join;
+    bg::strategy::buffer::geographic_end_round<FormulaPolicy> end;
+    bg::strategy::buffer::geographic_point_circle<FormulaPolicy> point;
+};
+
+template <typename Function>
+inline double measure(Function const& function, int runs, double& area)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double ms = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        area = function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double, std::milli>(finish - start).count();
+        if (i == 0 || elapsed < ms)
+        {
+            ms = elapsed;
+        }
+    }
+    return ms;
+}
+
+template <typename Geometry>
+inline void run(std::string const& name, std::vector<Geometry> const& geometries,
+                double distance, std::size_t points_per_circle, int runs)
+{
+    std::vector<multi_polygon_ll> buffers;
+
+    double const reference = buffer_geographic(geometries, distance,
+        geographic_strategies<bg::strategy::vincenty>(points_per_circle), buffers);
+
+    double area_andoyer = 0, area_thomas = 0, area_projected = 0;
+    double const ms_andoyer = measure([&]()
+        {
+            return buffer_geographic(geometries, distance,
+                geographic_strategies<bg::strategy::andoyer>(points_per_circle), buffers);
+        }, runs, area_andoyer);
+    double const ms_thomas = measure([&]()
+        {
+            return buffer_geographic(geometries, distance,
+                geographic_strategies<bg::strategy::thomas>(points_per_circle), buffers);
+        }, runs, area_thomas);
+    double const ms_projected = measure([&]()
+        {
+            return buffer_projected(geometries, distance, points_per_circle, buffers);
+        }, runs, area_projected);
+
+    auto report = [&](std::string const& method, double ms, double area)
+    {
+        std::cout << std::setw(16) << std::left << name
+                  << std::setw(10) << std::right << bg::num_points(geometries.front()) * geometries.size()
+                  << std::setw(10) << distance
+                  << std::setw(12) << method
+                  << std::setw(12) << std::fixed << std::setprecision(3) << ms
+                  << std::setw(14) << std::scientific << std::setprecision(3)
+                  << std::abs(area - reference) / reference
+                  << std::defaultfloat << std::endl;
+    };
+
+    report("andoyer", ms_andoyer, area_andoyer);
+    report("thomas", ms_thomas, area_thomas);
+    report("utm", ms_projected, area_projected);
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== buffer_geographic ===\nAllowed options");
+
+        std::size_t count = 100;
+        std::size_t points_per_circle = 36;
+        int seed = 12345;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(100), "Number of roads and polygons")
+            ("points_per_circle", po::value<std::size_t>(&points_per_circle)->default_value(36), "Points per circle of joins and ends")
+            ("seed", po::value<int>(&seed)->default_value(12345), "Initialization of random generator")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(16) << std::left << "case"
+                  << std::setw(10) << std::right << "points"
+                  << std::setw(10) << "distance"
+                  << std::setw(12) << "method"
+                  << std::setw(12) << "ms"
+                  << std::setw(14) << "area error"
+                  << std::endl;
+
+        run("roads", random_roads(count, 20, 4.9, 52.3, 0.01, seed), 50.0, points_per_circle, runs);
+        run("stars", random_stars(count, 20, 4.9, 52.3, 0.05, seed), 500.0, points_per_circle, runs);
+        run("long_road", long_road(count * 10), 1000.0, points_per_circle, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,307 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput (million points per second) of the steps of a
+// datum shift over arrays: geodetic to geocentric coordinates, the 7
+// parameter Helmert transformation to and from WGS84 and geocentric to
+// geodetic coordinates. Each step is measured point by point, with the
+// functions converting one point, and with the functions converting arrays.
+// The whole datum shift is measured in blocks, as srs::transformation does.
+// The largest differences of the results are reported, in radians and
+// in meters.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I.. -I../../include geocentric.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/srs/projections/impl/geocent.hpp>
+#include <boost/geometry/srs/projections/impl/pj_transform.hpp>
+#include <boost/geometry/srs/projections/impl/projects.hpp>
+
+
+namespace bgp = bg::projections::detail;
+
+typedef bgp::GeocentricInfo<double> info_type;
+typedef bgp::pj_helmert<double> helmert_type;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return count / seconds / 1.0e6;
+}
+
+inline double max_difference(std::vector<double> const& v1, std::vector<double> const& v2)
+{
+    double result = 0;
+    for (std::size_t i = 0; i < v1.size(); i++)
+    {
+        result = (std::max)(result, std::abs(v1[i] - v2[i]));
+    }
+    return result;
+}
+
+inline void report(std::string const& name, double mpps, double mpps_n,
+                   double angle_difference, double height_difference)
+{
+    std::cout << std::setw(24) << std::left << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << mpps
+              << std::setw(10) << mpps_n
+              << std::scientific << std::setprecision(1)
+              << std::setw(12) << angle_difference
+              << std::setw(12) << height_difference
+              << std::defaultfloat << std::endl;
+}
+
+// As the datum shift of transformations did before, with the datum type
+// checked for each point
+inline void to_wgs84(int datum, helmert_type const& p, double & x, double & y, double & z)
+{
+    if (datum == bgp::datum_3param)
+    {
+        x += p.dx;
+        y += p.dy;
+        z += p.dz;
+    }
+    else if (datum == bgp::datum_7param)
+    {
+        double const x_out = p.m*(       x - p.rz*y + p.ry*z) + p.dx;
+        double const y_out = p.m*( p.rz*x +      y - p.rx*z) + p.dy;
+        double const z_out = p.m*(-p.ry*x + p.rx*y +      z) + p.dz;
+        x = x_out;
+        y = y_out;
+        z = z_out;
+    }
+}
+
+inline void from_wgs84(int datum, helmert_type const& p, double & x, double & y, double & z)
+{
+    if (datum == bgp::datum_3param)
+    {
+        x -= p.dx;
+        y -= p.dy;
+        z -= p.dz;
+    }
+    else if (datum == bgp::datum_7param)
+    {
+        double const x_tmp = (x - p.dx) / p.m;
+        double const y_tmp = (y - p.dy) / p.m;
+        double const z_tmp = (z - p.dz) / p.m;
+        x =       x_tmp + p.rz*y_tmp - p.ry*z_tmp;
+        y = -p.rz*x_tmp +      y_tmp + p.rx*z_tmp;
+        z =  p.ry*x_tmp - p.rx*y_tmp +      z_tmp;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== geocentric ===\nAllowed options");
+
+        std::size_t count = 10000000;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(10000000), "Number of points")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        double const d2r = bg::math::d2r<double>();
+
+        // WGS84 to Bessel, with the parameters of DHDN (EPSG:31466)
+        info_type wgs84, bessel;
+        bgp::pj_Set_Geocentric_Parameters(wgs84, 6378137.0, 6356752.3142451793);
+        bgp::pj_Set_Geocentric_Parameters(bessel, 6377397.155, 6356078.962818189);
+        helmert_type const none = { 0, 0, 0, 0, 0, 0, 1 };
+        helmert_type const dhdn = { 598.1, 73.7, 418.2,
+                                    0.202 * d2r / 3600, 0.045 * d2r / 3600, -2.455 * d2r / 3600,
+                                    1.0 + 6.7e-6 };
+
+        // Points in Central Europe, heights up to 3 km
+        std::vector<double> lon(count), lat(count), h(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            lon[i] = (5.0 + 10.0 * ((i * 7919) % count) / count) * d2r;
+            lat[i] = (46.0 + 9.0 * ((i * 104729) % count) / count) * d2r;
+            h[i] = 3000.0 * ((i * 31) % 1000) / 1000.0;
+        }
+
+        // The datum types are not known at compile time
+        int const datum_src = argc > 1000 ? bgp::datum_wgs84 : bgp::datum_3param;
+        int const datum_dst = argc > 1000 ? bgp::datum_wgs84 : bgp::datum_7param;
+
+        std::vector<double> x(count), y(count), z(count);
+        std::vector<double> x_n(count), y_n(count), z_n(count);
+        std::vector<double> lon2(count), lat2(count), h2(count);
+        std::vector<double> lon2_n(count), lat2_n(count), h2_n(count);
+
+        std::size_t const block = bgp::pj_batch_size;
+
+        std::cout << std::setw(24) << std::left << "step"
+                  << std::setw(10) << std::right << "point"
+                  << std::setw(10) << "array"
+                  << std::setw(12) << "angle"
+                  << std::setw(12) << "height"
+                  << std::endl;
+
+        {
+            double const mpps = measure([&]()
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        bgp::pj_Convert_Geodetic_To_Geocentric(wgs84,
+                            lon[i], lat[i], h[i], x[i], y[i], z[i]);
+                    }
+                }, count, runs);
+            double const mpps_n = measure([&]()
+                {
+                    for (std::size_t first = 0; first < count; first += block)
+                    {
+                        bgp::pj_Convert_Geodetic_To_Geocentric_n(wgs84,
+                            (std::min)(block, count - first),
+                            &lon[first], &lat[first], &h[first],
+                            &x_n[first], &y_n[first], &z_n[first]);
+                    }
+                }, count, runs);
+            report("geodetic to geocentric", mpps, mpps_n, 0,
+                   (std::max)(max_difference(x, x_n), max_difference(z, z_n)));
+        }
+
+        {
+            // Applied runs times to both
+            double const mpps = measure([&]()
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        to_wgs84(datum_dst, dhdn, x[i], y[i], z[i]);
+                        from_wgs84(datum_src, none, x[i], y[i], z[i]);
+                    }
+                }, count, runs);
+            double const mpps_n = measure([&]()
+                {
+                    for (std::size_t first = 0; first < count; first += block)
+                    {
+                        std::size_t const n = (std::min)(block, count - first);
+                        bgp::pj_geocentric_to_wgs84_n(dhdn, n, &x_n[first], &y_n[first], &z_n[first]);
+                        bgp::pj_geocentric_from_wgs84_n(none, n, &x_n[first], &y_n[first], &z_n[first]);
+                    }
+                }, count, runs);
+            report("helmert", mpps, mpps_n, 0,
+                   (std::max)(max_difference(x, x_n), max_difference(z, z_n)));
+        }
+
+        {
+            double const mpps = measure([&]()
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        bgp::pj_Convert_Geocentric_To_Geodetic(bessel,
+                            x[i], y[i], z[i], lon2[i], lat2[i], h2[i]);
+                    }
+                }, count, runs);
+            double const mpps_n = measure([&]()
+                {
+                    for (std::size_t first = 0; first < count; first += block)
+                    {
+                        bgp::pj_Convert_Geocentric_To_Geodetic_n(bessel,
+                            (std::min)(block, count - first),
+                            &x[first], &y[first], &z[first],
+                            &lon2_n[first], &lat2_n[first], &h2_n[first]);
+                    }
+                }, count, runs);
+            report("geocentric to geodetic", mpps, mpps_n,
+                   max_difference(lat2, lat2_n), max_difference(h2, h2_n));
+        }
+
+        // The whole shift, as srs::transformation did before and does now
+        {
+            double const mpps = measure([&]()
+                {
+                    for (std::size_t i = 0; i < count; i++)
+                    {
+                        double px = 0, py = 0, pz = 0;
+                        if (bgp::pj_Convert_Geodetic_To_Geocentric(wgs84,
+                                lon[i], lat[i], h[i], px, py, pz) == 0)
+                        {
+                            to_wgs84(datum_src, none, px, py, pz);
+                            from_wgs84(datum_dst, dhdn, px, py, pz);
+                            bgp::pj_Convert_Geocentric_To_Geodetic(bessel,
+                                px, py, pz, lon2[i], lat2[i], h2[i]);
+                        }
+                    }
+                }, count, runs);
+            double const mpps_n = measure([&]()
+                {
+                    double bx[bgp::pj_batch_size], by[bgp::pj_batch_size], bz[bgp::pj_batch_size];
+                    for (std::size_t first = 0; first < count; first += block)
+                    {
+                        std::size_t const n = (std::min)(block, count - first);
+                        std::copy(lon.begin() + first, lon.begin() + first + n, lon2_n.begin() + first);
+                        std::copy(lat.begin() + first, lat.begin() + first + n, lat2_n.begin() + first);
+                        bgp::pj_Convert_Geodetic_To_Geocentric_n(wgs84, n,
+                            &lon2_n[first], &lat2_n[first], &h[first], bx, by, bz);
+                        bgp::pj_geocentric_to_wgs84_n(none, n, bx, by, bz);
+                        bgp::pj_geocentric_from_wgs84_n(dhdn, n, bx, by, bz);
+                        bgp::pj_Convert_Geocentric_To_Geodetic_n(bessel, n, bx, by, bz,
+                            &lon2_n[first], &lat2_n[first], &h2_n[first]);
+                    }
+                }, count, runs);
+            report("datum shift", mpps, mpps_n,
+                   max_difference(lat2, lat2_n), max_difference(h2, h2_n));
+        }
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
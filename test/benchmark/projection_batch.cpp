@@ -0,0 +1,172 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput (million points per second) of projecting points
+// one by one, with a dynamic projection, against projecting arrays of
+// coordinates with one call. Both are done forward and inverse, and the
+// results are verified to be the same.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I../../include projection_batch.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return count / seconds / 1.0e6;
+}
+
+inline void run(std::string const& name, std::string const& definition,
+                std::size_t count, int runs)
+{
+    bg::srs::projection<> const projection{bg::srs::proj4(definition)};
+
+    // A grid of 20x20 degrees around the center of the projections
+    std::size_t const width = 1000;
+    std::vector<point_ll> points(count), points_back(count);
+    std::vector<point_xy> projected(count);
+    std::vector<double> lons(count), lats(count), xs(count), ys(count);
+    std::vector<double> lons_back(count), lats_back(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        lons[i] = -10.0 + 20.0 * (i % width) / width;
+        lats[i] = 30.0 + 20.0 * (i / width) * width / count;
+        points[i] = point_ll(lons[i], lats[i]);
+    }
+
+    double const forward_points = measure([&]()
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                projection.forward(points[i], projected[i]);
+            }
+        }, count, runs);
+    double const forward_arrays = measure([&]()
+        {
+            projection.forward(count, lons.data(), lats.data(),
+                               xs.data(), ys.data());
+        }, count, runs);
+    double const inverse_points = measure([&]()
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                projection.inverse(projected[i], points_back[i]);
+            }
+        }, count, runs);
+    double const inverse_arrays = measure([&]()
+        {
+            projection.inverse(count, xs.data(), ys.data(),
+                               lons_back.data(), lats_back.data());
+        }, count, runs);
+
+    std::size_t differences = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (xs[i] != bg::get<0>(projected[i])
+            || ys[i] != bg::get<1>(projected[i])
+            || lons_back[i] != bg::get<0>(points_back[i])
+            || lats_back[i] != bg::get<1>(points_back[i]))
+        {
+            differences++;
+        }
+    }
+
+    std::cout << std::setw(10) << std::left << name
+              << std::setw(12) << std::right << std::fixed << std::setprecision(2)
+              << forward_points
+              << std::setw(12) << forward_arrays
+              << std::setw(12) << inverse_points
+              << std::setw(12) << inverse_arrays
+              << std::setw(14) << differences
+              << std::defaultfloat << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== projection_batch ===\nAllowed options");
+
+        std::size_t count = 1000000;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(1000000), "Number of points")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(10) << std::left << "proj"
+                  << std::setw(12) << std::right << "fwd points"
+                  << std::setw(12) << "fwd arrays"
+                  << std::setw(12) << "inv points"
+                  << std::setw(12) << "inv arrays"
+                  << std::setw(14) << "differences"
+                  << std::endl;
+
+        run("merc", "+proj=merc +ellps=WGS84", count, runs);
+        run("tmerc", "+proj=tmerc +ellps=WGS84 +lon_0=3", count, runs);
+        run("etmerc", "+proj=etmerc +ellps=WGS84 +lon_0=3", count, runs);
+        run("lcc", "+proj=lcc +ellps=WGS84 +lat_1=35 +lat_2=45 +lon_0=0", count, runs);
+        run("laea", "+proj=laea +ellps=WGS84 +lat_0=40 +lon_0=0", count, runs);
+        run("aea", "+proj=aea +ellps=WGS84 +lat_1=35 +lat_2=45", count, runs);
+        run("merc_sph", "+proj=merc +R=6371000", count, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the time (nanoseconds) of getting a projection or a transformation
+// for a definition, as a service handling requests does, by constructing it
+// and from projection_cache, which already contains it.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -pthread -I. -I.. -I../../include projection_cache.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/projection_cache.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return seconds / count * 1.0e9;
+}
+
+inline void report(std::string const& name, double ns, double ns_cached)
+{
+    std::cout << std::setw(22) << std::left << name
+              << std::right << std::fixed << std::setprecision(0)
+              << std::setw(12) << ns
+              << std::setw(12) << ns_cached
+              << std::setw(10) << std::setprecision(1) << ns / ns_cached
+              << std::defaultfloat << std::endl;
+}
+
+// Each projection is used for one point, so that it is not optimized out
+template <typename Params>
+inline void run_projection(std::string const& name, Params const& params,
+                           std::size_t count, int runs)
+{
+    bg::srs::projection_cache<> cache;
+    point_ll const ll(15.5, 50.1);
+    double sum = 0;
+
+    double const ns = measure([&]()
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                bg::srs::projection<> const prj(params);
+                point_xy xy;
+                prj.forward(ll, xy);
+                sum += bg::get<0>(xy);
+            }
+        }, count, runs);
+    double const ns_cached = measure([&]()
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                bg::srs::projection_cache<>::projection_ptr const prj
+                    = cache.get_projection(params);
+                point_xy xy;
+                prj->forward(ll, xy);
+                sum += bg::get<0>(xy);
+            }
+        }, count, runs);
+
+    report(name, ns, ns_cached);
+    if (sum == 0)
+    {
+        std::cout << sum << std::endl;
+    }
+}
+
+template <typename Params1, typename Params2>
+inline void run_transformation(std::string const& name,
+                               Params1 const& params1, Params2 const& params2,
+                               std::size_t count, int runs)
+{
+    bg::srs::projection_cache<> cache;
+    point_ll const ll(15.5, 50.1);
+    double sum = 0;
+
+    double const ns = measure([&]()
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                bg::srs::transformation<> const tr(params1, params2);
+                point_xy xy;
+                tr.forward(ll, xy);
+                sum += bg::get<0>(xy);
+            }
+        }, count, runs);
+    double const ns_cached = measure([&]()
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                bg::srs::projection_cache<>::transformation_ptr const tr
+                    = cache.get_transformation(params1, params2);
+                point_xy xy;
+                tr->forward(ll, xy);
+                sum += bg::get<0>(xy);
+            }
+        }, count, runs);
+
+    report(name, ns, ns_cached);
+    if (sum == 0)
+    {
+        std::cout << sum << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== projection_cache ===\nAllowed options");
+
+        std::size_t count = 20000;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(20000), "Number of objects got in each run")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(22) << std::left << "case"
+                  << std::setw(12) << std::right << "construct"
+                  << std::setw(12) << "cached"
+                  << std::setw(10) << "ratio"
+                  << std::endl;
+
+        using namespace bg::srs;
+
+        run_projection("proj4 utm", proj4("+proj=utm +zone=33 +ellps=WGS84 +units=m +no_defs"), count, runs);
+        run_projection("epsg 32633", epsg(32633), count, runs);
+        run_projection("epsg 2180", epsg(2180), count, runs);
+        run_transformation("epsg 4326-32633", epsg(4326), epsg(32633), count, runs);
+        run_transformation("epsg 4326-31466", epsg(4326), epsg(31466), count, runs);
+        run_transformation("proj4 longlat-utm",
+                           proj4("+proj=longlat +datum=WGS84 +no_defs"),
+                           proj4("+proj=utm +zone=33 +datum=WGS84 +units=m +no_defs"),
+                           count, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,250 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the time to find the turns between two polygons against the
+// maximal number of points per section (max_count), for the overlay test
+// cases densified to a specified number of vertices, and for synthetic
+// coastlines. Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I../../include sectionalize_max_count.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <algorithms/overlay/overlay_cases.hpp>
+
+
+typedef bg::model::d2::point_xy<double> point_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::sections<box_type, 2> sections_type;
+typedef bg::detail::overlay::turn_info<point_type> turn_type;
+
+struct benchmark_case
+{
+    std::string name;
+    polygon_type p;
+    polygon_type q;
+};
+
+// Densifies the polygon such that it gets (about) the specified number
+// of vertices
+inline polygon_type densified(polygon_type const& polygon, std::size_t vertices)
+{
+    double const length = bg::perimeter(polygon);
+    if (vertices <= bg::num_points(polygon) || length <= 0)
+    {
+        return polygon;
+    }
+    polygon_type result;
+    bg::densify(polygon, result, length / vertices);
+    return result;
+}
+
+// A long, nearly horizontal coastline, closed by a straight line at y=bottom
+inline polygon_type coastline(std::size_t vertices, double offset, double bottom)
+{
+    polygon_type result;
+    for (std::size_t i = 0; i <= vertices; i++)
+    {
+        double const x = i * 0.01;
+        bg::append(result.outer(),
+            point_type(x, offset + 0.05 * std::sin(x * 7.0) + ((i * 7) % 11) * 0.001));
+    }
+    bg::append(result.outer(), point_type(vertices * 0.01, bottom));
+    bg::append(result.outer(), point_type(0.0, bottom));
+    bg::correct(result);
+    return result;
+}
+
+inline void add_case(std::vector<benchmark_case>& cases, std::string const& name,
+                     std::string const* wkt, std::size_t vertices)
+{
+    benchmark_case c;
+    c.name = name;
+    bg::read_wkt(wkt[0], c.p);
+    bg::read_wkt(wkt[1], c.q);
+    bg::correct(c.p);
+    bg::correct(c.q);
+    c.p = densified(c.p, vertices);
+    c.q = densified(c.q, vertices);
+    cases.push_back(c);
+}
+
+// Sectionalizes both polygons and partitions the sections, as get_turns does,
+// but with the specified max_count
+inline std::size_t find_turns(benchmark_case const& c, std::size_t max_count,
+                              std::size_t& section_count)
+{
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+    typedef bg::detail::no_rescale_policy rescale_policy_type;
+    typedef bg::detail::get_turns::no_interrupt_policy interrupt_policy_type;
+    typedef bg::detail::overlay::get_turn_info
+        <
+            bg::detail::overlay::assign_null_policy
+        > turn_policy;
+    typedef std::integer_sequence<std::size_t, 0, 1> dimensions;
+
+    strategy_type strategy;
+    rescale_policy_type rescale_policy;
+    interrupt_policy_type interrupt_policy;
+    std::vector<turn_type> turns;
+
+    sections_type sec1, sec2;
+    bg::sectionalize<false, dimensions>(c.p, rescale_policy, sec1,
+        strategy.get_envelope_strategy(), strategy.get_expand_strategy(),
+        0, max_count);
+    bg::sectionalize<false, dimensions>(c.q, rescale_policy, sec2,
+        strategy.get_envelope_strategy(), strategy.get_expand_strategy(),
+        1, max_count);
+    section_count = sec1.size() + sec2.size();
+
+    bg::detail::get_turns::section_visitor
+        <
+            polygon_type, polygon_type, false, false, turn_policy,
+            strategy_type, rescale_policy_type,
+            std::vector<turn_type>, interrupt_policy_type
+        > visitor(0, c.p, 1, c.q, strategy, rescale_policy,
+                  turns, interrupt_policy);
+
+    bg::partition
+        <
+            box_type
+        >::apply(sec1, sec2, visitor,
+                 bg::detail::section::get_section_box
+                    <
+                        strategy_type::expand_box_strategy_type
+                    >(),
+                 bg::detail::section::overlaps_section_box
+                    <
+                        strategy_type::disjoint_box_box_strategy_type
+                    >());
+
+    return turns.size();
+}
+
+inline void run(benchmark_case const& c, std::vector<std::size_t> const& max_counts,
+                int runs)
+{
+    std::size_t const vertices = bg::num_points(c.p) + bg::num_points(c.q);
+    for (std::size_t const max_count : max_counts)
+    {
+        // Report the fastest run, the others are disturbed by other processes
+        std::size_t section_count = 0;
+        std::size_t turn_count = 0;
+        double ms = 0;
+        for (int i = 0; i < runs; i++)
+        {
+            auto const start = std::chrono::steady_clock::now();
+            turn_count = find_turns(c, max_count, section_count);
+            auto const finish = std::chrono::steady_clock::now();
+            double const elapsed = std::chrono::duration<double, std::milli>(finish - start).count();
+            if (i == 0 || elapsed < ms)
+            {
+                ms = elapsed;
+            }
+        }
+
+        std::string const label = max_count == bg::detail::sectionalize::adaptive_max_count
+            ? "adaptive(" + std::to_string(bg::detail::sectionalize::select_max_count(c.p))
+              + "/" + std::to_string(bg::detail::sectionalize::select_max_count(c.q)) + ")"
+            : std::to_string(max_count);
+
+        std::cout << std::setw(24) << std::left << c.name
+                  << std::setw(10) << std::right << vertices
+                  << std::setw(18) << label
+                  << std::setw(10) << section_count
+                  << std::setw(10) << turn_count
+                  << std::setw(12) << std::fixed << std::setprecision(3) << ms
+                  << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== sectionalize_max_count ===\nAllowed options");
+
+        std::size_t vertices = 100000;
+        int runs = 3;
+        std::vector<std::size_t> max_counts{2, 5, 10, 20, 50, 100, 0};
+
+        description.add_options()
+            ("help", "Help message")
+            ("vertices", po::value<std::size_t>(&vertices)->default_value(100000), "Number of vertices per input polygon after densifying")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+            ("max_count", po::value<std::vector<std::size_t> >(&max_counts)->multitoken(), "Section sizes to measure (0 is adaptive)")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::vector<benchmark_case> cases;
+        add_case(cases, "case_many_situations", case_many_situations, vertices);
+        add_case(cases, "geos_1", geos_1, vertices);
+        add_case(cases, "geos_3", geos_3, vertices);
+        add_case(cases, "isovist", isovist, vertices);
+        add_case(cases, "snl_1", snl_1, vertices);
+        add_case(cases, "dz_1", dz_1, vertices);
+        add_case(cases, "buffer_rt_a", buffer_rt_a, vertices);
+
+        benchmark_case coast;
+        coast.name = "coastline";
+        coast.p = coastline(vertices, 1.0, 0.0);
+        coast.q = coastline(vertices, 1.02, 2.0);
+        cases.push_back(coast);
+
+        std::cout << std::setw(24) << std::left << "case"
+                  << std::setw(10) << std::right << "vertices"
+                  << std::setw(18) << "max_count"
+                  << std::setw(10) << "sections"
+                  << std::setw(10) << "turns"
+                  << std::setw(12) << "ms"
+                  << std::endl;
+
+        for (benchmark_case const& c : cases)
+        {
+            run(c, max_counts, runs);
+        }
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput (million points per second) of threads transforming
+// points one by one with a grid shift, using the same grids shared by all
+// threads. The grids are stored in shared_grids_std, locking a shared mutex
+// for every point, and in shared_grids_snapshot, taking no lock.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -pthread -I. -I.. -I../../include shared_grids.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/shared_grids_snapshot.hpp>
+#include <boost/geometry/srs/shared_grids_std.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return count / seconds / 1.0e6;
+}
+
+// Little-endian ctable2 grid covering -100..-90, 30..40 degrees
+inline void write_grid(std::string const& name)
+{
+    double const d2r = bg::math::d2r<double>();
+    std::int32_t const size = 101;
+
+    std::ofstream os(name.c_str(), std::ios::binary);
+    char header[160] = {};
+    std::strcpy(header, "CTABLE V2");
+    std::strcpy(header + 16, "benchmark grid");
+    double const ll_del[4] = { -100 * d2r, 30 * d2r, 0.1 * d2r, 0.1 * d2r };
+    std::memcpy(header + 96, ll_del, sizeof(ll_del));
+    std::memcpy(header + 128, &size, 4);
+    std::memcpy(header + 132, &size, 4);
+    os.write(header, sizeof(header));
+
+    for (int row = 0; row < size; row++)
+    {
+        for (int col = 0; col < size; col++)
+        {
+            float const cell[2] = { float((1.0 + 0.01 * col) / 3600.0 * d2r),
+                                    float((-1.0 + 0.01 * row) / 3600.0 * d2r) };
+            os.write(reinterpret_cast<char const*>(cell), sizeof(cell));
+        }
+    }
+}
+
+template <typename Grids>
+inline double run(std::string const& grid, std::vector<point_ll> const& points,
+                  std::size_t threads, int runs)
+{
+    bg::srs::transformation<> const tr(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=" + grid),
+        bg::srs::proj4("+proj=longlat +datum=WGS84"));
+    typedef bg::srs::grids_storage<bg::srs::ifstream_policy, Grids> storage_type;
+    storage_type storage;
+    bg::srs::transformation_grids<storage_type> const grids = tr.initialize_grids(storage);
+
+    std::vector<point_ll> result(points.size());
+    auto const transform = [&](std::size_t first, std::size_t last)
+        {
+            for (std::size_t i = first; i < last; i++)
+            {
+                tr.forward(points[i], result[i], grids);
+            }
+        };
+
+    return measure([&]()
+        {
+            std::size_t const block = points.size() / threads;
+            std::vector<std::thread> pool;
+            for (std::size_t t = 1; t < threads; t++)
+            {
+                pool.emplace_back(transform, t * block,
+                                  t + 1 == threads ? points.size() : (t + 1) * block);
+            }
+            transform(0, threads == 1 ? points.size() : block);
+            for (std::thread& t : pool)
+            {
+                t.join();
+            }
+        }, points.size(), runs);
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== shared_grids ===\nAllowed options");
+
+        std::size_t count = 400000;
+        std::size_t max_threads = 64;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(400000), "Number of points")
+            ("threads", po::value<std::size_t>(&max_threads)->default_value(64), "Maximal number of threads, doubled from 1")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::string const grid = "shared_grids_benchmark.ct2";
+        write_grid(grid);
+
+        std::vector<point_ll> points(count);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            points[i] = point_ll(-99.5 + 9.0 * (i % 1000) / 1000.0,
+                                 30.5 + 9.0 * double(i) / count);
+        }
+
+        std::cout << std::setw(8) << "threads"
+                  << std::setw(12) << "std"
+                  << std::setw(12) << "snapshot"
+                  << std::endl;
+
+        for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+        {
+            double const mpps_std = run<bg::srs::shared_grids_std>(grid, points, threads, runs);
+            double const mpps_snapshot = run<bg::srs::shared_grids_snapshot>(grid, points, threads, runs);
+            std::cout << std::setw(8) << threads
+                      << std::fixed << std::setprecision(2)
+                      << std::setw(12) << mpps_std
+                      << std::setw(12) << mpps_snapshot
+                      << std::defaultfloat << std::endl;
+        }
+
+        std::remove(grid.c_str());
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput (million points per second) of transforming the
+// points of a raster, as in tile reprojection, exactly and approximated by
+// srs_approximate_transformer. The time to divide the extent is included.
+// The largest difference from the exact results is reported.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I.. -I../../include srs_approximate_transformer.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/strategies/transform/srs_approximate_transformer.hpp>
+#include <boost/geometry/strategies/transform/srs_transformer.hpp>
+
+
+namespace bst = bg::strategy::transform;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return count / seconds / 1.0e6;
+}
+
+// Transforms the size x size raster covering the extent
+template <typename PointIn, typename PointOut, typename Exact>
+inline void run(std::string const& name, Exact const& exact,
+                bg::model::box<PointIn> const& extent, double max_error,
+                std::size_t size, int runs)
+{
+    typedef bst::srs_approximate_transformer<Exact, PointIn, PointOut> approximate_type;
+
+    double const min_x = bg::get<bg::min_corner, 0>(extent);
+    double const min_y = bg::get<bg::min_corner, 1>(extent);
+    double const step_x = (bg::get<bg::max_corner, 0>(extent) - min_x) / size;
+    double const step_y = (bg::get<bg::max_corner, 1>(extent) - min_y) / size;
+
+    std::vector<PointIn> points;
+    points.reserve(size * size);
+    for (std::size_t j = 0; j < size; j++)
+    {
+        for (std::size_t i = 0; i < size; i++)
+        {
+            points.push_back(PointIn(min_x + (i + 0.5) * step_x,
+                                     min_y + (j + 0.5) * step_y));
+        }
+    }
+
+    std::vector<PointOut> result(points.size()), result_approximate(points.size());
+    std::size_t cells = 0;
+
+    double const mpps = measure([&]()
+        {
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                exact.apply(points[i], result[i]);
+            }
+        }, points.size(), runs);
+    double const mpps_approximate = measure([&]()
+        {
+            approximate_type const approximate(exact, extent, max_error);
+            for (std::size_t i = 0; i < points.size(); i++)
+            {
+                approximate.apply(points[i], result_approximate[i]);
+            }
+            cells = approximate.size();
+        }, points.size(), runs);
+
+    double error = 0;
+    for (std::size_t i = 0; i < points.size(); i++)
+    {
+        error = (std::max)(error, std::abs(bg::get<0>(result[i]) - bg::get<0>(result_approximate[i])));
+        error = (std::max)(error, std::abs(bg::get<1>(result[i]) - bg::get<1>(result_approximate[i])));
+    }
+
+    std::cout << std::setw(14) << std::left << name
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << mpps
+              << std::setw(10) << mpps_approximate
+              << std::setw(8) << cells
+              << std::setw(12) << std::scientific << std::setprecision(1) << max_error
+              << std::setw(12) << error
+              << std::defaultfloat << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== srs_approximate_transformer ===\nAllowed options");
+
+        std::size_t size = 1000;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("size", po::value<std::size_t>(&size)->default_value(1000), "Width and height of the raster")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(14) << std::left << "case"
+                  << std::setw(10) << std::right << "exact"
+                  << std::setw(10) << "approx"
+                  << std::setw(8) << "cells"
+                  << std::setw(12) << "max error"
+                  << std::setw(12) << "error"
+                  << std::endl;
+
+        using namespace bg::srs;
+        typedef bg::model::box<point_ll> box_ll;
+        typedef bg::model::box<point_xy> box_xy;
+
+        run<point_ll, point_xy>("ll-utm",
+            bst::srs_forward_transformer<projection<> >(proj4("+proj=utm +zone=33 +ellps=WGS84")),
+            box_ll(point_ll(15, 50), point_ll(15.1, 50.1)), 0.01, size, runs);
+        run<point_xy, point_ll>("utm-ll",
+            bst::srs_inverse_transformer<projection<> >(proj4("+proj=utm +zone=33 +ellps=WGS84")),
+            box_xy(point_xy(500000, 5500000), point_xy(510000, 5510000)), 1e-7, size, runs);
+        run<point_xy, point_ll>("31466-4326",
+            bst::srs_forward_transformer<transformation<> >(epsg(31466), epsg(4326)),
+            box_xy(point_xy(2500000, 5600000), point_xy(2510000, 5610000)), 1e-7, size, runs);
+        run<point_xy, point_xy>("3395-32633",
+            bst::srs_forward_transformer<transformation<> >(epsg(3395), epsg(32633)),
+            box_xy(point_xy(1600000, 6500000), point_xy(1620000, 6520000)), 0.01, size, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
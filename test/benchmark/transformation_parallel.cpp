@@ -0,0 +1,209 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput (million points per second) of transforming
+// building footprints and one large linestring, sequentially and with
+// forward_parallel and transform_all for a number of threads.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -pthread -I. -I.. -I../../include transformation_parallel.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/transform_all.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/strategies/transform/srs_transformer.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::polygon<point_ll> polygon_ll;
+typedef bg::model::polygon<point_xy> polygon_xy;
+typedef bg::model::multi_polygon<polygon_ll> multi_polygon_ll;
+typedef bg::model::multi_polygon<polygon_xy> multi_polygon_xy;
+typedef bg::model::linestring<point_ll> linestring_ll;
+typedef bg::model::linestring<point_xy> linestring_xy;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return count / seconds / 1.0e6;
+}
+
+// Rectangular footprints of 5 to 12 points in a grid
+inline multi_polygon_ll make_footprints(double lon, double lat, std::size_t count)
+{
+    multi_polygon_ll result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        double const x = lon + 0.0005 * (i % 1000);
+        double const y = lat + 0.0005 * (i / 1000);
+        std::size_t const extra = i % 8;
+        polygon_ll footprint;
+        bg::append(footprint, point_ll(x, y));
+        bg::append(footprint, point_ll(x, y + 0.0002));
+        for (std::size_t j = 0; j < extra; j++)
+        {
+            bg::append(footprint, point_ll(x + 0.0003 * j / extra, y + 0.00025));
+        }
+        bg::append(footprint, point_ll(x + 0.0003, y + 0.0002));
+        bg::append(footprint, point_ll(x + 0.0003, y));
+        bg::append(footprint, point_ll(x, y));
+        result.push_back(footprint);
+    }
+    return result;
+}
+
+template <typename Transformation>
+inline void run(std::string const& name, Transformation const& tr,
+                double lon, double lat, std::size_t count,
+                std::vector<std::size_t> const& thread_counts, int runs)
+{
+    typedef bg::strategy::transform::srs_forward_transformer<Transformation> strategy_type;
+
+    multi_polygon_ll const footprints = make_footprints(lon, lat, count);
+    std::vector<polygon_ll> const footprint_range(footprints.begin(), footprints.end());
+    std::size_t const points = bg::num_points(footprints);
+
+    linestring_ll line;
+    for (std::size_t i = 0; i < points; i++)
+    {
+        bg::append(line, point_ll(lon + 0.5 * i / points, lat + 0.001 * (i % 7)));
+    }
+
+    strategy_type const strategy(tr);
+
+    multi_polygon_xy footprints_xy;
+    std::vector<polygon_xy> footprint_range_xy;
+    linestring_xy line_xy;
+
+    double const mpps_polygons = measure([&]()
+        {
+            tr.forward(footprints, footprints_xy);
+        }, points, runs);
+    double const mpps_line = measure([&]()
+        {
+            tr.forward(line, line_xy);
+        }, points, runs);
+
+    std::cout << std::setw(12) << std::left << name
+              << std::setw(8) << std::right << "seq"
+              << std::fixed << std::setprecision(2)
+              << std::setw(10) << mpps_polygons
+              << std::setw(10) << "-"
+              << std::setw(10) << mpps_line
+              << std::defaultfloat << std::endl;
+
+    for (std::size_t threads : thread_counts)
+    {
+        double const mpps_polygons_parallel = measure([&]()
+            {
+                tr.forward_parallel(footprints, footprints_xy, threads);
+            }, points, runs);
+        double const mpps_all = measure([&]()
+            {
+                bg::transform_all(footprint_range, footprint_range_xy, strategy, threads);
+            }, points, runs);
+        double const mpps_line_parallel = measure([&]()
+            {
+                tr.forward_parallel(line, line_xy, threads);
+            }, points, runs);
+
+        std::cout << std::setw(12) << std::left << name
+                  << std::setw(8) << std::right << threads
+                  << std::fixed << std::setprecision(2)
+                  << std::setw(10) << mpps_polygons_parallel
+                  << std::setw(10) << mpps_all
+                  << std::setw(10) << mpps_line_parallel
+                  << std::defaultfloat << std::endl;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== transformation_parallel ===\nAllowed options");
+
+        std::size_t count = 100000;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(100000), "Number of footprints")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::vector<std::size_t> thread_counts;
+        std::size_t const hardware = (std::max)(1u, std::thread::hardware_concurrency());
+        for (std::size_t threads = 1; threads < hardware; threads *= 2)
+        {
+            thread_counts.push_back(threads);
+        }
+        thread_counts.push_back(hardware);
+
+        std::cout << std::setw(12) << std::left << "epsg"
+                  << std::setw(8) << std::right << "threads"
+                  << std::setw(10) << "polygons"
+                  << std::setw(10) << "all"
+                  << std::setw(10) << "line"
+                  << std::endl;
+
+        using namespace bg::srs;
+
+        run("4326-32633", transformation<>(epsg(4326), epsg(32633)), 15, 50, count, thread_counts, runs);
+        run("4326-31466", transformation<>(epsg(4326), epsg(31466)), 7, 50, count, thread_counts, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
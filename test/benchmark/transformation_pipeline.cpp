@@ -0,0 +1,188 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Benchmark
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// Measures the throughput (million points per second) of transforming points
+// between two EPSG systems with pj_transform(), which resolves the steps in
+// every call, against the pipeline resolved once, as used by
+// srs::transformation. Points are transformed one by one, as small
+// geometries, and all at once. The results are verified to be the same.
+// Build it optimized, for example:
+//   g++ -O2 -DNDEBUG -I. -I.. -I../../include transformation_pipeline.cpp -lboost_program_options
+
+#define BOOST_GEOMETRY_NO_BOOST_TEST
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+namespace pd = bg::projections::detail;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+template <typename Function>
+inline double measure(Function const& function, std::size_t count, int runs)
+{
+    // Report the fastest run, the others are disturbed by other processes
+    double seconds = 0;
+    for (int i = 0; i < runs; i++)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        function();
+        auto const finish = std::chrono::steady_clock::now();
+        double const elapsed = std::chrono::duration<double>(finish - start).count();
+        if (i == 0 || elapsed < seconds)
+        {
+            seconds = elapsed;
+        }
+    }
+    return count / seconds / 1.0e6;
+}
+
+// Transforms points (lon/lat in radians, or x/y) around x, y
+inline void run(std::string const& name, int src, int dst,
+                double x, double y, double step,
+                std::size_t count, int runs)
+{
+    typedef bg::projections::proj_wrapper<bg::srs::dynamic, double> proj_type;
+    proj_type const proj1{bg::srs::epsg(src)};
+    proj_type const proj2{bg::srs::epsg(dst)};
+    pd::pj_transform_pipeline<double> const pipeline(proj1.proj().params(),
+                                                     proj2.proj().params());
+    bg::srs::transformation_grids<bg::srs::detail::empty_grids_storage> grids;
+
+    std::size_t const width = 1000;
+    std::vector<point_xy> points(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        points[i] = point_xy(x + step * (i % width), y + step * (i / width) * width / count);
+    }
+
+    auto const transform = [&](point_xy* first, point_xy* last)
+        {
+            std::pair<point_xy*, point_xy*> range(first, last);
+            pd::pj_transform(proj1.proj(), proj1.proj().params(),
+                             proj2.proj(), proj2.proj().params(),
+                             range, grids.src_grids, grids.dst_grids);
+        };
+    auto const transform_fused = [&](point_xy* first, point_xy* last)
+        {
+            std::pair<point_xy*, point_xy*> range(first, last);
+            pipeline.apply(proj1.proj(), proj2.proj(), range);
+        };
+
+    std::vector<point_xy> result, result_fused;
+    double mpps[6];
+    std::size_t const sizes[3] = { 1, 10, count };
+    for (int i = 0; i < 3; i++)
+    {
+        std::size_t const size = sizes[i];
+        mpps[i * 2] = measure([&]()
+            {
+                result = points;
+                for (std::size_t j = 0; j + size <= count; j += size)
+                {
+                    transform(&result[j], &result[j] + size);
+                }
+            }, count, runs);
+        mpps[i * 2 + 1] = measure([&]()
+            {
+                result_fused = points;
+                for (std::size_t j = 0; j + size <= count; j += size)
+                {
+                    transform_fused(&result_fused[j], &result_fused[j] + size);
+                }
+            }, count, runs);
+    }
+
+    std::size_t differences = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (bg::get<0>(result[i]) != bg::get<0>(result_fused[i])
+            || bg::get<1>(result[i]) != bg::get<1>(result_fused[i]))
+        {
+            differences++;
+        }
+    }
+
+    std::cout << std::setw(12) << std::left << name
+              << std::right << std::fixed << std::setprecision(2);
+    for (int i = 0; i < 6; i++)
+    {
+        std::cout << std::setw(11) << mpps[i];
+    }
+    std::cout << std::setw(13) << differences
+              << std::defaultfloat << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    BoostGeometryWriteTestConfiguration();
+    try
+    {
+        namespace po = boost::program_options;
+        po::options_description description("=== transformation_pipeline ===\nAllowed options");
+
+        std::size_t count = 200000;
+        int runs = 3;
+
+        description.add_options()
+            ("help", "Help message")
+            ("count", po::value<std::size_t>(&count)->default_value(200000), "Number of points")
+            ("runs", po::value<int>(&runs)->default_value(3), "Number of runs per measurement, the fastest is reported")
+        ;
+
+        po::variables_map varmap;
+        po::store(po::parse_command_line(argc, argv, description), varmap);
+        po::notify(varmap);
+
+        if (varmap.count("help"))
+        {
+            std::cout << description << std::endl;
+            return 1;
+        }
+
+        std::cout << std::setw(12) << std::left << "epsg"
+                  << std::setw(11) << std::right << "point"
+                  << std::setw(11) << "fused"
+                  << std::setw(11) << "10 points"
+                  << std::setw(11) << "fused"
+                  << std::setw(11) << "all"
+                  << std::setw(11) << "fused"
+                  << std::setw(13) << "differences"
+                  << std::endl;
+
+        double const d2r = bg::math::d2r<double>();
+        run("31466-4326", 31466, 4326, 2500000, 5600000, 100, count, runs);
+        run("2180-32633", 2180, 32633, 500000, 500000, 100, count, runs);
+        run("4326-3395", 4326, 3395, 10 * d2r, 50 * d2r, 0.001 * d2r, count, runs);
+        run("4326-4314", 4326, 4314, 6 * d2r, 50.5 * d2r, 0.001 * d2r, count, runs);
+        run("4326-31466", 4326, 31466, 6 * d2r, 50.5 * d2r, 0.001 * d2r, count, runs);
+    }
+    catch(std::exception const& e)
+    {
+        std::cout << "Exception " << e.what() << std::endl;
+    }
+    catch(...)
+    {
+        std::cout << "Other exception" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,207 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/srs/projections/impl/geocent.hpp>
+#include <boost/geometry/srs/projections/impl/pj_transform.hpp>
+
+
+namespace bgp = bg::projections::detail;
+
+typedef bgp::GeocentricInfo<double> info_type;
+
+inline info_type make_info(double a, double b)
+{
+    info_type gi;
+    BOOST_CHECK_EQUAL(bgp::pj_Set_Geocentric_Parameters(gi, a, b), 0);
+    return gi;
+}
+
+void test_geodetic_to_geocentric(info_type const& gi)
+{
+    double const pi = bg::math::pi<double>();
+    double const half_pi = bg::math::half_pi<double>();
+
+    std::vector<double> lon, lat, h;
+    for (int i = 0; i < 1000; i++)
+    {
+        lon.push_back(-pi + i * 0.0071);
+        lat.push_back(-half_pi + i * 0.0031);
+        h.push_back(-1000.0 + i * 37.0);
+    }
+    // Wrapped longitude, latitudes just beyond the poles, out of range
+    lon.push_back(pi + 0.1);         lat.push_back(0.5);                h.push_back(0);
+    lon.push_back(0.2);              lat.push_back(half_pi * 1.0005);   h.push_back(0);
+    lon.push_back(0.3);              lat.push_back(-half_pi * 1.0005);  h.push_back(10);
+    lon.push_back(0.4);              lat.push_back(half_pi * 1.01);     h.push_back(0);
+    lon.push_back(HUGE_VAL);         lat.push_back(HUGE_VAL);           h.push_back(0);
+
+    std::size_t const count = lon.size();
+    std::vector<double> lon_n(lon), lat_n(lat), x(count), y(count), z(count);
+
+    long const error = bgp::pj_Convert_Geodetic_To_Geocentric_n(gi, count,
+        lon_n.data(), lat_n.data(), h.data(), x.data(), y.data(), z.data());
+    BOOST_CHECK_EQUAL(error, bgp::GEOCENT_LAT_ERROR);
+
+    for (std::size_t i = 0; i + 2 < count; i++)
+    {
+        double ex = 0, ey = 0, ez = 0;
+        BOOST_CHECK_EQUAL(bgp::pj_Convert_Geodetic_To_Geocentric(gi,
+            lon[i], lat[i], h[i], ex, ey, ez), 0);
+        // The same formulas
+        BOOST_CHECK_EQUAL(x[i], ex);
+        BOOST_CHECK_EQUAL(y[i], ey);
+        BOOST_CHECK_EQUAL(z[i], ez);
+    }
+
+    BOOST_CHECK_EQUAL(lon_n[count - 2], HUGE_VAL);
+    BOOST_CHECK_EQUAL(lat_n[count - 2], HUGE_VAL);
+    BOOST_CHECK_EQUAL(lon_n[count - 1], HUGE_VAL);
+}
+
+void test_geocentric_to_geodetic(info_type const& gi)
+{
+    double const half_pi = bg::math::half_pi<double>();
+
+    std::vector<double> x, y, z;
+    // From below the surface to beyond the geostationary orbit
+    for (double h : {-900000.0, -10000.0, 0.0, 100.0, 8848.0, 400000.0, 36000000.0})
+    {
+        for (int i = 0; i <= 100; i++)
+        {
+            double const lon = -3.0 + i * 0.06;
+            double lat = -half_pi + i * (2 * half_pi / 100);
+            double px = 0, py = 0, pz = 0;
+            bgp::pj_Convert_Geodetic_To_Geocentric(gi, lon, lat, h, px, py, pz);
+            x.push_back(px);
+            y.push_back(py);
+            z.push_back(pz);
+        }
+    }
+    // On the axis, at the center, deep below the surface
+    double const special[][3] = {
+        { 0, 0, 6356752.3 }, { 1.0e-7, 0, -6356752.3 }, { 0, 0, 0 },
+        { 1000, 2000, 3000 }, { 3000000, 0, 1000000 }
+    };
+    for (std::size_t i = 0; i < 5; i++)
+    {
+        x.push_back(special[i][0]);
+        y.push_back(special[i][1]);
+        z.push_back(special[i][2]);
+    }
+
+    std::size_t const count = x.size();
+    std::vector<double> lon(count, 0), lat(count, 0), h(count, 0);
+    lon[3] = lat[3] = HUGE_VAL;
+    h[3] = 1.5;
+
+    bgp::pj_Convert_Geocentric_To_Geodetic_n(gi, count, x.data(), y.data(), z.data(),
+                                             lon.data(), lat.data(), h.data());
+
+    // Invalid points are not changed
+    BOOST_CHECK_EQUAL(lon[3], HUGE_VAL);
+    BOOST_CHECK_EQUAL(lat[3], HUGE_VAL);
+    BOOST_CHECK_EQUAL(h[3], 1.5);
+
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (i == 3)
+        {
+            continue;
+        }
+
+        double elon = 0, elat = 0, eh = 0;
+        bgp::pj_Convert_Geocentric_To_Geodetic(gi, x[i], y[i], z[i], elon, elat, eh);
+
+        if (i + 5 >= count)
+        {
+            // Converted as before
+            BOOST_CHECK_EQUAL(lon[i], elon);
+            BOOST_CHECK_EQUAL(lat[i], elat);
+            BOOST_CHECK_EQUAL(h[i], eh);
+        }
+        else
+        {
+            BOOST_CHECK_SMALL(lon[i] - elon, 1.0e-15);
+            BOOST_CHECK_SMALL(lat[i] - elat, 1.0e-14);
+            BOOST_CHECK_SMALL(h[i] - eh, 1.0e-7);
+        }
+    }
+}
+
+void test_helmert()
+{
+    std::vector<double> x, y, z;
+    for (int i = 0; i < 100; i++)
+    {
+        x.push_back(4000000.0 + i * 1000.0);
+        y.push_back(1000000.0 - i * 700.0);
+        z.push_back(4800000.0 + i * 300.0);
+    }
+
+    bgp::pj_helmert<double> const p3 = { 598.1, 73.7, 418.2, 0, 0, 0, 1 };
+    bgp::pj_helmert<double> const p7 = { 598.1, 73.7, 418.2,
+                                         0.202 * bg::math::d2r<double>() / 3600,
+                                         0.045 * bg::math::d2r<double>() / 3600,
+                                         -2.455 * bg::math::d2r<double>() / 3600,
+                                         1.0 + 6.7e-6 };
+
+    // 3 parameters, the shift is added
+    {
+        std::vector<double> tx(x), ty(y), tz(z);
+        bgp::pj_geocentric_to_wgs84_n(p3, x.size(), tx.data(), ty.data(), tz.data());
+        for (std::size_t i = 0; i < x.size(); i++)
+        {
+            BOOST_CHECK_EQUAL(tx[i], x[i] + p3.dx);
+            BOOST_CHECK_EQUAL(ty[i], y[i] + p3.dy);
+            BOOST_CHECK_EQUAL(tz[i], z[i] + p3.dz);
+        }
+        bgp::pj_geocentric_from_wgs84_n(p3, x.size(), tx.data(), ty.data(), tz.data());
+        for (std::size_t i = 0; i < x.size(); i++)
+        {
+            BOOST_CHECK_EQUAL(tx[i], (x[i] + p3.dx) - p3.dx);
+        }
+    }
+
+    // 7 parameters, back and forth
+    {
+        std::vector<double> tx(x), ty(y), tz(z);
+        bgp::pj_geocentric_to_wgs84_n(p7, x.size(), tx.data(), ty.data(), tz.data());
+        BOOST_CHECK_CLOSE(tx[0], p7.m * (x[0] - p7.rz * y[0] + p7.ry * z[0]) + p7.dx, 1.0e-12);
+        BOOST_CHECK_GT(std::abs(tx[0] - x[0] - p7.dx), 1.0);
+        bgp::pj_geocentric_from_wgs84_n(p7, x.size(), tx.data(), ty.data(), tz.data());
+        for (std::size_t i = 0; i < x.size(); i++)
+        {
+            // The rotation is approximated for small angles
+            BOOST_CHECK_SMALL(tx[i] - x[i], 1.0e-3);
+            BOOST_CHECK_SMALL(ty[i] - y[i], 1.0e-3);
+            BOOST_CHECK_SMALL(tz[i] - z[i], 1.0e-3);
+        }
+    }
+}
+
+int test_main(int, char*[])
+{
+    info_type const wgs84 = make_info(6378137.0, 6356752.3142451793);
+    info_type const bessel = make_info(6377397.155, 6356078.962818189);
+    info_type const sphere = make_info(6371000.0, 6371000.0);
+
+    test_geodetic_to_geocentric(wgs84);
+    test_geodetic_to_geocentric(sphere);
+    test_geocentric_to_geodetic(wgs84);
+    test_geocentric_to_geodetic(bessel);
+    test_geocentric_to_geodetic(sphere);
+    test_helmert();
+
+    return 0;
+}
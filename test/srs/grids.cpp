@@ -0,0 +1,454 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/algorithms/detail/parallel_for.hpp>
+#include <boost/geometry/srs/mapped_grids.hpp>
+#include <boost/geometry/srs/shared_grids_snapshot.hpp>
+#include <boost/geometry/srs/shared_grids_std.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+namespace pd = bg::projections::detail;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::linestring<point_ll> linestring;
+
+// Shift in seconds of arc of a cell, varying in both directions
+inline double shift(int row, int col, int coord)
+{
+    return coord == 0 ? 1.0 + 0.1 * row + 0.02 * col
+                      : -2.0 + 0.05 * row - 0.03 * col;
+}
+
+enum byte_order { little_endian, big_endian, native };
+
+struct grid_file
+{
+    explicit grid_file(std::string const& name)
+        : name(name)
+        , os(name.c_str(), std::ios::binary)
+    {}
+
+    void write(const char * data, std::size_t size)
+    {
+        os.write(data, size);
+    }
+
+    template <typename T>
+    void write(T value, byte_order order = little_endian)
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        if ((order == little_endian && ! pd::is_lsb())
+            || (order == big_endian && pd::is_lsb()))
+        {
+            pd::swap_words(bytes, sizeof(T), 1);
+        }
+        write(bytes, sizeof(T));
+    }
+
+    // Label and value of NTv1 and NTv2 header records
+    void record(const char * label, const char * value)
+    {
+        write(label, 8);
+        write(value, 8);
+    }
+
+    template <typename T>
+    void record(const char * label, T value, byte_order order = little_endian)
+    {
+        write(label, 8);
+        write(value, order);
+        for (std::size_t i = sizeof(T) ; i < 8 ; i++)
+        {
+            write(char(0));
+        }
+    }
+
+    std::string name;
+    std::ofstream os;
+};
+
+// NTv2 subgrid with the longitudes (in seconds) positive to the west
+void write_ntv2_subgrid(grid_file & file, const char * name, const char * parent,
+                        double south, double north, double east, double west,
+                        double inc)
+{
+    int const rows = int((north - south) / inc + 0.5) + 1;
+    int const cols = int((west - east) / inc + 0.5) + 1;
+
+    file.record("SUB_NAME", name);
+    file.record("PARENT  ", parent);
+    file.record("CREATED ", "        ");
+    file.record("UPDATED ", "        ");
+    file.record("S_LAT   ", south);
+    file.record("N_LAT   ", north);
+    file.record("E_LONG  ", east);
+    file.record("W_LONG  ", west);
+    file.record("LAT_INC ", inc);
+    file.record("LONG_INC", inc);
+    file.record("GS_COUNT", boost::int32_t(rows * cols));
+
+    // Rows from south to north, from east to west
+    for (int row = 0 ; row < rows ; row++)
+    {
+        for (int i = 0 ; i < cols ; i++)
+        {
+            int const col = cols - i - 1;
+            file.write(float(shift(row, col, 1)));
+            file.write(float(shift(row, col, 0)));
+            file.write(float(0));
+            file.write(float(0));
+        }
+    }
+}
+
+void write_ntv2(std::string const& name)
+{
+    grid_file file(name);
+    file.record("NUM_OREC", boost::int32_t(11));
+    file.record("NUM_SREC", boost::int32_t(11));
+    file.record("NUM_FILE", boost::int32_t(2));
+    file.record("GS_TYPE ", "SECONDS ");
+    file.record("VERSION ", "NTv2.0  ");
+    file.record("SYSTEM_F", "NAD27   ");
+    file.record("SYSTEM_T", "NAD83   ");
+    file.record("MAJOR_F ", 6378206.4);
+    file.record("MINOR_F ", 6356583.8);
+    file.record("MAJOR_T ", 6378137.0);
+    file.record("MINOR_T ", 6356752.314);
+    // -100..-98, 40..42 and a denser child grid -99.5..-99, 40.5..41
+    write_ntv2_subgrid(file, "PARENT  ", "NONE    ",
+                       40 * 3600.0, 42 * 3600.0, 98 * 3600.0, 100 * 3600.0, 900.0);
+    write_ntv2_subgrid(file, "CHILD   ", "PARENT  ",
+                       40.5 * 3600.0, 41 * 3600.0, 99 * 3600.0, 99.5 * 3600.0, 450.0);
+}
+
+// Big-endian, the header values in degrees
+void write_ntv1(std::string const& name)
+{
+    grid_file file(name);
+    file.record("HEADER  ", boost::int32_t(12), big_endian);
+    file.record("S_LAT   ", 40.0, big_endian);
+    file.record("N_LAT   ", 42.0, big_endian);
+    file.record("E_LONG  ", 98.0, big_endian);
+    file.record("W_LONG  ", 100.0, big_endian);
+    file.record("N_GRID  ", 0.25, big_endian);
+    file.record("W GRID  ", 0.25, big_endian);
+    file.record("TYPE    ", "SECONDS ");
+    file.record("VERSION ", "NTv1    ");
+    file.record("TO      ", "NAD83   ");
+    file.write("D1      ", 8);
+    file.write(0.0, big_endian);
+
+    for (int row = 0 ; row < 9 ; row++)
+    {
+        for (int i = 0 ; i < 9 ; i++)
+        {
+            int const col = 9 - i - 1;
+            file.write(shift(row, col, 1), big_endian);
+            file.write(shift(row, col, 0), big_endian);
+        }
+    }
+}
+
+// The shifts in radians, ctable in the native byte order
+void write_ctable(std::string const& name, bool version2)
+{
+    double const d2r = bg::math::d2r<double>();
+    double const s2r = d2r / 3600.0;
+    byte_order const order = version2 ? little_endian : native;
+
+    grid_file file(name);
+    char text[80] = {};
+    if (version2)
+    {
+        std::strcpy(text, "CTABLE V2");
+        file.write(text, 16);
+    }
+    std::memset(text, 0, sizeof(text));
+    std::strcpy(text, "test grid");
+    file.write(text, 80);
+    file.write(-100.0 * d2r, order);
+    file.write(40.0 * d2r, order);
+    file.write(0.25 * d2r, order);
+    file.write(0.25 * d2r, order);
+    file.write(boost::int32_t(9), order);
+    file.write(boost::int32_t(9), order);
+    if (version2)
+    {
+        std::memset(text, 0, sizeof(text));
+        file.write(text, 24);
+    }
+    else
+    {
+        file.write(text, sizeof(pd::pj_ctable::flp_t*));
+    }
+
+    for (int row = 0 ; row < 9 ; row++)
+    {
+        for (int col = 0 ; col < 9 ; col++)
+        {
+            file.write(float(shift(row, col, 0) * s2r), order);
+            file.write(float(shift(row, col, 1) * s2r), order);
+        }
+    }
+}
+
+// Compares all cells accessed in place with the loaded grids
+void test_cells(std::string const& name, std::size_t expected_count)
+{
+    bg::srs::mapped_file_policy::stream_type is;
+    bg::srs::mapped_file_policy::open(is, name);
+    pd::pj_gridinfo gridinfo;
+    BOOST_CHECK(pd::pj_gridinfo_init(name, is, gridinfo));
+    BOOST_CHECK_EQUAL(gridinfo.size(), 1u);
+    if (gridinfo.size() != 1)
+    {
+        return;
+    }
+    BOOST_CHECK(pd::pj_gridinfo_mapped_fits(gridinfo[0], is.size()));
+    BOOST_CHECK(! pd::pj_gridinfo_mapped_fits(gridinfo[0], is.size() - 1));
+
+    std::vector<pd::pj_gi *> grids(1, &gridinfo[0]);
+    for (std::size_t i = 0 ; i < gridinfo[0].children.size() ; i++)
+    {
+        grids.push_back(&gridinfo[0].children[i]);
+    }
+    BOOST_CHECK_EQUAL(grids.size(), expected_count);
+
+    for (std::size_t g = 0 ; g < grids.size() ; g++)
+    {
+        pd::pj_gi loaded = *grids[g];
+        std::ifstream ifs(name.c_str(), std::ios::binary);
+        BOOST_CHECK(pd::pj_gridinfo_load(ifs, loaded));
+
+        pd::pj_gridinfo_mapped_cells const cells(*grids[g], is.file()->data());
+        std::size_t differences = 0;
+        for (std::size_t i = 0 ; i < loaded.ct.cvs.size() ; i++)
+        {
+            pd::pj_ctable::flp_t const cell = cells[boost::int32_t(i)];
+            if (cell.lam != loaded.ct.cvs[i].lam || cell.phi != loaded.ct.cvs[i].phi)
+            {
+                differences++;
+            }
+        }
+        BOOST_CHECK_MESSAGE(differences == 0,
+            name << " grid " << g << " differences: " << differences);
+    }
+}
+
+template <typename Storage>
+inline void transform(Storage & storage, std::string const& nadgrids,
+                      linestring const& in, linestring & out, linestring & back)
+{
+    bg::srs::transformation<> const tr(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=" + nadgrids),
+        bg::srs::proj4("+proj=longlat +datum=WGS84"));
+    bg::srs::transformation_grids<Storage> const grids = tr.initialize_grids(storage);
+    BOOST_CHECK(tr.forward(in, out, grids));
+    BOOST_CHECK(tr.inverse(out, back, grids));
+}
+
+// Points in, around and out of the grids
+inline linestring test_points()
+{
+    linestring result;
+    for (int i = 0 ; i < 30 ; i++)
+    {
+        for (int j = 0 ; j < 30 ; j++)
+        {
+            result.push_back(point_ll(-100.5 + i * 0.1, 39.5 + j * 0.1));
+        }
+    }
+    return result;
+}
+
+inline bool equal(linestring const& ls1, linestring const& ls2)
+{
+    if (ls1.size() != ls2.size())
+    {
+        return false;
+    }
+    for (std::size_t i = 0 ; i < ls1.size() ; i++)
+    {
+        if (! bg::equals(ls1[i], ls2[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Compares the results of loaded, mapped and shared grids
+void test_transformation(std::string const& nadgrids)
+{
+    linestring const in = test_points();
+
+    typedef bg::srs::grids_storage<> loaded_storage;
+    typedef bg::srs::grids_storage<bg::srs::mapped_file_policy> loaded_mapped_storage;
+    typedef bg::srs::grids_storage
+        <
+            bg::srs::mapped_file_policy, bg::srs::mapped_grids
+        > mapped_storage;
+
+    typedef bg::srs::grids_storage
+        <
+            bg::srs::ifstream_policy, bg::srs::shared_grids_snapshot
+        > snapshot_storage;
+
+    loaded_storage loaded;
+    loaded_mapped_storage loaded_mapped;
+    mapped_storage mapped;
+    snapshot_storage snapshot;
+    linestring out1, back1, out2, back2, out3, back3, out4, back4;
+    transform(loaded, nadgrids, in, out1, back1);
+    transform(loaded_mapped, nadgrids, in, out2, back2);
+    transform(mapped, nadgrids, in, out3, back3);
+    transform(snapshot, nadgrids, in, out4, back4);
+
+    // Nothing is loaded
+    BOOST_CHECK(! mapped.hgrids.empty());
+    BOOST_CHECK_EQUAL(mapped.hgrids.files.size(), mapped.hgrids.size());
+    BOOST_CHECK(mapped.hgrids.gridinfo[0].ct.cvs.empty());
+    // Everything is loaded before it is published
+    BOOST_CHECK(! snapshot.hgrids.empty());
+    BOOST_CHECK(! snapshot.hgrids.snapshot()[0]->ct.cvs.empty());
+
+    std::size_t shifted = 0, differences = 0;
+    for (std::size_t i = 0 ; i < in.size() ; i++)
+    {
+        if (! bg::equals(out1[i], in[i]))
+        {
+            shifted++;
+        }
+        if (! bg::equals(out1[i], out2[i]) || ! bg::equals(out1[i], out3[i])
+            || ! bg::equals(back1[i], back2[i]) || ! bg::equals(back1[i], back3[i]))
+        {
+            differences++;
+        }
+    }
+    BOOST_CHECK_MESSAGE(shifted > 0, nadgrids << " no shifted points");
+    BOOST_CHECK_MESSAGE(differences == 0,
+        nadgrids << " differences: " << differences);
+    BOOST_CHECK_MESSAGE(equal(out1, out4) && equal(back1, back4),
+        nadgrids << " shared snapshot differences");
+}
+
+// Threads initializing and applying the same grids concurrently
+template <typename Grids>
+void test_threads(std::string const& nadgrids1, std::string const& nadgrids2)
+{
+    linestring const in = test_points();
+    linestring expected1, expected2, back;
+    {
+        bg::srs::grids_storage<> loaded;
+        transform(loaded, nadgrids1, in, expected1, back);
+        transform(loaded, nadgrids2, in, expected2, back);
+    }
+
+    bg::srs::grids_storage<bg::srs::ifstream_policy, Grids> storage;
+    std::size_t const count = 16;
+    std::vector<int> correct(count, 0);
+    bg::detail::parallel::for_each_index(count, 4, [&](std::size_t i)
+        {
+            // Not checked here, Boost.Test is not thread-safe
+            bg::srs::transformation<> const tr(
+                bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids="
+                               + (i % 2 == 0 ? nadgrids1 : nadgrids2)),
+                bg::srs::proj4("+proj=longlat +datum=WGS84"));
+            auto const grids = tr.initialize_grids(storage);
+            linestring out;
+            correct[i] = tr.forward(in, out, grids)
+                      && equal(out, i % 2 == 0 ? expected1 : expected2) ? 1 : 0;
+        });
+
+    BOOST_CHECK_EQUAL(std::count(correct.begin(), correct.end(), 1), int(count));
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 2u);
+}
+
+int test_main(int, char*[])
+{
+    std::string const ntv2 = "grids_test.gsb";
+    std::string const ntv1 = "grids_test.dat";
+    std::string const ctable = "grids_test.lla";
+    std::string const ctable2 = "grids_test.ct2";
+    std::string const truncated = "grids_test_truncated.gsb";
+
+    write_ntv2(ntv2);
+    write_ntv1(ntv1);
+    write_ctable(ctable, false);
+    write_ctable(ctable2, true);
+
+    test_cells(ntv2, 2);
+    test_cells(ntv1, 1);
+    test_cells(ctable, 1);
+    test_cells(ctable2, 1);
+
+    test_transformation(ntv2);
+    test_transformation(ntv1);
+    test_transformation(ctable);
+    test_transformation(ctable2);
+    test_transformation("@grids_test_missing.gsb," + ntv2);
+
+    test_threads<bg::srs::shared_grids_std>(ntv2, ntv1 + "," + ntv2);
+    test_threads<bg::srs::shared_grids_snapshot>(ntv2, ntv1 + "," + ntv2);
+
+    // The grids are stored once and the mapped files shared
+    {
+        bg::srs::grids_storage<bg::srs::mapped_file_policy, bg::srs::mapped_grids> storage;
+        linestring in, out, back;
+        in.push_back(point_ll(-99, 41));
+        transform(storage, ntv2, in, out, back);
+        transform(storage, ntv2 + "," + ctable2, in, out, back);
+        BOOST_CHECK_EQUAL(storage.hgrids.size(), 2u);
+        BOOST_CHECK(storage.hgrids.files[0] != storage.hgrids.files[1]);
+    }
+
+    // Missing required grid files and files too short to contain the grids
+    {
+        std::ifstream is(ntv2.c_str(), std::ios::binary);
+        std::vector<char> data((std::istreambuf_iterator<char>(is)),
+                               std::istreambuf_iterator<char>());
+        std::ofstream os(truncated.c_str(), std::ios::binary);
+        os.write(&data[0], data.size() - 16);
+    }
+
+    bg::srs::transformation<> const tr_missing(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=grids_test_missing.gsb"),
+        bg::srs::proj4("+proj=longlat +datum=WGS84"));
+    bg::srs::transformation<> const tr_truncated(
+        bg::srs::proj4("+proj=longlat +ellps=clrk66 +nadgrids=" + truncated),
+        bg::srs::proj4("+proj=longlat +datum=WGS84"));
+    {
+        bg::srs::grids_storage<bg::srs::mapped_file_policy, bg::srs::mapped_grids> storage;
+        BOOST_CHECK_THROW(tr_missing.initialize_grids(storage), bg::projection_exception);
+        BOOST_CHECK_THROW(tr_truncated.initialize_grids(storage), bg::projection_exception);
+        BOOST_CHECK(storage.hgrids.empty());
+        BOOST_CHECK(storage.hgrids.files.empty());
+    }
+
+    std::remove(ntv2.c_str());
+    std::remove(ntv1.c_str());
+    std::remove(ctable.c_str());
+    std::remove(ctable2.c_str());
+    std::remove(truncated.c_str());
+
+    return 0;
+}
@@ -0,0 +1,139 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::radian> > point_ll_rad;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+// More points than projected in one block, some of them invalid
+inline std::vector<point_ll> grid_points()
+{
+    std::vector<point_ll> result;
+    for (int i = 0; i < 40; i++)
+    {
+        for (int j = 0; j < 30; j++)
+        {
+            result.push_back(point_ll(-20.0 + i, 25.0 + j * 1.1));
+        }
+    }
+    result[7] = point_ll(5.0, 95.0);
+    result[500] = point_ll(5.0, -91.0);
+    return result;
+}
+
+// Projects the points one by one and as arrays, the results should be
+// exactly the same
+template <typename Projection>
+void test_projection(std::string const& caseid, Projection const& projection)
+{
+    std::vector<point_ll> const points = grid_points();
+    std::size_t const count = points.size();
+
+    std::vector<point_xy> projected(count);
+    std::vector<point_ll> points_back(count);
+    bool expected_ok = true;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        expected_ok = projection.forward(points[i], projected[i]) && expected_ok;
+        projection.inverse(projected[i], points_back[i]);
+    }
+    BOOST_CHECK(! expected_ok);
+
+    std::vector<double> lons(count), lats(count), xs(count), ys(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        lons[i] = bg::get<0>(points[i]);
+        lats[i] = bg::get<1>(points[i]);
+    }
+
+    BOOST_CHECK(! projection.forward(count, lons.data(), lats.data(),
+                                     xs.data(), ys.data()));
+
+    std::vector<double> lons_back(count), lats_back(count);
+    projection.inverse(count, xs.data(), ys.data(),
+                       lons_back.data(), lats_back.data());
+
+    // Interleaved coordinates, in radians
+    std::vector<point_ll_rad> points_rad(count), points_rad_back(count);
+    std::vector<point_xy> projected_rad(count);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        bg::set<0>(points_rad[i], bg::get_as_radian<0>(points[i]));
+        bg::set<1>(points_rad[i], bg::get_as_radian<1>(points[i]));
+    }
+    double const* ll = reinterpret_cast<double const*>(points_rad.data());
+    double* xy = reinterpret_cast<double*>(projected_rad.data());
+    double* ll_back = reinterpret_cast<double*>(points_rad_back.data());
+    projection.template forward<bg::radian>(count, ll, ll + 1, xy, xy + 1, 2);
+    projection.template inverse<bg::radian>(count, xy, xy + 1, ll_back, ll_back + 1, 2);
+
+    std::size_t differences = 0;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        if (xs[i] != bg::get<0>(projected[i])
+            || ys[i] != bg::get<1>(projected[i])
+            || bg::get<0>(projected_rad[i]) != bg::get<0>(projected[i])
+            || bg::get<1>(projected_rad[i]) != bg::get<1>(projected[i]))
+        {
+            differences++;
+        }
+        if (xs[i] != HUGE_VAL
+            && (lons_back[i] != bg::get<0>(points_back[i])
+                || lats_back[i] != bg::get<1>(points_back[i])
+                || std::abs(bg::get<0>(points_rad_back[i])
+                            - bg::get_as_radian<0>(points_back[i])) > 1.0e-12
+                || std::abs(bg::get<1>(points_rad_back[i])
+                            - bg::get_as_radian<1>(points_back[i])) > 1.0e-12))
+        {
+            differences++;
+        }
+    }
+    BOOST_CHECK_MESSAGE(differences == 0,
+        caseid << " differences: " << differences);
+
+    BOOST_CHECK_EQUAL(xs[7], HUGE_VAL);
+    BOOST_CHECK_EQUAL(ys[500], HUGE_VAL);
+    BOOST_CHECK_CLOSE(lons_back[8], bg::get<0>(points[8]), 0.01);
+    BOOST_CHECK_CLOSE(lats_back[8], bg::get<1>(points[8]), 0.01);
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    test_projection("merc", projection<>(proj4("+proj=merc +ellps=WGS84")));
+    test_projection("merc_sph", projection<>(proj4("+proj=merc +R=6371000")));
+    test_projection("tmerc", projection<>(proj4("+proj=tmerc +ellps=WGS84 +lon_0=3 +x_0=500000")));
+    test_projection("etmerc", projection<>(proj4("+proj=etmerc +ellps=WGS84 +lon_0=3")));
+    test_projection("lcc", projection<>(proj4("+proj=lcc +ellps=WGS84 +lat_1=35 +lat_2=45 +lon_0=0 +units=km")));
+    test_projection("laea", projection<>(proj4("+proj=laea +ellps=WGS84 +lat_0=40 +lon_0=0")));
+    test_projection("aea", projection<>(proj4("+proj=aea +ellps=WGS84 +lat_1=35 +lat_2=45")));
+
+    {
+        using namespace bg::srs::spar;
+        test_projection("merc_static",
+            projection<parameters<proj_merc, ellps_wgs84> >());
+        test_projection("lcc_static",
+            projection<parameters<proj_lcc, ellps_wgs84, lat_1<>, lat_2<> > >(
+                parameters<proj_lcc, ellps_wgs84, lat_1<>, lat_2<> >(
+                    proj_lcc(), ellps_wgs84(), lat_1<>(35), lat_2<>(45))));
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/esri.hpp>
+#include <boost/geometry/srs/projection_cache.hpp>
+
+#include "check_geometry.hpp"
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+typedef bg::srs::projection_cache<> cache_type;
+
+void test_projections()
+{
+    using namespace bg::srs;
+
+    cache_type cache;
+
+    cache_type::projection_ptr const p1 = cache.get_projection(proj4("+proj=utm +zone=33 +ellps=WGS84"));
+    cache_type::projection_ptr const p2 = cache.get_projection(proj4("+proj=utm +zone=33 +ellps=WGS84"));
+    cache_type::projection_ptr const p3 = cache.get_projection(proj4("+proj=utm +zone=34 +ellps=WGS84"));
+    cache_type::projection_ptr const p4 = cache.get_projection(epsg(32633));
+    cache_type::projection_ptr const p5 = cache.get_projection(epsg(32633));
+    cache_type::projection_ptr const p6 = cache.get_projection(esri(102132));
+
+    BOOST_CHECK(p1 == p2);
+    BOOST_CHECK(p1 != p3);
+    BOOST_CHECK(p1 != p4);
+    BOOST_CHECK(p4 == p5);
+    BOOST_CHECK(p4 != p6);
+    BOOST_CHECK(projection_cache_key<epsg>::apply(epsg(102132))
+             != projection_cache_key<esri>::apply(esri(102132)));
+    BOOST_CHECK_EQUAL(cache.projections_size(), 4u);
+    BOOST_CHECK_EQUAL(cache.transformations_size(), 0u);
+
+    // Same results as not cached projections
+    point_ll const ll(15.5, 50.1);
+    point_xy xy, xy_expected;
+    projection<> const prj(epsg(32633));
+    prj.forward(ll, xy_expected);
+    p4->forward(ll, xy);
+    test::check_geometry(xy, xy_expected, 0.0);
+    p1->forward(ll, xy);
+    test::check_geometry(xy, xy_expected, 0.001);
+
+    // Not created definitions are not cached
+    BOOST_CHECK_THROW(cache.get_projection(proj4("+proj=unknown")),
+                      bg::projection_exception);
+    BOOST_CHECK_THROW(cache.get_projection(epsg(1)),
+                      bg::projection_exception);
+    BOOST_CHECK_EQUAL(cache.projections_size(), 4u);
+
+    cache.clear();
+    BOOST_CHECK_EQUAL(cache.projections_size(), 0u);
+    // Still valid
+    p1->forward(ll, xy);
+    test::check_geometry(xy, xy_expected, 0.001);
+    BOOST_CHECK(cache.get_projection(epsg(32633)) != p4);
+}
+
+void test_transformations()
+{
+    using namespace bg::srs;
+
+    cache_type cache;
+
+    cache_type::transformation_ptr const t1 = cache.get_transformation(epsg(4326), epsg(32633));
+    cache_type::transformation_ptr const t2 = cache.get_transformation(epsg(4326), epsg(32633));
+    cache_type::transformation_ptr const t3 = cache.get_transformation(epsg(32633), epsg(4326));
+    cache_type::transformation_ptr const t4 = cache.get_transformation(
+        proj4("+proj=longlat +datum=WGS84"), epsg(32633));
+
+    BOOST_CHECK(t1 == t2);
+    BOOST_CHECK(t1 != t3);
+    BOOST_CHECK(t1 != t4);
+    BOOST_CHECK_EQUAL(cache.transformations_size(), 3u);
+    BOOST_CHECK_EQUAL(cache.projections_size(), 0u);
+
+    // The definitions of the key can not be confused
+    cache_type::transformation_ptr const t5 = cache.get_transformation(
+        proj4("+proj=longlat +datum=WGS84 "), proj4("+proj=utm +zone=33"));
+    cache_type::transformation_ptr const t6 = cache.get_transformation(
+        proj4("+proj=longlat +datum=WGS84"), proj4(" +proj=utm +zone=33"));
+    BOOST_CHECK(t5 != t6);
+
+    point_ll const ll(15.5, 50.1);
+    point_xy xy, xy_expected;
+    transformation<> const tr(epsg(4326), epsg(32633));
+    tr.forward(ll, xy_expected);
+    t1->forward(ll, xy);
+    test::check_geometry(xy, xy_expected, 0.0);
+    t4->forward(ll, xy);
+    test::check_geometry(xy, xy_expected, 0.001);
+
+    point_ll ll2;
+    t3->forward(xy, ll2);
+    test::check_geometry(ll2, ll, 0.000001);
+}
+
+void test_bounded()
+{
+    using namespace bg::srs;
+
+    cache_type cache(2);
+
+    cache_type::projection_ptr const p1 = cache.get_projection(epsg(32631));
+    cache_type::projection_ptr const p2 = cache.get_projection(epsg(32632));
+    BOOST_CHECK(cache.get_projection(epsg(32631)) == p1);
+    // Removes 32632, used least recently
+    cache_type::projection_ptr const p3 = cache.get_projection(epsg(32633));
+    BOOST_CHECK_EQUAL(cache.projections_size(), 2u);
+    BOOST_CHECK(cache.get_projection(epsg(32631)) == p1);
+    BOOST_CHECK(cache.get_projection(epsg(32633)) == p3);
+    BOOST_CHECK(cache.get_projection(epsg(32632)) != p2);
+    BOOST_CHECK_EQUAL(cache.projections_size(), 2u);
+
+    // Nothing is cached
+    cache_type cache0(0);
+    BOOST_CHECK(cache0.get_projection(epsg(32631)) != cache0.get_projection(epsg(32631)));
+    BOOST_CHECK_EQUAL(cache0.projections_size(), 0u);
+}
+
+void test_threads()
+{
+    using namespace bg::srs;
+
+    std::size_t const threads = 8;
+    std::size_t const count = 200;
+
+    cache_type cache(16);
+    // Boost.Test is not thread-safe, the threads only store the results
+    std::vector<std::vector<cache_type::transformation_ptr> > results(threads);
+    std::vector<std::vector<point_xy> > points(threads);
+
+    std::vector<std::thread> pool;
+    for (std::size_t t = 0; t < threads; t++)
+    {
+        pool.emplace_back([&, t]()
+            {
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    int const zone = 31 + int((i + t) % 4);
+                    cache_type::transformation_ptr const tr
+                        = cache.get_transformation(epsg(4326), epsg(32600 + zone));
+                    point_xy xy;
+                    tr->forward(point_ll(zone * 6 - 183, 50), xy);
+                    results[t].push_back(tr);
+                    points[t].push_back(xy);
+                }
+            });
+    }
+    for (std::thread & t : pool)
+    {
+        t.join();
+    }
+
+    BOOST_CHECK_EQUAL(cache.transformations_size(), 4u);
+    for (std::size_t t = 0; t < threads; t++)
+    {
+        for (std::size_t i = 0; i < count; i++)
+        {
+            int const zone = 31 + int((i + t) % 4);
+            BOOST_CHECK(results[t][i] == cache.get_transformation(epsg(4326), epsg(32600 + zone)));
+            // The central meridian of the zone
+            BOOST_CHECK_CLOSE(bg::get<0>(points[t][i]), 500000.0, 0.0001);
+        }
+    }
+}
+
+int test_main(int, char*[])
+{
+    test_projections();
+    test_transformations();
+    test_bounded();
+    test_threads();
+
+    return 0;
+}
@@ -19,6 +19,71 @@ namespace srs = bg::srs;
 namespace par = bg::srs::spar;
 
 
+template <typename Ellps>
+void test_ellps(bg::srs::dpar::value_ellps id)
+{
+    typedef par::detail::ellps_traits<Ellps> traits;
+    bg::projections::detail::pj_ellps_type<double> const& e
+        = bg::projections::detail::pj_get_ellps<double>().first[id];
+
+    BOOST_CHECK_EQUAL(traits::template a<double>(), e.a);
+    BOOST_CHECK_EQUAL(traits::template b<double>(), e.b);
+}
+
+void test_ellps_all()
+{
+    // The axes of static ellipsoids are constant expressions
+    constexpr double a = par::detail::ellps_traits<par::ellps_wgs84>::a<double>();
+    constexpr double b = par::detail::ellps_traits<par::ellps_grs80>::b<double>();
+    BOOST_STATIC_ASSERT(a == 6378137.0);
+    BOOST_STATIC_ASSERT(b > 6356752.3 && b < 6356752.4);
+
+    test_ellps<par::ellps_merit>(srs::dpar::ellps_merit);
+    test_ellps<par::ellps_sgs85>(srs::dpar::ellps_sgs85);
+    test_ellps<par::ellps_grs80>(srs::dpar::ellps_grs80);
+    test_ellps<par::ellps_iau76>(srs::dpar::ellps_iau76);
+    test_ellps<par::ellps_airy>(srs::dpar::ellps_airy);
+    test_ellps<par::ellps_apl4_9>(srs::dpar::ellps_apl4_9);
+    test_ellps<par::ellps_nwl9d>(srs::dpar::ellps_nwl9d);
+    test_ellps<par::ellps_mod_airy>(srs::dpar::ellps_mod_airy);
+    test_ellps<par::ellps_andrae>(srs::dpar::ellps_andrae);
+    test_ellps<par::ellps_aust_sa>(srs::dpar::ellps_aust_sa);
+    test_ellps<par::ellps_grs67>(srs::dpar::ellps_grs67);
+    test_ellps<par::ellps_bessel>(srs::dpar::ellps_bessel);
+    test_ellps<par::ellps_bess_nam>(srs::dpar::ellps_bess_nam);
+    test_ellps<par::ellps_clrk66>(srs::dpar::ellps_clrk66);
+    test_ellps<par::ellps_clrk80>(srs::dpar::ellps_clrk80);
+    test_ellps<par::ellps_clrk80ign>(srs::dpar::ellps_clrk80ign);
+    test_ellps<par::ellps_cpm>(srs::dpar::ellps_cpm);
+    test_ellps<par::ellps_delmbr>(srs::dpar::ellps_delmbr);
+    test_ellps<par::ellps_engelis>(srs::dpar::ellps_engelis);
+    test_ellps<par::ellps_evrst30>(srs::dpar::ellps_evrst30);
+    test_ellps<par::ellps_evrst48>(srs::dpar::ellps_evrst48);
+    test_ellps<par::ellps_evrst56>(srs::dpar::ellps_evrst56);
+    test_ellps<par::ellps_evrst69>(srs::dpar::ellps_evrst69);
+    test_ellps<par::ellps_evrstss>(srs::dpar::ellps_evrstss);
+    test_ellps<par::ellps_fschr60>(srs::dpar::ellps_fschr60);
+    test_ellps<par::ellps_fschr60m>(srs::dpar::ellps_fschr60m);
+    test_ellps<par::ellps_fschr68>(srs::dpar::ellps_fschr68);
+    test_ellps<par::ellps_helmert>(srs::dpar::ellps_helmert);
+    test_ellps<par::ellps_hough>(srs::dpar::ellps_hough);
+    test_ellps<par::ellps_intl>(srs::dpar::ellps_intl);
+    test_ellps<par::ellps_krass>(srs::dpar::ellps_krass);
+    test_ellps<par::ellps_kaula>(srs::dpar::ellps_kaula);
+    test_ellps<par::ellps_lerch>(srs::dpar::ellps_lerch);
+    test_ellps<par::ellps_mprts>(srs::dpar::ellps_mprts);
+    test_ellps<par::ellps_new_intl>(srs::dpar::ellps_new_intl);
+    test_ellps<par::ellps_plessis>(srs::dpar::ellps_plessis);
+    test_ellps<par::ellps_seasia>(srs::dpar::ellps_seasia);
+    test_ellps<par::ellps_walbeck>(srs::dpar::ellps_walbeck);
+    test_ellps<par::ellps_wgs60>(srs::dpar::ellps_wgs60);
+    test_ellps<par::ellps_wgs66>(srs::dpar::ellps_wgs66);
+    test_ellps<par::ellps_wgs72>(srs::dpar::ellps_wgs72);
+    test_ellps<par::ellps_wgs84>(srs::dpar::ellps_wgs84);
+    test_ellps<par::ellps_sphere>(srs::dpar::ellps_sphere);
+}
+
+
 int test_main(int, char* [])
 {
     typedef par::proj_aea proj;
@@ -59,5 +124,7 @@ int test_main(int, char* [])
 
     boost::ignore_unused<params, params_e, params_d, params_0>();
 
+    test_ellps_all();
+
     return 0;
 }
@@ -0,0 +1,147 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/projection.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/strategies/transform/srs_approximate_transformer.hpp>
+#include <boost/geometry/strategies/transform/srs_transformer.hpp>
+
+
+namespace bst = bg::strategy::transform;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+// Compares the approximation with the exact transformation in a dense grid
+// of points in and around the extent
+template <typename PointIn, typename PointOut, typename Exact>
+void test_approximation(std::string const& caseid, Exact const& exact,
+                        bg::model::box<PointIn> const& extent,
+                        double max_error, double expected_max_error)
+{
+    bst::srs_approximate_transformer<Exact, PointIn, PointOut> const
+        approximate(exact, extent, max_error);
+
+    double const min_x = bg::get<bg::min_corner, 0>(extent);
+    double const min_y = bg::get<bg::min_corner, 1>(extent);
+    double const width = bg::get<bg::max_corner, 0>(extent) - min_x;
+    double const height = bg::get<bg::max_corner, 1>(extent) - min_y;
+
+    double error = 0;
+    std::size_t differences = 0;
+    std::size_t const n = 200;
+    for (std::size_t i = 0; i <= n; i++)
+    {
+        for (std::size_t j = 0; j <= n; j++)
+        {
+            // Also 10% around the extent
+            PointIn const p(min_x + width * (-0.1 + 1.2 * i / n),
+                            min_y + height * (-0.1 + 1.2 * j / n));
+            PointOut expected(0, 0), result(0, 0);
+            bool const expected_valid = exact.apply(p, expected);
+            bool const valid = approximate.apply(p, result);
+
+            if (! bg::covered_by(p, extent))
+            {
+                // Out of the extent, transformed exactly
+                if (valid != expected_valid || ! bg::equals(result, expected))
+                {
+                    differences++;
+                }
+            }
+            else if (valid != expected_valid)
+            {
+                differences++;
+            }
+            else if (valid)
+            {
+                error = (std::max)(error, std::abs(bg::get<0>(result) - bg::get<0>(expected)));
+                error = (std::max)(error, std::abs(bg::get<1>(result) - bg::get<1>(expected)));
+            }
+        }
+    }
+
+    BOOST_CHECK_MESSAGE(differences == 0, caseid << " differences: " << differences);
+    BOOST_CHECK_MESSAGE(error <= expected_max_error,
+        caseid << " error: " << error << " cells: " << approximate.size());
+
+    // A larger error needs less cells
+    bst::srs_approximate_transformer<Exact, PointIn, PointOut> const
+        coarse(exact, extent, max_error * 100);
+    BOOST_CHECK_MESSAGE(coarse.size() <= approximate.size(),
+        caseid << " cells: " << coarse.size() << " " << approximate.size());
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    typedef bg::model::box<point_ll> box_ll;
+    typedef bg::model::box<point_xy> box_xy;
+
+    // Projection, forward and inverse
+    test_approximation<point_ll, point_xy>("utm_forward",
+        bst::srs_forward_transformer<projection<> >(proj4("+proj=utm +zone=33 +ellps=WGS84")),
+        box_ll(point_ll(14, 50), point_ll(16, 52)), 0.1, 0.2);
+    test_approximation<point_xy, point_ll>("utm_inverse",
+        bst::srs_inverse_transformer<projection<> >(proj4("+proj=utm +zone=33 +ellps=WGS84")),
+        box_xy(point_xy(400000, 5500000), point_xy(600000, 5700000)), 1e-6, 2e-6);
+
+    // Linear projection, not divided
+    {
+        typedef bst::srs_forward_transformer<projection<> > exact_type;
+        exact_type const exact(proj4("+proj=eqc +ellps=WGS84"));
+        box_ll const extent(point_ll(-10, -10), point_ll(10, 10));
+        test_approximation<point_ll, point_xy>("eqc", exact, extent, 1e-6, 1e-6);
+        BOOST_CHECK_EQUAL((bst::srs_approximate_transformer<exact_type, point_ll, point_xy>(
+                            exact, extent, 1e-6).size()), 1u);
+    }
+
+    // Transformation with a datum shift
+    test_approximation<point_xy, point_ll>("transformation",
+        bst::srs_forward_transformer<transformation<> >(epsg(31466), epsg(4326)),
+        box_xy(point_xy(2500000, 5600000), point_xy(2510000, 5610000)), 1e-7, 2e-7);
+
+    // Cells where the projection fails are transformed exactly
+    test_approximation<point_ll, point_xy>("merc_pole",
+        bst::srs_forward_transformer<projection<> >(proj4("+proj=merc +ellps=WGS84")),
+        box_ll(point_ll(0, 60), point_ll(10, 90)), 100.0, 200.0);
+
+    // Geometries
+    {
+        bst::srs_forward_transformer<projection<> > const exact(
+            proj4("+proj=utm +zone=33 +ellps=WGS84"));
+        bst::srs_approximate_transformer
+            <
+                bst::srs_forward_transformer<projection<> >, point_ll, point_xy
+            > const approximate(exact, box_ll(point_ll(14, 50), point_ll(16, 52)), 0.01);
+
+        bg::model::linestring<point_ll> ls;
+        bg::read_wkt("LINESTRING(14.5 50.5,15 51,15.5 51.5,17 52)", ls);
+        bg::model::linestring<point_xy> result, expected;
+        BOOST_CHECK(bg::transform(ls, result, approximate));
+        BOOST_CHECK(bg::transform(ls, expected, exact));
+        BOOST_CHECK_EQUAL(result.size(), expected.size());
+        for (std::size_t i = 0; i < result.size(); i++)
+        {
+            BOOST_CHECK(bg::distance(result[i], expected[i]) <= 0.02);
+        }
+        BOOST_CHECK(bg::equals(result.back(), expected.back()));
+    }
+
+    return 0;
+}
@@ -47,11 +47,65 @@ void test_issue_657()
     test::check_geometry(pt_out1, pt_out, 0.001);
     test::check_geometry(pt_out2, pt_out, 0.001);
     test::check_geometry(pt_out3, pt_out, 0.001);
+
+    // Web Mercator under its current code
+    transformation<> tr4((bg::srs::epsg(4326)),
+                         (bg::srs::epsg(3857)));
+    transformation<bg::srs::static_epsg<4326>,
+                   bg::srs::static_epsg<3857> > tr5;
+    point_car pt_out4, pt_out5;
+
+    tr4.forward(pt, pt_out4);
+    tr5.forward(pt, pt_out5);
+
+    test::check_geometry(pt_out4, pt_out, 0.001);
+    test::check_geometry(pt_out5, pt_out, 0.001);
+}
+
+// Static and dynamic EPSG definitions give the same results
+template <int Code1, int Code2, typename P1, typename P2>
+void test_static_dynamic(P1 const& pt)
+{
+    using namespace boost::geometry::srs;
+
+    transformation<> tr_d((epsg(Code1)), (epsg(Code2)));
+    transformation<static_epsg<Code1>, static_epsg<Code2> > tr_s;
+
+    P2 pt_d, pt_s;
+    tr_d.forward(pt, pt_d);
+    tr_s.forward(pt, pt_s);
+    test::check_geometry(pt_s, pt_d, 0.000001);
+
+    P1 pt_di, pt_si;
+    tr_d.inverse(pt_d, pt_di);
+    tr_s.inverse(pt_s, pt_si);
+    test::check_geometry(pt_si, pt_di, 0.000001);
+}
+
+template <typename T>
+void test_static_dynamic_all()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point_car;
+    typedef bg::model::point<T, 2, bg::cs::geographic<bg::degree> > point_geo;
+
+    test_static_dynamic<4326, 3857, point_geo, point_car>(point_geo(16.9, 52.4));
+    test_static_dynamic<4326, 32601, point_geo, point_car>(point_geo(-178.5, 10));
+    test_static_dynamic<4326, 32633, point_geo, point_car>(point_geo(15.5, 50.1));
+    test_static_dynamic<4326, 32660, point_geo, point_car>(point_geo(176.2, 70));
+    test_static_dynamic<4326, 32701, point_geo, point_car>(point_geo(-177.9, -10));
+    test_static_dynamic<4326, 32733, point_geo, point_car>(point_geo(14.1, -33.9));
+    test_static_dynamic<4326, 32760, point_geo, point_car>(point_geo(178.4, -60));
+    // national grids
+    test_static_dynamic<4326, 2180, point_geo, point_car>(point_geo(21.0, 52.2));
+    test_static_dynamic<4326, 27700, point_geo, point_car>(point_geo(-0.1, 51.5));
+    test_static_dynamic<4326, 28992, point_geo, point_car>(point_geo(4.9, 52.4));
+    test_static_dynamic<31466, 32632, point_car, point_car>(point_car(2500000, 5600000));
 }
 
 int test_main(int, char*[])
 {
     test_issue_657<double>();
+    test_static_dynamic_all<double>();
     
     return 0;
 }
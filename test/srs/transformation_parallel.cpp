@@ -0,0 +1,246 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/algorithms/transform_all.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+#include <boost/geometry/strategies/transform/srs_transformer.hpp>
+
+#include "check_geometry.hpp"
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::point<float, 2, bg::cs::cartesian> point_xy_f;
+
+// A zigzag of count points around lon, lat, larger than one block
+template <typename Range>
+inline Range make_range(double lon, double lat, std::size_t count)
+{
+    Range result;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        bg::range::push_back(result,
+            typename bg::point_type<Range>::type(
+                lon + 0.5 * i / count, lat + 0.001 * (i % 3)));
+    }
+    return result;
+}
+
+// A closed square ring with count points on each side
+template <typename Ring>
+inline Ring make_ring(double lon, double lat, double size, std::size_t count)
+{
+    typedef typename bg::point_type<Ring>::type point_type;
+    Ring result;
+    double const step = size / count;
+    for (std::size_t i = 0; i < count; i++)
+        bg::range::push_back(result, point_type(lon, lat + i * step));
+    for (std::size_t i = 0; i < count; i++)
+        bg::range::push_back(result, point_type(lon + i * step, lat + size));
+    for (std::size_t i = 0; i < count; i++)
+        bg::range::push_back(result, point_type(lon + size, lat + size - i * step));
+    for (std::size_t i = 0; i < count; i++)
+        bg::range::push_back(result, point_type(lon + size - i * step, lat));
+    bg::range::push_back(result, point_type(lon, lat));
+    return result;
+}
+
+template <typename Transformation, typename GeometryIn, typename GeometryOut>
+inline void check_forward(Transformation const& tr, GeometryIn const& in,
+                          GeometryOut const& )
+{
+    GeometryOut expected;
+    bool const expected_res = tr.forward(in, expected);
+
+    for (std::size_t threads : {1, 4, 0})
+    {
+        GeometryOut out;
+        bool const res = tr.forward_parallel(in, out, threads);
+        BOOST_CHECK_EQUAL(res, expected_res);
+        // The same steps are applied to the same points
+        test::check_geometry(out, expected, 0.0);
+    }
+}
+
+template <typename Transformation, typename GeometryIn, typename GeometryOut>
+inline void check_inverse(Transformation const& tr, GeometryIn const& in,
+                          GeometryOut const& )
+{
+    GeometryOut expected;
+    bool const expected_res = tr.inverse(in, expected);
+
+    for (std::size_t threads : {1, 4, 0})
+    {
+        GeometryOut out;
+        bool const res = tr.inverse_parallel(in, out, threads);
+        BOOST_CHECK_EQUAL(res, expected_res);
+        test::check_geometry(out, expected, 0.0);
+    }
+}
+
+template <typename Transformation>
+void test_geometries(Transformation const& tr)
+{
+    typedef bg::model::linestring<point_ll> linestring_ll;
+    typedef bg::model::linestring<point_xy> linestring_xy;
+    typedef bg::model::multi_point<point_ll> multi_point_ll;
+    typedef bg::model::multi_point<point_xy> multi_point_xy;
+    typedef bg::model::multi_linestring<linestring_ll> multi_linestring_ll;
+    typedef bg::model::multi_linestring<linestring_xy> multi_linestring_xy;
+    typedef bg::model::polygon<point_ll> polygon_ll;
+    typedef bg::model::polygon<point_xy> polygon_xy;
+    typedef bg::model::polygon<point_xy, false> polygon_xy_ccw;
+    typedef bg::model::polygon<point_xy_f> polygon_xy_f;
+    typedef bg::model::multi_polygon<polygon_ll> multi_polygon_ll;
+    typedef bg::model::multi_polygon<polygon_xy> multi_polygon_xy;
+
+    linestring_ll const ls = make_range<linestring_ll>(15, 50, 20000);
+    multi_point_ll const mpt = make_range<multi_point_ll>(15, 50, 10001);
+
+    multi_linestring_ll mls;
+    for (std::size_t i = 0; i < 50; i++)
+    {
+        mls.push_back(make_range<linestring_ll>(15 + 0.01 * i, 50, 10 + i * 100));
+    }
+
+    polygon_ll poly;
+    poly.outer() = make_ring<polygon_ll::ring_type>(15, 50, 1, 5000);
+    for (std::size_t i = 0; i < 20; i++)
+    {
+        poly.inners().push_back(make_ring<polygon_ll::ring_type>(
+            15.1 + 0.04 * i, 50.1, 0.01, 10 + i));
+        bg::reverse(poly.inners().back());
+    }
+
+    multi_polygon_ll mpoly;
+    for (std::size_t i = 0; i < 1000; i++)
+    {
+        polygon_ll footprint;
+        footprint.outer() = make_ring<polygon_ll::ring_type>(
+            15 + 0.001 * (i % 40), 50 + 0.001 * (i / 40), 0.0002, 1 + i % 5);
+        mpoly.push_back(footprint);
+    }
+
+    check_forward(tr, point_ll(15.5, 50.1), point_xy());
+    check_forward(tr, bg::model::segment<point_ll>(point_ll(15, 50), point_ll(16, 51)),
+                  bg::model::segment<point_xy>());
+    check_forward(tr, ls, linestring_xy());
+    check_forward(tr, mpt, multi_point_xy());
+    check_forward(tr, mls, multi_linestring_xy());
+    check_forward(tr, poly, polygon_xy());
+    // Different order, the exterior ring is transformed sequentially
+    check_forward(tr, poly, polygon_xy_ccw());
+    // Converted from the calculation type
+    check_forward(tr, poly, polygon_xy_f());
+    check_forward(tr, mpoly, multi_polygon_xy());
+
+    linestring_xy ls_xy;
+    multi_polygon_xy mpoly_xy;
+    tr.forward(ls, ls_xy);
+    tr.forward(mpoly, mpoly_xy);
+    check_inverse(tr, ls_xy, linestring_ll());
+    check_inverse(tr, mpoly_xy, multi_polygon_ll());
+
+    // In place
+    {
+        linestring_xy expected;
+        tr.inverse(ls_xy, expected);
+        linestring_xy inplace = ls_xy;
+        BOOST_CHECK(tr.inverse_parallel(inplace, inplace, 4));
+        test::check_geometry(inplace, expected, 0.0);
+    }
+}
+
+void test_failures()
+{
+    using namespace bg::srs;
+
+    transformation<> const tr(proj4("+proj=longlat +ellps=WGS84"),
+                              proj4("+proj=merc +ellps=WGS84"));
+
+    // The poles can not be projected, in one of the blocks
+    bg::model::linestring<point_ll> ls = make_range<bg::model::linestring<point_ll> >(15, 50, 20000);
+    bg::set<1>(ls[15000], 90);
+
+    bg::model::linestring<point_xy> expected, out;
+    BOOST_CHECK(! tr.forward(ls, expected));
+    BOOST_CHECK(! tr.forward_parallel(ls, out, 4));
+    BOOST_CHECK_EQUAL(out.size(), expected.size());
+    for (std::size_t i = 0; i < out.size() && i < expected.size(); i++)
+    {
+        // The invalid point is HUGE_VAL, the other points are transformed
+        BOOST_CHECK_EQUAL(bg::get<0>(out[i]), bg::get<0>(expected[i]));
+        BOOST_CHECK_EQUAL(bg::get<1>(out[i]), bg::get<1>(expected[i]));
+    }
+    BOOST_CHECK_EQUAL(bg::get<1>(out[15000]), HUGE_VAL);
+    BOOST_CHECK_LT(bg::get<1>(out[14999]), HUGE_VAL);
+}
+
+void test_transform_all()
+{
+    using namespace bg::srs;
+    typedef bg::model::polygon<point_ll> polygon_ll;
+    typedef bg::model::polygon<point_xy> polygon_xy;
+    typedef bg::strategy::transform::srs_forward_transformer<transformation<> > strategy_type;
+
+    strategy_type const strategy(epsg(4326), epsg(31466));
+
+    std::vector<polygon_ll> footprints;
+    for (std::size_t i = 0; i < 500; i++)
+    {
+        polygon_ll footprint;
+        footprint.outer() = make_ring<polygon_ll::ring_type>(
+            7 + 0.001 * (i % 20), 50 + 0.001 * (i / 20), 0.0002, 1 + i % 3);
+        footprints.push_back(footprint);
+    }
+
+    std::vector<polygon_xy> expected(footprints.size());
+    for (std::size_t i = 0; i < footprints.size(); i++)
+    {
+        BOOST_CHECK(bg::transform(footprints[i], expected[i], strategy));
+    }
+
+    for (std::size_t threads : {1, 4, 0})
+    {
+        std::vector<polygon_xy> result;
+        BOOST_CHECK(bg::transform_all(footprints, result, strategy, threads));
+        BOOST_CHECK_EQUAL(result.size(), footprints.size());
+        for (std::size_t i = 0; i < result.size() && i < expected.size(); i++)
+        {
+            test::check_geometry(result[i], expected[i], 0.0);
+        }
+    }
+
+    std::vector<polygon_xy> empty;
+    BOOST_CHECK(bg::transform_all(std::vector<polygon_ll>(), empty, strategy, 4));
+    BOOST_CHECK(empty.empty());
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    test_geometries(transformation<>(epsg(4326), epsg(32633)));
+    // Datum shift
+    test_geometries(transformation<>(epsg(4326), epsg(31466)));
+    test_geometries(transformation<>(proj4("+proj=longlat +datum=WGS84"),
+                                     proj4("+proj=tmerc +lat_0=0 +lon_0=15 +k=1 +x_0=500000 +y_0=0 +ellps=bessel +towgs84=598.1,73.7,418.2,0.202,0.045,-2.455,6.7 +units=m")));
+    test_failures();
+    test_transform_all();
+
+    return 0;
+}
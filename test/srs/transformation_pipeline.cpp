@@ -0,0 +1,211 @@
+// Boost.Geometry
+// Unit Test
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/epsg.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+namespace pd = bg::projections::detail;
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+typedef bg::model::point<double, 3, bg::cs::geographic<bg::degree> > point_ll3;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point_xyz;
+
+inline bool close(double c1, double c2, double eps)
+{
+    return std::abs(c1 - c2) <= eps * (std::max)(1.0, std::abs(c1));
+}
+
+// The z coordinate of invalid points is not defined
+template <typename Point>
+inline bool close(Point const& p1, Point const& p2, double eps = 1.0e-10)
+{
+    if (bg::get<0>(p1) == HUGE_VAL || bg::get<0>(p2) == HUGE_VAL)
+    {
+        return bg::get<0>(p1) == bg::get<0>(p2);
+    }
+    return close(bg::get<0>(p1), bg::get<0>(p2), eps)
+        && close(bg::get<1>(p1), bg::get<1>(p2), eps)
+        && close(pd::get_z(p1), pd::get_z(p2), eps);
+}
+
+template <typename Range>
+inline std::size_t count_differences(Range const& rng1, Range const& rng2)
+{
+    std::size_t result = rng1.size() == rng2.size() ? 0 : 1;
+    for (std::size_t i = 0; i < (std::min)(rng1.size(), rng2.size()); i++)
+    {
+        if (! close(rng1[i], rng2[i]))
+        {
+            result++;
+        }
+    }
+    return result;
+}
+
+// Transforms more points than transformed in one block, one of them invalid
+// and one out of range, and compares with pj_transform() applying all steps
+// one after the other
+template <typename PointIn, typename PointOut, typename Src, typename Dst>
+void test_transformation(std::string const& caseid, Src const& src, Dst const& dst,
+                         double x, double y, double step,
+                         bool fused = true, bool identity = false)
+{
+    typedef bg::model::linestring<PointIn> ls_in;
+    typedef bg::model::linestring<PointOut> ls_out;
+
+    ls_in in;
+    for (int i = 0; i < 600; i++)
+    {
+        PointIn p;
+        bg::set<0>(p, x + (i % 40) * step);
+        bg::set<1>(p, y + (i / 40) * step);
+        pd::set_z(p, 100.0);
+        in.push_back(p);
+    }
+    bg::projections::set_invalid_point(in[300]);
+    bg::set<1>(in[400], 1.0e7);
+
+    bg::srs::transformation<> const tr(src, dst);
+    ls_out out;
+    ls_in back;
+    bool const result = tr.forward(in, out);
+    tr.inverse(out, back);
+
+    bg::projections::proj_wrapper<bg::srs::dynamic, double> const p1(src);
+    bg::projections::proj_wrapper<bg::srs::dynamic, double> const p2(dst);
+    pd::pj_transform_pipeline<double> const pipeline(p1.proj().params(),
+                                                     p2.proj().params());
+    BOOST_CHECK_MESSAGE(pipeline.is_fused() == fused, caseid << " fused");
+    BOOST_CHECK_MESSAGE(pipeline.is_identity() == identity, caseid << " identity");
+
+    bg::srs::transformation_grids<bg::srs::detail::empty_grids_storage> grids;
+    bool const input_angles = ! p1.proj().params().is_geocent
+                           && p1.proj().params().is_latlong;
+    ls_out expected;
+    pd::transform_geometry<ls_out, double>::apply(in, expected, input_angles);
+    bool const expected_result = pd::pj_transform(p1.proj(), p1.proj().params(),
+                                                  p2.proj(), p2.proj().params(),
+                                                  expected,
+                                                  grids.src_grids, grids.dst_grids);
+    BOOST_CHECK_EQUAL(result, expected_result);
+
+    BOOST_CHECK_MESSAGE(count_differences(out, expected) == 0,
+        caseid << " differences: " << count_differences(out, expected));
+
+    // The same for one point
+    PointOut out_point;
+    BOOST_CHECK(tr.forward(in[0], out_point));
+    BOOST_CHECK_MESSAGE(close(out_point, expected[0]), caseid << " point");
+    BOOST_CHECK_EQUAL(bg::get<0>(out[300]), HUGE_VAL);
+
+    // And back
+    std::size_t differences = 0;
+    for (std::size_t i = 0; i < in.size(); i++)
+    {
+        if (bg::get<0>(out[i]) != HUGE_VAL && i != 400
+            && ! close(back[i], in[i], 1.0e-7))
+        {
+            differences++;
+        }
+    }
+    BOOST_CHECK_MESSAGE(differences == 0,
+        caseid << " inverse differences: " << differences);
+}
+
+// Static projections and other geometries, compared with dynamic projections
+void test_static()
+{
+    using namespace bg::srs::spar;
+
+    bg::srs::transformation
+        <
+            parameters<proj_longlat, datum_wgs84>,
+            parameters<proj_merc, ellps_wgs84>
+        > const tr;
+    bg::srs::transformation<> const expected_tr(
+        bg::srs::proj4("+proj=longlat +datum=WGS84"),
+        bg::srs::proj4("+proj=merc +ellps=WGS84"));
+
+    bg::model::polygon<point_ll> polygon;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))", polygon);
+    bg::model::polygon<point_xy> result, expected;
+    BOOST_CHECK(tr.forward(polygon, result));
+    BOOST_CHECK(expected_tr.forward(polygon, expected));
+    BOOST_CHECK_EQUAL(count_differences(bg::exterior_ring(result),
+                                        bg::exterior_ring(expected)), 0u);
+    BOOST_CHECK_EQUAL(count_differences(bg::interior_rings(result)[0],
+                                        bg::interior_rings(expected)[0]), 0u);
+
+    bg::model::multi_point<point_ll> multi_point;
+    bg::read_wkt("MULTIPOINT((1 2),(3 4),(5 95))", multi_point);
+    bg::model::multi_point<point_xy> mp_result, mp_expected;
+    BOOST_CHECK(! tr.forward(multi_point, mp_result));
+    BOOST_CHECK(! expected_tr.forward(multi_point, mp_expected));
+    BOOST_CHECK_EQUAL(count_differences(mp_result, mp_expected), 0u);
+
+    bg::model::segment<point_ll> const segment(point_ll(1, 2), point_ll(3, 4));
+    bg::model::segment<point_xy> s_result, s_expected;
+    BOOST_CHECK(tr.forward(segment, s_result));
+    BOOST_CHECK(expected_tr.forward(segment, s_expected));
+    BOOST_CHECK(close(s_result.first, s_expected.first));
+    BOOST_CHECK(close(s_result.second, s_expected.second));
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    test_transformation<point_xy, point_ll>("7param_to_ll",
+        epsg(31466), epsg(4326), 2500000, 5600000, 100);
+    test_transformation<point_xy, point_ll>("same_datum_to_ll",
+        epsg(2180), epsg(4326), 500000, 500000, 100);
+    test_transformation<point_ll, point_xy>("ll_to_merc",
+        epsg(4326), epsg(3395), 10, 50, 0.01);
+    test_transformation<point_ll, point_xy>("ll_to_7param",
+        epsg(4326), epsg(31466), 6, 50.5, 0.01);
+    test_transformation<point_xy, point_xy>("projected",
+        epsg(2180), epsg(32633), 500000, 500000, 100);
+    test_transformation<point_ll, point_ll>("7param_ll",
+        epsg(4326), epsg(4314), 6, 50.5, 0.01);
+    test_transformation<point_ll, point_ll>("identity",
+        epsg(4326), epsg(4258), 6, 50.5, 0.01, true, true);
+
+    test_transformation<point_xy, point_xy>("pm_3param",
+        proj4("+proj=lcc +lat_1=46.8 +lat_0=46.8 +lon_0=0 +k_0=0.99987742 +x_0=600000 +y_0=2200000 +a=6378249.2 +b=6356515 +towgs84=-168,-60,320,0,0,0,0 +pm=paris +units=m"),
+        proj4("+proj=utm +zone=31 +datum=WGS84"), 600000, 2200000, 100);
+    test_transformation<point_xy, point_ll>("long_wrap",
+        proj4("+proj=tmerc +ellps=WGS84 +lon_0=179 +x_0=500000"),
+        proj4("+proj=longlat +datum=WGS84 +lon_wrap=180"), 450000, 100000, 100);
+    test_transformation<point_ll3, point_xyz>("vunits",
+        proj4("+proj=longlat +datum=WGS84 +vunits=ft"),
+        proj4("+proj=merc +ellps=WGS84 +vunits=us-ft"), 10, 50, 0.01);
+    test_transformation<point_ll, point_ll>("gridshift",
+        proj4("+proj=longlat +ellps=clrk66 +nadgrids=@null"),
+        proj4("+proj=longlat +datum=WGS84"), -100, 40, 0.01, false);
+
+    {
+        bg::projections::proj_wrapper<dynamic, double> const p1(proj4("+proj=geocent +datum=WGS84"));
+        bg::projections::proj_wrapper<dynamic, double> const p2(epsg(4326));
+        BOOST_CHECK(! pd::pj_transform_pipeline<double>(p1.proj().params(),
+                                                        p2.proj().params()).is_fused());
+    }
+
+    test_static();
+
+    return 0;
+}
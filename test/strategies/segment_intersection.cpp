@@ -21,21 +21,28 @@
 #pragma warning( disable : 4244 )
 #endif // defined(_MSC_VER)
 
+#include <sstream>
+
 #include <geometry_test_common.hpp>
 
 #include <boost/geometry/algorithms/assign.hpp>
 
 #include <boost/geometry/strategies/cartesian/intersection.hpp>
 #include <boost/geometry/strategies/intersection_result.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
 
 #include <boost/geometry/policies/relate/intersection_policy.hpp>
 
 #include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/union.hpp>
 #include <boost/geometry/algorithms/detail/overlay/segment_as_subrange.hpp>
 
+#include <boost/geometry/geometries/multi_polygon.hpp>
 #include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
 #include <boost/geometry/geometries/segment.hpp>
 #include <boost/geometry/geometries/adapted/boost_tuple.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
 
 BOOST_GEOMETRY_REGISTER_BOOST_TUPLE_CS(cs::cartesian);
 
@@ -207,6 +214,71 @@ void test_all()
     test_segment_intersection<P>(46, 8,2, 4,6, 0,0, 8, 8, 'i', 5, 5);
 }
 
+// An integral CalculationType of side_by_triangle is promoted to double,
+// so it does not overflow if the products exceed the CalculationType
+template <typename CalculationType>
+void test_side_promotion()
+{
+    typedef bg::model::point<int, 2, bg::cs::cartesian> P;
+    typedef bg::strategy::side::side_by_triangle<CalculationType> strategy_type;
+
+    BOOST_CHECK_EQUAL(strategy_type::apply(P(0, 0), P(100000, 1), P(50000, 100000)), 1);
+    BOOST_CHECK_EQUAL(strategy_type::apply(P(0, 0), P(100000, 1), P(50000, -100000)), -1);
+    BOOST_CHECK_EQUAL(strategy_type::apply(P(0, 0), P(100000, 100000), P(-100000, -100000)), 0);
+}
+
+#if defined(BOOST_HAS_INT128)
+void test_fixed_point()
+{
+    typedef bg::model::point<boost::long_long_type, 2, bg::cs::cartesian> P;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::referring_segment<const P> segment_type;
+    typedef bg::strategy::intersection::cartesian_segments_fixed_point strategy_type;
+
+    // Coordinates in millimeters, the squares overlap by 1 mm less than half
+    P const p1(1000000000, 0), p2(1000000000, 1000000000);
+    P const q1(500000000, 500000001), q2(1500000000, 500000001);
+    segment_type const p(p1, p2);
+    segment_type const q(q1, q2);
+
+    typedef bg::segment_intersection_points<P> result_type;
+    result_type const is = strategy_type::apply(
+        bg::detail::segment_as_subrange<segment_type>(p),
+        bg::detail::segment_as_subrange<segment_type>(q),
+        bg::policies::relate::segments_intersection_points<result_type>());
+    BOOST_CHECK_EQUAL(is.count, 1u);
+    BOOST_CHECK_EQUAL(bg::get<0>(is.intersections[0]), 1000000000);
+    BOOST_CHECK_EQUAL(bg::get<1>(is.intersections[0]), 500000001);
+
+    // Sides differing from collinear by one unit in 10^9
+    BOOST_CHECK_EQUAL(strategy_type::side_strategy_type::apply(p1, p2, P(1000000001, 999999999)), -1);
+    BOOST_CHECK_EQUAL(strategy_type::side_strategy_type::apply(p1, p2, P(999999999, 999999999)), 1);
+    BOOST_CHECK_EQUAL(strategy_type::side_strategy_type::apply(P(0, 0), P(999999999, 1000000000), P(999999998, 999999999)), 1);
+
+    polygon a, b;
+    bg::read_wkt("POLYGON((0 0,0 1000000000,1000000000 1000000000,1000000000 0,0 0))", a);
+    bg::read_wkt("POLYGON((500000000 500000001,500000000 1500000000,1500000000 1500000000,1500000000 500000001,500000000 500000001))", b);
+
+    multi_polygon result;
+    bg::intersection(a, b, result, strategy_type());
+    std::ostringstream out;
+    out << bg::wkt(result);
+    BOOST_CHECK_EQUAL(out.str(), "MULTIPOLYGON(((500000000 1000000000,"
+        "1000000000 1000000000,1000000000 500000001,500000000 500000001,"
+        "500000000 1000000000)))");
+
+    result.clear();
+    bg::union_(a, b, result, strategy_type());
+    out.str("");
+    out << bg::wkt(result);
+    BOOST_CHECK_EQUAL(out.str(), "MULTIPOLYGON(((500000000 1000000000,"
+        "500000000 1500000000,1500000000 1500000000,1500000000 500000001,"
+        "1000000000 500000001,1000000000 0,0 0,0 1000000000,"
+        "500000000 1000000000)))");
+}
+#endif
+
 int test_main(int, char* [])
 {
 #if !defined(BOOST_GEOMETRY_TEST_ONLY_ONE_TYPE)
@@ -215,5 +287,13 @@ int test_main(int, char* [])
 #endif
     test_all<bg::model::point<double, 2, bg::cs::cartesian> >();
 
+    test_side_promotion<void>();
+    test_side_promotion<int>();
+    test_side_promotion<boost::long_long_type>();
+
+#if defined(BOOST_HAS_INT128)
+    test_fixed_point();
+#endif
+
     return 0;
 }